@@ -859,6 +859,7 @@ namespace hal
 
         /**
          * Computes the truth table outputs for a Boolean function that comprises <= 10 single-bit variables.
+         * Functions that can be compiled into a `CompiledBooleanFunction` are evaluated for 64 rows at once and may comprise up to 16 single-bit variables.
          * \warning The generation of the truth table is exponential in the number of parameters.
          * 
          * @param[in] ordered_variables - A vector describing the order of input variables used to generate the truth table. Defaults to an empty vector.
@@ -869,6 +870,7 @@ namespace hal
 
         /**
          * Prints the truth table for a Boolean function that comprises <= 10 single-bit variables.
+         * Functions that can be compiled into a `CompiledBooleanFunction` may comprise up to 16 single-bit variables.
          * \warning The generation of the truth table is exponential in the number of parameters.
          * 
          * @param[in] ordered_variables - A vector describing the order of input variables used to generate the truth table. Defaults to an empty vector.
@@ -980,6 +982,12 @@ namespace hal
      * i.e. no separation from operation / operand nodes via inheritance, due to 
      * optimization reasons to keep node data closely together and prevent the 
      * use of smart pointers to manage memory safely.
+     * 
+     * To keep nodes small and trivially copyable, operand data is stored in a 
+     * single 64-bit payload: variable names are interned in a global symbol 
+     * table and referenced by their 32-bit identifier, constants of up to 64 
+     * bits that only consist of `ZERO` and `ONE` are packed into the payload 
+     * bit by bit, and all other constants are interned as well.
      *
      * @ingroup netlist
      */
@@ -993,12 +1001,8 @@ namespace hal
         u16 type;
         /// The bit-size of the node.
         u16 size;
-        /// The (optional) constant value of the node.
-        std::vector<BooleanFunction::Value> constant{};
         /// The (optional) index value of the node.
         u16 index{};
-        /// The (optional) variable name of the node.
-        std::string variable{};
 
         ////////////////////////////////////////////////////////////////////////
         // Constructors, Destructors, Operators
@@ -1074,6 +1078,38 @@ namespace hal
          */
         Node clone() const;
 
+        /**
+         * Returns the (optional) constant value of the node.
+         * 
+         * @returns The constant value if the node is of type `Constant`, an empty vector otherwise.
+         */
+        std::vector<BooleanFunction::Value> constant() const;
+
+        /**
+         * Returns the (optional) variable name of the node.
+         * 
+         * @returns The variable name if the node is of type `Variable`, an empty string otherwise.
+         */
+        const std::string& variable() const;
+
+        /**
+         * Replaces the constant value of a node of type `Constant` in place.<br>
+         * The type, bit-size, and index of the node remain unchanged.
+         * 
+         * @param[in] value - The new constant value.
+         * @returns Ok on success, an error if the node is not of type `Constant`.
+         */
+        Result<std::monostate> set_constant(const std::vector<BooleanFunction::Value>& value);
+
+        /**
+         * Replaces the variable name of a node of type `Variable` in place.<br>
+         * The type, bit-size, and index of the node remain unchanged.
+         * 
+         * @param[in] variable - The new variable name.
+         * @returns Ok on success, an error if the node is not of type `Variable`.
+         */
+        Result<std::monostate> set_variable(const std::string& variable);
+
         /**
          * Translates the Boolean function node into its string representation.
          * 
@@ -1081,6 +1117,13 @@ namespace hal
          */
         std::string to_string() const;
 
+        /**
+         * Computes a hash value of the Boolean function node that is consistent with `operator==`.
+         * 
+         * @returns The hash value.
+         */
+        std::size_t hash() const;
+
         /**
          * Returns the arity of the Boolean function node, i.e., the number of parameters.
          * 
@@ -1211,7 +1254,19 @@ namespace hal
         ////////////////////////////////////////////////////////////////////////
 
         /// constructor to initialize all Node fields
-        Node(u16 _type, u16 _size, std::vector<BooleanFunction::Value> _constant, u16 _index, std::string variable);
+        Node(u16 _type, u16 _size, u16 _index, bool _interned, u64 _payload);
+
+        /// Returns the bit at the given position of a constant node.
+        BooleanFunction::Value get_constant_bit(u16 position) const;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Member
+        ////////////////////////////////////////////////////////////////////////
+
+        /// Whether the payload is an identifier in the constant table rather than a packed bit-vector.
+        bool m_interned{};
+        /// The packed constant value, the constant identifier, or the variable identifier of the node.
+        u64 m_payload{};
     };
 
     /**
@@ -1257,3 +1312,15 @@ namespace hal
         static constexpr u16 Variable = 0x1002;
     };
 }    // namespace hal
+
+namespace std
+{
+    template<>
+    struct hash<hal::BooleanFunction::Node>
+    {
+        std::size_t operator()(const hal::BooleanFunction::Node& node) const
+        {
+            return node.hash();
+        }
+    };
+}    // namespace std
@@ -0,0 +1,173 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/expression_store.h"
+#include "hal_core/utilities/result.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A Boolean function that has been compiled into a flat, register-based program for fast repeated evaluation.
+     * 
+     * Evaluation is bit-parallel: every bit of every variable is represented by a 64-bit word, where each bit of the word (called a lane) belongs to a different input assignment.
+     * Hence, a single evaluation computes the outputs for 64 input assignments at once.
+     * Variables are addressed by their index within the variable order passed to `compile` instead of by name.
+     * 
+     * Only Boolean functions that can be evaluated exactly using two-valued logic are supported, i.e., functions must not contain constants with undefined or high-impedance bits and must not contain shift, rotate, or division operations.
+     * Evaluation reuses an internal register file and is therefore not thread-safe; use one copy per thread instead.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API CompiledBooleanFunction final
+    {
+    public:
+        /// The number of input assignments that are evaluated in parallel.
+        static constexpr u32 num_lanes = 64;
+
+        /**
+         * Compiles a Boolean function.
+         * 
+         * @param[in] function - The Boolean function to compile.
+         * @param[in] variables - The order of the input variables. Variables that do not occur in the function are treated as 1-bit inputs that are ignored. Defaults to the alphabetical order of the variables of the function.
+         * @returns Ok() and the compiled function on success, an error otherwise.
+         */
+        static Result<CompiledBooleanFunction> compile(const BooleanFunction& function, const std::vector<std::string>& variables = {});
+
+        /**
+         * Compiles a shared expression.
+         * Every distinct sub-expression is computed only once per evaluation.
+         * 
+         * @param[in] expression - The shared expression to compile.
+         * @param[in] variables - The order of the input variables. Variables that do not occur in the expression are treated as 1-bit inputs that are ignored. Defaults to the alphabetical order of the variables of the expression.
+         * @returns Ok() and the compiled function on success, an error otherwise.
+         */
+        static Result<CompiledBooleanFunction> compile(const SharedExpression& expression, const std::vector<std::string>& variables = {});
+
+        /**
+         * Get the order of the input variables.
+         * 
+         * @returns The variable names.
+         */
+        const std::vector<std::string>& get_variables() const;
+
+        /**
+         * Get the bit-sizes of the input variables in the order of `get_variables`.
+         * 
+         * @returns The variable sizes.
+         */
+        const std::vector<u16>& get_variable_sizes() const;
+
+        /**
+         * Get the total number of input bits, i.e., the sum of all variable sizes.
+         * 
+         * @returns The number of input bits.
+         */
+        u32 get_num_input_bits() const;
+
+        /**
+         * Get the bit-size of the compiled function.
+         * 
+         * @returns The bit-size.
+         */
+        u16 size() const;
+
+        /**
+         * Evaluates the compiled function for 64 input assignments at once.
+         * The inputs comprise one word per input bit, ordered by variable and then by bit index starting at the least significant bit.
+         * The outputs comprise one word per output bit starting at the least significant bit.
+         * Bit `i` of every input and output word belongs to the `i`-th input assignment.
+         * 
+         * @param[in] inputs - The input words, at least `get_num_input_bits()` many.
+         * @param[out] outputs - The output words, at least `size()` many.
+         */
+        void evaluate(const u64* inputs, u64* outputs) const;
+
+        /**
+         * Evaluates the compiled function for 64 input assignments at once.
+         * The inputs comprise one word per input bit, ordered by variable and then by bit index starting at the least significant bit.
+         * Bit `i` of every input and output word belongs to the `i`-th input assignment.
+         * 
+         * @param[in] inputs - The input words.
+         * @returns Ok() and the output words, one per output bit starting at the least significant bit, on success, an error otherwise.
+         */
+        Result<std::vector<u64>> evaluate(const std::vector<u64>& inputs) const;
+
+        /**
+         * Computes the truth table of a compiled function comprising only single-bit variables.
+         * The row index encodes the input assignment, where the first variable corresponds to the least significant bit.
+         * \warning The generation of the truth table is exponential in the number of variables.
+         * 
+         * @returns Ok() and a vector of values per output bit representing the truth table on success, an error otherwise.
+         */
+        Result<std::vector<std::vector<BooleanFunction::Value>>> compute_truth_table() const;
+
+    private:
+        /// A single instruction operating on word offsets into the register file.
+        struct Instruction
+        {
+            u16 type;
+            u16 size;
+            u32 dst;
+            u32 src[3];
+            u16 src_size[3];
+            u16 param[2];
+        };
+
+        /// A compiled operand, i.e., either a range of the register file or an index.
+        struct Operand
+        {
+            u32 offset;
+            u16 size;
+            bool is_index;
+            u16 index;
+        };
+
+        CompiledBooleanFunction() = default;
+
+        /// Determines the variable order and sizes and allocates the input words of the register file.
+        Result<std::unordered_map<std::string, u32>> initialize_inputs(const std::set<std::string>& names, const std::vector<std::string>& variables, const std::vector<BooleanFunction::Node>& variable_nodes);
+
+        /// Compiles a node given its already compiled operands.
+        Result<Operand> compile_node(const BooleanFunction::Node& node, const Operand* operands, const std::unordered_map<std::string, u32>& variable_offsets);
+
+        std::vector<std::string> m_variables;
+        std::vector<u16> m_variable_sizes;
+        u32 m_num_input_bits = 0;
+        u16 m_size           = 0;
+        u32 m_output         = 0;
+        std::vector<Instruction> m_program;
+
+        /// Register file comprising the input words, constant words, and the words of all intermediate results.
+        mutable std::vector<u64> m_registers;
+    };
+}    // namespace hal
@@ -0,0 +1,243 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/utilities/result.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace hal
+{
+    class ExpressionStore;
+
+    /**
+     * A reference-counted handle to a Boolean function expression that is stored in an `ExpressionStore`.
+     * 
+     * Since expressions are hash-consed by their store, two handles of the same store refer to structurally equal expressions if and only if they refer to the same expression.
+     * Hence, equality checks are constant-time and identical sub-expressions are stored only once.
+     * Handles are not thread-safe and must not outlive the store they were obtained from.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API SharedExpression final
+    {
+    public:
+        /**
+         * Constructs an empty expression handle.
+         */
+        SharedExpression() = default;
+
+        SharedExpression(const SharedExpression& other);
+        SharedExpression(SharedExpression&& other) noexcept;
+        SharedExpression& operator=(const SharedExpression& other);
+        SharedExpression& operator=(SharedExpression&& other) noexcept;
+        ~SharedExpression();
+
+        /**
+         * Checks whether two handles refer to the same expression in constant time.
+         * 
+         * @param[in] other - The other expression handle.
+         * @returns `true` if both handles refer to the same expression, `false` otherwise.
+         */
+        bool operator==(const SharedExpression& other) const;
+
+        /**
+         * Checks whether two handles refer to different expressions in constant time.
+         * 
+         * @param[in] other - The other expression handle.
+         * @returns `true` if the handles refer to different expressions, `false` otherwise.
+         */
+        bool operator!=(const SharedExpression& other) const;
+
+        /**
+         * Checks whether the handle is empty.
+         * 
+         * @returns `true` if the handle does not refer to an expression, `false` otherwise.
+         */
+        bool is_empty() const;
+
+        /**
+         * Get the top-level node of the expression.
+         * \warning Fails if the handle is empty.
+         * 
+         * @returns The top-level node.
+         */
+        const BooleanFunction::Node& get_node() const;
+
+        /**
+         * Get the bit-size of the expression.
+         * 
+         * @returns The bit-size of the expression.
+         */
+        u16 size() const;
+
+        /**
+         * Get the operands of the top-level node of the expression.
+         * 
+         * @returns A vector of expression handles.
+         */
+        std::vector<SharedExpression> get_operands() const;
+
+        /**
+         * Get the number of distinct nodes of the expression, i.e., the size of the expression when shared sub-expressions are counted once.
+         * 
+         * @returns The number of distinct nodes.
+         */
+        u64 get_num_unique_nodes() const;
+
+        /**
+         * Get the number of nodes of the equivalent `BooleanFunction`, i.e., the size of the expression when shared sub-expressions are expanded.
+         * The result saturates at the maximum value of a u64.
+         * 
+         * @returns The number of nodes in reverse polish notation.
+         */
+        u64 get_expanded_length() const;
+
+        /**
+         * Get the set of variable names used by the expression.
+         * 
+         * @returns A set of variable names.
+         */
+        std::set<std::string> get_variable_names() const;
+
+        /**
+         * Expands the expression into a `BooleanFunction`.
+         * \warning The size of the Boolean function may be exponential in the number of distinct nodes of the expression.
+         * 
+         * @returns Ok() and the Boolean function on success, an error otherwise.
+         */
+        Result<BooleanFunction> to_boolean_function() const;
+
+        /**
+         * Get a hash value of the expression that is consistent with `operator==`.
+         * 
+         * @returns The hash value.
+         */
+        std::size_t hash() const;
+
+        /// An expression node as stored within the `ExpressionStore`.
+        struct Entry;
+
+    private:
+        friend class ExpressionStore;
+
+        /// Constructs a handle and acquires a reference to the entry.
+        explicit SharedExpression(Entry* entry);
+
+        Entry* m_entry = nullptr;
+    };
+
+    /**
+     * A hash-consing store for Boolean function expressions.
+     * 
+     * Each structurally distinct expression is stored exactly once as a node that references its operands, i.e., expressions form a directed acyclic graph with shared sub-expressions.
+     * Expressions are reference-counted and removed from the store once the last `SharedExpression` handle referring to them (directly or as an operand) is destroyed.
+     * Composing expressions, e.g., by substituting the variables of gate functions with the functions of their fan-in, therefore grows the store with the number of unique sub-expressions rather than with the size of the expanded Boolean function.
+     * 
+     * The store is not thread-safe and must outlive all handles obtained from it.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API ExpressionStore final
+    {
+    public:
+        ExpressionStore() = default;
+        ExpressionStore(const ExpressionStore&)            = delete;
+        ExpressionStore& operator=(const ExpressionStore&) = delete;
+        ~ExpressionStore();
+
+        /**
+         * Get the expression comprising the given node and operands, creating it if it is not yet contained in the store.
+         * 
+         * @param[in] node - The top-level node.
+         * @param[in] operands - The operands of the node, all of which must belong to this store.
+         * @returns Ok() and the expression on success, an error otherwise.
+         */
+        Result<SharedExpression> get_expression(const BooleanFunction::Node& node, const std::vector<SharedExpression>& operands = {});
+
+        /**
+         * Get the expression that is structurally equal to the given Boolean function, creating all of its sub-expressions that are not yet contained in the store.
+         * 
+         * @param[in] function - The Boolean function.
+         * @returns Ok() and the expression on success, an error otherwise.
+         */
+        Result<SharedExpression> get_expression(const BooleanFunction& function);
+
+        /**
+         * Substitute variables of an expression with other expressions.
+         * Sub-expressions are rewritten at most once, so the result shares all unaffected sub-expressions with the original expression.
+         * Every substitution must have the same bit-size as the variable it replaces.
+         * 
+         * @param[in] expression - The expression.
+         * @param[in] substitutions - A map from variable names to the expressions replacing them.
+         * @returns Ok() and the resulting expression on success, an error otherwise.
+         */
+        Result<SharedExpression> substitute(const SharedExpression& expression, const std::map<std::string, SharedExpression>& substitutions);
+
+        /**
+         * Get the number of distinct expressions currently held by the store.
+         * 
+         * @returns The number of expressions.
+         */
+        u64 size() const;
+
+    private:
+        friend class SharedExpression;
+
+        struct EntryHash
+        {
+            std::size_t operator()(const SharedExpression::Entry* entry) const;
+        };
+
+        struct EntryEqual
+        {
+            bool operator()(const SharedExpression::Entry* lhs, const SharedExpression::Entry* rhs) const;
+        };
+
+        /// Removes an entry whose last reference was released and releases its operands.
+        void release(SharedExpression::Entry* entry);
+
+        std::unordered_set<SharedExpression::Entry*, EntryHash, EntryEqual> m_entries;
+    };
+}    // namespace hal
+
+namespace std
+{
+    template<>
+    struct hash<hal::SharedExpression>
+    {
+        std::size_t operator()(const hal::SharedExpression& expression) const
+        {
+            return expression.hash();
+        }
+    };
+}    // namespace std
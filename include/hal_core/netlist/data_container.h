@@ -28,13 +28,16 @@
 #include "hal_core/defines.h"
 
 #include <map>
+#include <string>
 #include <tuple>
 #include <vector>
 
 namespace hal
 {
     /**
-     * Container to hold data that is associated with an entity.
+     * Container to hold data that is associated with an entity.<br>
+     * Categories, keys, and data types are interned in a table shared by all data containers, and the entries are stored in a flat vector, as most entities hold no more than a few entries.
+     * The shared table is emptied as soon as no data container holds an entry anymore.
      *
      * @ingroup netlist
      */
@@ -46,7 +49,22 @@ namespace hal
          */
         DataContainer() = default;
 
-        virtual ~DataContainer() = default;
+        /**
+         * Construct a copy of a data container.
+         *
+         * @param[in] other - The data container to copy.
+         */
+        DataContainer(const DataContainer& other);
+
+        /**
+         * Replace the entries of the data container by those of another one.
+         *
+         * @param[in] other - The data container to copy.
+         * @returns A reference to this data container.
+         */
+        DataContainer& operator=(const DataContainer& other);
+
+        virtual ~DataContainer();
 
         /**
          * Check whether two data containers are equal.
@@ -106,11 +124,12 @@ namespace hal
         bool delete_data(const std::string& category, const std::string& key, const bool log_with_info_level = false);
 
         /**
-         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.
+         * Get a map from ((1) category, (2) key) to ((1) type, (2) value) containing all stored data entries.<br>
+         * The map is assembled from the stored entries on every call.
          *
          * @returns The stored data as a map.
          */
-        const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& get_data_map() const;
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data_map() const;
 
         /**
          * Overwrite the existing data with a new map from ((1) category, (2) key) to ((1) type, (2) value).
@@ -120,6 +139,19 @@ namespace hal
         void set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map);
 
     protected:
-        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
+        /* a single data entry, category, key, and data type refer to the shared intern table */
+        struct Entry
+        {
+            u32 category;
+            u32 key;
+            u32 data_type;
+            std::string value;
+        };
+
+        /* entries sorted by category and key identifier */
+        std::vector<Entry> m_data;
+
+        /* incremented on every modification of the data so that derived classes can invalidate values derived from it */
+        u64 m_data_revision = 0;
     };
 }    // namespace hal
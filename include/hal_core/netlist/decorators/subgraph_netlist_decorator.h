@@ -27,6 +27,7 @@
 
 #include "hal_core/defines.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/expression_store.h"
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/utilities/result.h"
 
@@ -141,6 +142,35 @@ namespace hal
          */
         Result<BooleanFunction> get_subgraph_function(const Module* subgraph_module, const Net* subgraph_output) const;
 
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as an expression of the given store.
+         * In contrast to `get_subgraph_function`, gate functions that feed into multiple other gates are shared instead of being copied into every function they are substituted into, which keeps memory consumption linear in the size of the subgraph.
+         * The variables of the resulting expression are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * Utilizes a cache for speedup on consecutive calls.
+         * 
+         * @param[in] store - The expression store to create the expression in.
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the expression.
+         * @param[inout] cache - Cache to speed up computations. The cache is filled by this function and must only be used with the same store.
+         * @return The combined expression of the subgraph on success, an error otherwise.
+         */
+        Result<SharedExpression> get_subgraph_expression(ExpressionStore& store,
+                                                         const std::vector<const Gate*>& subgraph_gates,
+                                                         const Net* subgraph_output,
+                                                         std::map<std::pair<u32, const GatePin*>, SharedExpression>& cache) const;
+
+        /**
+         * Get the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net as an expression of the given store.
+         * In contrast to `get_subgraph_function`, gate functions that feed into multiple other gates are shared instead of being copied into every function they are substituted into, which keeps memory consumption linear in the size of the subgraph.
+         * The variables of the resulting expression are created from the subgraph input nets using `BooleanFunctionNetDecorator::get_boolean_variable`.
+         * 
+         * @param[in] store - The expression store to create the expression in.
+         * @param[in] subgraph_gates - The gates making up the subgraph to consider.
+         * @param[in] subgraph_output - The subgraph oputput net for which to generate the expression.
+         * @return The combined expression of the subgraph on success, an error otherwise.
+         */
+        Result<SharedExpression> get_subgraph_expression(ExpressionStore& store, const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output) const;
+
         /**
          * Get the inputs of the combined Boolean function of a subgraph of combinational gates starting at the source of the provided subgraph output net.
          * This does not actually build the boolean function but only determines the inputs the subgraph function would have, which is a lot faster.
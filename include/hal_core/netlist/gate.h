@@ -31,6 +31,7 @@
 #include "hal_core/netlist/endpoint.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/utilities/filter_view.h"
 
 #include <functional>
 #include <map>
@@ -48,6 +49,116 @@ namespace hal
     class Grouping;
     class Endpoint;
     class NetlistInternalManager;
+    struct CachedLUTFunction;
+
+    /**
+     * A lazy view on the direct predecessor or successor endpoints of a gate.
+     * The endpoints are collected from the nets connected to the gate while iterating, hence no intermediate vector is allocated.
+     * The view and its iterators are invalidated when any of the involved connections change, and iterators must not outlive the view.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API GateNeighborView
+    {
+    public:
+        using Filter = std::function<bool(const GatePin* pin, Endpoint* ep)>;
+
+        class NETLIST_API iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Endpoint*;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = Endpoint* const*;
+            using reference         = Endpoint*;
+
+            iterator() = default;
+            iterator(const GateNeighborView* view, bool is_end);
+
+            reference operator*() const
+            {
+                return *m_inner;
+            }
+
+            iterator& operator++()
+            {
+                ++m_inner;
+                skip();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return m_outer == other.m_outer && m_inner == other.m_inner;
+            }
+
+            bool operator!=(const iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            void load_inner();
+            void skip();
+
+            const GateNeighborView* m_view = nullptr;
+            Endpoint* const* m_outer       = nullptr;
+            Endpoint* const* m_inner       = nullptr;
+            Endpoint* const* m_inner_end   = nullptr;
+        };
+
+        /**
+         * Create a view on the endpoints connected to the given endpoints of a gate.
+         *
+         * @param[in] gate_endpoints - The fan-out endpoints of the gate to view the successors, or its fan-in endpoints to view the predecessors.
+         * @param[in] successors - Set `true` to view successors, `false` to view predecessors.
+         * @param[in] filter - An optional filter being evaluated on the gate's pin as well as the neighboring endpoint.
+         */
+        GateNeighborView(const std::vector<Endpoint*>& gate_endpoints, bool successors, Filter filter = nullptr);
+
+        iterator begin() const
+        {
+            return iterator(this, false);
+        }
+
+        iterator end() const
+        {
+            return iterator(this, true);
+        }
+
+        /**
+         * Check whether the view contains no endpoints.
+         *
+         * @returns `true` if the view is empty, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return begin() == end();
+        }
+
+        /**
+         * Copy the endpoints of the view into a vector.
+         *
+         * @returns A vector of endpoints.
+         */
+        std::vector<Endpoint*> to_vector() const
+        {
+            return std::vector<Endpoint*>(begin(), end());
+        }
+
+    private:
+        Endpoint* const* m_begin;
+        Endpoint* const* m_end;
+        bool m_successors;
+        Filter m_filter;
+    };
 
     /**
      * Gate class containing information about a gate including its location, functions, and module.
@@ -225,6 +336,15 @@ namespace hal
          */
         std::unordered_map<std::string, BooleanFunction> get_boolean_functions(bool only_custom_functions = false) const;
 
+        /**
+         * Get the truth table of a LUT gate with at most six input pins as configured by its INIT data.<br>
+         * Bit `i` of the truth table holds the output of the LUT for the input assignment `i`, in which bit `j` corresponds to the `j`-th input pin of the gate type.
+         * The truth table is cached and shared among all gates of the same type with the same INIT value.
+         *
+         * @returns The truth table on success, an error otherwise.
+         */
+        Result<u64> get_lut_truth_table() const;
+
         /**
           * Get the resolved Boolean function corresponding to the given output pin, i.e., a Boolean function that only depends on input pins (or nets) and no internal or output pins.
           * If fan-in nets are used to derive variable names, the variable names are generated using the `BooleanFunctionNetDecorator`.
@@ -305,6 +425,15 @@ namespace hal
          */
         std::vector<Net*> get_fan_in_nets(const std::function<bool(Net*)>& filter) const;
 
+        /**
+         * Get a view on the fan-in nets of the gate that evaluates the filter while iterating instead of copying the nets into a vector.
+         * The view is invalidated when the connections of the gate change.
+         *
+         * @param[in] filter - Filter function to be evaluated on each net.
+         * @returns A view on the fan-in nets.
+         */
+        FilterView<Net*> get_fan_in_nets_view(const std::function<bool(Net*)>& filter = nullptr) const;
+
         /**
          * Get the fan-in net corresponding to the input pin specified by name.
          *
@@ -345,6 +474,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_fan_in_endpoints(const std::function<bool(Endpoint*)>& filter) const;
 
+        /**
+         * Get a view on the fan-in endpoints of the gate that evaluates the filter while iterating instead of copying the endpoints into a vector.
+         * The view is invalidated when the connections of the gate change.
+         *
+         * @param[in] filter - Filter function to be evaluated on each endpoint.
+         * @returns A view on the fan-in endpoints.
+         */
+        FilterView<Endpoint*> get_fan_in_endpoints_view(const std::function<bool(Endpoint*)>& filter = nullptr) const;
+
         /**
          * Get the fan-in endpoint corresponding to the input pin specified by name.
          *
@@ -385,6 +523,15 @@ namespace hal
          */
         std::vector<Net*> get_fan_out_nets(const std::function<bool(Net*)>& filter) const;
 
+        /**
+         * Get a view on the fan-out nets of the gate that evaluates the filter while iterating instead of copying the nets into a vector.
+         * The view is invalidated when the connections of the gate change.
+         *
+         * @param[in] filter - Filter function to be evaluated on each net.
+         * @returns A view on the fan-out nets.
+         */
+        FilterView<Net*> get_fan_out_nets_view(const std::function<bool(Net*)>& filter = nullptr) const;
+
         /**
          * Get the fan-out net corresponding to the output pin specified by name.
          *
@@ -425,6 +572,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_fan_out_endpoints(const std::function<bool(Endpoint*)>& filter) const;
 
+        /**
+         * Get a view on the fan-out endpoints of the gate that evaluates the filter while iterating instead of copying the endpoints into a vector.
+         * The view is invalidated when the connections of the gate change.
+         *
+         * @param[in] filter - Filter function to be evaluated on each endpoint.
+         * @returns A view on the fan-out endpoints.
+         */
+        FilterView<Endpoint*> get_fan_out_endpoints_view(const std::function<bool(Endpoint*)>& filter = nullptr) const;
+
         /**
          * Get the fan-out endpoint corresponding to the output pin specified by name.
          *
@@ -467,6 +623,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_predecessors(const std::function<bool(const GatePin* pin, Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on all direct predecessor endpoints of the gate that collects the endpoints while iterating instead of copying them into a vector.
+         * The view is invalidated when the connections of the gate or of its fan-in nets change.
+         *
+         * @param[in] filter - An optional filter being evaluated on the gate's input pin as well as the predecessor endpoint.
+         * @returns A view on the predecessor endpoints.
+         */
+        GateNeighborView get_predecessors_view(const std::function<bool(const GatePin* pin, Endpoint* ep)>& filter = nullptr) const;
+
         /**
          * Get a single direct predecessor endpoint that is connected to the input pin specified by name.
          * Fails if there are no or more than one predecessors.
@@ -503,6 +668,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_successors(const std::function<bool(const GatePin* pin, Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on all direct successor endpoints of the gate that collects the endpoints while iterating instead of copying them into a vector.
+         * The view is invalidated when the connections of the gate or of its fan-out nets change.
+         *
+         * @param[in] filter - An optional filter being evaluated on the gate's output pin as well as the successor endpoint.
+         * @returns A view on the successor endpoints.
+         */
+        GateNeighborView get_successors_view(const std::function<bool(const GatePin* pin, Endpoint* ep)>& filter = nullptr) const;
+
         /**
          * Get a single direct successor endpoint that is connected to the output pin specified by name.
          * Fails if there are no or more than one successors.
@@ -548,6 +722,7 @@ namespace hal
         Gate& operator=(Gate&&)      = delete;
 
         BooleanFunction get_lut_function(const GatePin* pin) const;
+        std::shared_ptr<const CachedLUTFunction> get_cached_lut_function() const;
 
         /* pointer to corresponding netlist parent */
         NetlistInternalManager* m_internal_manager;
@@ -565,8 +740,9 @@ namespace hal
         i32 m_x = -1;
         i32 m_y = -1;
 
-        /* owning module */
+        /* owning module and index of the gate within the gates of that module */
         Module* m_module;
+        u32 m_module_index = 0;
 
         /* grouping */
         Grouping* m_grouping = nullptr;
@@ -580,6 +756,10 @@ namespace hal
         /* dedicated functions */
         std::unordered_map<std::string, BooleanFunction> m_functions;
 
+        /* LUT function and the revision of the data it was derived from, guarded by the LUT function mutex of the netlist */
+        mutable std::shared_ptr<const CachedLUTFunction> m_lut_function;
+        mutable u64 m_lut_function_revision = 0;
+
         EventHandler* m_event_handler;
     };
 }    // namespace hal
@@ -35,6 +35,7 @@
 #include "hal_core/netlist/pins/module_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
 #include "hal_core/utilities/enums.h"
+#include "hal_core/utilities/id_allocator.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -55,6 +56,109 @@ namespace hal
     class Net;
     class Grouping;
     class Gate;
+    class Module;
+
+    /**
+     * A lazy view on the gates of a module and, optionally, of all of its submodules.
+     * The filter is evaluated and the submodules are traversed while iterating, hence no intermediate vector is allocated for the gates.
+     * Gates are visited in the same order as returned by `Module::get_gates`.
+     * The view and its iterators are invalidated when gates are assigned to or removed from any of the involved modules or when the module hierarchy changes.
+     *
+     * @ingroup module
+     */
+    class NETLIST_API ModuleGatesView
+    {
+    public:
+        using Filter = std::function<bool(Gate*)>;
+
+        class NETLIST_API iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Gate*;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = Gate* const*;
+            using reference         = Gate*;
+
+            iterator() = default;
+            iterator(const ModuleGatesView* view, bool is_end);
+
+            reference operator*() const;
+
+            iterator& operator++();
+
+            iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const;
+
+            bool operator!=(const iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            struct Frame
+            {
+                const Module* module;
+                u32 gate_index;
+                u32 submodule_index;
+            };
+
+            void skip();
+
+            const ModuleGatesView* m_view = nullptr;
+            std::vector<Frame> m_stack;
+        };
+
+        /**
+         * Create a view on the gates of a module.
+         *
+         * @param[in] module - The module.
+         * @param[in] filter - An optional filter to be evaluated on each gate.
+         * @param[in] recursive - Set to `true` to also consider gates in submodules, `false` otherwise.
+         */
+        ModuleGatesView(const Module* module, Filter filter = nullptr, bool recursive = false);
+
+        iterator begin() const
+        {
+            return iterator(this, false);
+        }
+
+        iterator end() const
+        {
+            return iterator(this, true);
+        }
+
+        /**
+         * Check whether the view contains no gates.
+         *
+         * @returns `true` if the view is empty, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return begin() == end();
+        }
+
+        /**
+         * Copy the gates of the view into a vector.
+         *
+         * @returns A vector of gates.
+         */
+        std::vector<Gate*> to_vector() const
+        {
+            return std::vector<Gate*>(begin(), end());
+        }
+
+    private:
+        const Module* m_module;
+        Filter m_filter;
+        bool m_recursive;
+    };
 
     /**
      * A module is a container for gates and their associated nets that enables hierarchization within the netlist.<br>
@@ -169,6 +273,7 @@ namespace hal
 
         /**
          * Check if the module is a parent of the specified module.
+         * The recursive check takes time logarithmic in the depth of the module hierarchy.
          * 
          * @param[in] module - The module.
          * @param[in] recursive - Set `true` to check recursively, `false` otherwise.
@@ -645,7 +750,8 @@ namespace hal
 
         /**
          * Check whether a gate is contained in the module.<br>
-         * If `recursive` is `true`, gates in submodules are considered as well.
+         * If `recursive` is `true`, gates in submodules are considered as well.<br>
+         * The check is answered from the owning module of the gate and does not depend on the number of gates or submodules.
          *
          * @param[in] gate - The gate to check for.
          * @param[in] recursive - Set to `true` to also consider gates in submodules, `false` otherwise.
@@ -681,6 +787,16 @@ namespace hal
          */
         std::vector<Gate*> get_gates(const std::function<bool(Gate*)>& filter, bool recursive = false) const;
 
+        /**
+         * Get a view on the gates contained within the module that evaluates the filter and traverses the submodules while iterating instead of copying the gates into a vector.
+         * If `recursive` is `true`, gates in submodules are considered as well.
+         *
+         * @param[in] filter - Filter function to be evaluated on each gate.
+         * @param[in] recursive - Set to `true` to also consider gates in submodules, `false` otherwise. Defaults to `false`.
+         * @return A view on the gates.
+         */
+        ModuleGatesView get_gates_view(const std::function<bool(Gate*)>& filter = nullptr, bool recursive = false) const;
+
         /**
          * Get the event handler connected to module
          * @return The event handler;
@@ -689,6 +805,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class ModuleGatesView;
         Module(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, Module* parent, const std::string& name);
 
         Module(const Module&)            = delete;    //disable copy-constructor
@@ -715,13 +832,13 @@ namespace hal
         std::unordered_map<u32, Module*> m_submodules_map;
         std::vector<Module*> m_submodules;
 
+        // ancestry index, i.e., the depth within the module hierarchy and the (2^k)-th parent module for all k
+        u32 m_depth = 0;
+        std::vector<Module*> m_ancestors;
+
         // pins
-        u32 m_next_pin_id;
-        std::set<u32> m_used_pin_ids;
-        std::set<u32> m_free_pin_ids;
-        u32 m_next_pin_group_id;
-        std::set<u32> m_used_pin_group_ids;
-        std::set<u32> m_free_pin_group_ids;
+        IdAllocator m_pin_ids;
+        IdAllocator m_pin_group_ids;
 
         u32 m_next_input_index  = 0;
         u32 m_next_inout_index  = 0;
@@ -735,8 +852,7 @@ namespace hal
         std::unordered_map<std::string, PinGroup<ModulePin>*> m_pin_group_names_map;
         std::list<PinGroup<ModulePin>*> m_pin_groups_ordered;
 
-        /* stores gates sorted by id */
-        std::unordered_map<u32, Gate*> m_gates_map;
+        /* stores gates, each gate knows its index within this vector */
         std::vector<Gate*> m_gates;
 
         std::unordered_set<Net*> m_nets;
@@ -746,6 +862,8 @@ namespace hal
 
         EventHandler* m_event_handler;
 
+        void update_ancestry();
+        const Module* get_ancestor(u32 distance) const;
         NetConnectivity check_net_endpoints(const Net* net) const;
         Result<std::monostate> check_net(Net* net, bool recursive = false);
         bool assign_pin_net(const u32 pin_id, Net* net, PinDirection direction);
@@ -30,6 +30,7 @@
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/pins/gate_pin.h"
 #include "hal_core/netlist/pins/pin_group.h"
+#include "hal_core/utilities/filter_view.h"
 #include "hal_core/utilities/result.h"
 
 #include <functional>
@@ -226,6 +227,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_sources(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on the sources of the net that evaluates the optional filter while iterating instead of copying the sources into a vector.
+         * The view is invalidated when sources are added to or removed from the net.
+         *
+         * @param[in] filter - An optional filter.
+         * @returns A view on the source endpoints.
+         */
+        FilterView<Endpoint*> get_sources_view(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
+
         /*
          *      dst specific functions
          */
@@ -336,6 +346,15 @@ namespace hal
          */
         std::vector<Endpoint*> get_destinations(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
 
+        /**
+         * Get a view on the destinations of the net that evaluates the optional filter while iterating instead of copying the destinations into a vector.
+         * The view is invalidated when destinations are added to or removed from the net.
+         *
+         * @param[in] filter - An optional filter.
+         * @returns A view on the destination endpoints.
+         */
+        FilterView<Endpoint*> get_destinations_view(const std::function<bool(Endpoint* ep)>& filter = nullptr) const;
+
         /**
          * Check whether the net is unrouted, i.e., it has no source or no destination.
          *
@@ -401,6 +420,7 @@ namespace hal
 
     private:
         friend class NetlistInternalManager;
+        friend class GateNeighborView;
         explicit Net(NetlistInternalManager* internal_manager, EventHandler* event_handler, const u32 id, const std::string& name = "");
 
         Net(const Net&)            = delete;
@@ -420,10 +440,8 @@ namespace hal
         Grouping* m_grouping = nullptr;
 
         /* stores the dst gate and pin id of the dst gate */
-        std::vector<std::unique_ptr<Endpoint>> m_destinations;
-        std::vector<std::unique_ptr<Endpoint>> m_sources;
-        std::vector<Endpoint*> m_destinations_raw;
-        std::vector<Endpoint*> m_sources_raw;
+        std::vector<Endpoint*> m_destinations;
+        std::vector<Endpoint*> m_sources;
 
         EventHandler* m_event_handler;
     };
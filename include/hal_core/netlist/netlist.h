@@ -28,6 +28,9 @@
 #include "hal_core/defines.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/gate_library/gate_library.h"
+#include "hal_core/utilities/filter_view.h"
+#include "hal_core/utilities/id_allocator.h"
+#include "hal_core/utilities/slot_map.h"
 
 #include <functional>
 #include <memory>
@@ -46,6 +49,7 @@ namespace hal
     class Module;
     class Grouping;
     class Endpoint;
+    class NetlistCSR;
 
     /**
      * Netlist class containing information about the netlist including its gates, modules, nets, and groupings as well as the underlying gate library.
@@ -234,6 +238,15 @@ namespace hal
          */
         std::vector<Gate*> get_gates(const std::function<bool(const Gate*)>& filter) const;
 
+        /**
+         * Get a view on the gates contained within the netlist that evaluates the filter while iterating instead of copying the gates into a vector.<br>
+         * The view is invalidated when gates are created or deleted.
+         *
+         * @param[in] filter - Filter function to be evaluated on each gate.
+         * @return A view on the gates.
+         */
+        FilterView<Gate*, const Gate*> get_gates_view(const std::function<bool(const Gate*)>& filter = nullptr) const;
+
         /**
          * Mark a gate as a global VCC gate.
          *
@@ -368,6 +381,15 @@ namespace hal
          */
         std::vector<Net*> get_nets(const std::function<bool(const Net*)>& filter) const;
 
+        /**
+         * Get a view on the nets contained within the netlist that evaluates the filter while iterating instead of copying the nets into a vector.<br>
+         * The view is invalidated when nets are created or deleted.
+         *
+         * @param[in] filter - Filter function to be evaluated on each net.
+         * @return A view on the nets.
+         */
+        FilterView<Net*, const Net*> get_nets_view(const std::function<bool(const Net*)>& filter = nullptr) const;
+
         /**
          * Mark a net as a global input net.
          *
@@ -452,6 +474,28 @@ namespace hal
          */
         void enable_automatic_net_checks(bool enable_checks = true);
 
+        /**
+         * Starts a batch of modifications during which automatic net checks are deferred.
+         * Instead of reclassifying the input, output, and internal nets as well as the pins of all affected modules after every single modification, affected nets are collected and each of them is checked exactly once per module when the batch is committed using `Netlist::commit_batch`.
+         * Batches may be nested, the checks are only performed once the outermost batch is committed.
+         * \warning{\b WARNING: until the batch is committed, module nets and pins do not reflect modifications made within the batch.}
+         */
+        void begin_batch();
+
+        /**
+         * Commits a batch of modifications started using `Netlist::begin_batch` and performs all deferred net checks.
+         * 
+         * @returns `true` on success, `false` otherwise.
+         */
+        bool commit_batch();
+
+        /**
+         * Check whether a batch of modifications started using `Netlist::begin_batch` has not yet been committed.
+         * 
+         * @returns `true` if a batch is active, `false` otherwise.
+         */
+        bool is_batch_active() const;
+
         /*
          * ################################################################
          *      module functions
@@ -801,6 +845,16 @@ namespace hal
          */
         void clear_caches();
 
+        /**
+         * Get a snapshot of the connectivity of the netlist in compressed sparse row format.<br>
+         * The snapshot is cached and only rebuilt once gates, nets, or connections have been added or removed since the last call.
+         * Previously returned snapshots remain valid, but do not reflect subsequent modifications.
+         * The function may be called from several threads at once as long as the netlist is not modified at the same time.
+         *
+         * @returns The connectivity snapshot.
+         */
+        std::shared_ptr<const NetlistCSR> get_csr() const;
+
         /**
          * Load the locations of the gates in the netlist from their associated data using the specified category and identifier.
          * If no parameter is given, the data is querried using the default category and identifier stored with the gate library.
@@ -834,18 +888,10 @@ namespace hal
         std::unique_ptr<EventHandler> m_event_handler;
 
         /* stores the auto generated ids for fast next id */
-        u32 m_next_gate_id;
-        std::set<u32> m_used_gate_ids;
-        std::set<u32> m_free_gate_ids;
-        u32 m_next_net_id;
-        std::set<u32> m_used_net_ids;
-        std::set<u32> m_free_net_ids;
-        u32 m_next_module_id;
-        std::set<u32> m_used_module_ids;
-        std::set<u32> m_free_module_ids;
-        u32 m_next_grouping_id;
-        std::set<u32> m_used_grouping_ids;
-        std::set<u32> m_free_grouping_ids;
+        IdAllocator m_gate_ids;
+        IdAllocator m_net_ids;
+        IdAllocator m_module_ids;
+        IdAllocator m_grouping_ids;
 
         /* stores the modules */
         Module* m_top_module;
@@ -853,15 +899,10 @@ namespace hal
         std::unordered_set<const Module*> m_modules_set;
         std::vector<Module*> m_modules;
 
-        /* stores the nets */
-        std::unordered_map<u32, std::unique_ptr<Net>> m_nets_map;
-        std::unordered_set<const Net*> m_nets_set;
-        std::vector<Net*> m_nets;
-
-        /* stores the gates */
-        std::unordered_map<u32, std::unique_ptr<Gate>> m_gates_map;
-        std::unordered_set<const Gate*> m_gates_set;
-        std::vector<Gate*> m_gates;
+        /* stores the nets, gates, and the endpoints connecting them */
+        SlotMap<Net> m_nets;
+        SlotMap<Gate> m_gates;
+        SlotMap<Endpoint> m_endpoints;
 
         /* stores the groupings */
         std::unordered_map<u32, std::unique_ptr<Grouping>> m_groupings_map;
@@ -0,0 +1,314 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/netlist/gate_library/enums/pin_type.h"
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /* forward declaration */
+    class Netlist;
+    class Gate;
+    class Net;
+
+    /**
+     * An immutable snapshot of the connectivity of a netlist stored in compressed sparse row (CSR) format.<br>
+     * Gates and nets are assigned dense indices in the order of `Netlist::get_gates` and `Netlist::get_nets`.
+     * For every gate, the snapshot stores the connected fan-in and fan-out nets as well as the predecessor and successor gates, and for every net, the source and destination gates.
+     * All adjacency lists are stored in contiguous arrays and are accessed through lightweight spans.<br>
+     * The snapshot does not observe the netlist, i.e., it reflects the netlist at the time of construction.
+     * Use `Netlist::get_csr` to get a cached snapshot that is rebuilt after the connectivity of the netlist has changed.
+     *
+     * @ingroup netlist
+     */
+    class NETLIST_API NetlistCSR
+    {
+    public:
+        /**
+         * Index returned for gates and nets that are not part of the snapshot.
+         */
+        static constexpr u32 invalid_index = std::numeric_limits<u32>::max();
+
+        /**
+         * A net connected to a gate.
+         */
+        struct NetConnection
+        {
+            /**
+             * The index of the net.
+             */
+            u32 net;
+
+            /**
+             * The type of the pin of the gate the net is connected to.
+             */
+            PinType pin_type;
+        };
+
+        /**
+         * A gate connected to a net.
+         */
+        struct GateConnection
+        {
+            /**
+             * The index of the gate.
+             */
+            u32 gate;
+
+            /**
+             * The type of the pin of the gate the net is connected to.
+             */
+            PinType pin_type;
+        };
+
+        /**
+         * A neighboring gate of a gate, i.e., a predecessor or successor.<br>
+         * A neighbor connected through several nets or pins is contained once for every such connection.
+         */
+        struct Edge
+        {
+            /**
+             * The index of the neighboring gate.
+             */
+            u32 gate;
+
+            /**
+             * The index of the net connecting both gates.
+             */
+            u32 net;
+
+            /**
+             * The type of the pin of the neighboring gate the net is connected to.
+             */
+            PinType pin_type;
+        };
+
+        /**
+         * A non-owning view on a contiguous range of elements of the snapshot.
+         */
+        template<typename T>
+        class Span
+        {
+        public:
+            Span(const T* begin, const T* end) : m_begin(begin), m_end(end)
+            {
+            }
+
+            const T* begin() const
+            {
+                return m_begin;
+            }
+
+            const T* end() const
+            {
+                return m_end;
+            }
+
+            size_t size() const
+            {
+                return m_end - m_begin;
+            }
+
+            bool empty() const
+            {
+                return m_begin == m_end;
+            }
+
+            const T& operator[](size_t index) const
+            {
+                return m_begin[index];
+            }
+
+        private:
+            const T* m_begin;
+            const T* m_end;
+        };
+
+        /**
+         * Build the snapshot of the given netlist.<br>
+         * The endpoints of all gates are visited only once, all remaining adjacency lists are derived from the collected ones.
+         *
+         * @param[in] nl - The netlist.
+         */
+        explicit NetlistCSR(const Netlist* nl);
+
+        /**
+         * Get the netlist the snapshot was built from.
+         *
+         * @returns The netlist.
+         */
+        const Netlist* get_netlist() const;
+
+        /**
+         * Get the number of gates in the snapshot.
+         *
+         * @returns The number of gates.
+         */
+        u32 get_num_gates() const;
+
+        /**
+         * Get the number of nets in the snapshot.
+         *
+         * @returns The number of nets.
+         */
+        u32 get_num_nets() const;
+
+        /**
+         * Get the gate with the given index.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns The gate.
+         */
+        Gate* get_gate(u32 index) const;
+
+        /**
+         * Get the net with the given index.
+         *
+         * @param[in] index - The index of the net.
+         * @returns The net.
+         */
+        Net* get_net(u32 index) const;
+
+        /**
+         * Get the index of the given gate.
+         *
+         * @param[in] gate - The gate.
+         * @returns The index of the gate or `NetlistCSR::invalid_index` if the gate is not part of the snapshot.
+         */
+        u32 get_gate_index(const Gate* gate) const;
+
+        /**
+         * Get the index of the given net.
+         *
+         * @param[in] net - The net.
+         * @returns The index of the net or `NetlistCSR::invalid_index` if the net is not part of the snapshot.
+         */
+        u32 get_net_index(const Net* net) const;
+
+        /**
+         * Check whether the gate with the given index is sequential, i.e., whether its type has the property `GateTypeProperty::sequential`.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns True if the gate is sequential, false otherwise.
+         */
+        bool is_sequential(u32 index) const;
+
+        /**
+         * Check whether the gate with the given index is combinational, i.e., whether its type has the property `GateTypeProperty::combinational`.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns True if the gate is combinational, false otherwise.
+         */
+        bool is_combinational(u32 index) const;
+
+        /**
+         * Get the fan-in nets of the gate with the given index in the order of its fan-in endpoints.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns The fan-in nets.
+         */
+        Span<NetConnection> get_fan_in_nets(u32 index) const;
+
+        /**
+         * Get the fan-out nets of the gate with the given index in the order of its fan-out endpoints.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns The fan-out nets.
+         */
+        Span<NetConnection> get_fan_out_nets(u32 index) const;
+
+        /**
+         * Get the predecessors of the gate with the given index.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns The predecessors.
+         */
+        Span<Edge> get_predecessors(u32 index) const;
+
+        /**
+         * Get the successors of the gate with the given index.
+         *
+         * @param[in] index - The index of the gate.
+         * @returns The successors.
+         */
+        Span<Edge> get_successors(u32 index) const;
+
+        /**
+         * Get the source gates of the net with the given index ordered by gate index.
+         *
+         * @param[in] index - The index of the net.
+         * @returns The source gates.
+         */
+        Span<GateConnection> get_sources(u32 index) const;
+
+        /**
+         * Get the destination gates of the net with the given index ordered by gate index.
+         *
+         * @param[in] index - The index of the net.
+         * @returns The destination gates.
+         */
+        Span<GateConnection> get_destinations(u32 index) const;
+
+    private:
+        enum GateFlags : u8
+        {
+            sequential    = 1 << 0,
+            combinational = 1 << 1
+        };
+
+        const Netlist* m_netlist;
+
+        std::vector<Gate*> m_gates;
+        std::vector<Net*> m_nets;
+        std::vector<u8> m_gate_flags;
+
+        // indices by ID, stored in a map instead of a vector if the IDs are sparse
+        std::vector<u32> m_gate_indices;
+        std::vector<u32> m_net_indices;
+        std::unordered_map<u32, u32> m_sparse_gate_indices;
+        std::unordered_map<u32, u32> m_sparse_net_indices;
+
+        // offsets into the adjacency arrays, one entry per gate or net plus one
+        std::vector<u32> m_fan_in_offsets;
+        std::vector<u32> m_fan_out_offsets;
+        std::vector<u32> m_predecessor_offsets;
+        std::vector<u32> m_successor_offsets;
+        std::vector<u32> m_source_offsets;
+        std::vector<u32> m_destination_offsets;
+
+        std::vector<NetConnection> m_fan_in_nets;
+        std::vector<NetConnection> m_fan_out_nets;
+        std::vector<Edge> m_predecessors;
+        std::vector<Edge> m_successors;
+        std::vector<GateConnection> m_sources;
+        std::vector<GateConnection> m_destinations;
+    };
+}    // namespace hal
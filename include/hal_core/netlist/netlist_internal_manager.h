@@ -26,10 +26,15 @@
 #pragma once
 
 #include "hal_core/defines.h"
+#include "hal_core/netlist/boolean_function.h"
 #include "hal_core/netlist/event_system/event_handler.h"
 #include "hal_core/netlist/pins/gate_pin.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace hal
@@ -42,7 +47,21 @@ namespace hal
     class Module;
     class Endpoint;
     class Grouping;
-    class BooleanFunction;
+    class NetlistCSR;
+
+    /**
+     * The function of a LUT, shared by all gates of the same type configured with the same INIT value.
+     *
+     * @ingroup netlist
+     */
+    struct CachedLUTFunction
+    {
+        /* truth table over the input pins of the gate type, only meaningful for at most six input pins */
+        u64 truth_table;
+
+        /* the simplified Boolean function */
+        BooleanFunction function;
+    };
 
     /**
      * @ingroup netlist
@@ -84,6 +103,15 @@ namespace hal
         bool module_assign_gate(Module* m, Gate* g);
         bool module_assign_gates(Module* module, const std::vector<Gate*>& gates);
         bool module_check_net(Module* module, Net* net, bool recursive = false);
+        void module_insert_gate(Module* module, Gate* gate);
+        void module_erase_gate(Module* module, Gate* gate);
+
+        // batched net checks
+        Result<std::monostate> schedule_net_check(Module* module, Net* net);
+        void begin_batch();
+        bool commit_batch();
+        u32 m_batch_depth = 0;
+        std::unordered_map<Module*, std::unordered_set<Net*>> m_pending_net_checks;
 
         // grouping functions
         Grouping* create_grouping(u32 id, const std::string name);
@@ -97,7 +125,13 @@ namespace hal
 
         // caches
         void clear_caches();
-        mutable std::map<std::pair<std::vector<GatePin*>, u64>, BooleanFunction> m_lut_function_cache;
+        std::shared_ptr<const NetlistCSR> get_csr();
+        // guards the LUT function cache and the per-gate LUT functions, which are filled lazily by const getters
+        mutable std::mutex m_lut_function_mutex;
+        mutable std::map<std::pair<const GateType*, u64>, std::shared_ptr<const CachedLUTFunction>> m_lut_function_cache;
+        // guards the connectivity snapshot, which is built lazily by the const Netlist::get_csr
+        std::mutex m_csr_mutex;
+        std::shared_ptr<const NetlistCSR> m_csr_cache;
         bool m_net_checks_enabled = true;
     };
 }    // namespace hal
@@ -46,6 +46,7 @@ namespace hal
 
         /**
          * Serializes a netlist into a `.hal` file.
+         * If the file has the extension `.halb`, the netlist is serialized into the binary format instead.
          *
          * @param[in] netlist - The netlist to serialize.
          * @param[in] hal_file - The path to the `.hal` file.
@@ -56,6 +57,7 @@ namespace hal
         /**
          * Deserializes a netlist from a `.hal` file using the provided gate library.
          * If no gate library is provided, a gate library path must be specified within the `.hal` file.
+         * If the file has the extension `.halb`, the netlist is deserialized from the binary format instead.
          *
          * @param[in] hal_file - The path to the `.hal` file.
          * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
@@ -63,6 +65,26 @@ namespace hal
          */
         NETLIST_API std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gate_lib = nullptr);
 
+        /**
+         * Serializes a netlist into a binary `.halb` file.
+         * The binary format stores the same information as the `.hal` format in flat tables that refer to a shared string table.
+         *
+         * @param[in] netlist - The netlist to serialize.
+         * @param[in] halb_file - The path to the `.halb` file.
+         * @returns `true` on success, `false` otherwise.
+         */
+        NETLIST_API bool serialize_to_binary_file(const Netlist* netlist, const std::filesystem::path& halb_file);
+
+        /**
+         * Deserializes a netlist from a binary `.halb` file using the provided gate library.
+         * If no gate library is provided, the gate library specified within the `.halb` file is used.
+         *
+         * @param[in] halb_file - The path to the `.halb` file.
+         * @param[in] gate_lib - The gate library. Defaults to a `nullptr`.
+         * @returns The deserialized netlist on success, a `nullptr` otherwise.
+         */
+        NETLIST_API std::unique_ptr<Netlist> deserialize_from_binary_file(const std::filesystem::path& halb_file, GateLibrary* gate_lib = nullptr);
+
         /**
          * Deserializes a string which contains a netlist in HAL-(JSON)-format using the provided gate library.
          * If no gate library is provided, a gate library path must be specified within the string.
@@ -69,6 +69,7 @@ namespace hal
         std::string m_proj_file;
         std::string m_netlist_file;
         std::string m_gatelib_path;
+        bool m_binary_netlist_format;
         std::unordered_map<std::string, ProjectSerializer*> m_serializer;
         std::unordered_map<std::string, std::string> m_filename;
 
@@ -161,6 +162,21 @@ namespace hal
          */
         bool serialize_project(Netlist* netlist, bool shadow = false);
 
+        /**
+         * Set whether the netlist is saved in the binary `.halb` format instead of the JSON `.hal` format by subsequent calls to `ProjectManager::serialize_project`.
+         * Opening a project selects the format of its netlist file.
+         *
+         * @param[in] binary - Set `true` to save the netlist in the binary format, `false` to save it in the JSON format.
+         */
+        void set_binary_netlist_format(bool binary);
+
+        /**
+         * Check whether the netlist is saved in the binary `.halb` format.
+         *
+         * @return `true` if the netlist is saved in the binary format, `false` if it is saved in the JSON format.
+         */
+        bool is_binary_netlist_format() const;
+
         /**
          * Open the project specified by the provided directory path.
          *
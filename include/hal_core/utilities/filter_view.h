@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * A lazy, non-owning view on the elements of a vector that match a filter.
+     * The filter is evaluated while iterating, hence no intermediate vector is allocated.
+     *
+     * The view refers to the vector it has been created from and is invalidated as soon as that vector is modified.
+     * Iterators of a filtered view refer to the filter stored within the view and must not outlive it, iterators of an unfiltered view only refer to the vector.
+     *
+     * @ingroup utilities
+     */
+    template<typename T, typename FilterArg = T>
+    class FilterView final
+    {
+    public:
+        using Filter = std::function<bool(FilterArg)>;
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = T;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const T*;
+            using reference         = const T&;
+
+            iterator() = default;
+
+            iterator(const T* current, const T* end, const Filter* filter) : m_current(current), m_end(end), m_filter(filter)
+            {
+                skip();
+            }
+
+            reference operator*() const
+            {
+                return *m_current;
+            }
+
+            pointer operator->() const
+            {
+                return m_current;
+            }
+
+            iterator& operator++()
+            {
+                ++m_current;
+                skip();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return m_current == other.m_current;
+            }
+
+            bool operator!=(const iterator& other) const
+            {
+                return m_current != other.m_current;
+            }
+
+        private:
+            void skip()
+            {
+                if (m_filter != nullptr)
+                {
+                    while (m_current != m_end && !(*m_filter)(*m_current))
+                    {
+                        ++m_current;
+                    }
+                }
+            }
+
+            const T* m_current     = nullptr;
+            const T* m_end         = nullptr;
+            const Filter* m_filter = nullptr;
+        };
+
+        FilterView() = default;
+
+        /**
+         * Create a view on the elements of a vector that match a filter.
+         *
+         * @param[in] values - The vector.
+         * @param[in] filter - The filter, an empty filter matches all elements.
+         */
+        explicit FilterView(const std::vector<T>& values, Filter filter = nullptr) : m_begin(values.data()), m_end(values.data() + values.size()), m_filter(std::move(filter))
+        {
+        }
+
+        iterator begin() const
+        {
+            return iterator(m_begin, m_end, m_filter ? &m_filter : nullptr);
+        }
+
+        iterator end() const
+        {
+            return iterator(m_end, m_end, nullptr);
+        }
+
+        /**
+         * Check whether no element matches the filter.
+         *
+         * @returns `true` if the view is empty, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return begin() == end();
+        }
+
+        /**
+         * Get the number of elements that match the filter.
+         * Takes time linear in the size of the underlying vector if a filter is set.
+         *
+         * @returns The number of elements.
+         */
+        u32 size() const
+        {
+            if (!m_filter)
+            {
+                return m_end - m_begin;
+            }
+            return std::distance(begin(), end());
+        }
+
+        /**
+         * Copy the elements that match the filter into a vector.
+         *
+         * @returns A vector of elements.
+         */
+        std::vector<T> to_vector() const
+        {
+            return std::vector<T>(begin(), end());
+        }
+
+    private:
+        const T* m_begin = nullptr;
+        const T* m_end   = nullptr;
+        Filter m_filter;
+    };
+}    // namespace hal
@@ -0,0 +1,150 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <set>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Keeps track of used and freed IDs of a class of objects, e.g., all gates of a netlist.<br>
+     * New IDs are handed out from the freed IDs first, smallest first, and otherwise from the next ID that is not in use.
+     * 
+     * IDs are stored in bitmaps, so that reserving, releasing, and checking an ID takes constant time. 
+     * IDs that are far beyond the number of tracked IDs are kept in an ordered set instead, so that sparse IDs do not blow up the bitmaps.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API IdAllocator
+    {
+    public:
+        IdAllocator() = default;
+
+        /**
+         * Get a unique ID, which is the smallest freed ID if any, and the next unused ID otherwise.<br>
+         * The ID is not reserved.
+         *
+         * @returns The unique ID.
+         */
+        u32 get_unique_id();
+
+        /**
+         * Check whether an ID is currently in use.
+         *
+         * @param[in] id - The ID to check.
+         * @returns True if the ID is in use, false otherwise.
+         */
+        bool is_used(const u32 id) const;
+
+        /**
+         * Mark an ID as used and remove it from the freed IDs.
+         *
+         * @param[in] id - The ID to reserve.
+         */
+        void reserve(const u32 id);
+
+        /**
+         * Mark an ID as freed and no longer in use.
+         *
+         * @param[in] id - The ID to release.
+         */
+        void release(const u32 id);
+
+        /**
+         * Get the ID following the highest ID handed out so far.
+         *
+         * @returns The next ID.
+         */
+        u32 get_next_id() const;
+
+        /**
+         * Set the ID following the highest ID handed out so far.
+         *
+         * @param[in] id - The next ID.
+         */
+        void set_next_id(const u32 id);
+
+        /**
+         * Get all IDs that are currently in use.
+         *
+         * @returns The used IDs.
+         */
+        std::set<u32> get_used_ids() const;
+
+        /**
+         * Replace all IDs that are currently in use.
+         *
+         * @param[in] ids - The used IDs.
+         */
+        void set_used_ids(const std::set<u32>& ids);
+
+        /**
+         * Get all IDs that have previously been used but have been freed ever since.
+         *
+         * @returns The freed IDs.
+         */
+        std::set<u32> get_free_ids() const;
+
+        /**
+         * Replace all IDs that have previously been used but have been freed ever since.
+         *
+         * @param[in] ids - The freed IDs.
+         */
+        void set_free_ids(const std::set<u32>& ids);
+
+    private:
+        class Bitmap
+        {
+        public:
+            bool test(const u32 id) const;
+            void set(const u32 id);
+            void reset(const u32 id);
+            void clear();
+            bool empty() const;
+            u32 find_first_set() const;
+            u32 find_first_unset(u32 id) const;
+            std::set<u32> to_set() const;
+
+        private:
+            /* bits for all IDs below 64 * m_words.size() */
+            std::vector<u64> m_words;
+            /* IDs beyond the bitmap, all of them larger than the IDs covered by m_words */
+            std::set<u32> m_overflow;
+            u32 m_count = 0;
+            /* no bit is set in any word before this one */
+            mutable u32 m_first_word = 0;
+
+            void grow(const u32 word);
+        };
+
+        u32 m_next_id = 1;
+        Bitmap m_used;
+        Bitmap m_free;
+    };
+}    // namespace hal
@@ -0,0 +1,189 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace hal
+{
+    /**
+     * An append-only table that maps each distinct value to a dense 32-bit identifier and back.
+     * Interning the same value twice returns the same identifier, hence two identifiers are equal if and only if the interned values are equal.
+     * 
+     * Values are never removed individually, so an identifier remains valid until the table is cleared or destroyed.
+     * All operations are thread-safe. Resolving an identifier to its value does not acquire a lock.
+     *
+     * @ingroup utilities
+     */
+    template<typename T, typename Hash = std::hash<T>>
+    class InternTable final
+    {
+    public:
+        InternTable()
+        {
+            for (auto& chunk : m_chunks)
+            {
+                chunk.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        ~InternTable()
+        {
+            for (auto& chunk : m_chunks)
+            {
+                delete[] chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        InternTable(const InternTable&)            = delete;
+        InternTable& operator=(const InternTable&) = delete;
+
+        /**
+         * Get the identifier of a value, adding the value to the table if it is not yet contained.
+         *
+         * @param[in] value - The value to intern.
+         * @returns The identifier of the value.
+         */
+        u32 intern(const T& value)
+        {
+            {
+                std::shared_lock lock(m_mutex);
+                if (const auto it = m_ids.find(value); it != m_ids.end())
+                {
+                    return it->second;
+                }
+            }
+
+            std::unique_lock lock(m_mutex);
+            const auto id           = m_size.load(std::memory_order_relaxed);
+            const auto [it, is_new] = m_ids.emplace(value, id);
+            if (!is_new)
+            {
+                return it->second;
+            }
+
+            const auto [chunk_index, offset] = locate(id);
+            auto* chunk                      = m_chunks[chunk_index].load(std::memory_order_relaxed);
+            if (chunk == nullptr)
+            {
+                chunk = new const T*[chunk_size(chunk_index)];
+                m_chunks[chunk_index].store(chunk, std::memory_order_release);
+            }
+            chunk[offset] = &it->first;
+            m_size.store(id + 1, std::memory_order_release);
+
+            return id;
+        }
+
+        /**
+         * Get the identifier of a value without adding the value to the table.
+         *
+         * @param[in] value - The value to look up.
+         * @returns The identifier of the value if it is contained in the table, an empty optional otherwise.
+         */
+        std::optional<u32> find(const T& value) const
+        {
+            std::shared_lock lock(m_mutex);
+            if (const auto it = m_ids.find(value); it != m_ids.end())
+            {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Get the value that belongs to an identifier.
+         * \warning The identifier must have been returned by `intern` of the same table.
+         *
+         * @param[in] id - The identifier.
+         * @returns The interned value.
+         */
+        const T& get(u32 id) const
+        {
+            const auto [chunk_index, offset] = locate(id);
+            return *m_chunks[chunk_index].load(std::memory_order_acquire)[offset];
+        }
+
+        /**
+         * Remove all values from the table and release its memory.
+         * \warning All identifiers previously returned by the table become invalid. Must not be called concurrently with any other operation on the table.
+         */
+        void clear()
+        {
+            std::unique_lock lock(m_mutex);
+            for (auto& chunk : m_chunks)
+            {
+                delete[] chunk.exchange(nullptr, std::memory_order_relaxed);
+            }
+            std::unordered_map<T, u32, Hash>().swap(m_ids);
+            m_size.store(0, std::memory_order_release);
+        }
+
+        /**
+         * Get the number of distinct values in the table.
+         *
+         * @returns The number of values.
+         */
+        u32 size() const
+        {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+    private:
+        /*
+         * Values are referenced from chunks of geometrically growing size, i.e., chunk k holds 2^(k + base_bits) entries.
+         * Chunks are never moved once allocated, which allows `get` to resolve identifiers without synchronizing with concurrent insertions.
+         * The map nodes of `m_ids` are stable as well, so the chunks simply point to the keys of the map.
+         */
+        static constexpr u32 base_bits  = 6;
+        static constexpr u32 num_chunks = 32 - base_bits + 1;
+
+        static u64 chunk_size(u32 chunk_index)
+        {
+            return u64(1) << (chunk_index + base_bits);
+        }
+
+        static std::pair<u32, u64> locate(u32 id)
+        {
+            const u64 biased = (u64(id) >> base_bits) + 1;
+            const u32 index  = 63 - __builtin_clzll(biased);
+            return {index, u64(id) - ((u64(1) << (index + base_bits)) - (u64(1) << base_bits))};
+        }
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<T, u32, Hash> m_ids;
+        std::array<std::atomic<const T**>, num_chunks> m_chunks;
+        std::atomic<u32> m_size{0};
+    };
+}    // namespace hal
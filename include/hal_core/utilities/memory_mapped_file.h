@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "hal_core/utilities/result.h"
+
+#include <filesystem>
+#include <string_view>
+
+namespace hal
+{
+    /**
+     * A read-only view of the contents of a file that is mapped into memory.<br>
+     * The contents remain valid until the file is unmapped or the object is destroyed.
+     *
+     * @ingroup utilities
+     */
+    class CORE_API MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /**
+         * Map a file into memory, unmapping any previously mapped file.
+         *
+         * @param[in] file_path - The path to the file.
+         * @returns Ok on success, an error otherwise.
+         */
+        Result<std::monostate> map(const std::filesystem::path& file_path);
+
+        /**
+         * Unmap the file. Views into its contents become invalid.
+         */
+        void unmap();
+
+        /**
+         * Get the contents of the mapped file.
+         *
+         * @returns The contents of the file, or an empty view if no file is mapped.
+         */
+        std::string_view get_data() const;
+
+    private:
+        const char* m_data = nullptr;
+        u64 m_size         = 0;
+    };
+}    // namespace hal
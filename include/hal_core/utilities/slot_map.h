@@ -0,0 +1,390 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Owning storage for netlist objects that keeps objects in slots of large, never moving chunks instead of allocating each object on its own.
+     * Live objects are additionally kept in a contiguous vector for iteration and can optionally be registered under a 32-bit ID for lookup.
+     * Insertion, removal, lookup by ID, and membership checks take constant time.
+     *
+     * Slots of destroyed objects are reused for later insertions. Every slot carries a generation counter that is incremented whenever an object is added to or removed from it, an odd generation marks a contained object.
+     * Membership checks only inspect the slot a pointer falls into and never dereference the pointer, hence they are safe for pointers to removed objects or objects owned by other containers.
+     * Since objects are handed out as plain pointers that do not carry a generation, a pointer to a removed object is reported as contained again as soon as its slot is reused by a new object.
+     * Hence, pointers to removed objects must not be kept to identify objects later on, the ID has to be used instead.
+     *
+     * @ingroup utilities
+     */
+    template<typename T>
+    class SlotMap final
+    {
+    public:
+        SlotMap()
+        {
+            m_chunks.fill(nullptr);
+        }
+
+        ~SlotMap()
+        {
+            clear();
+            for (Slot* chunk : m_chunks)
+            {
+                ::operator delete(chunk, std::align_val_t(granule_bytes));
+            }
+        }
+
+        SlotMap(const SlotMap&)            = delete;
+        SlotMap& operator=(const SlotMap&) = delete;
+
+        /**
+         * Construct a new object in a free slot.
+         * The object is constructed by calling `construct` with a pointer to uninitialized memory suitable for a `T`, which allows the caller to use constructors that are only accessible to itself.
+         *
+         * @param[in] construct - A function constructing the object in the given memory using placement new and returning the constructed object.
+         * @returns The constructed object.
+         */
+        template<typename F>
+        T* emplace(F&& construct)
+        {
+            Slot* slot = acquire_slot();
+            T* object  = construct(static_cast<void*>(slot->storage));
+            slot->generation++;
+            slot->dense_index = m_objects.size();
+            m_objects.push_back(object);
+            return object;
+        }
+
+        /**
+         * Construct a new object in a free slot and register it under the given ID.
+         * \warning The ID must not be registered for another object.
+         *
+         * @param[in] id - The ID of the object.
+         * @param[in] construct - A function constructing the object in the given memory using placement new and returning the constructed object.
+         * @returns The constructed object.
+         */
+        template<typename F>
+        T* emplace(u32 id, F&& construct)
+        {
+            T* object    = emplace(std::forward<F>(construct));
+            Slot* slot   = slot_of(object);
+            slot->id     = id;
+            slot->has_id = true;
+
+            // IDs are usually dense, hence a vector indexed by ID is used as long as it stays reasonably filled
+            if (id < m_by_id.size() || id <= 2 * m_objects.size() + dense_id_slack)
+            {
+                if (id >= m_by_id.size())
+                {
+                    m_by_id.resize(id + 1, nullptr);
+                }
+                m_by_id[id] = object;
+            }
+            else
+            {
+                m_sparse_by_id[id] = object;
+            }
+            return object;
+        }
+
+        /**
+         * Remove an object from the slot map without destroying it.
+         * Afterwards, the object is neither contained nor registered under its ID, but remains valid until it is destroyed using `destroy`.
+         * \warning The object must be contained in the slot map.
+         *
+         * @param[in] object - The object to remove.
+         */
+        void detach(T* object)
+        {
+            assert(contains(object));
+            Slot* slot = slot_of(object);
+
+            if (slot->has_id)
+            {
+                if (slot->id < m_by_id.size() && m_by_id[slot->id] == object)
+                {
+                    m_by_id[slot->id] = nullptr;
+                }
+                else
+                {
+                    m_sparse_by_id.erase(slot->id);
+                }
+                slot->has_id = false;
+            }
+
+            // swap with the last object to keep the objects contiguous
+            T* last                      = m_objects.back();
+            m_objects[slot->dense_index] = last;
+            slot_of(last)->dense_index   = slot->dense_index;
+            m_objects.pop_back();
+
+            slot->generation++;
+        }
+
+        /**
+         * Destroy an object that has been removed using `detach` and release its slot for reuse.
+         *
+         * @param[in] object - The object to destroy.
+         */
+        void destroy(T* object)
+        {
+            u32 index  = invalid_index;
+            Slot* slot = find_slot(object, &index);
+            assert(slot != nullptr && (slot->generation & 1) == 0);
+
+            object->~T();
+            slot->dense_index = m_free_head;
+            m_free_head       = index;
+        }
+
+        /**
+         * Remove and destroy an object and release its slot for reuse.
+         * \warning The object must be contained in the slot map.
+         *
+         * @param[in] object - The object to destroy.
+         */
+        void erase(T* object)
+        {
+            detach(object);
+            destroy(object);
+        }
+
+        /**
+         * Destroy all objects.
+         * Allocated chunks are kept for reuse.
+         */
+        void clear()
+        {
+            for (T* object : m_objects)
+            {
+                Slot* slot = slot_of(object);
+                object->~T();
+                slot->generation++;
+                slot->has_id = false;
+            }
+            m_objects.clear();
+            m_by_id.clear();
+            m_sparse_by_id.clear();
+
+            // rebuild the free list over all allocated slots
+            m_free_head = invalid_index;
+            for (u32 i = m_num_slots; i > 0; i--)
+            {
+                Slot* slot        = get_slot(i - 1);
+                slot->dense_index = m_free_head;
+                m_free_head       = i - 1;
+            }
+        }
+
+        /**
+         * Check whether an object is contained in the slot map.
+         * The pointer is never dereferenced.
+         *
+         * @param[in] object - The object to check.
+         * @returns `true` if the object is contained, `false` otherwise.
+         */
+        bool contains(const T* object) const
+        {
+            const Slot* slot = find_slot(object);
+            return slot != nullptr && (slot->generation & 1) != 0;
+        }
+
+        /**
+         * Get the object registered under the given ID.
+         *
+         * @param[in] id - The ID.
+         * @returns The object on success, a `nullptr` otherwise.
+         */
+        T* get(u32 id) const
+        {
+            if (id < m_by_id.size() && m_by_id[id] != nullptr)
+            {
+                return m_by_id[id];
+            }
+            if (!m_sparse_by_id.empty())
+            {
+                if (const auto it = m_sparse_by_id.find(id); it != m_sparse_by_id.end())
+                {
+                    return it->second;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * Get all objects as a contiguous vector.
+         * The order of the objects changes when objects are removed.
+         *
+         * @returns A vector of objects.
+         */
+        const std::vector<T*>& objects() const
+        {
+            return m_objects;
+        }
+
+        /**
+         * Get the number of objects.
+         *
+         * @returns The number of objects.
+         */
+        u32 size() const
+        {
+            return m_objects.size();
+        }
+
+    private:
+        struct Slot
+        {
+            alignas(T) unsigned char storage[sizeof(T)];
+            u32 generation = 0;
+            u32 id         = 0;
+            /* position in `m_objects` for live objects, next free slot otherwise */
+            u32 dense_index = 0;
+            bool has_id     = false;
+        };
+
+        /*
+         * Chunk k holds 2^(k + base_bits) slots, so a slot index is resolved to its chunk without a search.
+         * Every chunk is aligned to `granule_bytes`, which is at least the size of the smallest chunk, so no two chunks share a granule and the chunk an address falls into is found by a single lookup of its granule.
+         */
+        static constexpr u32 base_bits      = 6;
+        static constexpr u32 num_chunks     = 32 - base_bits + 1;
+        static constexpr u32 invalid_index  = ~u32(0);
+        static constexpr u64 dense_id_slack = 1024;
+
+        static constexpr std::size_t granule_bytes = [] {
+            std::size_t bytes = alignof(Slot);
+            while (bytes < (std::size_t(1) << base_bits) * sizeof(Slot))
+            {
+                bytes <<= 1;
+            }
+            return bytes;
+        }();
+
+        static u64 chunk_size(u32 chunk_index)
+        {
+            return u64(1) << (chunk_index + base_bits);
+        }
+
+        static u64 chunk_begin(u32 chunk_index)
+        {
+            return (u64(1) << (chunk_index + base_bits)) - (u64(1) << base_bits);
+        }
+
+        static std::pair<u32, u64> locate(u32 index)
+        {
+            const u64 biased = (u64(index) >> base_bits) + 1;
+            const u32 chunk  = 63 - __builtin_clzll(biased);
+            return {chunk, u64(index) - chunk_begin(chunk)};
+        }
+
+        Slot* get_slot(u32 index) const
+        {
+            const auto [chunk, offset] = locate(index);
+            return &m_chunks[chunk][offset];
+        }
+
+        static Slot* slot_of(T* object)
+        {
+            return reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(object) - offsetof(Slot, storage));
+        }
+
+        Slot* find_slot(const T* object, u32* index = nullptr) const
+        {
+            if (object == nullptr)
+            {
+                return nullptr;
+            }
+
+            const auto address = reinterpret_cast<std::uintptr_t>(object);
+            const auto it      = m_granules.find(address / granule_bytes);
+            if (it == m_granules.end())
+            {
+                return nullptr;
+            }
+
+            const u32 chunk   = it->second;
+            const auto offset = address - reinterpret_cast<std::uintptr_t>(m_chunks[chunk]);
+            if (offset >= chunk_size(chunk) * sizeof(Slot) || offset % sizeof(Slot) != 0)
+            {
+                return nullptr;
+            }
+            if (index != nullptr)
+            {
+                *index = chunk_begin(chunk) + offset / sizeof(Slot);
+            }
+            return &m_chunks[chunk][offset / sizeof(Slot)];
+        }
+
+        Slot* acquire_slot()
+        {
+            if (m_free_head != invalid_index)
+            {
+                Slot* slot  = get_slot(m_free_head);
+                m_free_head = slot->dense_index;
+                return slot;
+            }
+
+            const auto [chunk, offset] = locate(m_num_slots);
+            if (m_chunks[chunk] == nullptr)
+            {
+                const std::size_t bytes = chunk_size(chunk) * sizeof(Slot);
+                m_chunks[chunk]         = static_cast<Slot*>(::operator new(bytes, std::align_val_t(granule_bytes)));
+                for (u64 i = 0; i < chunk_size(chunk); i++)
+                {
+                    new (&m_chunks[chunk][i]) Slot();
+                }
+
+                const auto first = reinterpret_cast<std::uintptr_t>(m_chunks[chunk]) / granule_bytes;
+                const auto last  = (reinterpret_cast<std::uintptr_t>(m_chunks[chunk]) + bytes - 1) / granule_bytes;
+                for (std::uintptr_t granule = first; granule <= last; granule++)
+                {
+                    m_granules[granule] = chunk;
+                }
+            }
+            m_num_slots++;
+            return &m_chunks[chunk][offset];
+        }
+
+        std::array<Slot*, num_chunks> m_chunks;
+        std::unordered_map<std::uintptr_t, u32> m_granules;
+        u32 m_num_slots = 0;
+        u32 m_free_head = invalid_index;
+        std::vector<T*> m_objects;
+        std::vector<T*> m_by_id;
+        std::unordered_map<u32, T*> m_sparse_by_id;
+    };
+}    // namespace hal
@@ -29,10 +29,30 @@
 
 #include <algorithm>
 #include <map>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace hal
 {
+    /**
+     * The string type used for strings that are assembled from tokens, e.g., when joining tokens or creating error messages.<br>
+     * Tokens that are views into a buffer are assembled into owning strings.
+     * 
+     * @ingroup utilities
+     */
+    template<typename T>
+    struct TokenOwnedString
+    {
+        using type = T;
+    };
+
+    template<>
+    struct TokenOwnedString<std::string_view>
+    {
+        using type = std::string;
+    };
+
     /**
      * A token holds a string and a line number and may, for example, be used during parsing of input files.
      * 
@@ -125,6 +145,8 @@ namespace hal
     class NETLIST_API TokenStream
     {
     public:
+        using owned_string_t = typename TokenOwnedString<T>::type;
+
         /**
          * The exception that is raised on any kind of error that occurs while working on the tokens of the stream.
          */
@@ -133,7 +155,7 @@ namespace hal
             /**
              * The message that is displayed to the user.
              */
-            T message;
+            owned_string_t message;
 
             /**
              * The affected line number.
@@ -233,7 +255,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but reached the end of the stream", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' but reached the end of the stream", get_current_line_number()});
                 }
                 return false;
             }
@@ -242,7 +264,7 @@ namespace hal
             {
                 if (throw_on_error)
                 {
-                    throw TokenStreamException({"expected Token '" + expected + "' but got '" + at(m_pos).string + "'", get_current_line_number()});
+                    throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' but got '" + owned_string_t(at(m_pos).string) + "'", get_current_line_number()});
                 }
                 return false;
             }
@@ -268,7 +290,7 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' not found", get_current_line_number()});
             }
             m_pos = std::min(size(), found);
             return at(m_pos - 1);
@@ -310,7 +332,7 @@ namespace hal
             auto found = find_next(expected, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"expected Token '" + expected + "' not found", get_current_line_number()});
+                throw TokenStreamException({"expected Token '" + owned_string_t(expected) + "' not found", get_current_line_number()});
             }
             auto end_pos = std::min(size(), found);
             TokenStream res(m_increase_level_tokens, m_decrease_level_tokens);
@@ -335,23 +357,23 @@ namespace hal
          * @param[in] throw_on_error - If true, throws an TokenStreamException instead of returning false on error.
          * @returns The joined token.
          */
-        Token<T> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
+        Token<owned_string_t> join_until(const T& match, const T& joiner, u32 end = END_OF_STREAM, bool level_aware = true, bool throw_on_error = false)
         {
             u32 start_line = get_current_line_number();
             auto found     = find_next(match, end, level_aware);
             if (found > size() && throw_on_error)
             {
-                throw TokenStreamException({"match Token '" + match + "' not found", start_line});
+                throw TokenStreamException({"match Token '" + owned_string_t(match) + "' not found", start_line});
             }
             auto end_pos = std::min(size(), found);
-            T result;
+            owned_string_t result;
             while (m_pos < end_pos && remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
@@ -364,17 +386,17 @@ namespace hal
          * @param[in] joiner - The string used to join consumed tokens.
          * @returns The joined token.
          */
-        Token<T> join(const T& joiner)
+        Token<owned_string_t> join(const T& joiner)
         {
             u32 start_line = get_current_line_number();
-            T result;
+            owned_string_t result;
             while (remaining() > 0)
             {
                 if (!result.empty())
                 {
                     result += joiner;
                 }
-                result += consume();
+                result += consume().string;
             }
             return {start_line, result};
         }
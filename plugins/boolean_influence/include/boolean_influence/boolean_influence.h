@@ -20,6 +20,7 @@ namespace hal
     {
         /**
          * Generates the Boolean influence of each input variable of a Boolean function.
+         * The function is compiled into a bit-parallel program that is evaluated in-process on all available cores.
          *
          * @param[in] bf - The Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
@@ -72,9 +73,20 @@ namespace hal
          */
         Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& e);
 
+        /**
+         * Generates the Boolean influence of each input variable of a Boolean function by translating it to C code that is compiled with an external g++ and executed for every variable.
+         * This was the default before Boolean functions could be evaluated in-process and is mainly kept as a reference and for expressions that cannot be compiled otherwise.
+         *
+         * @param[in] e - The z3 expression representing a Boolean function.
+         * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
+         * @param[in] deterministic - Set `true` to evaluate all input assignments instead of sampling, `false` otherwise.
+         * @returns A map from the variables that appear in the function to their Boolean influence on said function on success, an error otherwise.
+         */
+        Result<std::unordered_map<std::string, double>> get_boolean_influence_with_external_compiler(const z3::expr& e, const u32 num_evaluations = 32000, const bool deterministic = false);
+
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -85,7 +97,7 @@ namespace hal
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @param[in] num_evaluations - The amount of evaluations that are performed for each input variable.
@@ -95,7 +107,7 @@ namespace hal
 
         /**
          * Generates the function of the net using only the given gates.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
          *
          * @param[in] gates - The gates of the subcircuit.
          * @param[in] start_net - The output net of the subcircuit at which to start the analysis.
@@ -105,7 +117,7 @@ namespace hal
 
         /**
          * Generates the function of the dataport net of the given flip-flop.
-         * Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+         * Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
          *
          * @param[in] gate - Pointer to the flip-flop which data input net is used to build the Boolean function.
          * @returns A map from the nets that appear in the function of the data net to their Boolean influence on said function on success, an error otherwise.
@@ -114,6 +126,7 @@ namespace hal
 
         /**
          * Get the FF dependency matrix of a netlist.
+         * The Boolean influences of the flip-flops are computed in parallel.
          *
          * @param[in] netlist - The netlist to extract the dependency matrix from.
          * @param[in] with_boolean_influence - True -- set Boolean influence, False -- sets 1.0 if connection between FFs
@@ -96,8 +96,8 @@ namespace hal
             py::arg("bf"),
             py::arg("num_evaluations") = 32000,
             R"(
-            Generates the Boolean influence of each input variable of a Boolean function using the internal HAL functions only
-            The function is slower, but can be better used in multithreading enviroment.
+            Generates the Boolean influence of each input variable of a Boolean function.
+            The function is compiled into a bit-parallel program that is evaluated in-process on all available cores.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The amount of evaluations that are performed for each input variable.
@@ -122,8 +122,8 @@ namespace hal
             py::arg("bf"),
             py::arg("num_evaluations") = 32000,
             R"(
-            The Boolean function gets translated to a z3::expr and afterwards efficient c code.
-            The program is compiled and executed many times to measure the Boolean influence of each input variable.
+            Generates the Boolean influence of each input variable of a Boolean function using the internal HAL functions only.
+            The function is evaluated on the calling thread, hence it can be better used in multithreading environment.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :param int num_evaluations: The amount of evaluations that are performed for each input variable.
@@ -176,7 +176,7 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Generates the function of the net using only the given gates.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
 
             :param list[hal_py.Gate] gates: The gates of the subcircuit.
             :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -203,7 +203,7 @@ namespace hal
             py::arg("num_evaluations") = 32000,
             R"(
             Generates the function of the dataport net of the given flip-flop.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
 
             :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
             :param int num_evaluations: The amount of evaluations that are performed for each input variable.
@@ -227,8 +227,8 @@ namespace hal
             },
             py::arg("bf"),
             R"(
-            The Boolean function gets translated to a z3::expr and afterwards efficient c code.
-            The program is compiled and executed exactly once for every possible input mapping to accurately determine the boolean influence of each variable.
+            The Boolean function gets compiled into a bit-parallel program.
+            The program is evaluated in-process exactly once for every possible input mapping to accurately determine the boolean influence of each variable.
 
             :param hal_py.BooleanFunction bf: The Boolean function.
             :returns: A dict from the variables that appear in the function to their Boolean influence on said function on success, None otherwise.
@@ -253,7 +253,7 @@ namespace hal
             py::arg("start_net"),
             R"(
             Generates the function of the net using only the given gates.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
 
             :param list[hal_py.Gate] gates: The gates of the subcircuit.
             :param hal_py.Net start_net: The output net of the subcircuit at which to start the analysis.
@@ -278,7 +278,7 @@ namespace hal
             py::arg("gate"),
             R"(
             Generates the function of the dataport net of the given flip-flop.
-            Afterwards the generated function gets translated from a z3::expr to efficient c code, compiled, executed and evaluated.
+            Afterwards the generated function gets compiled into a bit-parallel program and evaluated in-process on all available cores.
 
             :param hal_py.Gate gate: The flip-flop which data input net is used to build the boolean function.
             :returns: A dict from the nets that appear in the function of the data net to their Boolean influence on said function on success, None otherwise.
@@ -1,6 +1,8 @@
 #include "boolean_influence/boolean_influence.h"
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+#include "hal_core/netlist/boolean_function/expression_store.h"
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/netlist/decorators/netlist_traversal_decorator.h"
 #include "hal_core/netlist/gate.h"
@@ -9,8 +11,11 @@
 #include "z3_utils/subgraph_function_generation.h"
 #include "z3_utils/z3_utils.h"
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <optional>
+#include <thread>
 
 namespace hal
 {
@@ -137,7 +142,118 @@ int main(int argc, char *argv[]) {
                 return z;
             }
 
-            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+            bool is_single_bit_predicate(const CompiledBooleanFunction& compiled)
+            {
+                const auto& sizes = compiled.get_variable_sizes();
+                return compiled.size() == 1 && std::all_of(sizes.begin(), sizes.end(), [](u16 size) { return size == 1; });
+            }
+
+            u64 count_influential_assignments(CompiledBooleanFunction& compiled, const u32 var_idx, const u32 num_evaluations, const bool deterministic)
+            {
+                const u32 num_variables = compiled.get_variables().size();
+
+                std::vector<u64> inputs(num_variables);
+                u64 count = 0;
+                u64 r1, r2;
+
+                const auto count_block = [&](const u64 valid) {
+                    // evaluate 1
+                    inputs[var_idx] = ~u64(0);
+                    compiled.evaluate(inputs.data(), &r1);
+
+                    // evaluate 0
+                    inputs[var_idx] = 0;
+                    compiled.evaluate(inputs.data(), &r2);
+
+                    count += __builtin_popcountll((r1 ^ r2) & valid);
+                };
+
+                if (deterministic)
+                {
+                    // enumerate all assignments, the lowest six variables vary across the 64 lanes and all others across blocks
+                    static const u64 lane_patterns[6] = {
+                        0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0, 0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000};
+
+                    const u64 num_assignments = u64(1) << num_variables;
+                    const u64 num_blocks      = std::max(u64(1), num_assignments / CompiledBooleanFunction::num_lanes);
+                    const u64 valid           = (num_assignments >= CompiledBooleanFunction::num_lanes) ? ~u64(0) : ((u64(1) << num_assignments) - 1);
+                    for (u64 block = 0; block < num_blocks; block++)
+                    {
+                        for (u32 bit = 0; bit < num_variables; bit++)
+                        {
+                            inputs[bit] = (bit < 6) ? lane_patterns[bit] : (((block >> (bit - 6)) & 1) ? ~u64(0) : u64(0));
+                        }
+                        count_block(valid);
+                    }
+                }
+                else
+                {
+                    // every variable restarts the random sequence, hence the result does not depend on the order of evaluation
+                    u64 x = 123456789, y = 362436069, z = 521288629;
+
+                    // every evaluation of the compiled function processes 64 random input assignments at once
+                    for (u32 i = 0; i < num_evaluations; i += CompiledBooleanFunction::num_lanes)
+                    {
+                        for (auto& input : inputs)
+                        {
+                            input = xorshf96(x, y, z);
+                        }
+
+                        const u32 num_valid = std::min(num_evaluations - i, CompiledBooleanFunction::num_lanes);
+                        count_block((num_valid == CompiledBooleanFunction::num_lanes) ? ~u64(0) : ((u64(1) << num_valid) - 1));
+                    }
+                }
+
+                return count;
+            }
+
+            std::unordered_map<std::string, double>
+                get_boolean_influence_compiled(const CompiledBooleanFunction& compiled, const u32 num_evaluations, const bool deterministic, const u32 max_num_threads)
+            {
+                const auto& variables   = compiled.get_variables();
+                const u32 num_variables = variables.size();
+                const double real_evaluations = deterministic ? (double)(u64(1) << num_variables) : (double)num_evaluations;
+
+                std::vector<u64> counts(num_variables, 0);
+                std::atomic<u32> next_var_idx = 0;
+
+                // every worker operates on its own copy of the compiled function since evaluation uses its register file
+                const auto work = [&]() {
+                    CompiledBooleanFunction evaluator = compiled;
+                    for (u32 var_idx = next_var_idx++; var_idx < num_variables; var_idx = next_var_idx++)
+                    {
+                        counts[var_idx] = count_influential_assignments(evaluator, var_idx, num_evaluations, deterministic);
+                    }
+                };
+
+                const u32 num_threads = std::max(1u, std::min({max_num_threads, std::thread::hardware_concurrency(), num_variables}));
+                if (num_threads == 1)
+                {
+                    work();
+                }
+                else
+                {
+                    std::vector<std::thread> workers;
+                    for (u32 i = 0; i < num_threads; i++)
+                    {
+                        workers.emplace_back(work);
+                    }
+                    for (auto& worker : workers)
+                    {
+                        worker.join();
+                    }
+                }
+
+                std::unordered_map<std::string, double> influences;
+                for (u32 var_idx = 0; var_idx < num_variables; var_idx++)
+                {
+                    influences.insert({variables.at(var_idx), (double)(counts.at(var_idx)) / real_evaluations});
+                }
+
+                return influences;
+            }
+
+            Result<std::unordered_map<std::string, double>> get_boolean_influence_external(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
             {
                 const auto to_replacement_var = [](const u32 var_idx) -> std::string { return "var_" + std::to_string(var_idx); };
 
@@ -294,48 +410,90 @@ int main(int argc, char *argv[]) {
                 return OK(influences);
             }
 
-            Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const bool deterministic)
+            std::optional<CompiledBooleanFunction> compile_predicate(const z3::expr& expr, const std::vector<std::string>& input_vars)
             {
-                for (const auto* gate : gates)
+                ExpressionStore store;
+                if (const auto expression_res = z3_utils::to_shared_expression(expr, store); expression_res.is_ok())
                 {
-                    if (!gate->get_type()->has_property(GateTypeProperty::combinational) || gate->is_vcc_gate() || gate->is_gnd_gate())
+                    if (auto compiled_res = CompiledBooleanFunction::compile(expression_res.get(), input_vars); compiled_res.is_ok() && is_single_bit_predicate(compiled_res.get()))
                     {
-                        return ERR("unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ": sub circuit gates include gate "
-                                   + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + " that is either not a combinational gate or is a VCC / GND gate.");
+                        return compiled_res.get();
                     }
                 }
+                return std::nullopt;
+            }
 
-                // Generate function for the data port
-                auto ctx  = z3::context();
-                auto func = z3::expr(ctx);
+            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const z3::expr& expr, const u32 num_evaluations, const bool deterministic, const u32 num_threads)
+            {
+                const std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(expr));
 
-                if (!gates.empty())
+                if (input_vars.empty())
                 {
-                    const auto func_res = z3_utils::get_subgraph_z3_function(gates, start_net, ctx);
-                    if (func_res.is_error())
+                    return OK(std::unordered_map<std::string, double>());
+                }
+
+                if (deterministic && input_vars.size() > 16)
+                {
+                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got " + std::to_string(input_vars.size()));
+                }
+
+                // evaluate in-process whenever the expression can be compiled, only fall back to an external compiler otherwise
+                if (const auto compiled = compile_predicate(expr, input_vars); compiled.has_value())
+                {
+                    return OK(get_boolean_influence_compiled(compiled.value(), num_evaluations, deterministic, num_threads));
+                }
+
+                return get_boolean_influence_external(expr, num_evaluations, deterministic);
+            }
+
+            Result<std::unordered_map<std::string, double>> get_boolean_influence_internal(const BooleanFunction& bf, const u32 num_evaluations, const bool deterministic, const u32 num_threads)
+            {
+                if (deterministic && bf.get_variable_names().size() > 16)
+                {
+                    return ERR("unable to generate Boolean influence: Cannot evaluate Boolean function deterministically for more than 16 variables but got "
+                               + std::to_string(bf.get_variable_names().size()));
+                }
+
+                if (const auto compiled_res = CompiledBooleanFunction::compile(bf); compiled_res.is_ok() && is_single_bit_predicate(compiled_res.get()))
+                {
+                    return OK(get_boolean_influence_compiled(compiled_res.get(), num_evaluations, deterministic, num_threads));
+                }
+
+                auto ctx         = z3::context();
+                const auto z3_bf = z3_utils::from_bf(bf, ctx);
+
+                return get_boolean_influence_internal(z3_bf, num_evaluations, deterministic, num_threads);
+            }
+
+            Result<z3::expr> get_subcircuit_function(const std::vector<Gate*>& gates, const Net* start_net, z3::context& ctx)
+            {
+                for (const auto* gate : gates)
+                {
+                    if (!gate->get_type()->has_property(GateTypeProperty::combinational) || gate->is_vcc_gate() || gate->is_gnd_gate())
                     {
-                        return ERR_APPEND(func_res.get_error(),
-                                          "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
-                                              + ": failed to build subgraph function");
+                        return ERR("unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ": sub circuit gates include gate "
+                                   + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + " that is either not a combinational gate or is a VCC / GND gate.");
                     }
-                    func = func_res.get();
                 }
+
                 // edge case if the gates are empty
-                else
+                if (gates.empty())
                 {
-                    func = ctx.bv_const(BooleanFunctionNetDecorator(*start_net).get_boolean_variable_name().c_str(), 1);
+                    return OK(ctx.bv_const(BooleanFunctionNetDecorator(*start_net).get_boolean_variable_name().c_str(), 1));
                 }
 
-                // Generate Boolean influences
-                const auto inf_res = get_boolean_influence_internal(func, num_evaluations, deterministic);
-                if (inf_res.is_error())
+                // Generate function for the data port
+                const auto func_res = z3_utils::get_subgraph_z3_function(gates, start_net, ctx);
+                if (func_res.is_error())
                 {
-                    return ERR_APPEND(inf_res.get_error(),
-                                      "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
-                                          + ": failed to get boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ".");
+                    return ERR_APPEND(func_res.get_error(),
+                                      "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ": failed to build subgraph function");
                 }
-                const std::unordered_map<std::string, double> var_names_to_inf = inf_res.get();
+                return func_res;
+            }
 
+            Result<std::map<Net*, double>> get_net_influences(const std::unordered_map<std::string, double>& var_names_to_inf, const Net* start_net)
+            {
                 // translate net_ids back to nets
                 std::map<Net*, double> nets_to_inf;
 
@@ -357,7 +515,29 @@ int main(int argc, char *argv[]) {
                 return OK(nets_to_inf);
             }
 
-            Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic)
+            Result<std::map<Net*, double>>
+                get_boolean_influences_of_subcircuit_internal(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations, const bool deterministic, const u32 num_threads)
+            {
+                auto ctx            = z3::context();
+                const auto func_res = get_subcircuit_function(gates, start_net, ctx);
+                if (func_res.is_error())
+                {
+                    return ERR(func_res.get_error());
+                }
+
+                // Generate Boolean influences
+                const auto inf_res = get_boolean_influence_internal(func_res.get(), num_evaluations, deterministic, num_threads);
+                if (inf_res.is_error())
+                {
+                    return ERR_APPEND(inf_res.get_error(),
+                                      "unable to get Boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id())
+                                          + ": failed to get boolean influence for net " + start_net->get_name() + " with ID " + std::to_string(start_net->get_id()) + ".");
+                }
+
+                return get_net_influences(inf_res.get(), start_net);
+            }
+
+            Result<std::pair<const Net*, std::vector<Gate*>>> get_data_fan_in(const Gate* gate)
             {
                 if (!gate->get_type()->has_property(GateTypeProperty::ff))
                 {
@@ -388,10 +568,21 @@ int main(int argc, char *argv[]) {
                     return ERR_APPEND(function_gates_res.get_error(),
                                       "unable to get Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id()) + ": failed to get combinational fan-in gates.");
                 }
-                const auto function_gates = utils::to_vector(function_gates_res.get());
+
+                return OK(std::make_pair(data_net, utils::to_vector(function_gates_res.get())));
+            }
+
+            Result<std::map<Net*, double>> get_boolean_influences_of_gate_internal(const Gate* gate, const u32 num_evaluations, const bool deterministic, const u32 num_threads)
+            {
+                const auto fan_in_res = get_data_fan_in(gate);
+                if (fan_in_res.is_error())
+                {
+                    return ERR(fan_in_res.get_error());
+                }
+                const auto& [data_net, function_gates] = fan_in_res.get();
 
                 // Generate Boolean influences
-                const auto inf_res = get_boolean_influences_of_subcircuit_internal(function_gates, data_net, num_evaluations, deterministic);
+                const auto inf_res = get_boolean_influences_of_subcircuit_internal(function_gates, data_net, num_evaluations, deterministic, num_threads);
                 if (inf_res.is_error())
                 {
                     return ERR_APPEND(inf_res.get_error(),
@@ -402,56 +593,106 @@ int main(int argc, char *argv[]) {
                 return inf_res;
             }
 
+            /**
+             * The Boolean influences of the data input of a flip-flop, either already known or still to be evaluated from the compiled function.
+             */
+            struct PendingInfluences
+            {
+                const Net* data_net = nullptr;
+                std::optional<CompiledBooleanFunction> compiled;
+                Result<std::unordered_map<std::string, double>> influences = OK(std::unordered_map<std::string, double>());
+            };
+
+            PendingInfluences prepare_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations)
+            {
+                PendingInfluences pending;
+
+                const auto fan_in_res = get_data_fan_in(gate);
+                if (fan_in_res.is_error())
+                {
+                    pending.influences = ERR(fan_in_res.get_error());
+                    return pending;
+                }
+                const auto& [data_net, function_gates] = fan_in_res.get();
+                pending.data_net                       = data_net;
+
+                auto ctx            = z3::context();
+                const auto func_res = get_subcircuit_function(function_gates, data_net, ctx);
+                if (func_res.is_error())
+                {
+                    pending.influences = ERR(func_res.get_error());
+                    return pending;
+                }
+
+                const std::vector<std::string> input_vars = utils::to_vector(z3_utils::get_variable_names(func_res.get()));
+                if (input_vars.empty())
+                {
+                    return pending;
+                }
+
+                pending.compiled = compile_predicate(func_res.get(), input_vars);
+                if (!pending.compiled.has_value())
+                {
+                    pending.influences = get_boolean_influence_external(func_res.get(), num_evaluations, false);
+                }
+                return pending;
+            }
+
         }    // namespace
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence(const BooleanFunction& bf, const u32 num_evaluations)
         {
-            auto ctx         = z3::context();
-            const auto z3_bf = z3_utils::from_bf(bf, ctx);
-
-            return get_boolean_influence(z3_bf, num_evaluations);
+            return get_boolean_influence_internal(bf, num_evaluations, false, std::thread::hardware_concurrency());
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence(const z3::expr& expr, const u32 num_evaluations)
         {
-            return get_boolean_influence_internal(expr, num_evaluations, false);
+            return get_boolean_influence_internal(expr, num_evaluations, false, std::thread::hardware_concurrency());
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const BooleanFunction& bf)
         {
-            auto ctx         = z3::context();
-            const auto z3_bf = z3_utils::from_bf(bf, ctx);
-
-            return get_boolean_influence_deterministic(z3_bf);
+            return get_boolean_influence_internal(bf, 0, true, std::thread::hardware_concurrency());
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence_deterministic(const z3::expr& expr)
         {
-            return get_boolean_influence_internal(expr, 0, true);
+            return get_boolean_influence_internal(expr, 0, true, std::thread::hardware_concurrency());
+        }
+
+        Result<std::unordered_map<std::string, double>> get_boolean_influence_with_external_compiler(const z3::expr& expr, const u32 num_evaluations, const bool deterministic)
+        {
+            return get_boolean_influence_external(expr, num_evaluations, deterministic);
         }
 
         Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit(const std::vector<Gate*>& gates, const Net* start_net, const u32 num_evaluations)
         {
-            return get_boolean_influences_of_subcircuit_internal(gates, start_net, num_evaluations, false);
+            return get_boolean_influences_of_subcircuit_internal(gates, start_net, num_evaluations, false, std::thread::hardware_concurrency());
         }
 
         Result<std::map<Net*, double>> get_boolean_influences_of_gate(const Gate* gate, const u32 num_evaluations)
         {
-            return get_boolean_influences_of_gate_internal(gate, num_evaluations, false);
+            return get_boolean_influences_of_gate_internal(gate, num_evaluations, false, std::thread::hardware_concurrency());
         }
 
         Result<std::map<Net*, double>> get_boolean_influences_of_subcircuit_deterministic(const std::vector<Gate*>& gates, const Net* start_net)
         {
-            return get_boolean_influences_of_subcircuit_internal(gates, start_net, 0, true);
+            return get_boolean_influences_of_subcircuit_internal(gates, start_net, 0, true, std::thread::hardware_concurrency());
         }
 
         Result<std::map<Net*, double>> get_boolean_influences_of_gate_deterministic(const Gate* gate)
         {
-            return get_boolean_influences_of_gate_internal(gate, 0, true);
+            return get_boolean_influences_of_gate_internal(gate, 0, true, std::thread::hardware_concurrency());
         }
 
         Result<std::unordered_map<std::string, double>> get_boolean_influence_with_hal_boolean_function_class(const BooleanFunction& bf, const u32 num_evaluations)
         {
+            // use the bit-parallel evaluator whenever the function can be compiled, but stay on the calling thread
+            if (const auto compiled_res = CompiledBooleanFunction::compile(bf); compiled_res.is_ok() && is_single_bit_predicate(compiled_res.get()))
+            {
+                return OK(get_boolean_influence_compiled(compiled_res.get(), num_evaluations, false, 1));
+            }
+
             std::unordered_map<std::string, double> influences;
             std::set<std::string> variables = bf.get_variable_names();
 
@@ -589,8 +830,6 @@ int main(int argc, char *argv[]) {
             std::map<Gate*, u32> gate_to_matrix_id;
             std::vector<std::vector<double>> matrix;
 
-            std::unordered_map<const Net*, std::set<Gate*>>* cache;
-
             u32 matrix_gates = 0;
             for (const auto& gate : nl->get_gates())
             {
@@ -603,18 +842,12 @@ int main(int argc, char *argv[]) {
                 matrix_gates++;
             }
 
-            u32 status_counter = 0;
+            // collect the sequential predecessors of all flip-flops, sharing the traversal cache between them
+            std::unordered_map<const Net*, std::set<Gate*>> cache;
+            std::vector<std::set<u32>> predecessor_ids(matrix_gates);
             for (const auto& [id, gate] : matrix_id_to_gate)
             {
-                if (status_counter % 100 == 0)
-                {
-                    log_info("boolean_influence", "status {}/{} processed", status_counter, matrix_id_to_gate.size());
-                }
-                status_counter++;
-                std::vector<double> line_of_matrix;
-
-                std::set<u32> gates_to_add;
-                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, cache);
+                const auto next_seq_gates = NetlistTraversalDecorator(*nl).get_next_sequential_gates(gate, false, {}, &cache);
                 if (next_seq_gates.is_error())
                 {
                     return ERR_APPEND(next_seq_gates.get_error(),
@@ -623,12 +856,64 @@ int main(int argc, char *argv[]) {
                 }
                 for (const auto& pred_gate : next_seq_gates.get())
                 {
-                    gates_to_add.insert(gate_to_matrix_id[pred_gate]);
+                    predecessor_ids[id].insert(gate_to_matrix_id[pred_gate]);
+                }
+            }
+
+            // the subgraph functions are built on the calling thread since they read from the netlist and its caches, only their compiled evaluation runs in parallel
+            const u32 num_evaluations = 32000;
+            std::vector<PendingInfluences> influences;
+            if (with_boolean_influence)
+            {
+                influences.reserve(matrix_gates);
+                for (const auto& [id, gate] : matrix_id_to_gate)
+                {
+                    influences.push_back(prepare_boolean_influences_of_gate(gate, num_evaluations));
+                    if (id % 100 == 0)
+                    {
+                        log_info("boolean_influence", "status {}/{} functions built", id, matrix_gates);
+                    }
+                }
+
+                std::atomic<u32> next_id = 0;
+                const auto work          = [&]() {
+                    for (u32 id = next_id++; id < matrix_gates; id = next_id++)
+                    {
+                        if (auto& pending = influences[id]; pending.compiled.has_value())
+                        {
+                            pending.influences = OK(get_boolean_influence_compiled(pending.compiled.value(), num_evaluations, false, 1));
+                        }
+                    }
+                };
+
+                const u32 num_threads = std::max(1u, std::min(std::thread::hardware_concurrency(), matrix_gates));
+                std::vector<std::thread> workers;
+                for (u32 i = 0; i < num_threads; i++)
+                {
+                    workers.emplace_back(work);
+                }
+                for (auto& worker : workers)
+                {
+                    worker.join();
                 }
+            }
+
+            for (const auto& [id, gate] : matrix_id_to_gate)
+            {
+                std::vector<double> line_of_matrix;
+
+                const std::set<u32>& gates_to_add = predecessor_ids.at(id);
                 std::map<Net*, double> boolean_influence_for_gate;
                 if (with_boolean_influence)
                 {
-                    const auto inf_res = get_boolean_influences_of_gate(gate);
+                    const auto& pending = influences.at(id);
+                    if (pending.influences.is_error())
+                    {
+                        return ERR_APPEND(pending.influences.get_error(),
+                                          "unable to generate ff dependency matrix: failed to generate Boolean influence for gate " + gate->get_name() + " with ID " + std::to_string(gate->get_id())
+                                              + ".");
+                    }
+                    const auto inf_res = get_net_influences(pending.influences.get(), pending.data_net);
                     if (inf_res.is_error())
                     {
                         return ERR_APPEND(inf_res.get_error(),
@@ -0,0 +1,180 @@
+#include "boolean_influence/boolean_influence.h"
+
+#include "gate_library_test_utils.h"
+#include "hal_core/netlist/boolean_function.h"
+#include "netlist_test_utils.h"
+
+#include <chrono>
+
+namespace hal
+{
+
+    class BooleanInfluenceTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            test_utils::create_sandbox_directory();
+        }
+
+        virtual void TearDown()
+        {
+            test_utils::remove_sandbox_directory();
+        }
+    };
+
+    TEST_F(BooleanInfluenceTest, check_boolean_influence)
+    {
+        TEST_START
+        {
+            const auto a = BooleanFunction::Var("A"), b = BooleanFunction::Var("B"), c = BooleanFunction::Var("C");
+
+            // exact influences of (A & B) | C are 1/4, 1/4 and 3/4
+            const auto bf = (a & b) | c;
+            const std::unordered_map<std::string, double> expected = {{"A", 0.25}, {"B", 0.25}, {"C", 0.75}};
+
+            auto ctx          = z3::context();
+            const auto z3_bf  = z3_utils::from_bf(bf, ctx);
+
+            const auto det_bf_res = boolean_influence::get_boolean_influence_deterministic(bf);
+            ASSERT_TRUE(det_bf_res.is_ok());
+            EXPECT_EQ(det_bf_res.get(), expected);
+
+            const auto det_z3_res = boolean_influence::get_boolean_influence_deterministic(z3_bf);
+            ASSERT_TRUE(det_z3_res.is_ok());
+            EXPECT_EQ(det_z3_res.get(), expected);
+
+            const auto bf_res = boolean_influence::get_boolean_influence(bf);
+            ASSERT_TRUE(bf_res.is_ok());
+            const auto z3_res = boolean_influence::get_boolean_influence(z3_bf);
+            ASSERT_TRUE(z3_res.is_ok());
+            const auto hal_res = boolean_influence::get_boolean_influence_with_hal_boolean_function_class(bf, 32000);
+            ASSERT_TRUE(hal_res.is_ok());
+            for (const auto& [var, influence] : expected)
+            {
+                EXPECT_NEAR(bf_res.get().at(var), influence, 0.02);
+                EXPECT_NEAR(z3_res.get().at(var), influence, 0.02);
+                EXPECT_NEAR(hal_res.get().at(var), influence, 0.02);
+            }
+
+            // every variable of a parity function is fully influential
+            const auto parity_res = boolean_influence::get_boolean_influence(a ^ b ^ c ^ BooleanFunction::Var("D"), 100);
+            ASSERT_TRUE(parity_res.is_ok());
+            EXPECT_EQ(parity_res.get().size(), 4);
+            for (const auto& [var, influence] : parity_res.get())
+            {
+                EXPECT_EQ(influence, 1.0) << var;
+            }
+
+            // constant functions have no variables
+            const auto const_res = boolean_influence::get_boolean_influence(BooleanFunction::Const(1, 1));
+            ASSERT_TRUE(const_res.is_ok());
+            EXPECT_TRUE(const_res.get().empty());
+        }
+        TEST_END
+    }
+
+    TEST_F(BooleanInfluenceTest, check_ff_dependency_matrix)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_empty_netlist();
+            const auto* gl = nl->get_gate_library();
+
+            Gate* ff0  = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff0");
+            Gate* ff1  = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff1");
+            Gate* ff2  = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff2");
+            Gate* and0 = nl->create_gate(gl->get_gate_type_by_name("AND2"), "and0");
+            Gate* or0  = nl->create_gate(gl->get_gate_type_by_name("OR2"), "or0");
+
+            test_utils::connect_global_in(nl.get(), ff0, "D", "in_0");
+            test_utils::connect_global_in(nl.get(), ff1, "D", "in_1");
+            Net* q0 = test_utils::connect(nl.get(), ff0, "Q", and0, "I0", "q_0");
+            Net* q1 = test_utils::connect(nl.get(), ff1, "Q", and0, "I1", "q_1");
+            test_utils::connect(nl.get(), and0, "O", or0, "I0", "and_0");
+            Net* q2 = test_utils::connect(nl.get(), ff2, "Q", or0, "I1", "q_2");
+            test_utils::connect(nl.get(), or0, "O", ff2, "D", "d_2");
+
+            // ff2 stores (ff0 & ff1) | ff2
+            const auto inf_res = boolean_influence::get_boolean_influences_of_gate_deterministic(ff2);
+            ASSERT_TRUE(inf_res.is_ok());
+            EXPECT_EQ(inf_res.get(), (std::map<Net*, double>({{q0, 0.25}, {q1, 0.25}, {q2, 0.75}})));
+
+            const auto matrix_res = boolean_influence::get_ff_dependency_matrix(nl.get(), true);
+            ASSERT_TRUE(matrix_res.is_ok());
+            const auto& [matrix_id_to_gate, matrix] = matrix_res.get();
+            ASSERT_EQ(matrix_id_to_gate.size(), 3);
+            ASSERT_EQ(matrix.size(), 3);
+
+            std::map<Gate*, u32> gate_to_matrix_id;
+            for (const auto& [id, gate] : matrix_id_to_gate)
+            {
+                gate_to_matrix_id[gate] = id;
+            }
+
+            const auto& row = matrix.at(gate_to_matrix_id.at(ff2));
+            EXPECT_NEAR(row.at(gate_to_matrix_id.at(ff0)), 0.25, 0.02);
+            EXPECT_NEAR(row.at(gate_to_matrix_id.at(ff1)), 0.25, 0.02);
+            EXPECT_NEAR(row.at(gate_to_matrix_id.at(ff2)), 0.75, 0.02);
+            EXPECT_EQ(matrix.at(gate_to_matrix_id.at(ff0)), std::vector<double>(3, 0.0));
+            EXPECT_EQ(matrix.at(gate_to_matrix_id.at(ff1)), std::vector<double>(3, 0.0));
+        }
+        TEST_END
+    }
+
+    TEST_F(BooleanInfluenceTest, DISABLED_benchmark_external_compiler)
+    {
+        TEST_START
+        {
+            if (std::system("g++ --version > /dev/null 2>&1") != 0)
+            {
+                GTEST_SKIP() << "no external compiler available";
+            }
+
+            // a 24-input cone of alternating XOR and AND-OR layers
+            std::vector<BooleanFunction> layer;
+            for (u32 i = 0; i < 24; i++)
+            {
+                layer.push_back(BooleanFunction::Var("I" + std::to_string(i)));
+            }
+            for (u32 depth = 0; layer.size() > 1; depth++)
+            {
+                std::vector<BooleanFunction> next;
+                for (u32 i = 0; i + 1 < layer.size(); i += 2)
+                {
+                    next.push_back((depth % 2 == 0) ? (layer[i] ^ layer[i + 1]) : ((layer[i] & layer[i + 1]) | ~layer[(i + 2) % layer.size()]));
+                }
+                if (layer.size() % 2 == 1)
+                {
+                    next.push_back(layer.back());
+                }
+                layer = next;
+            }
+
+            auto ctx         = z3::context();
+            const auto z3_bf = z3_utils::from_bf(layer.front(), ctx);
+
+            auto begin_time   = std::chrono::steady_clock::now();
+            const auto in_res = boolean_influence::get_boolean_influence(z3_bf, 320000);
+            const auto in_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_time).count();
+            ASSERT_TRUE(in_res.is_ok());
+
+            begin_time         = std::chrono::steady_clock::now();
+            const auto ext_res = boolean_influence::get_boolean_influence_with_external_compiler(z3_bf, 320000);
+            const auto ext_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_time).count();
+            ASSERT_TRUE(ext_res.is_ok());
+
+            ASSERT_EQ(in_res.get().size(), ext_res.get().size());
+            for (const auto& [var, influence] : ext_res.get())
+            {
+                EXPECT_NEAR(in_res.get().at(var), influence, 0.01) << var;
+            }
+
+            RecordProperty("in_process_ms", std::to_string(in_ms));
+            RecordProperty("external_compiler_ms", std::to_string(ext_ms));
+        }
+        TEST_END
+    }
+}    // namespace hal
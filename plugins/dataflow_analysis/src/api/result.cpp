@@ -441,8 +441,9 @@ namespace hal
             }
             log_info("dataflow", "successfully deleted old DANA modules");
 
-            // create new modules and try to keep hierarchy if possible
+            // create new modules and try to keep hierarchy if possible, defer net checks until all modules have been created
             std::unordered_map<u32, Module*> group_to_module;
+            nl->begin_batch();
             for (const auto& [group_id, group] : this->get_groups())
             {
                 if (!group_ids.empty() && group_ids.find(group_id) == group_ids.end())
@@ -495,7 +496,16 @@ namespace hal
 
                 auto* new_mod             = nl->create_module("DANA_" + suffix + "_" + std::to_string(group_id), reference_module, gates);
                 group_to_module[group_id] = new_mod;
+            }
 
+            if (!nl->commit_batch())
+            {
+                return ERR("could not create modules for dataflow groups: failed to update module nets and pins");
+            }
+
+            // name pins and pin groups of the new modules
+            for (const auto& [group_id, new_mod] : group_to_module)
+            {
                 std::map<const std::pair<PinDirection, std::string>, PinGroup<ModulePin>*> pin_groups;
                 for (auto* pin : new_mod->get_pins())
                 {
@@ -4,6 +4,7 @@
 #include "hal_core/netlist/gate.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_csr.h"
 
 namespace hal
 {
@@ -41,38 +42,36 @@ namespace hal
 
             auto graph = std::unique_ptr<NetlistGraph>(new NetlistGraph(nl));
 
+            // the connectivity snapshot assigns dense indices to gates and nets that are used as vertices
+            const auto csr = nl->get_csr();
+
             // count all edges as this number is needed to create a new graph
             u32 edge_counter = 0;
-            for (const auto* net : graph->m_nl->get_nets(filter))
+            for (u32 net = 0; net < csr->get_num_nets(); net++)
             {
-                std::vector<Gate*> src_gates;
-                for (const auto* src_ep : net->get_sources())
+                if (filter && !filter(csr->get_net(net)))
                 {
-                    src_gates.push_back(src_ep->get_gate());
+                    continue;
                 }
 
-                std::vector<Gate*> dst_gates;
-                for (const auto* dst_ep : net->get_destinations())
-                {
-                    dst_gates.push_back(dst_ep->get_gate());
-                }
-
-                if (src_gates.empty() && create_dummy_vertices)
+                const u32 num_sources      = csr->get_sources(net).size();
+                const u32 num_destinations = csr->get_destinations(net).size();
+                if (num_sources == 0 && create_dummy_vertices)
                 {
                     // if no sources, add one dummy edge for every destination
                     // all dummy edges will come from the same dummy node
-                    edge_counter += dst_gates.size();
+                    edge_counter += num_destinations;
                 }
-                else if (dst_gates.empty() && create_dummy_vertices)
+                else if (num_destinations == 0 && create_dummy_vertices)
                 {
                     // if no destinations, add one dummy edge for every source
                     // all dummy edges will go to the same dummy node
-                    edge_counter += src_gates.size();
+                    edge_counter += num_sources;
                 }
                 else
                 {
                     // add one edge for every source-destination pair
-                    edge_counter += dst_gates.size() * src_gates.size();
+                    edge_counter += num_destinations * num_sources;
                 }
             }
 
@@ -85,60 +84,57 @@ namespace hal
             }
 
             // we need dummy gates for input/outputs
-            u32 node_counter = 0;
+            u32 node_counter = csr->get_num_gates();
             u32 edge_index   = 0;
 
-            for (auto* g : graph->m_nl->get_gates())
+            graph->m_gates_to_nodes.reserve(node_counter);
+            graph->m_nodes_to_gates.reserve(node_counter);
+            for (u32 node = 0; node < node_counter; node++)
             {
-                const u32 node                = node_counter++;
+                Gate* g                       = csr->get_gate(node);
                 graph->m_gates_to_nodes[g]    = node;
                 graph->m_nodes_to_gates[node] = g;
             }
 
-            for (const auto* net : graph->m_nl->get_nets(filter))
+            for (u32 net = 0; net < csr->get_num_nets(); net++)
             {
-                std::vector<Gate*> src_gates;
-                for (const auto* src_ep : net->get_sources())
-                {
-                    src_gates.push_back(src_ep->get_gate());
-                }
-
-                std::vector<Gate*> dst_gates;
-                for (const auto* dst_ep : net->get_destinations())
+                if (filter && !filter(csr->get_net(net)))
                 {
-                    dst_gates.push_back(dst_ep->get_gate());
+                    continue;
                 }
 
-                if (src_gates.empty() && create_dummy_vertices)
+                const auto sources      = csr->get_sources(net);
+                const auto destinations = csr->get_destinations(net);
+                if (sources.empty() && create_dummy_vertices)
                 {
                     // if no sources, add one dummy node
                     const u32 dummy_node                = node_counter++;
                     graph->m_nodes_to_gates[dummy_node] = nullptr;
-                    for (auto* dst_gate : dst_gates)
+                    for (const auto& dst : destinations)
                     {
                         VECTOR(edges)[edge_index++] = dummy_node;
-                        VECTOR(edges)[edge_index++] = graph->m_gates_to_nodes.at(dst_gate);
+                        VECTOR(edges)[edge_index++] = dst.gate;
                     }
                 }
-                else if (dst_gates.empty() && create_dummy_vertices)
+                else if (destinations.empty() && create_dummy_vertices)
                 {
                     // if no destinations, add one dummy node
                     const u32 dummy_node                = node_counter++;
                     graph->m_nodes_to_gates[dummy_node] = nullptr;
-                    for (auto* src_gate : src_gates)
+                    for (const auto& src : sources)
                     {
                         VECTOR(edges)[edge_index++] = dummy_node;
-                        VECTOR(edges)[edge_index++] = graph->m_gates_to_nodes.at(src_gate);
+                        VECTOR(edges)[edge_index++] = src.gate;
                     }
                 }
                 else
                 {
-                    for (auto* dst_gate : dst_gates)
+                    for (const auto& dst : destinations)
                     {
-                        for (auto* src_gate : src_gates)
+                        for (const auto& src : sources)
                         {
-                            VECTOR(edges)[edge_index++] = graph->m_gates_to_nodes.at(src_gate);
-                            VECTOR(edges)[edge_index++] = graph->m_gates_to_nodes.at(dst_gate);
+                            VECTOR(edges)[edge_index++] = src.gate;
+                            VECTOR(edges)[edge_index++] = dst.gate;
                         }
                     }
                 }
@@ -0,0 +1,142 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/defines.h"
+#include "netlist_simulator_controller/wave_event.h"
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    class Net;
+
+    /**
+     * Timing wheel holding the pending events of the event-driven simulation.
+     * Events within the next 'wheel_size' picoseconds are stored in one bucket per picosecond, events further in the future are kept in an overflow calendar and moved into the wheel once it reaches them.
+     * The wheel advances with every point in time whose events are popped.
+     * Event nodes are pooled and reused, so that scheduling an event does not allocate memory once the queue has warmed up.
+     * At most one event is pending per net and point in time, scheduling another event for the same net and time only updates the pending value.
+     */
+    class EventQueue
+    {
+    public:
+        /**
+         * The number of buckets of the wheel, i.e., the number of picoseconds covered without resorting to the overflow calendar.
+         */
+        static constexpr u32 wheel_size = 1024;
+
+        EventQueue();
+
+        /**
+         * Schedule an event for the given net at the given point in time.
+         * If an event for the same net and point in time is already pending, its value is replaced.
+         * Otherwise, the event is assigned a new ID and will be returned after all previously scheduled events of the same point in time.
+         *
+         * @param[in] net - The affected net.
+         * @param[in] time - The time of the event.
+         * @param[in] value - The new value of the net.
+         */
+        void schedule(const Net* net, u64 time, BooleanFunction::Value value);
+
+        /**
+         * Check whether there are pending events.
+         *
+         * @returns True if no event is pending, false otherwise.
+         */
+        bool empty() const;
+
+        /**
+         * Get the number of pending events.
+         *
+         * @returns The number of pending events.
+         */
+        u64 size() const;
+
+        /**
+         * Get the point in time of the earliest pending event.
+         * Must only be called if the queue is not empty.
+         *
+         * @returns The time of the earliest pending event.
+         */
+        u64 get_next_time() const;
+
+        /**
+         * Remove all events that are scheduled at or before the given point in time.
+         * The events are ordered by time first and by ID second.
+         *
+         * @param[in] time - The latest point in time to consider.
+         * @param[out] events - The removed events.
+         */
+        void pop_events(u64 time, std::vector<WaveEvent>& events);
+
+        /**
+         * Remove all pending events and reset the event IDs.
+         */
+        void clear();
+
+    private:
+        static constexpr u32 no_node = ~u32(0);
+
+        struct Node
+        {
+            WaveEvent event;
+            u32 next;
+            u32 next_of_net;
+        };
+
+        /**
+         * Singly linked list of the events scheduled for a single point in time.
+         */
+        struct Bucket
+        {
+            u32 head = no_node;
+            u32 tail = no_node;
+            u32 size = 0;
+        };
+
+        std::vector<Node> m_nodes;
+        u32 m_free_nodes = no_node;
+
+        // the wheel covers the points in time [m_base, m_base + wheel_size), all other events are located in the overflow calendar
+        std::vector<Bucket> m_wheel;
+        u64 m_base             = 0;
+        u64 m_next_wheel_time  = 0;
+        u64 m_num_wheel_events = 0;
+        std::map<u64, Bucket> m_overflow;
+
+        // pending events of every net, linked via 'next_of_net'
+        std::unordered_map<const Net*, u32> m_pending;
+
+        u64 m_size       = 0;
+        u64 m_id_counter = 0;
+
+        void append(Bucket& bucket, u32 node);
+        void set_base(u64 base);
+    };
+}    // namespace hal
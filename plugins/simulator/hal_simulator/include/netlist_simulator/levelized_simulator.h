@@ -0,0 +1,350 @@
+// MIT License
+//
+// Copyright (c) 2019 Ruhr University Bochum, Chair for Embedded Security. All Rights reserved.
+// Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+// Copyright (c) 2021 Max Planck Institute for Security and Privacy. All Rights reserved.
+// Copyright (c) 2021 Jörn Langheinrich, Julian Speith, Nils Albartus, René Walendy, Simon Klix ("ORIGINAL AUTHORS"). All Rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/utilities/result.h"
+#include "netlist_simulator_controller/simulation_engine.h"
+#include "netlist_simulator_controller/simulation_input.h"
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace hal
+{
+    /**
+     * Result of simulating multiple independent stimuli in parallel using 'LevelizedSimulator::simulate_batch'.
+     */
+    struct BatchSimulationResult
+    {
+        /**
+         * The simulated nets, the toggle counts of each stimulus are given in the same order.
+         */
+        std::vector<const Net*> nets;
+
+        /**
+         * The number of transitions between 0 and 1 for every stimulus and net.
+         */
+        std::vector<std::vector<u64>> toggle_counts;
+
+        /**
+         * The events of the traced nets for every stimulus, indexed by net ID.
+         */
+        std::vector<std::unordered_map<u32, std::vector<WaveEvent>>> traces;
+    };
+
+    /**
+     * Zero-delay cycle simulator that levelizes the combinational logic once and compiles it into a flat instruction array.
+     * All signal values are kept in a dense vector indexed by net.
+     * Each point in time is handled by a single pass over the compiled combinational logic, followed by updating all flip-flops and RAMs that were clocked and re-evaluating the logic until the circuit is stable.
+     * If the engine property 'num_of_threads' is set to a value greater than 1 before initialization, the levelized combinational logic is split into that many partitions along the fan-in cones of the sequential gates.
+     * The partitions are evaluated concurrently and synchronized by a barrier before the sequential gates are clocked.
+     */
+    class LevelizedSimulator : public SimulationEngineEventDriven
+    {
+        friend class LevelizedSimulatorFactory;
+
+    public:
+        ~LevelizedSimulator() override;
+
+        /**
+         * Set the signal for a specific wire to control input signals between simulation cycles.
+         *
+         * @param[in] net - The net to set a signal value for.
+         * @param[in] value - The value to set.
+         */
+        void set_input(const Net* net, BooleanFunction::Value value);
+
+        /**
+         * Configure the sequential gates matching the (optional) user-defined filter condition with initialization data specified within the netlist.
+         * The configuration is applied during initialization of the simulator.
+         * This function can only be called before the simulation has started.
+         * 
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Configure the sequential gates matching the (optional) user-defined filter condition with the specified value.
+         * The configuration is applied during initialization of the simulator.
+         * This function can only be called before the simulation has started.
+         * 
+         * @param[in] value - The value to initialize the selected gates with.
+         * @param[in] filter - The optional filter to be applied before initialization.
+         */
+        void initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter = nullptr);
+
+        /**
+         * Initialize the simulation, i.e., levelize and compile the simulated gates.
+         * No additional gates or clocks can be added after this point.
+         * 
+         * @returns True on success, false otherwise.
+         */
+        bool initialize();
+
+        /**
+         * Simulate for a specific period, advancing the internal state.
+         * Automatically initializes the simulation if 'initialize' has not yet been called.
+         * Use 'set_input' to control specific signals.
+         *
+         * @param[in] picoseconds - The duration to simulate.
+         */
+        void simulate(u64 picoseconds);
+
+        /**
+         * Simulate multiple independent stimuli in parallel by packing one stimulus into each bit lane of a machine word, so that up to 'lane_width' stimuli are processed by a single pass over the compiled circuit.
+         * Each stimulus is a sequence of input events that is applied from time 0 onwards starting from the initial state of the circuit, while the clocks keep running until the longest stimulus ends.
+         * Automatically initializes the simulation if 'initialize' has not yet been called, but does not affect the state of regular simulation.
+         * The values X and Z are not distinguished, i.e., Z is simulated as X. RAMs are not supported.
+         *
+         * @param[in] stimuli - The stimuli, each being a sequence of input events.
+         * @param[in] lane_width - The number of stimuli simulated in parallel, must be 64, 128, or 256.
+         * @param[in] traced_nets - The nets for which all events are recorded.
+         * @returns The toggle counts and traces of every stimulus on success, an error otherwise.
+         */
+        Result<BatchSimulationResult> simulate_batch(const std::vector<std::vector<SimulationInputNetEvent>>& stimuli, u32 lane_width = 64, const std::vector<const Net*>& traced_nets = {});
+
+        SimulationInput* get_simulation_input() const override
+        {
+            return mSimulationInput;
+        }
+
+        /**
+         * Reset the simulator state, i.e., treat all signals as unknown.
+         */
+        void reset();
+
+        /**
+         * Set the iteration timeout, i.e., the maximum number of times the sequential gates may be clocked for a single point in time.
+         * Useful to abort in case of combinational loops or oscillating feedback paths.
+         * A value of 0 disables the timeout.
+         *
+         * @param[in] iterations - The iteration timeout.
+         */
+        void set_iteration_timeout(u64 iterations);
+
+        /**
+         * Get the current iteration timeout value.
+         *
+         * @returns The iteration timeout.
+         */
+        u64 get_iteration_timeout() const;
+
+        /**
+         * Get the number of levels of the compiled combinational logic.
+         * Gates within combinational loops are not levelized and are not counted.
+         *
+         * @returns The number of levels.
+         */
+        u32 get_num_levels() const;
+
+        /**
+         * Get the number of partitions the combinational logic is evaluated in concurrently.
+         * Returns 1 if the combinational logic is evaluated by a single thread.
+         *
+         * @returns The number of partitions.
+         */
+        u32 get_num_partitions() const;
+
+        /**
+         * Get vector of simulated events for net
+         *
+         * @param[in] netId - The ID of the net for which events where simulated
+         * @return Vector of events
+         */
+        std::vector<WaveEvent> get_simulation_events(u32 netId) const override;
+
+        bool inputEvent(const SimulationInputNetEvent& netEv) override;
+
+    private:
+        static constexpr u32 no_net = ~u32(0);
+
+        // marks net arguments of partition instructions that refer to partition-local scratch values
+        static constexpr u32 local_net = 1u << 31;
+
+        enum class OpCode : u8
+        {
+            LoadNet,
+            LoadConst,
+            Not,
+            And,
+            Or,
+            Xor,
+            Evaluate,
+            Store
+        };
+
+        /**
+         * Single instruction of the stack machine, 'arg' is a net index for loads and stores and a fallback function index for evaluations.
+         */
+        struct Instruction
+        {
+            OpCode op;
+            BooleanFunction::Value value;
+            u32 arg;
+        };
+
+        /**
+         * Range of instructions that leaves the value of a Boolean function on the stack, an empty range evaluates to X.
+         */
+        struct Function
+        {
+            u32 begin = 0;
+            u32 end   = 0;
+        };
+
+        /**
+         * Boolean function that cannot be compiled and is evaluated using the generic evaluation of 'BooleanFunction' instead.
+         */
+        struct FallbackFunction
+        {
+            BooleanFunction function;
+            std::vector<std::pair<std::string, u32>> inputs;
+        };
+
+        /**
+         * Part of the levelized combinational logic that is evaluated by a single thread.
+         * Gates owned by other partitions but required by this one are duplicated and store their outputs in partition-local scratch values instead of the shared value vector.
+         */
+        struct Partition
+        {
+            std::vector<Instruction> program;
+            std::vector<FallbackFunction> fallback_functions;
+            std::vector<BooleanFunction::Value> scratch;
+            std::vector<BooleanFunction::Value> stack;
+            std::vector<u32> changed_nets;
+            std::vector<u32> touched_nets;
+            u64 num_value_changes = 0;
+        };
+
+        struct WorkerPool;
+
+        struct FlipFlop
+        {
+            Function clock_func;
+            Function next_state_func;
+            Function set_func;
+            Function reset_func;
+            std::vector<u32> input_nets;
+            std::vector<u32> clock_nets;
+            std::vector<u32> state_nets;
+            std::vector<u32> neg_state_nets;
+            AsyncSetResetBehavior sr_behavior_out;
+            AsyncSetResetBehavior sr_behavior_out_inverted;
+        };
+
+        struct RAM
+        {
+            struct Port
+            {
+                u32 clock_net;
+                Function clock_func;
+                Function enable_func;
+                bool is_write;
+                std::vector<u32> address_nets;
+                std::vector<u32> data_nets;
+                std::unordered_map<u32, Function> write_mask_funcs;
+            };
+
+            const Gate* gate;
+            std::vector<Port> ports;
+            std::vector<u64> data;
+        };
+
+        bool m_is_initialized = false;
+        std::vector<std::tuple<bool, BooleanFunction::Value, const std::function<bool(const Gate*)>>> m_init_seq_gates;
+        std::vector<std::pair<const Net*, BooleanFunction::Value>> m_pending_inputs;
+
+        u64 m_current_time       = 0;
+        u64 m_timeout_iterations = 10000ul;
+        u64 m_id_counter         = 0;
+
+        // dense net index
+        std::vector<const Net*> m_nets;
+        std::unordered_map<u32, u32> m_net_id_to_index;
+        u32 m_num_circuit_nets = 0;
+
+        // compiled circuit, the combinational logic occupies the front of the program in level order
+        std::vector<Instruction> m_program;
+        u32 m_levelized_end = 0;
+        u32 m_loop_end      = 0;
+        u32 m_num_levels    = 0;
+        std::vector<FallbackFunction> m_fallback_functions;
+        std::vector<FlipFlop> m_flip_flops;
+        std::vector<RAM> m_rams;
+        std::vector<std::pair<u32, BooleanFunction::Value>> m_init_values;
+
+        // concurrent evaluation of the levelized combinational logic
+        std::vector<Partition> m_partitions;
+        std::unique_ptr<WorkerPool> m_worker_pool;
+
+        // simulation state
+        std::vector<BooleanFunction::Value> m_values;
+        std::vector<BooleanFunction::Value> m_stack;
+        std::vector<u8> m_changed;
+        std::vector<u32> m_changed_nets;
+        std::vector<u8> m_touched;
+        std::vector<u32> m_touched_nets;
+        u64 m_num_value_changes = 0;
+        std::vector<std::vector<WaveEvent>> m_events;
+
+        LevelizedSimulator(const std::string& nam);
+
+        u32 add_net(const Net* net);
+        Function compile(const BooleanFunction& function, const std::unordered_map<std::string, u32>& pin_to_net);
+        BooleanFunction::Value execute(u32 begin, u32 end);
+        BooleanFunction::Value evaluate(const Function& function);
+        void partition_combinational_logic(const std::vector<u32>& gate_bounds, u32 num_threads);
+        void execute_partition(Partition& partition);
+        void write_value(u32 net_index, BooleanFunction::Value value);
+        bool evaluate_combinational();
+        bool clock_sequential_gates();
+        bool process_time_step(u64 time);
+        void record_events(u64 time);
+
+        template<u32 W>
+        bool simulate_lanes(const std::vector<std::vector<SimulationInputNetEvent>>& stimuli,
+                            u32 first_stimulus,
+                            const std::vector<const Net*>& traced_nets,
+                            const std::vector<u32>& trace_slots,
+                            BatchSimulationResult& result);
+    };
+
+    class LevelizedSimulatorFactory : public SimulationEngineFactory
+    {
+    public:
+        LevelizedSimulatorFactory() : SimulationEngineFactory("hal_levelized_simulator")
+        {
+            ;
+        }
+        SimulationEngine* createEngine() const override;
+    };
+}    // namespace hal
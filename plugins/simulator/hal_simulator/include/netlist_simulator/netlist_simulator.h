@@ -29,6 +29,7 @@
 #include "hal_core/netlist/gate_library/enums/async_set_reset_behavior.h"
 #include "hal_core/netlist/gate_library/gate_type.h"
 #include "hal_core/netlist/net.h"
+#include "netlist_simulator/event_queue.h"
 #include "netlist_simulator/simulation.h"
 #include "netlist_simulator_controller/simulation_engine.h"
 
@@ -176,45 +177,89 @@ namespace hal
     private:
         friend class NetlistSimulatorPlugin;
 
+        /**
+         * Boolean function over the input pins of a gate type.
+         * Single-bit functions composed of NOT, AND, OR, and XOR operations on input pins are compiled into a short instruction sequence.
+         * If such a function depends on at most 'max_table_inputs' pins, it is further expanded into a lookup table over all four-valued input assignments.
+         * All other functions are evaluated generically.
+         */
+        struct SimulationFunction
+        {
+            static constexpr u32 max_table_inputs = 6;
+
+            enum class OpCode : u8
+            {
+                LoadInput,
+                LoadConst,
+                Not,
+                And,
+                Or,
+                Xor
+            };
+
+            struct Instruction
+            {
+                OpCode op;
+                BooleanFunction::Value value;
+                u32 arg;
+            };
+
+            // indices of the input pins the function depends on, the lookup table is indexed by the values of these pins with two bits per pin
+            std::vector<u32> m_inputs;
+            std::vector<BooleanFunction::Value> m_table;
+            std::vector<Instruction> m_program;
+            u32 m_stack_size = 0;
+
+            // generic fallback
+            BooleanFunction m_function;
+            std::vector<std::string> m_input_names;
+
+            SimulationFunction(const BooleanFunction& function, const std::vector<GatePin*>& input_pins);
+
+            BooleanFunction::Value evaluate(const std::vector<BooleanFunction::Value>& net_values, const std::vector<u32>& input_nets) const;
+
+            template<typename LoadInput>
+            BooleanFunction::Value execute(BooleanFunction::Value* stack, const LoadInput& load_input) const;
+        };
+
         struct SimulationGate
         {
             const Gate* m_gate;
             std::vector<GatePin*> m_input_pins;
-            std::vector<const Net*> m_input_nets;
-            std::unordered_map<std::string, BooleanFunction::Value> m_input_values;
+            // IDs of the nets connected to the input pins, unconnected pins refer to the invalid net ID 0 that always holds X
+            std::vector<u32> m_input_nets;
 
             SimulationGate(const Gate* gate);
             virtual ~SimulationGate() = default;
 
-            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) = 0;
+            virtual bool simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events) = 0;
         };
 
         struct SimulationGateCombinational : public SimulationGate
         {
-            std::vector<GatePin*> m_output_pins;
             std::vector<const Net*> m_output_nets;
-            std::unordered_map<const Net*, BooleanFunction> m_functions;
+            std::vector<const SimulationFunction*> m_functions;
 
-            SimulationGateCombinational(const Gate* gate);
+            SimulationGateCombinational(const Gate* gate, NetlistSimulator* simulator);
 
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events) override;
         };
 
         struct SimulationGateSequential : public SimulationGate
         {
             SimulationGateSequential(const Gate* gate);
 
-            virtual void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value)                    = 0;
-            virtual bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) = 0;
-            virtual void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)                                  = 0;
+            virtual void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value)                         = 0;
+            virtual bool simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events) = 0;
+            virtual void clock(const u64 current_time, const std::vector<BooleanFunction::Value>& net_values, EventQueue& new_events)                                  = 0;
         };
 
         struct SimulationGateFF : public SimulationGateSequential
         {
-            BooleanFunction m_clock_func;
-            BooleanFunction m_clear_func;
-            BooleanFunction m_preset_func;
-            BooleanFunction m_next_state_func;
+            const SimulationFunction* m_clock_func;
+            const SimulationFunction* m_clear_func;
+            const SimulationFunction* m_preset_func;
+            const SimulationFunction* m_next_state_func;
             std::vector<const Net*> m_state_output_nets;
             std::vector<const Net*> m_state_inverted_output_nets;
             std::vector<const Net*> m_clock_nets;
@@ -223,11 +268,11 @@ namespace hal
             BooleanFunction::Value m_output;
             BooleanFunction::Value m_inv_output;
 
-            SimulationGateFF(const Gate* gate);
+            SimulationGateFF(const Gate* gate, NetlistSimulator* simulator);
 
             void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value) override;
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
-            void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events) override;
+            void clock(const u64 current_time, const std::vector<BooleanFunction::Value>& net_values, EventQueue& new_events) override;
         };
 
         struct SimulationGateRAM : public SimulationGateSequential
@@ -235,12 +280,14 @@ namespace hal
             struct Port
             {
                 const Net* clock_net;
-                BooleanFunction clock_func;
-                BooleanFunction enable_func;
+                const SimulationFunction* clock_func;
+                const SimulationFunction* enable_func;
                 bool is_write;
 
-                std::vector<GatePin*> address_pins;
-                std::vector<GatePin*> data_pins;
+                std::vector<u32> address_nets;
+                std::vector<u32> data_nets;
+                std::vector<const Net*> data_out_nets;
+                std::vector<const SimulationFunction*> write_mask_funcs;
             };
 
             std::vector<Port> m_ports;
@@ -249,31 +296,37 @@ namespace hal
             std::vector<size_t> m_clocked_read_ports;
             std::vector<size_t> m_clocked_write_ports;
 
-            SimulationGateRAM(const Gate* gate);
+            SimulationGateRAM(const Gate* gate, NetlistSimulator* simulator);
 
             void initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value) override;
-            bool simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
-            void clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events) override;
+            bool simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events) override;
+            void clock(const u64 current_time, const std::vector<BooleanFunction::Value>& net_values, EventQueue& new_events) override;
         };
 
         bool m_is_initialized = false;
         std::vector<std::tuple<bool, BooleanFunction::Value, const std::function<bool(const Gate*)>>> m_init_seq_gates;
 
         u64 m_current_time = 0;
-        std::vector<WaveEvent> m_event_queue;
+        EventQueue m_event_queue;
         Simulation m_simulation;
         u64 m_timeout_iterations = 10000000ul;
-        u64 m_id_counter         = 0;
 
-        std::unordered_map<const Net*, std::vector<std::pair<SimulationGate*, std::vector<const GatePin*>>>> m_successors;
+        // dense simulation state indexed by net ID
+        std::vector<BooleanFunction::Value> m_net_values;
+        std::vector<std::vector<SimulationGate*>> m_successors;
         std::vector<std::unique_ptr<SimulationGate>> m_sim_gates;
         std::vector<SimulationGate*> m_sim_gates_raw;
 
+        // compiled gate functions, kept across resets and re-initializations
+        std::map<std::pair<const GateType*, std::string>, SimulationFunction> m_function_cache;
+        std::unordered_map<const GateType*, std::vector<const SimulationFunction*>> m_type_functions;
+
         NetlistSimulator(const std::string& nam);
         void compute_input_nets();
         void compute_output_nets();
         void prepare_clock_events(u64 nanoseconds);
         void process_events(u64 timeout);
+        const SimulationFunction* get_simulation_function(const GateType* gate_type, const BooleanFunction& function);
 
         BooleanFunction::Value process_clear_preset_behavior(AsyncSetResetBehavior behavior, BooleanFunction::Value previous_output);
     };
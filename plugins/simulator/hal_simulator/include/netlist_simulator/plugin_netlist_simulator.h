@@ -35,6 +35,7 @@ namespace hal
     class PLUGIN_API NetlistSimulatorPlugin : public BasePluginInterface
     {
         static std::string s_engine_name;
+        static std::string s_levelized_engine_name;
 
     public:
         /**
@@ -65,12 +66,12 @@ namespace hal
         std::set<std::string> get_dependencies() const override;
 
         /**
-         * Creates instance and registers with NetlistSimulatorController
+         * Creates the event-driven and the levelized simulation engine factories and registers them with NetlistSimulatorController
          */
         void on_load() override;
 
         /**
-         * Unregisters and delete instance
+         * Unregisters and deletes both simulation engine factories
          */
         void on_unload() override;
     };
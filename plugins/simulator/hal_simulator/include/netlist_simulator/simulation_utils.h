@@ -32,6 +32,9 @@
 
 namespace hal
 {
+    class Gate;
+    class RAMComponent;
+
     namespace simulation_utils
     {
         BooleanFunction::Value toggle(BooleanFunction::Value v);
@@ -39,5 +42,50 @@ namespace hal
         std::vector<BooleanFunction::Value> int_to_values(u32 integer, u32 len);
         u32 values_to_int(const std::vector<BooleanFunction::Value>& values);
         u32 get_int_bus_value(const std::unordered_map<std::string, BooleanFunction::Value>& signal_values, const std::vector<GatePin*>& ordered_pins);
+        u32 get_data_word(const std::vector<u64>& data, u32 address, u32 width);
+        void set_data_word(std::vector<u64>& data, u32 in_data, u32 address, u32 width);
+
+        // initial state of a flip-flop, 'value' is only overwritten by a non-empty init string if 'from_netlist' is set, returns false if the gate cannot be initialized
+        bool get_initial_ff_value(const Gate* gate, bool from_netlist, BooleanFunction::Value& value);
+
+        // initial contents of a RAM gate, either parsed from its init data if 'from_netlist' is set or filled with 'value', returns false if the gate cannot be initialized
+        bool get_initial_ram_data(const Gate* gate, const RAMComponent* ram_component, bool from_netlist, BooleanFunction::Value value, std::vector<u64>& data);
+
+        // four-valued logic operations that mirror constant propagation, i.e., X and Z are passed through by NOT and result in X otherwise
+        inline BooleanFunction::Value apply_not(BooleanFunction::Value a)
+        {
+            if (a == BooleanFunction::Value::ZERO || a == BooleanFunction::Value::ONE)
+            {
+                return (a == BooleanFunction::Value::ZERO) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
+            }
+            return a;
+        }
+
+        inline BooleanFunction::Value apply_and(BooleanFunction::Value a, BooleanFunction::Value b)
+        {
+            if (a == BooleanFunction::Value::ZERO || b == BooleanFunction::Value::ZERO)
+            {
+                return BooleanFunction::Value::ZERO;
+            }
+            return (a == BooleanFunction::Value::ONE && b == BooleanFunction::Value::ONE) ? BooleanFunction::Value::ONE : BooleanFunction::Value::X;
+        }
+
+        inline BooleanFunction::Value apply_or(BooleanFunction::Value a, BooleanFunction::Value b)
+        {
+            if (a == BooleanFunction::Value::ONE || b == BooleanFunction::Value::ONE)
+            {
+                return BooleanFunction::Value::ONE;
+            }
+            return (a == BooleanFunction::Value::ZERO && b == BooleanFunction::Value::ZERO) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::X;
+        }
+
+        inline BooleanFunction::Value apply_xor(BooleanFunction::Value a, BooleanFunction::Value b)
+        {
+            if ((a == BooleanFunction::Value::ZERO || a == BooleanFunction::Value::ONE) && (b == BooleanFunction::Value::ZERO || b == BooleanFunction::Value::ONE))
+            {
+                return (a == b) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+            }
+            return BooleanFunction::Value::X;
+        }
     }    // namespace simulation_utils
 }    // namespace hal
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include "netlist_simulator/event_queue.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    EventQueue::EventQueue() : m_wheel(wheel_size)
+    {
+    }
+
+    void EventQueue::schedule(const Net* net, u64 time, BooleanFunction::Value value)
+    {
+        // if there is already an event for the net at this point in time, we simply update its value
+        const auto pending_it = m_pending.try_emplace(net, no_node).first;
+        for (u32 node = pending_it->second; node != no_node; node = m_nodes[node].next_of_net)
+        {
+            if (m_nodes[node].event.time == time)
+            {
+                m_nodes[node].event.new_value = value;
+                return;
+            }
+        }
+
+        u32 node = m_free_nodes;
+        if (node != no_node)
+        {
+            m_free_nodes = m_nodes[node].next;
+        }
+        else
+        {
+            node = m_nodes.size();
+            m_nodes.emplace_back();
+        }
+
+        Node& n              = m_nodes[node];
+        n.event.affected_net = net;
+        n.event.new_value    = value;
+        n.event.time         = time;
+        n.event.id           = m_id_counter++;
+        n.next               = no_node;
+        n.next_of_net        = pending_it->second;
+        pending_it->second   = node;
+
+        if (m_size == 0)
+        {
+            m_base = time;
+        }
+        else if (time < m_base)
+        {
+            set_base(time);
+        }
+
+        if (time < m_base + wheel_size)
+        {
+            if (m_num_wheel_events == 0 || time < m_next_wheel_time)
+            {
+                m_next_wheel_time = time;
+            }
+            append(m_wheel[time % wheel_size], node);
+            m_num_wheel_events++;
+        }
+        else
+        {
+            append(m_overflow[time], node);
+        }
+        m_size++;
+    }
+
+    bool EventQueue::empty() const
+    {
+        return m_size == 0;
+    }
+
+    u64 EventQueue::size() const
+    {
+        return m_size;
+    }
+
+    u64 EventQueue::get_next_time() const
+    {
+        return (m_num_wheel_events != 0) ? m_next_wheel_time : m_overflow.begin()->first;
+    }
+
+    void EventQueue::pop_events(u64 time, std::vector<WaveEvent>& events)
+    {
+        events.clear();
+        while (m_size != 0)
+        {
+            if (m_num_wheel_events == 0)
+            {
+                // the wheel is exhausted, advance it to the earliest event of the overflow calendar
+                if (m_overflow.begin()->first > time)
+                {
+                    break;
+                }
+                set_base(m_overflow.begin()->first);
+                m_next_wheel_time = m_base;
+            }
+            else if (m_next_wheel_time > time)
+            {
+                break;
+            }
+
+            const u64 current_time = m_next_wheel_time;
+            Bucket& bucket         = m_wheel[current_time % wheel_size];
+            for (u32 node = bucket.head; node != no_node;)
+            {
+                Node& n = m_nodes[node];
+                events.push_back(n.event);
+
+                u32* link = &m_pending.at(n.event.affected_net);
+                while (*link != node)
+                {
+                    link = &m_nodes[*link].next_of_net;
+                }
+                *link = n.next_of_net;
+
+                const u32 next = n.next;
+                n.next         = m_free_nodes;
+                m_free_nodes   = node;
+                node           = next;
+            }
+            m_num_wheel_events -= bucket.size;
+            m_size -= bucket.size;
+            bucket = Bucket();
+
+            // no event is pending before the current point in time anymore, so the wheel follows the simulation time and takes in events from the overflow calendar
+            if (current_time > m_base)
+            {
+                set_base(current_time);
+            }
+
+            if (m_num_wheel_events != 0)
+            {
+                while (m_wheel[++m_next_wheel_time % wheel_size].head == no_node)
+                {
+                }
+            }
+        }
+    }
+
+    void EventQueue::clear()
+    {
+        m_nodes.clear();
+        m_free_nodes = no_node;
+        m_wheel.assign(wheel_size, Bucket());
+        m_base             = 0;
+        m_next_wheel_time  = 0;
+        m_num_wheel_events = 0;
+        m_overflow.clear();
+        m_pending.clear();
+        m_size       = 0;
+        m_id_counter = 0;
+    }
+
+    void EventQueue::append(Bucket& bucket, u32 node)
+    {
+        if (bucket.head == no_node)
+        {
+            bucket.head = node;
+        }
+        else
+        {
+            m_nodes[bucket.tail].next = node;
+        }
+        bucket.tail = node;
+        bucket.size++;
+    }
+
+    void EventQueue::set_base(u64 base)
+    {
+        // moving the wheel backwards pushes all events beyond its new end into the overflow calendar
+        if (base < m_base && m_num_wheel_events != 0)
+        {
+            for (u64 time = std::max(base + wheel_size, m_base); time < m_base + wheel_size; time++)
+            {
+                Bucket& bucket = m_wheel[time % wheel_size];
+                if (bucket.head != no_node)
+                {
+                    m_num_wheel_events -= bucket.size;
+                    m_overflow.emplace(time, bucket);
+                    bucket = Bucket();
+                }
+            }
+        }
+        m_base = base;
+
+        // pull all events from the overflow calendar that are now covered by the wheel
+        while (!m_overflow.empty() && m_overflow.begin()->first < m_base + wheel_size)
+        {
+            const auto it = m_overflow.begin();
+            m_wheel[it->first % wheel_size] = it->second;
+            m_num_wheel_events += it->second.size;
+            m_overflow.erase(it);
+        }
+    }
+}    // namespace hal
@@ -0,0 +1,2010 @@
+#include "netlist_simulator/levelized_simulator.h"
+
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_port_component.h"
+#include "hal_core/utilities/log.h"
+#include "netlist_simulator/simulation_utils.h"
+#include "netlist_simulator_controller/simulation_input.h"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace hal
+{
+    namespace
+    {
+        /**
+         * Values of a net within 64 * W lanes in dual-rail encoding, i.e., a lane is 1 if its bit is set in 'one', 0 if its bit is set in 'zero', and X otherwise.
+         */
+        template<u32 W>
+        struct LaneValue
+        {
+            std::array<u64, W> one{};
+            std::array<u64, W> zero{};
+        };
+
+        template<u32 W>
+        LaneValue<W> broadcast_value(BooleanFunction::Value value)
+        {
+            LaneValue<W> result;
+            if (value == BooleanFunction::Value::ONE)
+            {
+                result.one.fill(~u64(0));
+            }
+            else if (value == BooleanFunction::Value::ZERO)
+            {
+                result.zero.fill(~u64(0));
+            }
+            return result;
+        }
+
+        template<u32 W>
+        BooleanFunction::Value get_lane_value(const LaneValue<W>& value, u32 lane)
+        {
+            const u64 bit = u64(1) << (lane % 64);
+            if (value.one[lane / 64] & bit)
+            {
+                return BooleanFunction::Value::ONE;
+            }
+            else if (value.zero[lane / 64] & bit)
+            {
+                return BooleanFunction::Value::ZERO;
+            }
+            return BooleanFunction::Value::X;
+        }
+
+        template<u32 W>
+        void set_lane_value(LaneValue<W>& value, u32 lane, BooleanFunction::Value lane_value)
+        {
+            const u64 bit = u64(1) << (lane % 64);
+            value.one[lane / 64] &= ~bit;
+            value.zero[lane / 64] &= ~bit;
+            if (lane_value == BooleanFunction::Value::ONE)
+            {
+                value.one[lane / 64] |= bit;
+            }
+            else if (lane_value == BooleanFunction::Value::ZERO)
+            {
+                value.zero[lane / 64] |= bit;
+            }
+        }
+
+        template<u32 W>
+        LaneValue<W> invert_lanes(const LaneValue<W>& value)
+        {
+            return LaneValue<W>{value.zero, value.one};
+        }
+
+        template<u32 W>
+        LaneValue<W> process_clear_preset_behavior_lanes(AsyncSetResetBehavior behavior, const LaneValue<W>& previous_output)
+        {
+            switch (behavior)
+            {
+                case AsyncSetResetBehavior::N:
+                    return previous_output;
+                case AsyncSetResetBehavior::L:
+                    return broadcast_value<W>(BooleanFunction::Value::ZERO);
+                case AsyncSetResetBehavior::H:
+                    return broadcast_value<W>(BooleanFunction::Value::ONE);
+                case AsyncSetResetBehavior::T:
+                    return invert_lanes(previous_output);
+                default:
+                    return LaneValue<W>();
+            }
+        }
+    }    // namespace
+
+    /**
+     * Persistent worker threads that execute one task per thread and return once all threads have finished, i.e., every call to 'run' acts as a barrier.
+     * The calling thread executes the task with index 0.
+     */
+    struct LevelizedSimulator::WorkerPool
+    {
+        std::vector<std::thread> threads;
+        std::mutex mutex;
+        std::condition_variable start_condition;
+        std::condition_variable done_condition;
+        std::function<void(u32)> task;
+        u64 generation  = 0;
+        u32 num_running = 0;
+        bool stop       = false;
+
+        WorkerPool(u32 num_threads)
+        {
+            for (u32 i = 1; i < num_threads; i++)
+            {
+                threads.emplace_back([this, i]() { work(i); });
+            }
+        }
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            start_condition.notify_all();
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        void work(u32 index)
+        {
+            u64 finished_generation = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    start_condition.wait(lock, [this, finished_generation]() { return stop || generation != finished_generation; });
+                    if (stop)
+                    {
+                        return;
+                    }
+                    finished_generation = generation;
+                }
+
+                task(index);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--num_running == 0)
+                {
+                    done_condition.notify_one();
+                }
+            }
+        }
+
+        void run(const std::function<void(u32)>& new_task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                task        = new_task;
+                num_running = threads.size();
+                generation++;
+            }
+            start_condition.notify_all();
+
+            task(0);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            done_condition.wait(lock, [this]() { return num_running == 0; });
+        }
+    };
+
+    LevelizedSimulator::LevelizedSimulator(const std::string& nam) : SimulationEngineEventDriven(nam)
+    {
+        ;
+    }
+
+    LevelizedSimulator::~LevelizedSimulator() = default;
+
+    void LevelizedSimulator::set_input(const Net* net, BooleanFunction::Value value)
+    {
+        if (net == nullptr)
+        {
+            log_error("hal_simulator", "net is a nullptr.");
+            return;
+        }
+
+        m_pending_inputs.emplace_back(net, value);
+    }
+
+    void LevelizedSimulator::initialize_sequential_gates(const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("hal_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+
+        m_init_seq_gates.push_back(std::make_tuple(true, BooleanFunction::Value::X, filter));
+    }
+
+    void LevelizedSimulator::initialize_sequential_gates(BooleanFunction::Value value, const std::function<bool(const Gate*)>& filter)
+    {
+        if (m_is_initialized)
+        {
+            log_error("hal_simulator", "cannot initialize sequential gates after the simulation was started.");
+            return;
+        }
+
+        m_init_seq_gates.push_back(std::make_tuple(false, value, filter));
+    }
+
+    bool LevelizedSimulator::initialize()
+    {
+        m_nets.clear();
+        m_net_id_to_index.clear();
+        m_program.clear();
+        m_fallback_functions.clear();
+        m_flip_flops.clear();
+        m_rams.clear();
+        m_stack.clear();
+        m_partitions.clear();
+        m_num_levels = 0;
+
+        // process gates in a deterministic order
+        std::vector<const Gate*> gates(mSimulationInput->get_gates().begin(), mSimulationInput->get_gates().end());
+        std::sort(gates.begin(), gates.end(), [](const Gate* a, const Gate* b) { return a->get_id() < b->get_id(); });
+
+        // (1) assign a dense index to every net connected to a simulated gate
+        m_values.clear();
+        m_changed.clear();
+        m_changed_nets.clear();
+        m_touched.clear();
+        m_touched_nets.clear();
+        m_events.clear();
+        for (const Gate* gate : gates)
+        {
+            for (const Net* net : gate->get_fan_in_nets())
+            {
+                add_net(net);
+            }
+            for (const Net* net : gate->get_fan_out_nets())
+            {
+                add_net(net);
+            }
+        }
+        for (const Net* net : mSimulationInput->get_input_nets())
+        {
+            add_net(net);
+        }
+
+        const u32 num_nets = m_nets.size();
+        m_num_circuit_nets = num_nets;
+
+        auto get_net_index = [this](const Net* net) { return (net == nullptr) ? no_net : m_net_id_to_index.at(net->get_id()); };
+        auto get_pin_to_net = [&get_net_index](const Gate* gate) {
+            std::unordered_map<std::string, u32> pin_to_net;
+            for (const GatePin* pin : gate->get_type()->get_input_pins())
+            {
+                pin_to_net[pin->get_name()] = get_net_index(gate->get_fan_in_net(pin));
+            }
+            return pin_to_net;
+        };
+
+        // (2) split gates into combinational and sequential ones, compile the functions of sequential gates
+        std::vector<const Gate*> combinational_gates;
+        m_init_values.clear();
+        for (const Gate* gate : gates)
+        {
+            const GateType* gate_type = gate->get_type();
+            if (gate_type->has_property(GateTypeProperty::ff))
+            {
+                const FFComponent* ff_component = gate_type->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
+                if (ff_component == nullptr)
+                {
+                    log_error("hal_simulator", "cannot find flip-flop properties for flip-flop '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    return false;
+                }
+
+                const auto pin_to_net = get_pin_to_net(gate);
+
+                FlipFlop ff;
+                ff.clock_func      = compile(ff_component->get_clock_function(), pin_to_net);
+                ff.next_state_func = compile(ff_component->get_next_state_function(), pin_to_net);
+                ff.set_func        = compile(ff_component->get_async_set_function(), pin_to_net);
+                ff.reset_func      = compile(ff_component->get_async_reset_function(), pin_to_net);
+                for (const GatePin* pin : gate_type->get_pins())
+                {
+                    switch (pin->get_type())
+                    {
+                        case PinType::state:
+                            if (const Net* net = gate->get_fan_out_net(pin); net != nullptr)
+                            {
+                                ff.state_nets.push_back(get_net_index(net));
+                            }
+                            break;
+                        case PinType::neg_state:
+                            if (const Net* net = gate->get_fan_out_net(pin); net != nullptr)
+                            {
+                                ff.neg_state_nets.push_back(get_net_index(net));
+                            }
+                            break;
+                        case PinType::clock:
+                            if (const Net* net = gate->get_fan_in_net(pin); net != nullptr)
+                            {
+                                ff.clock_nets.push_back(get_net_index(net));
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                for (const auto& [pin, net_index] : pin_to_net)
+                {
+                    if (net_index != no_net && std::find(ff.input_nets.begin(), ff.input_nets.end(), net_index) == ff.input_nets.end())
+                    {
+                        ff.input_nets.push_back(net_index);
+                    }
+                }
+
+                const auto behavior         = ff_component->get_async_set_reset_behavior();
+                ff.sr_behavior_out          = behavior.first;
+                ff.sr_behavior_out_inverted = behavior.second;
+
+                for (const auto& [from_netlist, value, filter] : m_init_seq_gates)
+                {
+                    if (filter && !filter(gate))
+                    {
+                        continue;
+                    }
+
+                    BooleanFunction::Value init_value = value;
+                    if (simulation_utils::get_initial_ff_value(gate, from_netlist, init_value))
+                    {
+                        for (const u32 net_index : ff.state_nets)
+                        {
+                            m_init_values.emplace_back(net_index, init_value);
+                        }
+                        for (const u32 net_index : ff.neg_state_nets)
+                        {
+                            m_init_values.emplace_back(net_index, simulation_utils::toggle(init_value));
+                        }
+                    }
+                }
+
+                m_flip_flops.push_back(std::move(ff));
+            }
+            else if (gate_type->has_property(GateTypeProperty::ram))
+            {
+                const RAMComponent* ram_component = gate_type->get_component_as<RAMComponent>([](const GateTypeComponent* c) { return RAMComponent::is_class_of(c); });
+                if (ram_component == nullptr)
+                {
+                    log_error("hal_simulator", "cannot find RAM properties for RAM gate '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    return false;
+                }
+
+                const auto pin_to_net = get_pin_to_net(gate);
+                const auto functions  = gate->get_boolean_functions();
+
+                RAM ram;
+                ram.gate = gate;
+                for (const GateTypeComponent* component : ram_component->get_components([](const GateTypeComponent* c) { return RAMPortComponent::is_class_of(c); }))
+                {
+                    const RAMPortComponent* port_component = component->convert_to<RAMPortComponent>();
+
+                    RAM::Port port;
+                    port.clock_net   = no_net;
+                    port.clock_func  = compile(port_component->get_clock_function(), pin_to_net);
+                    port.enable_func = compile(port_component->get_enable_function(), pin_to_net);
+                    port.is_write    = port_component->is_write_port();
+
+                    for (const std::string& var : port_component->get_clock_function().get_variable_names())
+                    {
+                        if (const GatePin* pin = gate_type->get_pin_by_name(var); pin != nullptr && pin->get_type() == PinType::clock)
+                        {
+                            port.clock_net = get_net_index(gate->get_fan_in_net(pin));
+                        }
+                    }
+
+                    for (const GatePin* pin : gate_type->get_pin_group_by_name(port_component->get_address_group())->get_pins())
+                    {
+                        port.address_nets.push_back(get_net_index(gate->get_fan_in_net(pin)));
+                    }
+
+                    for (const GatePin* pin : gate_type->get_pin_group_by_name(port_component->get_data_group())->get_pins())
+                    {
+                        if (port.is_write)
+                        {
+                            // do not change memory content if a masking function is specified and does not evaluate to 1
+                            if (const auto func_it = functions.find(pin->get_name()); func_it != functions.end())
+                            {
+                                port.write_mask_funcs.emplace((u32)port.data_nets.size(), compile(func_it->second, pin_to_net));
+                            }
+                            port.data_nets.push_back(get_net_index(gate->get_fan_in_net(pin)));
+                        }
+                        else
+                        {
+                            port.data_nets.push_back(get_net_index(gate->get_fan_out_net(pin)));
+                        }
+                    }
+
+                    ram.ports.push_back(std::move(port));
+                }
+
+                for (const auto& [from_netlist, value, filter] : m_init_seq_gates)
+                {
+                    if (filter && !filter(gate))
+                    {
+                        continue;
+                    }
+
+                    if (simulation_utils::get_initial_ram_data(gate, ram_component, from_netlist, value, ram.data))
+                    {
+                        for (const auto& port : ram.ports)
+                        {
+                            if (port.is_write)
+                            {
+                                continue;
+                            }
+
+                            for (const u32 net_index : port.data_nets)
+                            {
+                                if (net_index != no_net)
+                                {
+                                    m_init_values.emplace_back(net_index, BooleanFunction::Value::ZERO);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                m_rams.push_back(std::move(ram));
+            }
+            else if (gate_type->has_property(GateTypeProperty::combinational) || gate->is_gnd_gate() || gate->is_vcc_gate())
+            {
+                combinational_gates.push_back(gate);
+            }
+            else
+            {
+                log_error("hal_simulator", "no support for gate type {} of gate {}.", gate_type->get_name(), gate->get_name());
+                return false;
+            }
+        }
+
+        // (3) levelize the combinational gates using Kahn's algorithm, gates within or behind combinational loops remain unsorted
+        std::unordered_map<const Gate*, u32> gate_to_index;
+        for (u32 i = 0; i < combinational_gates.size(); i++)
+        {
+            gate_to_index[combinational_gates[i]] = i;
+        }
+
+        std::vector<std::vector<u32>> successors(combinational_gates.size());
+        std::vector<u32> in_degree(combinational_gates.size(), 0);
+        for (u32 i = 0; i < combinational_gates.size(); i++)
+        {
+            for (const Endpoint* ep : combinational_gates[i]->get_fan_out_endpoints())
+            {
+                for (const Endpoint* dst : ep->get_net()->get_destinations())
+                {
+                    if (const auto it = gate_to_index.find(dst->get_gate()); it != gate_to_index.end())
+                    {
+                        successors[i].push_back(it->second);
+                        in_degree[it->second]++;
+                    }
+                }
+            }
+        }
+
+        std::vector<u32> order;
+        order.reserve(combinational_gates.size());
+        std::vector<u32> frontier;
+        for (u32 i = 0; i < combinational_gates.size(); i++)
+        {
+            if (in_degree[i] == 0)
+            {
+                frontier.push_back(i);
+            }
+        }
+        while (!frontier.empty())
+        {
+            m_num_levels++;
+            std::vector<u32> next_frontier;
+            for (const u32 i : frontier)
+            {
+                order.push_back(i);
+                for (const u32 successor : successors[i])
+                {
+                    if (--in_degree[successor] == 0)
+                    {
+                        next_frontier.push_back(successor);
+                    }
+                }
+            }
+            frontier = std::move(next_frontier);
+        }
+
+        const u32 num_levelized = order.size();
+        for (u32 i = 0; i < combinational_gates.size(); i++)
+        {
+            if (in_degree[i] != 0)
+            {
+                order.push_back(i);
+            }
+        }
+
+        // (4) compile the combinational gates in level order into the front of the program, remember where the instructions of every levelized gate begin
+        std::vector<Instruction> combinational_program;
+        std::vector<u32> gate_bounds;
+        for (u32 k = 0; k < order.size(); k++)
+        {
+            if (k == num_levelized)
+            {
+                m_levelized_end = combinational_program.size();
+            }
+            else if (k < num_levelized)
+            {
+                gate_bounds.push_back(combinational_program.size());
+            }
+
+            const Gate* gate = combinational_gates[order[k]];
+            if (gate->is_gnd_gate() || gate->is_vcc_gate())
+            {
+                const BooleanFunction::Value value = gate->is_gnd_gate() ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+                for (const Net* net : gate->get_fan_out_nets())
+                {
+                    combinational_program.push_back({OpCode::LoadConst, value, 0});
+                    combinational_program.push_back({OpCode::Store, BooleanFunction::Value::X, get_net_index(net)});
+                }
+                m_stack.resize(std::max<size_t>(m_stack.size(), 1), BooleanFunction::Value::X);
+                continue;
+            }
+
+            const auto pin_to_net = get_pin_to_net(gate);
+            auto functions        = gate->get_boolean_functions();
+            const auto out_pins   = gate->get_type()->get_output_pins();
+            for (const GatePin* pin : out_pins)
+            {
+                const Net* out_net = gate->get_fan_out_net(pin);
+                auto func_it       = functions.find(pin->get_name());
+                if (out_net == nullptr || func_it == functions.end())
+                {
+                    continue;
+                }
+
+                // resolve recursion within output functions
+                BooleanFunction& func = func_it->second;
+                while (true)
+                {
+                    const auto vars = func.get_variable_names();
+                    bool exit       = true;
+                    for (const GatePin* other_pin : out_pins)
+                    {
+                        if (const std::string& other_pin_name = other_pin->get_name(); vars.find(other_pin_name) != vars.end() && functions.find(other_pin_name) != functions.end())
+                        {
+                            func = func.substitute(other_pin_name, functions.at(other_pin_name)).get();
+                            exit = false;
+                        }
+                    }
+                    if (exit)
+                    {
+                        break;
+                    }
+                }
+
+                // the function is compiled into the sequential part of the program first and moved to the combinational part afterwards
+                const Function compiled = compile(func, pin_to_net);
+                combinational_program.insert(combinational_program.end(), m_program.begin() + compiled.begin, m_program.begin() + compiled.end);
+                combinational_program.push_back({OpCode::Store, BooleanFunction::Value::X, get_net_index(out_net)});
+                m_program.resize(compiled.begin);
+            }
+        }
+        if (num_levelized == order.size())
+        {
+            m_levelized_end = combinational_program.size();
+        }
+        gate_bounds.push_back(m_levelized_end);
+        m_loop_end = combinational_program.size();
+
+        // shift the functions of the sequential gates behind the combinational logic
+        auto relocate = [this](Function& f) {
+            f.begin += m_loop_end;
+            f.end += m_loop_end;
+        };
+        for (auto& ff : m_flip_flops)
+        {
+            relocate(ff.clock_func);
+            relocate(ff.next_state_func);
+            relocate(ff.set_func);
+            relocate(ff.reset_func);
+        }
+        for (auto& ram : m_rams)
+        {
+            for (auto& port : ram.ports)
+            {
+                relocate(port.clock_func);
+                relocate(port.enable_func);
+                for (auto& [index, mask_func] : port.write_mask_funcs)
+                {
+                    relocate(mask_func);
+                }
+            }
+        }
+        combinational_program.insert(combinational_program.end(), m_program.begin(), m_program.end());
+        m_program = std::move(combinational_program);
+
+        if (num_levelized != order.size())
+        {
+            log_warning("hal_simulator", "{} combinational gates are part of or depend on combinational loops and are evaluated until they are stable.", order.size() - num_levelized);
+        }
+        log_info("hal_simulator",
+                 "compiled {} combinational gates in {} levels, {} flip-flops, and {} RAMs into {} instructions.",
+                 combinational_gates.size(),
+                 m_num_levels,
+                 m_flip_flops.size(),
+                 m_rams.size(),
+                 m_program.size());
+
+        u32 num_threads = 1;
+        if (const std::string property = get_engine_property("num_of_threads"); !property.empty())
+        {
+            num_threads = std::max(1, std::atoi(property.c_str()));
+        }
+        partition_combinational_logic(gate_bounds, num_threads);
+
+        // (5) apply initial values and mark all nets as changed, so that the first time step evaluates the entire circuit
+        for (const auto& [net_index, value] : m_init_values)
+        {
+            write_value(net_index, value);
+        }
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            if (!m_changed[i])
+            {
+                m_changed[i] = 1;
+                m_changed_nets.push_back(i);
+            }
+            if (!m_touched[i])
+            {
+                m_touched[i] = 1;
+                m_touched_nets.push_back(i);
+            }
+        }
+
+        // set initialization flag only if this point is reached
+        m_is_initialized = true;
+        return true;
+    }
+
+    u32 LevelizedSimulator::add_net(const Net* net)
+    {
+        if (net == nullptr)
+        {
+            return no_net;
+        }
+
+        const auto [it, inserted] = m_net_id_to_index.emplace(net->get_id(), (u32)m_nets.size());
+        if (inserted)
+        {
+            m_nets.push_back(net);
+            m_values.push_back(BooleanFunction::Value::X);
+            m_changed.push_back(0);
+            m_touched.push_back(0);
+            m_events.emplace_back();
+        }
+        return it->second;
+    }
+
+    LevelizedSimulator::Function LevelizedSimulator::compile(const BooleanFunction& function, const std::unordered_map<std::string, u32>& pin_to_net)
+    {
+        Function compiled;
+        compiled.begin = m_program.size();
+        compiled.end   = compiled.begin;
+
+        if (function.is_empty())
+        {
+            return compiled;
+        }
+
+        // only single-bit functions composed of basic logic operations are compiled, all others are evaluated generically
+        bool is_compilable = (function.size() == 1);
+        for (const auto& node : function.get_nodes())
+        {
+            if (!is_compilable)
+            {
+                break;
+            }
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Constant:
+                case BooleanFunction::NodeType::Variable:
+                case BooleanFunction::NodeType::Not:
+                case BooleanFunction::NodeType::And:
+                case BooleanFunction::NodeType::Or:
+                case BooleanFunction::NodeType::Xor:
+                    is_compilable = (node.size == 1);
+                    break;
+                default:
+                    is_compilable = false;
+                    break;
+            }
+        }
+
+        u32 depth     = 0;
+        u32 max_depth = 1;
+        if (is_compilable)
+        {
+            for (const auto& node : function.get_nodes())
+            {
+                if (node.is_constant())
+                {
+                    m_program.push_back({OpCode::LoadConst, node.constant().front(), 0});
+                    depth++;
+                }
+                else if (node.is_variable())
+                {
+                    const auto it = pin_to_net.find(node.variable());
+                    if (it == pin_to_net.end() || it->second == no_net)
+                    {
+                        m_program.push_back({OpCode::LoadConst, BooleanFunction::Value::X, 0});
+                    }
+                    else
+                    {
+                        m_program.push_back({OpCode::LoadNet, BooleanFunction::Value::X, it->second});
+                    }
+                    depth++;
+                }
+                else
+                {
+                    switch (node.type)
+                    {
+                        case BooleanFunction::NodeType::Not:
+                            m_program.push_back({OpCode::Not, BooleanFunction::Value::X, 0});
+                            break;
+                        case BooleanFunction::NodeType::And:
+                            m_program.push_back({OpCode::And, BooleanFunction::Value::X, 0});
+                            break;
+                        case BooleanFunction::NodeType::Or:
+                            m_program.push_back({OpCode::Or, BooleanFunction::Value::X, 0});
+                            break;
+                        default:
+                            m_program.push_back({OpCode::Xor, BooleanFunction::Value::X, 0});
+                            break;
+                    }
+                    depth -= node.get_arity() - 1;
+                }
+                max_depth = std::max(max_depth, depth);
+            }
+        }
+        else
+        {
+            FallbackFunction fallback;
+            fallback.function = function;
+            for (const auto& [pin, net_index] : pin_to_net)
+            {
+                fallback.inputs.emplace_back(pin, net_index);
+            }
+
+            m_program.push_back({OpCode::Evaluate, BooleanFunction::Value::X, (u32)m_fallback_functions.size()});
+            m_fallback_functions.push_back(std::move(fallback));
+        }
+
+        m_stack.resize(std::max<size_t>(m_stack.size(), max_depth), BooleanFunction::Value::X);
+
+        compiled.end = m_program.size();
+        return compiled;
+    }
+
+    BooleanFunction::Value LevelizedSimulator::execute(u32 begin, u32 end)
+    {
+        BooleanFunction::Value* sp = m_stack.data();
+        for (u32 i = begin; i < end; i++)
+        {
+            const Instruction& ins = m_program[i];
+            switch (ins.op)
+            {
+                case OpCode::LoadNet:
+                    *sp++ = m_values[ins.arg];
+                    break;
+                case OpCode::LoadConst:
+                    *sp++ = ins.value;
+                    break;
+                case OpCode::Not:
+                    sp[-1] = simulation_utils::apply_not(sp[-1]);
+                    break;
+                case OpCode::And:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_and(sp[-1], sp[0]);
+                    break;
+                case OpCode::Or:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_or(sp[-1], sp[0]);
+                    break;
+                case OpCode::Xor:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_xor(sp[-1], sp[0]);
+                    break;
+                case OpCode::Evaluate: {
+                    const FallbackFunction& fallback = m_fallback_functions[ins.arg];
+                    std::unordered_map<std::string, BooleanFunction::Value> inputs;
+                    for (const auto& [pin, net_index] : fallback.inputs)
+                    {
+                        inputs[pin] = (net_index == no_net) ? BooleanFunction::Value::X : m_values[net_index];
+                    }
+                    const auto res = fallback.function.evaluate(inputs);
+                    *sp++          = res.is_ok() ? res.get() : BooleanFunction::Value::X;
+                    break;
+                }
+                case OpCode::Store:
+                    write_value(ins.arg, *--sp);
+                    break;
+            }
+        }
+
+        return (sp != m_stack.data()) ? sp[-1] : BooleanFunction::Value::X;
+    }
+
+    BooleanFunction::Value LevelizedSimulator::evaluate(const Function& function)
+    {
+        return execute(function.begin, function.end);
+    }
+
+    void LevelizedSimulator::partition_combinational_logic(const std::vector<u32>& gate_bounds, u32 num_threads)
+    {
+        m_partitions.clear();
+        m_worker_pool.reset();
+
+        const u32 num_gates = gate_bounds.size() - 1;
+        if (num_threads <= 1 || num_gates < num_threads)
+        {
+            return;
+        }
+
+        // (1) determine the gate driving every net and the predecessors of every levelized gate
+        std::vector<u32> drivers(m_nets.size(), no_net);
+        for (u32 g = 0; g < num_gates; g++)
+        {
+            for (u32 i = gate_bounds[g]; i < gate_bounds[g + 1]; i++)
+            {
+                if (const Instruction& ins = m_program[i]; ins.op == OpCode::Store)
+                {
+                    if (drivers[ins.arg] != no_net && drivers[ins.arg] != g)
+                    {
+                        log_warning("hal_simulator", "net '{}' with ID {} is driven by multiple gates, evaluating the combinational logic using a single thread.", m_nets[ins.arg]->get_name(), m_nets[ins.arg]->get_id());
+                        return;
+                    }
+                    drivers[ins.arg] = g;
+                }
+            }
+        }
+
+        std::vector<std::vector<u32>> predecessors(num_gates);
+        auto add_predecessor = [&drivers, &predecessors](u32 g, u32 net_index) {
+            if (net_index == no_net || drivers[net_index] == no_net)
+            {
+                return;
+            }
+            if (std::vector<u32>& preds = predecessors[g]; std::find(preds.begin(), preds.end(), drivers[net_index]) == preds.end())
+            {
+                preds.push_back(drivers[net_index]);
+            }
+        };
+        for (u32 g = 0; g < num_gates; g++)
+        {
+            for (u32 i = gate_bounds[g]; i < gate_bounds[g + 1]; i++)
+            {
+                const Instruction& ins = m_program[i];
+                if (ins.op == OpCode::LoadNet)
+                {
+                    add_predecessor(g, ins.arg);
+                }
+                else if (ins.op == OpCode::Evaluate)
+                {
+                    for (const auto& [pin, net_index] : m_fallback_functions[ins.arg].inputs)
+                    {
+                        add_predecessor(g, net_index);
+                    }
+                }
+            }
+        }
+
+        // (2) assign the fan-in cones of the sequential gates (and then of all remaining gates) to the least loaded partition, a cone stops at gates that are already assigned
+        std::vector<u32> owners(num_gates, no_net);
+        std::vector<u64> loads(num_threads, 0);
+        std::vector<u32> affinities(num_threads, 0);
+        u64 total_load = 0;
+        std::vector<u32> cone;
+        std::vector<u32> stack;
+        auto assign_cone = [&](u32 root) {
+            if (root == no_net || owners[root] != no_net)
+            {
+                return;
+            }
+
+            cone.clear();
+            stack.assign(1, root);
+            owners[root] = num_threads;
+            while (!stack.empty())
+            {
+                const u32 g = stack.back();
+                stack.pop_back();
+                cone.push_back(g);
+                for (const u32 pred : predecessors[g])
+                {
+                    if (owners[pred] == no_net)
+                    {
+                        owners[pred] = num_threads;
+                        stack.push_back(pred);
+                    }
+                }
+            }
+
+            // prefer the partition that already owns most of the gates feeding the cone unless it would become overloaded
+            u64 cone_load = 0;
+            std::fill(affinities.begin(), affinities.end(), 0);
+            for (const u32 g : cone)
+            {
+                cone_load += gate_bounds[g + 1] - gate_bounds[g];
+                for (const u32 pred : predecessors[g])
+                {
+                    if (owners[pred] < num_threads)
+                    {
+                        affinities[owners[pred]]++;
+                    }
+                }
+            }
+            total_load += cone_load;
+
+            u32 partition = std::min_element(loads.begin(), loads.end()) - loads.begin();
+            for (u32 p = 0; p < num_threads; p++)
+            {
+                if (affinities[p] > affinities[partition] && (loads[p] + cone_load) * num_threads <= total_load + total_load / 4)
+                {
+                    partition = p;
+                }
+            }
+            for (const u32 g : cone)
+            {
+                owners[g] = partition;
+            }
+            loads[partition] += cone_load;
+        };
+        auto assign_net = [&assign_cone, &drivers](u32 net_index) {
+            if (net_index != no_net)
+            {
+                assign_cone(drivers[net_index]);
+            }
+        };
+
+        for (const FlipFlop& ff : m_flip_flops)
+        {
+            std::for_each(ff.input_nets.begin(), ff.input_nets.end(), assign_net);
+        }
+        for (const RAM& ram : m_rams)
+        {
+            for (const RAM::Port& port : ram.ports)
+            {
+                assign_net(port.clock_net);
+                std::for_each(port.address_nets.begin(), port.address_nets.end(), assign_net);
+                if (port.is_write)
+                {
+                    std::for_each(port.data_nets.begin(), port.data_nets.end(), assign_net);
+                }
+            }
+        }
+        for (u32 g = num_gates; g-- > 0;)
+        {
+            assign_cone(g);
+        }
+
+        // (3) compile every partition from its own gates and duplicates of all gates of other partitions within their fan-in
+        m_partitions.resize(num_threads);
+        std::vector<u8> required(num_gates);
+        std::vector<u32> local_slots(m_nets.size());
+        u64 num_instructions = 0;
+        u32 num_duplicates   = 0;
+        for (u32 p = 0; p < num_threads; p++)
+        {
+            Partition& partition = m_partitions[p];
+
+            for (u32 g = 0; g < num_gates; g++)
+            {
+                required[g] = (owners[g] == p);
+            }
+            for (u32 g = num_gates; g-- > 0;)
+            {
+                if (required[g])
+                {
+                    for (const u32 pred : predecessors[g])
+                    {
+                        required[pred] = 1;
+                    }
+                }
+            }
+
+            std::fill(local_slots.begin(), local_slots.end(), no_net);
+            auto map_net = [&local_slots](u32 net_index) { return (net_index != no_net && local_slots[net_index] != no_net) ? (local_slots[net_index] | local_net) : net_index; };
+
+            for (u32 g = 0; g < num_gates; g++)
+            {
+                if (!required[g])
+                {
+                    continue;
+                }
+
+                const bool is_duplicate = (owners[g] != p);
+                num_duplicates += is_duplicate ? 1 : 0;
+                for (u32 i = gate_bounds[g]; i < gate_bounds[g + 1]; i++)
+                {
+                    Instruction ins = m_program[i];
+                    if (ins.op == OpCode::LoadNet)
+                    {
+                        ins.arg = map_net(ins.arg);
+                    }
+                    else if (ins.op == OpCode::Evaluate)
+                    {
+                        FallbackFunction fallback = m_fallback_functions[ins.arg];
+                        for (auto& [pin, net_index] : fallback.inputs)
+                        {
+                            net_index = map_net(net_index);
+                        }
+                        ins.arg = partition.fallback_functions.size();
+                        partition.fallback_functions.push_back(std::move(fallback));
+                    }
+                    else if (ins.op == OpCode::Store && is_duplicate)
+                    {
+                        local_slots[ins.arg] = partition.scratch.size();
+                        ins.arg              = partition.scratch.size() | local_net;
+                        partition.scratch.push_back(BooleanFunction::Value::X);
+                    }
+                    partition.program.push_back(ins);
+                }
+            }
+
+            partition.stack.resize(m_stack.size(), BooleanFunction::Value::X);
+            num_instructions += partition.program.size();
+        }
+
+        m_worker_pool = std::make_unique<WorkerPool>(num_threads);
+
+        log_info("hal_simulator", "split the levelized combinational logic into {} partitions of {} instructions in total, duplicating {} gates.", num_threads, num_instructions, num_duplicates);
+    }
+
+    void LevelizedSimulator::execute_partition(Partition& partition)
+    {
+        auto load = [this, &partition](u32 net_index) { return (net_index & local_net) ? partition.scratch[net_index & ~local_net] : m_values[net_index]; };
+
+        BooleanFunction::Value* sp = partition.stack.data();
+        for (const Instruction& ins : partition.program)
+        {
+            switch (ins.op)
+            {
+                case OpCode::LoadNet:
+                    *sp++ = load(ins.arg);
+                    break;
+                case OpCode::LoadConst:
+                    *sp++ = ins.value;
+                    break;
+                case OpCode::Not:
+                    sp[-1] = simulation_utils::apply_not(sp[-1]);
+                    break;
+                case OpCode::And:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_and(sp[-1], sp[0]);
+                    break;
+                case OpCode::Or:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_or(sp[-1], sp[0]);
+                    break;
+                case OpCode::Xor:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_xor(sp[-1], sp[0]);
+                    break;
+                case OpCode::Evaluate: {
+                    const FallbackFunction& fallback = partition.fallback_functions[ins.arg];
+                    std::unordered_map<std::string, BooleanFunction::Value> inputs;
+                    for (const auto& [pin, net_index] : fallback.inputs)
+                    {
+                        inputs[pin] = (net_index == no_net) ? BooleanFunction::Value::X : load(net_index);
+                    }
+                    const auto res = fallback.function.evaluate(inputs);
+                    *sp++          = res.is_ok() ? res.get() : BooleanFunction::Value::X;
+                    break;
+                }
+                case OpCode::Store: {
+                    const BooleanFunction::Value value = *--sp;
+                    if (ins.arg & local_net)
+                    {
+                        partition.scratch[ins.arg & ~local_net] = value;
+                        break;
+                    }
+
+                    // every net is owned by a single partition, so no other thread accesses its state
+                    if (m_values[ins.arg] == value)
+                    {
+                        break;
+                    }
+                    m_values[ins.arg] = value;
+                    partition.num_value_changes++;
+                    if (!m_changed[ins.arg])
+                    {
+                        m_changed[ins.arg] = 1;
+                        partition.changed_nets.push_back(ins.arg);
+                    }
+                    if (!m_touched[ins.arg])
+                    {
+                        m_touched[ins.arg] = 1;
+                        partition.touched_nets.push_back(ins.arg);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    void LevelizedSimulator::write_value(u32 net_index, BooleanFunction::Value value)
+    {
+        if (net_index == no_net || m_values[net_index] == value)
+        {
+            return;
+        }
+
+        m_values[net_index] = value;
+        m_num_value_changes++;
+        if (!m_changed[net_index])
+        {
+            m_changed[net_index] = 1;
+            m_changed_nets.push_back(net_index);
+        }
+        if (!m_touched[net_index])
+        {
+            m_touched[net_index] = 1;
+            m_touched_nets.push_back(net_index);
+        }
+    }
+
+    bool LevelizedSimulator::evaluate_combinational()
+    {
+        // a single pass suffices for all levelized gates
+        if (m_partitions.empty())
+        {
+            execute(0, m_levelized_end);
+        }
+        else
+        {
+            m_worker_pool->run([this](u32 index) { execute_partition(m_partitions[index]); });
+
+            // merge the changes of all partitions
+            for (Partition& partition : m_partitions)
+            {
+                m_changed_nets.insert(m_changed_nets.end(), partition.changed_nets.begin(), partition.changed_nets.end());
+                m_touched_nets.insert(m_touched_nets.end(), partition.touched_nets.begin(), partition.touched_nets.end());
+                m_num_value_changes += partition.num_value_changes;
+                partition.changed_nets.clear();
+                partition.touched_nets.clear();
+                partition.num_value_changes = 0;
+            }
+        }
+
+        // gates within combinational loops are evaluated until they are stable
+        for (u64 iteration = 0; m_loop_end > m_levelized_end; iteration++)
+        {
+            const u64 num_changes = m_num_value_changes;
+            execute(m_levelized_end, m_loop_end);
+            if (num_changes == m_num_value_changes)
+            {
+                break;
+            }
+            if (m_timeout_iterations > 0 && iteration >= m_timeout_iterations)
+            {
+                log_error("hal_simulator", "reached iteration timeout of {} while evaluating combinational loops, aborting simulation.", m_timeout_iterations);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool LevelizedSimulator::clock_sequential_gates()
+    {
+        auto is_changed = [this](u32 net_index) { return net_index != no_net && m_changed[net_index]; };
+        auto get_value  = [this](u32 net_index) { return (net_index == no_net) ? BooleanFunction::Value::X : m_values[net_index]; };
+
+        // compute all new outputs before applying any of them, so that all gates sample the same state
+        std::vector<std::pair<u32, BooleanFunction::Value>> updates;
+        for (const FlipFlop& ff : m_flip_flops)
+        {
+            if (std::none_of(ff.input_nets.begin(), ff.input_nets.end(), is_changed))
+            {
+                continue;
+            }
+
+            BooleanFunction::Value result;
+            const BooleanFunction::Value async_set   = evaluate(ff.set_func);
+            const BooleanFunction::Value async_reset = evaluate(ff.reset_func);
+
+            // check whether an asynchronous set or reset is triggered, which takes precedence over the clock
+            if (async_set == BooleanFunction::Value::ONE && async_reset == BooleanFunction::Value::ONE)
+            {
+                // both signals set? -> evaluate special behavior
+                const BooleanFunction::Value old_output     = ff.state_nets.empty() ? BooleanFunction::Value::X : m_values[ff.state_nets.front()];
+                const BooleanFunction::Value old_output_inv = ff.neg_state_nets.empty() ? BooleanFunction::Value::X : m_values[ff.neg_state_nets.front()];
+                for (const u32 net_index : ff.state_nets)
+                {
+                    updates.emplace_back(net_index, simulation_utils::process_clear_preset_behavior(ff.sr_behavior_out, old_output));
+                }
+                for (const u32 net_index : ff.neg_state_nets)
+                {
+                    updates.emplace_back(net_index, simulation_utils::process_clear_preset_behavior(ff.sr_behavior_out_inverted, old_output_inv));
+                }
+                continue;
+            }
+            else if (async_set == BooleanFunction::Value::ONE)
+            {
+                result = BooleanFunction::Value::ONE;
+            }
+            else if (async_reset == BooleanFunction::Value::ONE)
+            {
+                result = BooleanFunction::Value::ZERO;
+            }
+            else if (std::any_of(ff.clock_nets.begin(), ff.clock_nets.end(), is_changed) && evaluate(ff.clock_func) == BooleanFunction::Value::ONE)
+            {
+                result = evaluate(ff.next_state_func);
+            }
+            else
+            {
+                continue;
+            }
+
+            for (const u32 net_index : ff.state_nets)
+            {
+                updates.emplace_back(net_index, result);
+            }
+            for (const u32 net_index : ff.neg_state_nets)
+            {
+                updates.emplace_back(net_index, simulation_utils::toggle(result));
+            }
+        }
+
+        for (RAM& ram : m_rams)
+        {
+            std::vector<const RAM::Port*> clocked_read_ports;
+            std::vector<const RAM::Port*> clocked_write_ports;
+            for (const RAM::Port& port : ram.ports)
+            {
+                if (is_changed(port.clock_net) && evaluate(port.clock_func) == BooleanFunction::Value::ONE && evaluate(port.enable_func) == BooleanFunction::Value::ONE)
+                {
+                    (port.is_write ? clocked_write_ports : clocked_read_ports).push_back(&port);
+                }
+            }
+
+            for (const RAM::Port* port : clocked_read_ports)
+            {
+                std::vector<BooleanFunction::Value> address_values;
+                std::transform(port->address_nets.begin(), port->address_nets.end(), std::back_inserter(address_values), get_value);
+
+                const u32 data_size   = port->data_nets.size();
+                const u32 read_data   = simulation_utils::get_data_word(ram.data, simulation_utils::values_to_int(address_values), data_size);
+                const auto data_value = simulation_utils::int_to_values(read_data, data_size);
+                for (u32 i = 0; i < data_size && i < data_value.size(); i++)
+                {
+                    updates.emplace_back(port->data_nets[i], data_value[i]);
+                }
+            }
+
+            for (const RAM::Port* port : clocked_write_ports)
+            {
+                std::vector<BooleanFunction::Value> address_values;
+                std::transform(port->address_nets.begin(), port->address_nets.end(), std::back_inserter(address_values), get_value);
+
+                const u32 address = simulation_utils::values_to_int(address_values);
+                const u32 data_size = port->data_nets.size();
+                auto data_values    = simulation_utils::int_to_values(simulation_utils::get_data_word(ram.data, address, data_size), data_size);
+                for (u32 i = 0; i < data_size && i < data_values.size(); i++)
+                {
+                    if (const auto it = port->write_mask_funcs.find(i); it != port->write_mask_funcs.end() && evaluate(it->second) != BooleanFunction::Value::ONE)
+                    {
+                        continue;
+                    }
+                    data_values[i] = get_value(port->data_nets[i]);
+                }
+                simulation_utils::set_data_word(ram.data, simulation_utils::values_to_int(data_values), address, data_size);
+            }
+        }
+
+        for (const u32 net_index : m_changed_nets)
+        {
+            m_changed[net_index] = 0;
+        }
+        m_changed_nets.clear();
+
+        for (const auto& [net_index, value] : updates)
+        {
+            write_value(net_index, value);
+        }
+
+        return !m_changed_nets.empty();
+    }
+
+    bool LevelizedSimulator::process_time_step(u64 time)
+    {
+        if (m_changed_nets.empty())
+        {
+            return true;
+        }
+
+        // propagate all signals at the current point in time, THEN clock all sequential gates and repeat until the circuit is stable
+        if (!evaluate_combinational())
+        {
+            return false;
+        }
+        for (u64 iteration = 0; clock_sequential_gates(); iteration++)
+        {
+            if (m_timeout_iterations > 0 && iteration >= m_timeout_iterations)
+            {
+                log_error("hal_simulator", "reached iteration timeout of {} without advancing in time, aborting simulation. Please check for a combinational loop.", m_timeout_iterations);
+                return false;
+            }
+            if (!evaluate_combinational())
+            {
+                return false;
+            }
+        }
+
+        record_events(time);
+        return true;
+    }
+
+    void LevelizedSimulator::record_events(u64 time)
+    {
+        for (const u32 net_index : m_touched_nets)
+        {
+            m_touched[net_index] = 0;
+
+            std::vector<WaveEvent>& events     = m_events[net_index];
+            const BooleanFunction::Value value = m_values[net_index];
+            if (!events.empty())
+            {
+                // if the value did not change, skip it
+                if (events.back().new_value == value)
+                {
+                    continue;
+                }
+                // if there was already an event for this point in time, we simply update the value
+                else if (events.back().time == time)
+                {
+                    events.back().new_value = value;
+                    if (events.size() > 1 && events[events.size() - 2].new_value == value)
+                    {
+                        events.pop_back();
+                    }
+                    continue;
+                }
+            }
+
+            WaveEvent e;
+            e.affected_net = m_nets[net_index];
+            e.new_value    = value;
+            e.time         = time;
+            e.id           = m_id_counter++;
+            events.push_back(e);
+        }
+        m_touched_nets.clear();
+    }
+
+    void LevelizedSimulator::simulate(u64 picoseconds)
+    {
+        if (!m_is_initialized && !initialize())
+        {
+            return;
+        }
+
+        const u64 end_time = m_current_time + picoseconds;
+
+        // apply all inputs at the current point in time
+        for (const auto& [net, value] : m_pending_inputs)
+        {
+            // nets that do not drive any simulated gate are only recorded
+            write_value(add_net(net), value);
+        }
+        m_pending_inputs.clear();
+
+        // collect all clock switches within the simulated period, a clock is 0 (or 1 if not starting at zero) in every even half period
+        std::vector<std::tuple<u64, u32, BooleanFunction::Value>> clock_events;
+        for (const SimulationInput::Clock& c : mSimulationInput->get_clocks())
+        {
+            const auto it = m_net_id_to_index.find(c.clock_net->get_id());
+            if (it == m_net_id_to_index.end() || c.switch_time == 0)
+            {
+                continue;
+            }
+
+            u64 time                 = m_current_time - (m_current_time % c.switch_time);
+            BooleanFunction::Value v = ((time / c.switch_time) % 2 == 0) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+            if (!c.start_at_zero)
+            {
+                v = simulation_utils::toggle(v);
+            }
+
+            for (; time < end_time; time += c.switch_time)
+            {
+                clock_events.emplace_back(std::max(time, m_current_time), it->second, v);
+                v = simulation_utils::toggle(v);
+            }
+        }
+        std::stable_sort(clock_events.begin(), clock_events.end(), [](const auto& a, const auto& b) { return std::get<0>(a) < std::get<0>(b); });
+
+        // process the current point in time and every point in time at which a clock switches
+        auto event_it = clock_events.begin();
+        for (u64 time = m_current_time;;)
+        {
+            for (; event_it != clock_events.end() && std::get<0>(*event_it) == time; ++event_it)
+            {
+                write_value(std::get<1>(*event_it), std::get<2>(*event_it));
+            }
+
+            if (!process_time_step(time) || event_it == clock_events.end())
+            {
+                break;
+            }
+            time = std::get<0>(*event_it);
+        }
+
+        m_current_time = end_time;
+    }
+
+    template<u32 W>
+    bool LevelizedSimulator::simulate_lanes(const std::vector<std::vector<SimulationInputNetEvent>>& stimuli,
+                                            u32 first_stimulus,
+                                            const std::vector<const Net*>& traced_nets,
+                                            const std::vector<u32>& trace_slots,
+                                            BatchSimulationResult& result)
+    {
+        const u32 num_lanes = std::min<u32>(64 * W, stimuli.size() - first_stimulus);
+        const u32 num_nets  = m_nets.size();
+
+        // schedule the input events of every lane, a lane is recorded until its last input event ends
+        std::map<u64, std::vector<std::pair<u32, const SimulationInputNetEvent*>>> input_events;
+        std::vector<u64> end_times(num_lanes, 0);
+        std::vector<u64> last_start_times(num_lanes, ~u64(0));
+        u64 end_time = 0;
+        for (u32 lane = 0; lane < num_lanes; lane++)
+        {
+            u64 time = 0;
+            for (const SimulationInputNetEvent& net_event : stimuli[first_stimulus + lane])
+            {
+                input_events[time].emplace_back(lane, &net_event);
+                last_start_times[lane] = time;
+                time += net_event.get_simulation_duration();
+            }
+            end_times[lane] = time;
+            end_time        = std::max(end_time, time);
+        }
+
+        // clocks are shared by all lanes
+        std::vector<std::tuple<u64, u32, BooleanFunction::Value>> clock_events;
+        for (const SimulationInput::Clock& c : mSimulationInput->get_clocks())
+        {
+            const auto it = m_net_id_to_index.find(c.clock_net->get_id());
+            if (it == m_net_id_to_index.end() || c.switch_time == 0)
+            {
+                continue;
+            }
+
+            BooleanFunction::Value v = c.start_at_zero ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+            for (u64 time = 0; time < end_time; time += c.switch_time)
+            {
+                clock_events.emplace_back(time, it->second, v);
+                v = simulation_utils::toggle(v);
+            }
+        }
+        std::stable_sort(clock_events.begin(), clock_events.end(), [](const auto& a, const auto& b) { return std::get<0>(a) < std::get<0>(b); });
+
+        // simulation state of all lanes, mirrors the state of the regular simulation with one bit per lane instead of a single value
+        std::vector<LaneValue<W>> values(num_nets);
+        std::vector<LaneValue<W>> recorded_values(num_nets);
+        std::vector<LaneValue<W>> stack(m_stack.size());
+        std::vector<std::array<u64, W>> changed(num_nets);
+        std::vector<u8> is_changed(num_nets, 0);
+        std::vector<u32> changed_nets;
+        std::vector<u8> touched(num_nets, 0);
+        std::vector<u32> touched_nets;
+        std::vector<std::array<u64, W>> unrecorded(num_nets);
+        std::vector<std::vector<WaveEvent>> lane_events(num_lanes * traced_nets.size());
+        std::vector<u64> id_counters(num_lanes, 0);
+        u64 num_value_changes = 0;
+
+        auto write_lanes = [&](u32 net_index, const LaneValue<W>& value) {
+            if (net_index == no_net)
+            {
+                return;
+            }
+
+            LaneValue<W>& old_value = values[net_index];
+            std::array<u64, W> diff;
+            u64 any_diff = 0;
+            for (u32 w = 0; w < W; w++)
+            {
+                diff[w] = (old_value.one[w] ^ value.one[w]) | (old_value.zero[w] ^ value.zero[w]);
+                any_diff |= diff[w];
+            }
+            if (any_diff == 0)
+            {
+                return;
+            }
+
+            old_value = value;
+            num_value_changes++;
+            for (u32 w = 0; w < W; w++)
+            {
+                changed[net_index][w] |= diff[w];
+            }
+            if (!is_changed[net_index])
+            {
+                is_changed[net_index] = 1;
+                changed_nets.push_back(net_index);
+            }
+            if (!touched[net_index])
+            {
+                touched[net_index] = 1;
+                touched_nets.push_back(net_index);
+            }
+        };
+
+        auto execute_lanes = [&](u32 begin, u32 end) {
+            LaneValue<W>* sp = stack.data();
+            for (u32 i = begin; i < end; i++)
+            {
+                const Instruction& ins = m_program[i];
+                switch (ins.op)
+                {
+                    case OpCode::LoadNet:
+                        *sp++ = values[ins.arg];
+                        break;
+                    case OpCode::LoadConst:
+                        *sp++ = broadcast_value<W>(ins.value);
+                        break;
+                    case OpCode::Not:
+                        sp[-1] = invert_lanes(sp[-1]);
+                        break;
+                    case OpCode::And: {
+                        const LaneValue<W>& a = sp[-2];
+                        const LaneValue<W>& b = sp[-1];
+                        for (u32 w = 0; w < W; w++)
+                        {
+                            sp[-2].one[w]  = a.one[w] & b.one[w];
+                            sp[-2].zero[w] = a.zero[w] | b.zero[w];
+                        }
+                        sp--;
+                        break;
+                    }
+                    case OpCode::Or: {
+                        const LaneValue<W>& a = sp[-2];
+                        const LaneValue<W>& b = sp[-1];
+                        for (u32 w = 0; w < W; w++)
+                        {
+                            sp[-2].one[w]  = a.one[w] | b.one[w];
+                            sp[-2].zero[w] = a.zero[w] & b.zero[w];
+                        }
+                        sp--;
+                        break;
+                    }
+                    case OpCode::Xor: {
+                        const LaneValue<W> a  = sp[-2];
+                        const LaneValue<W>& b = sp[-1];
+                        for (u32 w = 0; w < W; w++)
+                        {
+                            sp[-2].one[w]  = (a.one[w] & b.zero[w]) | (a.zero[w] & b.one[w]);
+                            sp[-2].zero[w] = (a.one[w] & b.one[w]) | (a.zero[w] & b.zero[w]);
+                        }
+                        sp--;
+                        break;
+                    }
+                    case OpCode::Evaluate: {
+                        // functions that cannot be compiled are evaluated lane by lane
+                        const FallbackFunction& fallback = m_fallback_functions[ins.arg];
+                        std::unordered_map<std::string, BooleanFunction::Value> inputs;
+                        LaneValue<W> lane_result;
+                        for (u32 lane = 0; lane < num_lanes; lane++)
+                        {
+                            for (const auto& [pin, net_index] : fallback.inputs)
+                            {
+                                inputs[pin] = (net_index == no_net) ? BooleanFunction::Value::X : get_lane_value(values[net_index], lane);
+                            }
+                            const auto res = fallback.function.evaluate(inputs);
+                            set_lane_value(lane_result, lane, res.is_ok() ? res.get() : BooleanFunction::Value::X);
+                        }
+                        *sp++ = lane_result;
+                        break;
+                    }
+                    case OpCode::Store:
+                        sp--;
+                        write_lanes(ins.arg, *sp);
+                        break;
+                }
+            }
+
+            return (sp != stack.data()) ? sp[-1] : LaneValue<W>();
+        };
+
+        auto evaluate_combinational_lanes = [&]() {
+            execute_lanes(0, m_levelized_end);
+            for (u64 iteration = 0; m_loop_end > m_levelized_end; iteration++)
+            {
+                const u64 num_changes = num_value_changes;
+                execute_lanes(m_levelized_end, m_loop_end);
+                if (num_changes == num_value_changes)
+                {
+                    break;
+                }
+                if (m_timeout_iterations > 0 && iteration >= m_timeout_iterations)
+                {
+                    log_error("hal_simulator", "reached iteration timeout of {} while evaluating combinational loops, aborting simulation.", m_timeout_iterations);
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto clock_sequential_lanes = [&]() {
+            // every update only applies to the lanes selected by its mask
+            std::vector<std::tuple<u32, std::array<u64, W>, LaneValue<W>>> updates;
+            auto add_updates = [&updates](const std::vector<u32>& net_indices, const std::array<u64, W>& mask, const LaneValue<W>& value) {
+                for (const u32 net_index : net_indices)
+                {
+                    updates.emplace_back(net_index, mask, value);
+                }
+            };
+
+            for (const FlipFlop& ff : m_flip_flops)
+            {
+                std::array<u64, W> active{};
+                u64 any_active = 0;
+                for (const u32 net_index : ff.input_nets)
+                {
+                    for (u32 w = 0; w < W; w++)
+                    {
+                        active[w] |= changed[net_index][w];
+                        any_active |= changed[net_index][w];
+                    }
+                }
+                if (any_active == 0)
+                {
+                    continue;
+                }
+
+                std::array<u64, W> clock_changed{};
+                for (const u32 net_index : ff.clock_nets)
+                {
+                    for (u32 w = 0; w < W; w++)
+                    {
+                        clock_changed[w] |= changed[net_index][w];
+                    }
+                }
+
+                const LaneValue<W> async_set   = execute_lanes(ff.set_func.begin, ff.set_func.end);
+                const LaneValue<W> async_reset = execute_lanes(ff.reset_func.begin, ff.reset_func.end);
+                const LaneValue<W> clock       = execute_lanes(ff.clock_func.begin, ff.clock_func.end);
+                const LaneValue<W> next_state  = execute_lanes(ff.next_state_func.begin, ff.next_state_func.end);
+
+                // asynchronous set and reset take precedence over the clock, lanes in which both are active follow the special behavior
+                LaneValue<W> next_value;
+                std::array<u64, W> both_mask, update_mask;
+                u64 any_both = 0, any_update = 0;
+                for (u32 w = 0; w < W; w++)
+                {
+                    const u64 set_only   = active[w] & async_set.one[w] & ~async_reset.one[w];
+                    const u64 reset_only = active[w] & async_reset.one[w] & ~async_set.one[w];
+                    const u64 clocked    = active[w] & ~async_set.one[w] & ~async_reset.one[w] & clock_changed[w] & clock.one[w];
+
+                    both_mask[w]       = active[w] & async_set.one[w] & async_reset.one[w];
+                    update_mask[w]     = set_only | reset_only | clocked;
+                    next_value.one[w]  = set_only | (clocked & next_state.one[w]);
+                    next_value.zero[w] = reset_only | (clocked & next_state.zero[w]);
+                    any_both |= both_mask[w];
+                    any_update |= update_mask[w];
+                }
+
+                if (any_both != 0)
+                {
+                    const LaneValue<W> old_output     = ff.state_nets.empty() ? LaneValue<W>() : values[ff.state_nets.front()];
+                    const LaneValue<W> old_output_inv = ff.neg_state_nets.empty() ? LaneValue<W>() : values[ff.neg_state_nets.front()];
+                    add_updates(ff.state_nets, both_mask, process_clear_preset_behavior_lanes(ff.sr_behavior_out, old_output));
+                    add_updates(ff.neg_state_nets, both_mask, process_clear_preset_behavior_lanes(ff.sr_behavior_out_inverted, old_output_inv));
+                }
+                if (any_update != 0)
+                {
+                    add_updates(ff.state_nets, update_mask, next_value);
+                    add_updates(ff.neg_state_nets, update_mask, invert_lanes(next_value));
+                }
+            }
+
+            for (const u32 net_index : changed_nets)
+            {
+                changed[net_index].fill(0);
+                is_changed[net_index] = 0;
+            }
+            changed_nets.clear();
+
+            for (const auto& [net_index, mask, value] : updates)
+            {
+                LaneValue<W> new_value = values[net_index];
+                for (u32 w = 0; w < W; w++)
+                {
+                    new_value.one[w]  = (new_value.one[w] & ~mask[w]) | (value.one[w] & mask[w]);
+                    new_value.zero[w] = (new_value.zero[w] & ~mask[w]) | (value.zero[w] & mask[w]);
+                }
+                write_lanes(net_index, new_value);
+            }
+
+            return !changed_nets.empty();
+        };
+
+        auto record_lanes = [&](u64 time) {
+            std::array<u64, W> recording{};
+            for (u32 lane = 0; lane < num_lanes; lane++)
+            {
+                if (time < end_times[lane] || time == last_start_times[lane])
+                {
+                    recording[lane / 64] |= u64(1) << (lane % 64);
+                }
+            }
+
+            for (const u32 net_index : touched_nets)
+            {
+                touched[net_index] = 0;
+
+                const LaneValue<W>& value = values[net_index];
+                LaneValue<W>& recorded    = recorded_values[net_index];
+                const u32 trace_slot      = trace_slots[net_index];
+                for (u32 w = 0; w < W; w++)
+                {
+                    // only transitions between 0 and 1 count as toggles
+                    for (u64 toggled = recording[w] & ((recorded.one[w] & value.zero[w]) | (recorded.zero[w] & value.one[w])); toggled != 0; toggled &= toggled - 1)
+                    {
+                        result.toggle_counts[first_stimulus + w * 64 + __builtin_ctzll(toggled)][net_index]++;
+                    }
+
+                    // only lanes in which the value differs from the last recorded one produce an event, except for the very first event of a net
+                    const u64 emitted = recording[w] & ((recorded.one[w] ^ value.one[w]) | (recorded.zero[w] ^ value.zero[w]) | unrecorded[net_index][w]);
+                    unrecorded[net_index][w] &= ~recording[w];
+                    recorded.one[w]  = (recorded.one[w] & ~recording[w]) | (value.one[w] & recording[w]);
+                    recorded.zero[w] = (recorded.zero[w] & ~recording[w]) | (value.zero[w] & recording[w]);
+
+                    if (trace_slot == no_net)
+                    {
+                        continue;
+                    }
+
+                    for (u64 bits = emitted; bits != 0; bits &= bits - 1)
+                    {
+                        const u32 lane = w * 64 + __builtin_ctzll(bits);
+
+                        WaveEvent e;
+                        e.affected_net = m_nets[net_index];
+                        e.new_value    = get_lane_value(value, lane);
+                        e.time         = time;
+                        e.id           = id_counters[lane]++;
+                        lane_events[lane * traced_nets.size() + trace_slot].push_back(e);
+                    }
+                }
+            }
+            touched_nets.clear();
+        };
+
+        auto process_lanes = [&](u64 time) {
+            if (changed_nets.empty())
+            {
+                return true;
+            }
+
+            if (!evaluate_combinational_lanes())
+            {
+                return false;
+            }
+            for (u64 iteration = 0; clock_sequential_lanes(); iteration++)
+            {
+                if (m_timeout_iterations > 0 && iteration >= m_timeout_iterations)
+                {
+                    log_error("hal_simulator", "reached iteration timeout of {} without advancing in time, aborting simulation. Please check for a combinational loop.", m_timeout_iterations);
+                    return false;
+                }
+                if (!evaluate_combinational_lanes())
+                {
+                    return false;
+                }
+            }
+
+            record_lanes(time);
+            return true;
+        };
+
+        // start from the initial state in all lanes and evaluate the entire circuit in the first time step, nets that do not belong to the circuit are only recorded once they change
+        for (const auto& [net_index, value] : m_init_values)
+        {
+            write_lanes(net_index, broadcast_value<W>(value));
+        }
+        for (u32 i = 0; i < m_num_circuit_nets; i++)
+        {
+            unrecorded[i].fill(~u64(0));
+            changed[i].fill(~u64(0));
+            if (!is_changed[i])
+            {
+                is_changed[i] = 1;
+                changed_nets.push_back(i);
+            }
+            if (!touched[i])
+            {
+                touched[i] = 1;
+                touched_nets.push_back(i);
+            }
+        }
+
+        auto input_it = input_events.begin();
+        auto clock_it = clock_events.begin();
+        while (input_it != input_events.end() || clock_it != clock_events.end())
+        {
+            u64 time = ~u64(0);
+            if (input_it != input_events.end())
+            {
+                time = input_it->first;
+            }
+            if (clock_it != clock_events.end())
+            {
+                time = std::min(time, std::get<0>(*clock_it));
+            }
+
+            // apply the inputs of all lanes first, followed by the clocks
+            for (; input_it != input_events.end() && input_it->first == time; ++input_it)
+            {
+                for (const auto& [lane, net_event] : input_it->second)
+                {
+                    for (const auto& [net, value] : *net_event)
+                    {
+                        const u32 net_index    = m_net_id_to_index.at(net->get_id());
+                        LaneValue<W> new_value = values[net_index];
+                        set_lane_value(new_value, lane, value);
+                        write_lanes(net_index, new_value);
+                    }
+                }
+            }
+            for (; clock_it != clock_events.end() && std::get<0>(*clock_it) == time; ++clock_it)
+            {
+                write_lanes(std::get<1>(*clock_it), broadcast_value<W>(std::get<2>(*clock_it)));
+            }
+
+            if (!process_lanes(time))
+            {
+                return false;
+            }
+        }
+
+        for (u32 lane = 0; lane < num_lanes; lane++)
+        {
+            for (u32 i = 0; i < traced_nets.size(); i++)
+            {
+                result.traces[first_stimulus + lane][traced_nets[i]->get_id()] = std::move(lane_events[lane * traced_nets.size() + i]);
+            }
+        }
+
+        return true;
+    }
+
+    Result<BatchSimulationResult> LevelizedSimulator::simulate_batch(const std::vector<std::vector<SimulationInputNetEvent>>& stimuli, u32 lane_width, const std::vector<const Net*>& traced_nets)
+    {
+        if (lane_width != 64 && lane_width != 128 && lane_width != 256)
+        {
+            return ERR("could not simulate batch: lane width " + std::to_string(lane_width) + " is not supported, must be 64, 128, or 256");
+        }
+
+        if (!m_is_initialized && !initialize())
+        {
+            return ERR("could not simulate batch: failed to initialize simulation");
+        }
+
+        if (!m_rams.empty())
+        {
+            return ERR("could not simulate batch: RAMs are not supported");
+        }
+
+        // nets that do not drive any simulated gate are only recorded
+        for (const auto& stimulus : stimuli)
+        {
+            for (const SimulationInputNetEvent& net_event : stimulus)
+            {
+                for (const auto& [net, value] : net_event)
+                {
+                    if (net == nullptr)
+                    {
+                        return ERR("could not simulate batch: input net is a nullptr");
+                    }
+                    add_net(net);
+                }
+            }
+        }
+
+        // every traced net is recorded once, even if it is given multiple times
+        std::vector<const Net*> unique_traced_nets;
+        std::vector<u32> trace_slots;
+        for (const Net* net : traced_nets)
+        {
+            if (net == nullptr)
+            {
+                return ERR("could not simulate batch: traced net is a nullptr");
+            }
+
+            const u32 net_index = add_net(net);
+            trace_slots.resize(m_nets.size(), no_net);
+            if (trace_slots[net_index] == no_net)
+            {
+                trace_slots[net_index] = unique_traced_nets.size();
+                unique_traced_nets.push_back(net);
+            }
+        }
+        trace_slots.resize(m_nets.size(), no_net);
+
+        BatchSimulationResult result;
+        result.nets = m_nets;
+        result.toggle_counts.assign(stimuli.size(), std::vector<u64>(m_nets.size(), 0));
+        result.traces.resize(stimuli.size());
+
+        for (u32 first_stimulus = 0; first_stimulus < stimuli.size(); first_stimulus += lane_width)
+        {
+            bool success;
+            switch (lane_width)
+            {
+                case 64:
+                    success = simulate_lanes<1>(stimuli, first_stimulus, unique_traced_nets, trace_slots, result);
+                    break;
+                case 128:
+                    success = simulate_lanes<2>(stimuli, first_stimulus, unique_traced_nets, trace_slots, result);
+                    break;
+                default:
+                    success = simulate_lanes<4>(stimuli, first_stimulus, unique_traced_nets, trace_slots, result);
+                    break;
+            }
+
+            if (!success)
+            {
+                return ERR("could not simulate batch: simulation of stimuli " + std::to_string(first_stimulus) + " and following was aborted");
+            }
+        }
+
+        return OK(std::move(result));
+    }
+
+    void LevelizedSimulator::reset()
+    {
+        mSimulationInput->clear();
+        m_current_time = 0;
+        m_id_counter   = 0;
+        m_pending_inputs.clear();
+        m_events.clear();
+        m_is_initialized = false;
+    }
+
+    void LevelizedSimulator::set_iteration_timeout(u64 iterations)
+    {
+        m_timeout_iterations = iterations;
+    }
+
+    u64 LevelizedSimulator::get_iteration_timeout() const
+    {
+        return m_timeout_iterations;
+    }
+
+    u32 LevelizedSimulator::get_num_levels() const
+    {
+        return m_num_levels;
+    }
+
+    u32 LevelizedSimulator::get_num_partitions() const
+    {
+        return m_partitions.empty() ? 1 : m_partitions.size();
+    }
+
+    std::vector<WaveEvent> LevelizedSimulator::get_simulation_events(u32 netId) const
+    {
+        if (const auto it = m_net_id_to_index.find(netId); it != m_net_id_to_index.end() && it->second < m_events.size())
+        {
+            return m_events[it->second];
+        }
+        return {};
+    }
+
+    bool LevelizedSimulator::inputEvent(const SimulationInputNetEvent& netEv)
+    {
+        for (auto it = netEv.begin(); it != netEv.end(); ++it)
+        {
+            set_input(it->first, it->second);
+        }
+        simulate(netEv.get_simulation_duration());
+        return m_is_initialized;
+    }
+
+    SimulationEngine* LevelizedSimulatorFactory::createEngine() const
+    {
+        return new LevelizedSimulator(mName);
+    }
+}    // namespace hal
@@ -40,11 +40,7 @@ namespace hal
             }
         }
 
-        WaveEvent e;
-        e.affected_net = net;
-        e.time         = m_current_time;
-        e.new_value    = value;
-        m_event_queue.push_back(e);
+        m_event_queue.schedule(net, m_current_time, value);
     }
 
     void NetlistSimulator::initialize_sequential_gates(const std::function<bool(const Gate*)>& filter)
@@ -91,22 +87,12 @@ namespace hal
                 {
                     switch (ep->get_pin()->get_type())
                     {
-                        case PinType::state: {
-                            WaveEvent e;
-                            e.affected_net = ep->get_net();
-                            e.new_value    = value;
-                            e.time         = m_current_time;
-                            m_event_queue.push_back(e);
+                        case PinType::state:
+                            m_event_queue.schedule(ep->get_net(), m_current_time, value);
                             break;
-                        }
-                        case PinType::neg_state: {
-                            WaveEvent e;
-                            e.affected_net = ep->get_net();
-                            e.new_value    = inv_value;
-                            e.time         = m_current_time;
-                            m_event_queue.push_back(e);
+                        case PinType::neg_state:
+                            m_event_queue.schedule(ep->get_net(), m_current_time, inv_value);
                             break;
-                        }
                         default:
                             break;
                     }
@@ -160,22 +146,12 @@ namespace hal
                     {
                         switch (ep->get_pin()->get_type())
                         {
-                            case PinType::state: {
-                                WaveEvent e;
-                                e.affected_net = ep->get_net();
-                                e.new_value    = value;
-                                e.time         = m_current_time;
-                                m_event_queue.push_back(e);
+                            case PinType::state:
+                                m_event_queue.schedule(ep->get_net(), m_current_time, value);
                                 break;
-                            }
-                            case PinType::neg_state: {
-                                WaveEvent e;
-                                e.affected_net = ep->get_net();
-                                e.new_value    = inv_value;
-                                e.time         = m_current_time;
-                                m_event_queue.push_back(e);
+                            case PinType::neg_state:
+                                m_event_queue.schedule(ep->get_net(), m_current_time, inv_value);
                                 break;
-                            }
                             default:
                                 break;
                         }
@@ -201,7 +177,6 @@ namespace hal
     {
         mSimulationInput->clear();
         m_current_time = 0;
-        m_id_counter   = 0;
         m_simulation   = Simulation();
         m_event_queue.clear();
         m_is_initialized = false;
@@ -263,7 +238,7 @@ namespace hal
 
             if (gate->get_type()->has_property(GateTypeProperty::ff))
             {
-                std::unique_ptr<SimulationGateFF> sim_gate_owner = std::make_unique<SimulationGateFF>(gate);
+                std::unique_ptr<SimulationGateFF> sim_gate_owner = std::make_unique<SimulationGateFF>(gate, this);
                 SimulationGateFF* sim_gate                       = sim_gate_owner.get();
                 sim_gate_base                                    = sim_gate;
                 m_sim_gates.push_back(std::move(sim_gate_owner));
@@ -278,7 +253,7 @@ namespace hal
             }
             else if (gate->get_type()->has_property(GateTypeProperty::ram))
             {
-                std::unique_ptr<SimulationGateRAM> sim_gate_owner = std::make_unique<SimulationGateRAM>(gate);
+                std::unique_ptr<SimulationGateRAM> sim_gate_owner = std::make_unique<SimulationGateRAM>(gate, this);
                 SimulationGateRAM* sim_gate                       = sim_gate_owner.get();
                 sim_gate_base                                     = sim_gate;
                 m_sim_gates.push_back(std::move(sim_gate_owner));
@@ -293,7 +268,7 @@ namespace hal
             }
             else if (gate->get_type()->has_property(GateTypeProperty::combinational))
             {
-                std::unique_ptr<SimulationGateCombinational> sim_gate_owner = std::make_unique<SimulationGateCombinational>(gate);
+                std::unique_ptr<SimulationGateCombinational> sim_gate_owner = std::make_unique<SimulationGateCombinational>(gate, this);
                 SimulationGateCombinational* sim_gate                       = sim_gate_owner.get();
                 sim_gate_base                                               = sim_gate;
                 m_sim_gates.push_back(std::move(sim_gate_owner));
@@ -316,31 +291,40 @@ namespace hal
         const std::unordered_set<const Net*>& inets = mSimulationInput->get_input_nets();
         all_nets.insert(inets.begin(), inets.end());
 
-        // find all successors of nets and transform them to their respective simulation gate instance
-        for (auto net : all_nets)
+        // the simulation state is indexed by net ID, ID 0 is never assigned to a net and always holds X for unconnected pins
+        u32 max_net_id = 0;
+        for (const Net* net : all_nets)
         {
-            if (auto it = m_successors.find(net); it != m_successors.end())
-            {
-                continue;
-            }
-            auto endpoints = net->get_destinations();
-            std::unordered_map<Gate*, std::vector<const GatePin*>> affected_pins;
-            for (auto ep : endpoints)
+            max_net_id = std::max(max_net_id, net->get_id());
+        }
+        for (const SimulationGate* sim_gate : m_sim_gates_raw)
+        {
+            for (u32 net_id : sim_gate->m_input_nets)
             {
-                auto gate = ep->get_gate();
-                affected_pins[gate].push_back(ep->get_pin());
+                max_net_id = std::max(max_net_id, net_id);
             }
+        }
+        m_net_values.assign(max_net_id + 1, BooleanFunction::Value::X);
+        m_successors.assign(max_net_id + 1, {});
 
-            for (auto it : affected_pins)
+        // find all successors of nets and transform them to their respective simulation gate instance
+        for (const Net* net : all_nets)
+        {
+            std::vector<SimulationGate*>& successors = m_successors[net->get_id()];
+            for (const Endpoint* ep : net->get_destinations())
             {
-                auto gate  = it.first;
-                auto& pins = it.second;
+                const Gate* gate = ep->get_gate();
                 if (!mSimulationInput->contains_gate(gate))
                 {
                     continue;
                 }
-                auto sim_gate = sim_gates_map.at(gate);
-                m_successors[net].emplace_back(sim_gate, pins);
+
+                // every gate is simulated once per event, even if the net is connected to several of its pins
+                SimulationGate* sim_gate = sim_gates_map.at(gate);
+                if (std::find(successors.begin(), successors.end(), sim_gate) == successors.end())
+                {
+                    successors.push_back(sim_gate);
+                }
             }
         }
 
@@ -366,11 +350,7 @@ namespace hal
         // set initial values
         for (const auto& [net, value] : init_events)
         {
-            WaveEvent e;
-            e.affected_net = net;
-            e.new_value    = value;
-            e.time         = m_current_time;
-            m_event_queue.push_back(e);
+            m_event_queue.schedule(net, m_current_time, value);
         }
 
         // set initialization flag only if this point is reached
@@ -395,11 +375,7 @@ namespace hal
             // insert the required amount of clock signal switch events
             while (time < picoseconds)
             {
-                WaveEvent e;
-                e.affected_net = c.clock_net;
-                e.new_value    = v;
-                e.time         = base_time + time;
-                m_event_queue.push_back(e);
+                m_event_queue.schedule(c.clock_net, base_time + time, v);
 
                 v = simulation_utils::toggle(v);
                 time += c.switch_time;
@@ -420,22 +396,18 @@ namespace hal
         std::vector<SimulationGateSequential*> clocked_gates;
         bool clocked_gates_processed = false;
 
+        std::vector<WaveEvent> current_events;
         while (!m_event_queue.empty() || !clocked_gates.empty())
         {
-            std::map<std::pair<const Net*, u64>, BooleanFunction::Value> new_events;
-
-            // sort events by time
-            std::sort(m_event_queue.begin(), m_event_queue.end());
-
             // queue empty or all events of the current point in time processed?
-            if (m_event_queue.empty() || m_current_time != m_event_queue[0].time)
+            if (m_event_queue.empty() || m_current_time != m_event_queue.get_next_time())
             {
                 // are there FFs that were clocked? process them now!
                 if (!clocked_gates.empty() && !clocked_gates_processed)
                 {
                     for (SimulationGateSequential* clocked_gate : clocked_gates)
                     {
-                        clocked_gate->clock(m_current_time, new_events);
+                        clocked_gate->clock(m_current_time, m_net_values, m_event_queue);
                     }
                     clocked_gates.clear();
                     clocked_gates_processed = true;
@@ -447,7 +419,7 @@ namespace hal
                 }
                 else    // no FFs but queue is not empty -> advance point in time
                 {
-                    m_current_time                    = m_event_queue[0].time;
+                    m_current_time                    = m_event_queue.get_next_time();
                     total_iterations_for_one_timeslot = 0;
                     clocked_gates_processed           = false;
                 }
@@ -460,12 +432,10 @@ namespace hal
                 break;
             }
 
-            // process all events of the current point in time
-            u32 processed = 0;
-            for (; processed < m_event_queue.size() && m_event_queue[processed].time <= m_current_time; ++processed)
+            // process all events of the current point in time, new events are scheduled to the queue and processed in the next iteration
+            m_event_queue.pop_events(m_current_time, current_events);
+            for (const WaveEvent& event : current_events)
             {
-                auto& event = m_event_queue[processed];
-
                 // is there already a value recorded for the net?
                 if (auto it = m_simulation.m_events.find(event.affected_net); it != m_simulation.m_events.end())
                 {
@@ -485,7 +455,7 @@ namespace hal
                     }
                     else    // new event
                     {
-                        m_simulation.m_events[event.affected_net].push_back(event);
+                        it->second.push_back(event);
                     }
                 }
                 else    // no value recorded -> new event
@@ -495,15 +465,12 @@ namespace hal
 
                 // simulate affected gates
                 // record all FFs that have to be clocked
-                if (auto suc_it = m_successors.find(event.affected_net); suc_it != m_successors.end())
+                if (const u32 net_id = event.affected_net->get_id(); net_id < m_successors.size() && !m_successors[net_id].empty())
                 {
-                    for (auto& [gate, pins] : suc_it->second)
+                    m_net_values[net_id] = event.new_value;
+                    for (SimulationGate* gate : m_successors[net_id])
                     {
-                        for (auto& pin : pins)
-                        {
-                            gate->m_input_values[pin->get_name()] = event.new_value;
-                        }
-                        if (!gate->simulate(m_simulation, event, new_events))
+                        if (!gate->simulate(m_simulation, m_net_values, event, m_event_queue))
                         {
                             clocked_gates.push_back(static_cast<SimulationGateSequential*>(gate));
                         }
@@ -512,33 +479,29 @@ namespace hal
             }
 
             // check for iteration limit
-            total_iterations_for_one_timeslot += processed;
+            total_iterations_for_one_timeslot += current_events.size();
             if (m_timeout_iterations > 0 && total_iterations_for_one_timeslot > m_timeout_iterations)
             {
                 log_error("hal_simulator", "reached iteration timeout of {} without advancing in time, aborting simulation. Please check for a combinational loop.", m_timeout_iterations);
                 return;
             }
-
-            // remove processed events
-            m_event_queue.erase(m_event_queue.begin(), m_event_queue.begin() + processed);
-
-            // add new events
-            m_event_queue.reserve(m_event_queue.size() + new_events.size());
-            for (const auto& event_it : new_events)
-            {
-                WaveEvent e;
-                e.affected_net = event_it.first.first;
-                e.time         = event_it.first.second;
-                e.new_value    = event_it.second;
-                e.id           = m_id_counter++;
-                m_event_queue.push_back(e);
-            }
         }
 
         // adjust point in time
         m_current_time = timeout;
     }
 
+    const NetlistSimulator::SimulationFunction* NetlistSimulator::get_simulation_function(const GateType* gate_type, const BooleanFunction& function)
+    {
+        auto key = std::make_pair(gate_type, function.to_string());
+        auto it  = m_function_cache.find(key);
+        if (it == m_function_cache.end())
+        {
+            it = m_function_cache.emplace(std::move(key), SimulationFunction(function, gate_type->get_input_pins())).first;
+        }
+        return &it->second;
+    }
+
     BooleanFunction::Value NetlistSimulator::process_clear_preset_behavior(AsyncSetResetBehavior behavior, BooleanFunction::Value previous_output)
     {
         if (behavior == AsyncSetResetBehavior::N)
@@ -0,0 +1,197 @@
+#include "netlist_simulator/netlist_simulator.h"
+#include "netlist_simulator/simulation_utils.h"
+
+namespace hal
+{
+    namespace
+    {
+        // maps the two least significant bits of a value to the value itself, i.e., ZERO, ONE, Z, and X
+        const BooleanFunction::Value code_to_value[4] = {BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE, BooleanFunction::Value::Z, BooleanFunction::Value::X};
+
+        inline u32 value_to_code(BooleanFunction::Value value)
+        {
+            return ((u32)value) & 3;
+        }
+    }    // namespace
+
+    NetlistSimulator::SimulationFunction::SimulationFunction(const BooleanFunction& function, const std::vector<GatePin*>& input_pins)
+    {
+        std::unordered_map<std::string, u32> pin_indices;
+        for (u32 i = 0; i < input_pins.size(); i++)
+        {
+            pin_indices[input_pins[i]->get_name()] = i;
+        }
+
+        // empty functions always evaluate to X
+        if (function.get_nodes().empty())
+        {
+            m_table.push_back(BooleanFunction::Value::X);
+            return;
+        }
+
+        // only single-bit functions composed of basic logic operations on input pins are compiled, all others are evaluated generically
+        bool is_compilable = (function.size() == 1);
+        for (const auto& node : function.get_nodes())
+        {
+            if (!is_compilable)
+            {
+                break;
+            }
+
+            switch (node.type)
+            {
+                case BooleanFunction::NodeType::Variable:
+                    is_compilable = (node.size == 1) && (pin_indices.find(node.variable()) != pin_indices.end());
+                    break;
+                case BooleanFunction::NodeType::Constant:
+                case BooleanFunction::NodeType::Not:
+                case BooleanFunction::NodeType::And:
+                case BooleanFunction::NodeType::Or:
+                case BooleanFunction::NodeType::Xor:
+                    is_compilable = (node.size == 1);
+                    break;
+                default:
+                    is_compilable = false;
+                    break;
+            }
+        }
+
+        if (!is_compilable)
+        {
+            m_function = function;
+            for (const GatePin* pin : input_pins)
+            {
+                m_input_names.push_back(pin->get_name());
+            }
+            return;
+        }
+
+        std::unordered_map<u32, u32> pin_to_input;
+        u32 depth = 0;
+        for (const auto& node : function.get_nodes())
+        {
+            if (node.is_constant())
+            {
+                m_program.push_back({OpCode::LoadConst, node.constant().front(), 0});
+                depth++;
+            }
+            else if (node.is_variable())
+            {
+                const u32 pin_index = pin_indices.at(node.variable());
+                if (auto it = pin_to_input.find(pin_index); it != pin_to_input.end())
+                {
+                    m_program.push_back({OpCode::LoadInput, BooleanFunction::Value::X, it->second});
+                }
+                else
+                {
+                    pin_to_input[pin_index] = m_inputs.size();
+                    m_program.push_back({OpCode::LoadInput, BooleanFunction::Value::X, (u32)m_inputs.size()});
+                    m_inputs.push_back(pin_index);
+                }
+                depth++;
+            }
+            else
+            {
+                switch (node.type)
+                {
+                    case BooleanFunction::NodeType::Not:
+                        m_program.push_back({OpCode::Not, BooleanFunction::Value::X, 0});
+                        break;
+                    case BooleanFunction::NodeType::And:
+                        m_program.push_back({OpCode::And, BooleanFunction::Value::X, 0});
+                        break;
+                    case BooleanFunction::NodeType::Or:
+                        m_program.push_back({OpCode::Or, BooleanFunction::Value::X, 0});
+                        break;
+                    default:
+                        m_program.push_back({OpCode::Xor, BooleanFunction::Value::X, 0});
+                        break;
+                }
+                depth -= node.get_arity() - 1;
+            }
+            m_stack_size = std::max(m_stack_size, depth);
+        }
+
+        if (m_inputs.size() > max_table_inputs)
+        {
+            return;
+        }
+
+        // expand the function into a lookup table over all four-valued input assignments
+        std::vector<BooleanFunction::Value> stack(m_stack_size);
+        m_table.resize(1ull << (2 * m_inputs.size()));
+        for (u32 index = 0; index < m_table.size(); index++)
+        {
+            m_table[index] = execute(stack.data(), [index](u32 input) { return code_to_value[(index >> (2 * input)) & 3]; });
+        }
+        m_program.clear();
+    }
+
+    template<typename LoadInput>
+    BooleanFunction::Value NetlistSimulator::SimulationFunction::execute(BooleanFunction::Value* stack, const LoadInput& load_input) const
+    {
+        BooleanFunction::Value* sp = stack;
+        for (const Instruction& ins : m_program)
+        {
+            switch (ins.op)
+            {
+                case OpCode::LoadInput:
+                    *sp++ = load_input(ins.arg);
+                    break;
+                case OpCode::LoadConst:
+                    *sp++ = ins.value;
+                    break;
+                case OpCode::Not:
+                    sp[-1] = simulation_utils::apply_not(sp[-1]);
+                    break;
+                case OpCode::And:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_and(sp[-1], sp[0]);
+                    break;
+                case OpCode::Or:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_or(sp[-1], sp[0]);
+                    break;
+                case OpCode::Xor:
+                    sp--;
+                    sp[-1] = simulation_utils::apply_xor(sp[-1], sp[0]);
+                    break;
+            }
+        }
+
+        return sp[-1];
+    }
+
+    BooleanFunction::Value NetlistSimulator::SimulationFunction::evaluate(const std::vector<BooleanFunction::Value>& net_values, const std::vector<u32>& input_nets) const
+    {
+        if (!m_table.empty())
+        {
+            u32 index = 0;
+            for (u32 i = 0; i < m_inputs.size(); i++)
+            {
+                index |= value_to_code(net_values[input_nets[m_inputs[i]]]) << (2 * i);
+            }
+            return m_table[index];
+        }
+
+        const auto load_input = [this, &net_values, &input_nets](u32 input) { return net_values[input_nets[m_inputs[input]]]; };
+        if (!m_program.empty())
+        {
+            if (m_stack_size <= 32)
+            {
+                BooleanFunction::Value stack[32];
+                return execute(stack, load_input);
+            }
+            std::vector<BooleanFunction::Value> stack(m_stack_size);
+            return execute(stack.data(), load_input);
+        }
+
+        std::unordered_map<std::string, BooleanFunction::Value> inputs;
+        for (u32 i = 0; i < m_input_names.size(); i++)
+        {
+            inputs[m_input_names[i]] = net_values[input_nets[i]];
+        }
+        const auto res = m_function.evaluate(inputs);
+        return res.is_ok() ? res.get() : BooleanFunction::Value::X;
+    }
+}    // namespace hal
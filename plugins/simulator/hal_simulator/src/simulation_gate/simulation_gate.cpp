@@ -8,9 +8,9 @@ namespace hal
 
         for (GatePin* pin : gate->get_type()->get_input_pins())
         {
-            m_input_values[pin->get_name()] = BooleanFunction::Value::X;
+            const Net* net = gate->get_fan_in_net(pin);
             m_input_pins.push_back(pin);
-            m_input_nets.push_back(gate->get_fan_in_net(pin));
+            m_input_nets.push_back((net != nullptr) ? net->get_id() : 0);
         }
     }
 }    // namespace hal
\ No newline at end of file
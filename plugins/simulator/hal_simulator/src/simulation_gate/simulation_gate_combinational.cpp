@@ -2,24 +2,38 @@
 
 namespace hal
 {
-    NetlistSimulator::SimulationGateCombinational::SimulationGateCombinational(const Gate* gate) : SimulationGate(gate)
+    NetlistSimulator::SimulationGateCombinational::SimulationGateCombinational(const Gate* gate, NetlistSimulator* simulator) : SimulationGate(gate)
     {
-        std::unordered_map<std::string, BooleanFunction> functions = gate->get_boolean_functions();
+        const GateType* gate_type              = gate->get_type();
+        const std::vector<GatePin*> output_pins = gate_type->get_output_pins();
 
-        m_output_pins = gate->get_type()->get_output_pins();
+        for (const GatePin* pin : output_pins)
+        {
+            m_output_nets.push_back(gate->get_fan_out_net(pin));
+        }
 
-        for (const GatePin* pin : m_output_pins)
+        // gates without custom functions share the compiled functions of their gate type
+        const bool uses_type_functions = gate->get_boolean_functions(true).empty() && !gate_type->has_component_of_type(GateTypeComponent::ComponentType::lut);
+        if (uses_type_functions)
         {
-            const Net* out_net = gate->get_fan_out_net(pin);
-            m_output_nets.push_back(out_net);
+            if (auto it = simulator->m_type_functions.find(gate_type); it != simulator->m_type_functions.end())
+            {
+                m_functions = it->second;
+                return;
+            }
+        }
+
+        std::unordered_map<std::string, BooleanFunction> functions = gate->get_boolean_functions();
 
+        for (const GatePin* pin : output_pins)
+        {
             // resolve recursion within output functions
             BooleanFunction& func = functions.at(pin->get_name());
             while (true)
             {
                 auto vars = func.get_variable_names();
                 bool exit = true;
-                for (const GatePin* other_pin : m_output_pins)
+                for (const GatePin* other_pin : output_pins)
                 {
                     if (const std::string& other_pin_name = other_pin->get_name(); std::find(vars.begin(), vars.end(), other_pin_name) != vars.end())
                     {
@@ -32,22 +46,32 @@ namespace hal
                     break;
                 }
             }
-            m_functions.emplace(out_net, func);
+            m_functions.push_back(simulator->get_simulation_function(gate_type, func));
+        }
+
+        if (uses_type_functions)
+        {
+            simulator->m_type_functions.emplace(gate_type, m_functions);
         }
     }
 
-    bool NetlistSimulator::SimulationGateCombinational::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    bool NetlistSimulator::SimulationGateCombinational::simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events)
     {
         UNUSED(simulation);
 
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
-        for (auto out_net : m_output_nets)
+        for (u32 i = 0; i < m_output_nets.size(); i++)
         {
-            BooleanFunction::Value result = m_functions[out_net].evaluate(m_input_values).get();
+            if (m_output_nets[i] == nullptr)
+            {
+                continue;
+            }
+
+            BooleanFunction::Value result = m_functions[i]->evaluate(net_values, m_input_nets);
 
-            new_events[std::make_pair(out_net, event.time + delay)] = result;
+            new_events.schedule(m_output_nets[i], event.time + delay, result);
         }
 
         return true;
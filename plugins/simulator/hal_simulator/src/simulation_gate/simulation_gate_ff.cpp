@@ -1,19 +1,29 @@
 #include "hal_core/netlist/gate_library/gate_type_component/ff_component.h"
-#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
 #include "netlist_simulator/netlist_simulator.h"
 #include "netlist_simulator/simulation_utils.h"
 
 namespace hal
 {
-    NetlistSimulator::SimulationGateFF::SimulationGateFF(const Gate* gate) : SimulationGateSequential(gate)
+    NetlistSimulator::SimulationGateFF::SimulationGateFF(const Gate* gate, NetlistSimulator* simulator) : SimulationGateSequential(gate)
     {
         const GateType* gate_type       = gate->get_type();
         const FFComponent* ff_component = gate_type->get_component_as<FFComponent>([](const GateTypeComponent* c) { return FFComponent::is_class_of(c); });
         assert(ff_component != nullptr);
-        m_clock_func      = ff_component->get_clock_function();
-        m_next_state_func = ff_component->get_next_state_function();
-        m_preset_func     = ff_component->get_async_set_function();
-        m_clear_func      = ff_component->get_async_reset_function();
+
+        // the functions of a flip-flop only depend on its gate type
+        auto it = simulator->m_type_functions.find(gate_type);
+        if (it == simulator->m_type_functions.end())
+        {
+            std::vector<const SimulationFunction*> functions = {simulator->get_simulation_function(gate_type, ff_component->get_clock_function()),
+                                                                simulator->get_simulation_function(gate_type, ff_component->get_next_state_function()),
+                                                                simulator->get_simulation_function(gate_type, ff_component->get_async_set_function()),
+                                                                simulator->get_simulation_function(gate_type, ff_component->get_async_reset_function())};
+            it = simulator->m_type_functions.emplace(gate_type, std::move(functions)).first;
+        }
+        m_clock_func      = it->second[0];
+        m_next_state_func = it->second[1];
+        m_preset_func     = it->second[2];
+        m_clear_func      = it->second[3];
         for (const GatePin* pin : gate_type->get_pins())
         {
             switch (pin->get_type())
@@ -45,42 +55,13 @@ namespace hal
 
     void NetlistSimulator::SimulationGateFF::initialize(std::map<const Net*, BooleanFunction::Value>& new_events, bool from_netlist, BooleanFunction::Value value = BooleanFunction::Value::X)
     {
-        GateType* gate_type = m_gate->get_type();
-
-        BooleanFunction::Value inv_value = simulation_utils::toggle(value);
-
-        if (from_netlist)
+        if (!simulation_utils::get_initial_ff_value(m_gate, from_netlist, value))
         {
-            // extract init string
-            const InitComponent* init_component = gate_type->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
-            if (init_component == nullptr)
-            {
-                log_error("hal_simulator", "cannot find initialization data for flip-flop '{}' with ID {} of type '{}'.", m_gate->get_name(), m_gate->get_id(), gate_type->get_name());
-                return;
-            }
-            const std::string& init_str = std::get<1>(m_gate->get_data(init_component->get_init_category(), init_component->get_init_identifiers().front()));
-
-            if (!init_str.empty())
-            {
-                // parse init string
-                value = BooleanFunction::Value::X;
-                if (init_str == "1")
-                {
-                    value = BooleanFunction::Value::ONE;
-                }
-                else if (init_str == "0")
-                {
-                    value = BooleanFunction::Value::ZERO;
-                }
-                else
-                {
-                    log_error("hal_simulator", "init value of flip-flop '{}' with ID {} of type '{}' is neither '1' or '0'.", m_gate->get_name(), m_gate->get_id(), gate_type->get_name());
-                }
-
-                inv_value = simulation_utils::toggle(value);
-            }
+            return;
         }
 
+        BooleanFunction::Value inv_value = simulation_utils::toggle(value);
+
         // generate events
         for (Endpoint* ep : m_gate->get_fan_out_endpoints())
         {
@@ -95,13 +76,13 @@ namespace hal
         }
     }
 
-    bool NetlistSimulator::SimulationGateFF::simulate(const Simulation& simulation, const WaveEvent& event, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    bool NetlistSimulator::SimulationGateFF::simulate(const Simulation& simulation, const std::vector<BooleanFunction::Value>& net_values, const WaveEvent& event, EventQueue& new_events)
     {
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
-        auto async_set   = m_preset_func.evaluate(m_input_values).get();
-        auto async_reset = m_clear_func.evaluate(m_input_values).get();
+        auto async_set   = m_preset_func->evaluate(net_values, m_input_nets);
+        auto async_reset = m_clear_func->evaluate(net_values, m_input_nets);
 
         // check whether an asynchronous set or reset ist triggered
         if (async_set == BooleanFunction::ONE || async_reset == BooleanFunction::ONE)
@@ -149,11 +130,11 @@ namespace hal
             // generate events
             for (auto out_net : m_state_output_nets)
             {
-                new_events[std::make_pair(out_net, event.time + delay)] = result;
+                new_events.schedule(out_net, event.time + delay, result);
             }
             for (auto out_net : m_state_inverted_output_nets)
             {
-                new_events[std::make_pair(out_net, event.time + delay)] = inv_result;
+                new_events.schedule(out_net, event.time + delay, inv_result);
             }
 
             return true;
@@ -161,29 +142,29 @@ namespace hal
         else if (std::find(m_clock_nets.begin(), m_clock_nets.end(), event.affected_net) != m_clock_nets.end())
         {
             // return true if the event was completely handled -> true if the gate is NOT clocked at this point
-            return (m_clock_func.evaluate(m_input_values).get() != BooleanFunction::ONE);
+            return (m_clock_func->evaluate(net_values, m_input_nets) != BooleanFunction::ONE);
         }
 
         return true;
     }
 
-    void NetlistSimulator::SimulationGateFF::clock(const u64 current_time, std::map<std::pair<const Net*, u64>, BooleanFunction::Value>& new_events)
+    void NetlistSimulator::SimulationGateFF::clock(const u64 current_time, const std::vector<BooleanFunction::Value>& net_values, EventQueue& new_events)
     {
         // compute delay, currently just a placeholder
         u64 delay = 0;
 
         // compute output
-        BooleanFunction::Value result     = m_next_state_func.evaluate(m_input_values).get();
+        BooleanFunction::Value result     = m_next_state_func->evaluate(net_values, m_input_nets);
         BooleanFunction::Value inv_result = simulation_utils::toggle(result);
 
         // generate events
         for (const Net* out_net : m_state_output_nets)
         {
-            new_events[std::make_pair(out_net, current_time + delay)] = result;
+            new_events.schedule(out_net, current_time + delay, result);
         }
         for (const Net* out_net : m_state_inverted_output_nets)
         {
-            new_events[std::make_pair(out_net, current_time + delay)] = inv_result;
+            new_events.schedule(out_net, current_time + delay, inv_result);
         }
     }
 }    // namespace hal
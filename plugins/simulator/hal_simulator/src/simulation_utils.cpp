@@ -1,5 +1,12 @@
 #include "netlist_simulator/simulation_utils.h"
 
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_type.h"
+#include "hal_core/netlist/gate_library/gate_type_component/init_component.h"
+#include "hal_core/netlist/gate_library/gate_type_component/ram_component.h"
+
+#include <cstdlib>
+
 namespace hal
 {
     namespace simulation_utils
@@ -89,5 +96,127 @@ namespace hal
 
             return simulation_utils::values_to_int(ordered_values);
         }
+
+        u32 get_data_word(const std::vector<u64>& data, u32 address, u32 width)
+        {
+            u32 start_pos = address * width;
+            u32 row       = start_pos >> 6;
+            u32 start_bit = start_pos & 0x3F;
+
+            if (row >= data.size() || 64 % width != 0 || width > 32)
+            {
+                log_error("hal_simulator", "cannot read data word of width {} at address {0:x}.", width, address);
+                return 0;
+            }
+
+            // reads right to left
+            return (u32)((data.at(row) >> start_bit) & ((1 << width) - 1));
+        }
+
+        void set_data_word(std::vector<u64>& data, u32 in_data, u32 address, u32 width)
+        {
+            u32 start_pos = address * width;
+            u32 row       = start_pos >> 6;
+            u32 start_bit = start_pos & 0x3F;
+
+            if (row >= data.size() || 64 % width != 0 || width > 32)
+            {
+                log_error("hal_simulator", "cannot write data word {0:x} of width {} to address {0:x}.", in_data, width, address);
+                return;
+            }
+
+            // reads right to left
+            u64 mask     = ~((((u64)1 << width) - 1) << start_bit);
+            data.at(row) = (data.at(row) & mask) ^ ((u64)in_data << start_bit);
+        }
+
+        bool get_initial_ff_value(const Gate* gate, bool from_netlist, BooleanFunction::Value& value)
+        {
+            if (!from_netlist)
+            {
+                return true;
+            }
+
+            const GateType* gate_type           = gate->get_type();
+            const InitComponent* init_component = gate_type->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+            if (init_component == nullptr)
+            {
+                log_error("hal_simulator", "cannot find initialization data for flip-flop '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                return false;
+            }
+
+            const std::string& init_str = std::get<1>(gate->get_data(init_component->get_init_category(), init_component->get_init_identifiers().front()));
+            if (init_str.empty())
+            {
+                return true;
+            }
+
+            value = BooleanFunction::Value::X;
+            if (init_str == "1")
+            {
+                value = BooleanFunction::Value::ONE;
+            }
+            else if (init_str == "0")
+            {
+                value = BooleanFunction::Value::ZERO;
+            }
+            else
+            {
+                log_error("hal_simulator", "init value of flip-flop '{}' with ID {} of type '{}' is neither '1' or '0'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+            }
+            return true;
+        }
+
+        bool get_initial_ram_data(const Gate* gate, const RAMComponent* ram_component, bool from_netlist, BooleanFunction::Value value, std::vector<u64>& data)
+        {
+            const GateType* gate_type = gate->get_type();
+
+            data.clear();
+            if (from_netlist)
+            {
+                const InitComponent* init_component = gate_type->get_component_as<InitComponent>([](const GateTypeComponent* c) { return InitComponent::is_class_of(c); });
+                if (init_component == nullptr)
+                {
+                    log_error("hal_simulator", "cannot find initialization data for RAM gate '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    return false;
+                }
+
+                const std::string& category = init_component->get_init_category();
+                for (const std::string& identifier : init_component->get_init_identifiers())
+                {
+                    const std::string init_data = std::get<1>(gate->get_data(category, identifier));
+
+                    u32 data_len = init_data.size();
+                    if (data_len % 16 != 0)
+                    {
+                        log_error("hal_simulator", "initialization data of RAM gate '{}' with ID {} of type '{}' is malformed.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                        data.clear();
+                        return false;
+                    }
+
+                    for (u32 i = 0; i < data_len; i += 16)
+                    {
+                        data.push_back(strtoull(init_data.substr(data_len - i - 16, 16).c_str(), nullptr, 16));
+                    }
+                }
+
+                if (ram_component->get_bit_size() != data.size() * 64)
+                {
+                    log_error("hal_simulator", "initialization data does not fit memory size for RAM gate '{}' with ID {} of type '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name());
+                    data.clear();
+                    return false;
+                }
+                return true;
+            }
+
+            if (value != BooleanFunction::Value::ZERO && value != BooleanFunction::Value::ONE)
+            {
+                log_error("hal_simulator", "RAM gate '{}' with ID {} of type {} cannot be initialized with value '{}'.", gate->get_name(), gate->get_id(), gate_type->get_name(), BooleanFunction::to_string(value));
+                return false;
+            }
+
+            data.assign(ram_component->get_bit_size() / 64, (value == BooleanFunction::Value::ONE) ? 0xFFFFFFFFFFFFFFFF : 0x0);
+            return true;
+        }
     }    // namespace simulation_utils
 }    // namespace hal
@@ -0,0 +1,508 @@
+#include "netlist_simulator/netlist_simulator.h"
+
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_parser/netlist_parser_manager.h"
+#include "hal_core/plugin_system/plugin_manager.h"
+#include "netlist_simulator/event_queue.h"
+#include "netlist_simulator/levelized_simulator.h"
+#include "netlist_simulator_controller/simulation_input.h"
+#include "netlist_test_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+
+namespace hal
+{
+    class NetlistSimulatorTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp()
+        {
+            NO_COUT_BLOCK;
+            test_utils::init_log_channels();
+            plugin_manager::load_all_plugins();
+        }
+
+        virtual void TearDown()
+        {
+            NO_COUT_BLOCK;
+            plugin_manager::unload_all_plugins();
+        }
+
+        /**
+         * Create an engine of the given name that simulates the given input.
+         */
+        static std::unique_ptr<SimulationEngine> create_engine(const std::string& name, SimulationInput* input)
+        {
+            SimulationEngineFactory* factory = SimulationEngineFactories::instance()->factoryByName(name);
+            if (factory == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::unique_ptr<SimulationEngine> engine(factory->createEngine());
+            engine->setSimulationInput(input);
+            return engine;
+        }
+
+        /**
+         * Create a random sequential netlist with the given number of inputs, flip-flops, and combinational gates.
+         * Gates preferably read recently created nets so that the combinational logic is deep.
+         */
+        static std::unique_ptr<Netlist> create_random_netlist(u32 seed, u32 num_inputs, u32 num_ffs, u32 num_gates, std::vector<Net*>& inputs, Net*& clock)
+        {
+            std::mt19937 rng(seed);
+            auto nl               = test_utils::create_empty_netlist();
+            const GateLibrary* gl = nl->get_gate_library();
+
+            std::vector<Net*> nets;
+            clock = nl->create_net("clk");
+            nl->mark_global_input_net(clock);
+            for (u32 i = 0; i < num_inputs; i++)
+            {
+                Net* net = nl->create_net("in_" + std::to_string(i));
+                nl->mark_global_input_net(net);
+                inputs.push_back(net);
+                nets.push_back(net);
+            }
+
+            std::vector<Gate*> ffs;
+            for (u32 i = 0; i < num_ffs; i++)
+            {
+                Gate* ff = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_" + std::to_string(i));
+                clock->add_destination(ff, "CLK");
+                Net* q = nl->create_net("q_" + std::to_string(i));
+                q->add_source(ff, "Q");
+                nets.push_back(q);
+                ffs.push_back(ff);
+            }
+
+            const std::vector<std::string> types = {"AND2", "OR2", "XOR2", "INV", "MUX", "AND3", "XOR3"};
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                GateType* type = gl->get_gate_type_by_name(types[rng() % types.size()]);
+                Gate* gate     = nl->create_gate(type, "gate_" + std::to_string(i));
+                for (GatePin* pin : type->get_input_pins())
+                {
+                    const u32 index = (rng() % 2 == 0) ? nets.size() - 1 - (rng() % std::min<size_t>(nets.size(), 16)) : rng() % nets.size();
+                    nets[index]->add_destination(gate, pin);
+                }
+                Net* out = nl->create_net("out_" + std::to_string(i));
+                out->add_source(gate, type->get_output_pins().front());
+                nets.push_back(out);
+            }
+
+            for (Gate* ff : ffs)
+            {
+                nets[num_inputs + rng() % (nets.size() - num_inputs)]->add_destination(ff, "D");
+            }
+
+            return nl;
+        }
+
+        /**
+         * Create a random pipelined netlist consisting of independent slices, each being a sequence of register stages separated by random combinational logic.
+         * The first stage of every slice reads one input per register.
+         */
+        static std::unique_ptr<Netlist> create_pipelined_netlist(u32 seed, u32 num_slices, u32 num_stages, u32 width, u32 gates_per_stage, std::vector<Net*>& inputs, Net*& clock)
+        {
+            std::mt19937 rng(seed);
+            auto nl               = test_utils::create_empty_netlist();
+            const GateLibrary* gl = nl->get_gate_library();
+
+            clock = nl->create_net("clk");
+            nl->mark_global_input_net(clock);
+
+            const std::vector<std::string> types = {"AND2", "OR2", "XOR2", "INV", "MUX", "AND3", "XOR3"};
+            for (u32 slice = 0; slice < num_slices; slice++)
+            {
+                std::vector<Net*> stage_nets;
+                for (u32 i = 0; i < width; i++)
+                {
+                    Net* net = nl->create_net("in_" + std::to_string(slice) + "_" + std::to_string(i));
+                    nl->mark_global_input_net(net);
+                    inputs.push_back(net);
+                    stage_nets.push_back(net);
+                }
+
+                for (u32 stage = 0; stage < num_stages; stage++)
+                {
+                    const std::string prefix = std::to_string(slice) + "_" + std::to_string(stage) + "_";
+
+                    std::vector<Net*> nets = stage_nets;
+                    for (u32 i = 0; i < gates_per_stage; i++)
+                    {
+                        GateType* type = gl->get_gate_type_by_name(types[rng() % types.size()]);
+                        Gate* gate     = nl->create_gate(type, "gate_" + prefix + std::to_string(i));
+                        for (GatePin* pin : type->get_input_pins())
+                        {
+                            nets[nets.size() - 1 - (rng() % std::min<size_t>(nets.size(), 2 * width))]->add_destination(gate, pin);
+                        }
+                        Net* out = nl->create_net("out_" + prefix + std::to_string(i));
+                        out->add_source(gate, type->get_output_pins().front());
+                        nets.push_back(out);
+                    }
+
+                    stage_nets.clear();
+                    for (u32 i = 0; i < width; i++)
+                    {
+                        Gate* ff = nl->create_gate(gl->get_gate_type_by_name("DFF"), "ff_" + prefix + std::to_string(i));
+                        clock->add_destination(ff, "CLK");
+                        nets[nets.size() - 1 - i]->add_destination(ff, "D");
+                        Net* q = nl->create_net("q_" + prefix + std::to_string(i));
+                        q->add_source(ff, "Q");
+                        stage_nets.push_back(q);
+                    }
+                }
+            }
+
+            return nl;
+        }
+
+        /**
+         * Simulate the given number of clock cycles with random inputs and return the number of processed events per second.
+         */
+        static double measure_events_per_second(Netlist* nl, const std::vector<Net*>& inputs, Net* clock, u64 clock_period, u32 num_cycles, const std::vector<std::pair<Net*, BooleanFunction::Value>>& constants = {})
+        {
+            SimulationInput input;
+            input.add_gates(nl->get_gates());
+            input.add_clock({clock, clock_period / 2, true});
+
+            auto engine           = create_engine("hal_simulator", &input);
+            NetlistSimulator* sim = dynamic_cast<NetlistSimulator*>(engine.get());
+            if (sim == nullptr)
+            {
+                return 0;
+            }
+            sim->initialize_sequential_gates(BooleanFunction::Value::ZERO);
+
+            std::mt19937 rng(num_cycles);
+            const auto begin_time = std::chrono::system_clock::now();
+            for (u32 cycle = 0; cycle < num_cycles; cycle++)
+            {
+                for (const auto& [net, value] : constants)
+                {
+                    sim->set_input(net, value);
+                }
+                for (const Net* net : inputs)
+                {
+                    sim->set_input(net, (rng() % 2 == 0) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE);
+                }
+                sim->simulate(clock_period);
+            }
+            const double duration = std::chrono::duration<double>(std::chrono::system_clock::now() - begin_time).count();
+
+            u64 num_events = 0;
+            for (const auto& [net, events] : sim->get_simulation_state().get_events())
+            {
+                num_events += events.size();
+            }
+            return num_events / duration;
+        }
+
+        /**
+         * Simulate the given number of clock cycles with random inputs using the levelized engine with the given number of threads.
+         * Returns the recorded events of all nets and stores the duration of the simulation.
+         */
+        static std::unordered_map<u32, std::vector<WaveEvent>>
+            simulate_levelized(Netlist* nl, const std::vector<Net*>& inputs, Net* clock, u32 num_cycles, u32 num_threads, u32& num_partitions, double& duration)
+        {
+            SimulationInput input;
+            input.add_gates(nl->get_gates());
+            input.add_clock({clock, 5000, true});
+
+            auto engine             = create_engine("hal_levelized_simulator", &input);
+            LevelizedSimulator* sim = dynamic_cast<LevelizedSimulator*>(engine.get());
+            if (sim == nullptr)
+            {
+                return {};
+            }
+            sim->set_engine_property("num_of_threads", std::to_string(num_threads));
+            sim->initialize_sequential_gates(BooleanFunction::Value::ZERO);
+            if (!sim->initialize())
+            {
+                return {};
+            }
+            num_partitions = sim->get_num_partitions();
+
+            std::mt19937 rng(num_cycles);
+            const auto begin_time = std::chrono::system_clock::now();
+            for (u32 cycle = 0; cycle < num_cycles; cycle++)
+            {
+                for (const Net* net : inputs)
+                {
+                    sim->set_input(net, (rng() % 2 == 0) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE);
+                }
+                sim->simulate(10000);
+            }
+            duration = std::chrono::duration<double>(std::chrono::system_clock::now() - begin_time).count();
+
+            std::unordered_map<u32, std::vector<WaveEvent>> events;
+            for (const Net* net : nl->get_nets())
+            {
+                events[net->get_id()] = sim->get_simulation_events(net->get_id());
+            }
+            return events;
+        }
+    };
+
+    TEST_F(NetlistSimulatorTest, check_event_queue)
+    {
+        TEST_START
+        {
+            auto nl = test_utils::create_empty_netlist();
+            Net* a  = nl->create_net("a");
+            Net* b  = nl->create_net("b");
+
+            EventQueue queue;
+            EXPECT_TRUE(queue.empty());
+
+            queue.schedule(a, 10, BooleanFunction::Value::ONE);
+            queue.schedule(b, 5, BooleanFunction::Value::ZERO);
+            queue.schedule(b, 10, BooleanFunction::Value::ONE);
+            queue.schedule(a, 10, BooleanFunction::Value::ZERO);    // replaces the pending event of 'a' at time 10
+            queue.schedule(a, 10 * EventQueue::wheel_size, BooleanFunction::Value::ONE);
+            EXPECT_EQ(queue.size(), 4);
+            EXPECT_EQ(queue.get_next_time(), 5);
+
+            std::vector<WaveEvent> events;
+            queue.pop_events(4, events);
+            EXPECT_TRUE(events.empty());
+
+            // events are ordered by time and, within the same point in time, by the order in which they were scheduled
+            queue.pop_events(10, events);
+            ASSERT_EQ(events.size(), 3);
+            EXPECT_EQ(events.at(0), (WaveEvent{b, BooleanFunction::Value::ZERO, 5, 0}));
+            EXPECT_EQ(events.at(1), (WaveEvent{a, BooleanFunction::Value::ZERO, 10, 0}));
+            EXPECT_EQ(events.at(2), (WaveEvent{b, BooleanFunction::Value::ONE, 10, 0}));
+            EXPECT_LT(events.at(1).id, events.at(2).id);
+            EXPECT_EQ(queue.size(), 1);
+            EXPECT_EQ(queue.get_next_time(), 10 * EventQueue::wheel_size);
+
+            // events before all pending ones and far beyond the wheel are supported alike
+            queue.schedule(b, 2, BooleanFunction::Value::ONE);
+            queue.schedule(b, 100 * EventQueue::wheel_size, BooleanFunction::Value::X);
+            EXPECT_EQ(queue.get_next_time(), 2);
+            queue.pop_events(100 * EventQueue::wheel_size, events);
+            ASSERT_EQ(events.size(), 3);
+            EXPECT_EQ(events.at(0), (WaveEvent{b, BooleanFunction::Value::ONE, 2, 0}));
+            EXPECT_EQ(events.at(1), (WaveEvent{a, BooleanFunction::Value::ONE, 10 * EventQueue::wheel_size, 0}));
+            EXPECT_EQ(events.at(2), (WaveEvent{b, BooleanFunction::Value::X, 100 * EventQueue::wheel_size, 0}));
+            EXPECT_TRUE(queue.empty());
+
+            queue.schedule(a, 1, BooleanFunction::Value::ONE);
+            queue.clear();
+            EXPECT_TRUE(queue.empty());
+        }
+        {
+            // the wheel has to follow the simulation time while events keep being scheduled within and beyond its range
+            auto nl = test_utils::create_empty_netlist();
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < 8; i++)
+            {
+                nets.push_back(nl->create_net("net_" + std::to_string(i)));
+            }
+
+            EventQueue queue;
+            std::map<u64, std::vector<std::pair<const Net*, BooleanFunction::Value>>> expected;
+            std::mt19937 rng(1);
+            std::vector<WaveEvent> events;
+            u64 current_time = 0;
+            for (u32 i = 0; i < 20000; i++)
+            {
+                if (rng() % 4 != 0 || expected.empty())
+                {
+                    const Net* net                     = nets.at(rng() % nets.size());
+                    const u64 time                     = current_time + rng() % (3 * EventQueue::wheel_size);
+                    const BooleanFunction::Value value = (rng() % 2 == 0) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE;
+                    queue.schedule(net, time, value);
+
+                    auto& pending = expected[time];
+                    auto it       = std::find_if(pending.begin(), pending.end(), [net](const auto& p) { return p.first == net; });
+                    if (it != pending.end())
+                    {
+                        it->second = value;
+                    }
+                    else
+                    {
+                        pending.emplace_back(net, value);
+                    }
+                }
+                else
+                {
+                    ASSERT_EQ(queue.get_next_time(), expected.begin()->first);
+                    current_time = expected.begin()->first + rng() % EventQueue::wheel_size;
+                    queue.pop_events(current_time, events);
+
+                    u32 index = 0;
+                    while (!expected.empty() && expected.begin()->first <= current_time)
+                    {
+                        for (const auto& [net, value] : expected.begin()->second)
+                        {
+                            ASSERT_LT(index, events.size());
+                            EXPECT_EQ(events.at(index), (WaveEvent{net, value, expected.begin()->first, 0}));
+                            index++;
+                        }
+                        expected.erase(expected.begin());
+                    }
+                    EXPECT_EQ(index, events.size());
+                }
+
+                u64 num_expected = 0;
+                for (const auto& [time, pending] : expected)
+                {
+                    num_expected += pending.size();
+                }
+                ASSERT_EQ(queue.size(), num_expected);
+            }
+        }
+        TEST_END
+    }
+
+    TEST_F(NetlistSimulatorTest, check_reset)
+    {
+        TEST_START
+        {
+            Net* clock = nullptr;
+            std::vector<Net*> inputs;
+            auto nl = create_random_netlist(2, 8, 16, 200, inputs, clock);
+
+            SimulationInput input;
+            auto engine           = create_engine("hal_simulator", &input);
+            NetlistSimulator* sim = dynamic_cast<NetlistSimulator*>(engine.get());
+            ASSERT_NE(sim, nullptr);
+
+            // repeated simulations of the same netlist must yield the same result
+            std::vector<std::unordered_map<const Net*, std::vector<WaveEvent>>> results;
+            for (u32 run = 0; run < 2; run++)
+            {
+                sim->reset();
+                input.add_gates(nl->get_gates());
+                input.add_clock({clock, 5000, true});
+                sim->initialize_sequential_gates(BooleanFunction::Value::ZERO);
+
+                std::mt19937 rng(1);
+                for (u32 cycle = 0; cycle < 10; cycle++)
+                {
+                    for (const Net* net : inputs)
+                    {
+                        sim->set_input(net, (rng() % 2 == 0) ? BooleanFunction::Value::ZERO : BooleanFunction::Value::ONE);
+                    }
+                    sim->simulate(10000);
+                }
+                results.push_back(sim->get_simulation_state().get_events());
+            }
+
+            ASSERT_EQ(results.at(0).size(), results.at(1).size());
+            for (const auto& [net, events] : results.at(0))
+            {
+                ASSERT_EQ(results.at(1).count(net), 1);
+                EXPECT_EQ(events, results.at(1).at(net)) << net->get_name();
+            }
+        }
+        TEST_END
+    }
+
+    TEST_F(NetlistSimulatorTest, check_levelized_partitions)
+    {
+        TEST_START
+        {
+            Net* clock = nullptr;
+            std::vector<Net*> inputs;
+            auto nl = create_random_netlist(3, 16, 64, 2000, inputs, clock);
+
+            u32 num_partitions = 0;
+            double duration    = 0;
+            const auto expected = simulate_levelized(nl.get(), inputs, clock, 20, 1, num_partitions, duration);
+            ASSERT_FALSE(expected.empty());
+            EXPECT_EQ(num_partitions, 1);
+
+            // partitioned evaluation must not change the result
+            for (u32 num_threads : {2, 3, 8})
+            {
+                const auto events = simulate_levelized(nl.get(), inputs, clock, 20, num_threads, num_partitions, duration);
+                EXPECT_EQ(num_partitions, num_threads);
+                EXPECT_EQ(events, expected) << num_threads << " threads";
+            }
+        }
+        TEST_END
+    }
+
+    TEST_F(NetlistSimulatorTest, DISABLED_benchmark_performance)
+    {
+        TEST_START
+        {
+            // large random netlist
+            {
+                Net* clock = nullptr;
+                std::vector<Net*> inputs;
+                auto nl = create_random_netlist(1, 64, 1024, 20000, inputs, clock);
+
+                const double events_per_second = measure_events_per_second(nl.get(), inputs, clock, 10000, 20);
+                EXPECT_GT(events_per_second, 0);
+                RecordProperty("random_netlist_events_per_second", std::to_string((u64)events_per_second));
+            }
+
+            // scaling of the partitioned levelized engine
+            {
+                Net* clock = nullptr;
+                std::vector<Net*> inputs;
+                auto nl = create_pipelined_netlist(4, 64, 16, 16, 100, inputs, clock);
+
+                for (u32 num_threads : {1, 2, 4, 8, 16})
+                {
+                    u32 num_partitions = 0;
+                    double duration    = 0;
+                    simulate_levelized(nl.get(), inputs, clock, 100, num_threads, num_partitions, duration);
+                    RecordProperty("levelized_" + std::to_string(num_threads) + "_threads_ms", std::to_string((u64)(duration * 1000)));
+                }
+            }
+
+            // toy cipher
+            {
+                const std::string path = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/netlist_simulator/toy_cipher.vhd";
+                GateLibrary* lib       = gate_library_manager::get_gate_library("XILINX_UNISIM.hgl");
+                if (!utils::file_exists(path) || lib == nullptr)
+                {
+                    GTEST_SKIP() << "toy cipher netlist or XILINX_UNISIM gate library not found";
+                }
+
+                std::unique_ptr<Netlist> nl;
+                {
+                    NO_COUT_BLOCK;
+                    nl = netlist_parser_manager::parse(path, lib);
+                }
+                ASSERT_NE(nl, nullptr);
+
+                Net* clock = nullptr;
+                Net* start = nullptr;
+                std::vector<Net*> inputs;
+                for (Net* net : nl->get_global_input_nets())
+                {
+                    if (net->get_name() == "CLK")
+                    {
+                        clock = net;
+                    }
+                    else if (net->get_name() == "START")
+                    {
+                        start = net;
+                    }
+                    else
+                    {
+                        inputs.push_back(net);
+                    }
+                }
+                ASSERT_NE(clock, nullptr);
+                ASSERT_NE(start, nullptr);
+
+                const double events_per_second = measure_events_per_second(nl.get(), inputs, clock, 10000, 500, {{start, BooleanFunction::Value::ONE}});
+                EXPECT_GT(events_per_second, 0);
+                RecordProperty("toy_cipher_events_per_second", std::to_string((u64)events_per_second));
+            }
+        }
+        TEST_END
+    }
+}    // namespace hal
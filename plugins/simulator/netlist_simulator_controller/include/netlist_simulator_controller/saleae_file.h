@@ -27,6 +27,8 @@
 
 #include <fstream>
 #include <functional>
+#include <mutex>
+#include <vector>
 #ifdef STANDALONE_PARSER
 #include "saleae_directory.h"
 #else
@@ -200,6 +202,91 @@ namespace hal
     };
 
 
+    /**
+     * @brief Read-only view of a SALEAE data file which is memory-mapped instead of being copied into buffers.
+     * Transition times are accessed in place and located by binary search, so random access does not depend on the number of events.
+     * A multi-resolution summary of the time spent at each value is built upon first request and used for zoomed-out rendering.
+     */
+    class SaleaeMappedFile
+    {
+    public:
+        /// Number of intervals (or blocks of the next lower level) combined into one block of the summary index
+        static const uint64_t sSummaryFanout = 64;
+
+        /// Accumulated data for a range of consecutive intervals between events
+        struct Summary
+        {
+            /// Time spent at value 0 and 1
+            uint64_t mTimeAtValue[2] = {0, 0};
+
+            /// Time spent at undefined value (X or Z)
+            uint64_t mTimeUndefined = 0;
+
+            /// Number of intervals
+            uint64_t mNumIntervals = 0;
+
+            void add(const Summary& other);
+        };
+    private:
+        SaleaeHeader mHeader;
+        SaleaeStatus::ErrorCode mStatus;
+        void* mMapped;
+        size_t mMappedSize;
+        const char* mTimeArray;
+
+        std::once_flag mSummaryFlag;
+        std::vector<std::vector<Summary>> mSummaryLevels;
+
+        uint64_t rawTime(uint64_t i) const;
+        void addInterval(Summary& sum, uint64_t i) const;
+        void buildSummary();
+    public:
+        SaleaeMappedFile(const std::string& filename);
+        ~SaleaeMappedFile();
+
+        SaleaeMappedFile(const SaleaeMappedFile&)            = delete;
+        SaleaeMappedFile& operator=(const SaleaeMappedFile&) = delete;
+
+        /// Returns whether the file was mapped successfully
+        bool good() const { return mStatus == SaleaeStatus::Ok; }
+
+        /// Get verbose error message based on internal status, empty string if no error
+        std::string get_last_error() const;
+
+        /// Getter for header information
+        const SaleaeHeader* header() const { return &mHeader; }
+
+        /// Number of events including the start value from header
+        uint64_t get_num_events() const { return mHeader.numTransitions() + 1; }
+
+        /// Time of event with index i, index 0 is the start value from header
+        uint64_t get_time(uint64_t i) const;
+
+        /// Value of event with index i, index 0 is the start value from header
+        int get_value(uint64_t i) const;
+
+        /// Getter for (time,value) tuple of event with index i
+        SaleaeDataTuple get_event(uint64_t i) const { return SaleaeDataTuple(get_time(i), get_value(i)); }
+
+        /// Index of last event at or before time t, -1 if t is before the first event
+        int64_t find_event(uint64_t t) const;
+
+        /// Index of first event at or after time t, number of events if there is none
+        uint64_t find_successor(uint64_t t) const;
+
+        /// Get waveform value for time t, -1 if t is before the first event
+        int get_int_value(uint64_t t) const;
+
+        /**
+         * Accumulate the intervals between event i0 and event i1 using the summary index, i.e., O(log n) blocks are visited.
+         * Interval i lasts from event i to event i+1 and is at the value of event i.
+         * @param i0 Index of first event
+         * @param i1 Index of last event, gets truncated to the index of the last event in file
+         * @return The accumulated summary
+         */
+        Summary get_summary(uint64_t i0, uint64_t i1);
+    };
+
     class SaleaeOutputFile : public std::ofstream
     {
         int mIndex;
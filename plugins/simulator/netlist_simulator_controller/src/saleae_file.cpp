@@ -10,6 +10,10 @@
 #include <iostream>
 #include <math.h>
 #include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace hal
 {
@@ -355,6 +359,207 @@ namespace hal
         return (pos%2==0) ? mHeader.value() : 1 - mHeader.value();
     }
 
+    SaleaeMappedFile::SaleaeMappedFile(const std::string& filename)
+        : mStatus(SaleaeStatus::Ok), mMapped(nullptr), mMappedSize(0), mTimeArray(nullptr)
+    {
+        std::ifstream ff(filename, std::ios::binary);
+        if (!ff.good())
+        {
+            mStatus = SaleaeStatus::ErrorOpenFile;
+            return;
+        }
+        mStatus = mHeader.read(ff);
+        if (mStatus) return;
+        uint64_t dataOffset = ff.tellg();
+        ff.close();
+
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            mStatus = SaleaeStatus::ErrorOpenFile;
+            return;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) || (uint64_t) st.st_size < dataOffset + mHeader.numTransitions() * sizeof(uint64_t))
+        {
+            ::close(fd);
+            mStatus = SaleaeStatus::UnexpectedEof;
+            return;
+        }
+
+        mMappedSize = st.st_size;
+        mMapped = mmap(nullptr, mMappedSize, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mMapped == MAP_FAILED)
+        {
+            mMapped = nullptr;
+            mStatus = SaleaeStatus::ErrorOpenFile;
+            return;
+        }
+        mTimeArray = static_cast<const char*>(mMapped) + dataOffset;
+    }
+
+    SaleaeMappedFile::~SaleaeMappedFile()
+    {
+        if (mMapped) munmap(mMapped, mMappedSize);
+    }
+
+    std::string SaleaeMappedFile::get_last_error() const
+    {
+        switch (mStatus) {
+        case SaleaeStatus::ErrorOpenFile:
+            return "Error mapping SALEAE file";
+        case SaleaeStatus::BadIndentifier:
+            return "No <SALEAE> identifier found";
+        case SaleaeStatus::UnsupportedType:
+            return "Expected SALEAE type 0 (digital data)";
+        case SaleaeStatus::UnexpectedEof:
+            return "SALEAE file is shorter than announced in header";
+        default:
+            break;
+        }
+        return std::string();
+    }
+
+    uint64_t SaleaeMappedFile::rawTime(uint64_t i) const
+    {
+        // data section starts at unaligned offset, memcpy compiles to a single load
+        uint64_t retval;
+        memcpy(&retval, mTimeArray + (i-1) * sizeof(uint64_t), sizeof(retval));
+        return retval;
+    }
+
+    uint64_t SaleaeMappedFile::get_time(uint64_t i) const
+    {
+        if (!i) return mHeader.beginTime();
+        switch (mHeader.storageFormat())
+        {
+        case SaleaeHeader::Double:
+        {
+            uint64_t raw = rawTime(i);
+            double tmp;
+            memcpy(&tmp, &raw, sizeof(tmp));
+            return (uint64_t) floor(tmp * SaleaeParser::sTimeScaleFactor + 0.5) - mHeader.beginTime();
+        }
+        case SaleaeHeader::Coded:
+            return rawTime(i) & 0x3fffffffffffffffull;
+        default:
+            break;
+        }
+        return rawTime(i);
+    }
+
+    int SaleaeMappedFile::get_value(uint64_t i) const
+    {
+        if (i && mHeader.storageFormat() == SaleaeHeader::Coded)
+            return ((rawTime(i) >> 62) & 0x3) - 2;
+        return (i%2==0) ? mHeader.value() : 1 - mHeader.value();
+    }
+
+    int64_t SaleaeMappedFile::find_event(uint64_t t) const
+    {
+        if (!good() || t < get_time(0)) return -1;
+
+        // binary search for first event after t
+        uint64_t lo = 1;
+        uint64_t hi = get_num_events();
+        while (lo < hi)
+        {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (get_time(mid) <= t)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo - 1;
+    }
+
+    uint64_t SaleaeMappedFile::find_successor(uint64_t t) const
+    {
+        int64_t pos = find_event(t);
+        if (pos < 0) return 0;
+        if (get_time(pos) < t) ++pos;
+        return pos;
+    }
+
+    int SaleaeMappedFile::get_int_value(uint64_t t) const
+    {
+        int64_t pos = find_event(t);
+        if (pos < 0) return -1;
+        return get_value(pos);
+    }
+
+    void SaleaeMappedFile::Summary::add(const Summary& other)
+    {
+        mTimeAtValue[0] += other.mTimeAtValue[0];
+        mTimeAtValue[1] += other.mTimeAtValue[1];
+        mTimeUndefined  += other.mTimeUndefined;
+        mNumIntervals   += other.mNumIntervals;
+    }
+
+    void SaleaeMappedFile::addInterval(Summary& sum, uint64_t i) const
+    {
+        uint64_t dt = get_time(i+1) - get_time(i);
+        int val = get_value(i);
+        if (0 <= val && val <= 1)
+            sum.mTimeAtValue[val] += dt;
+        else
+            sum.mTimeUndefined += dt;
+        ++sum.mNumIntervals;
+    }
+
+    void SaleaeMappedFile::buildSummary()
+    {
+        uint64_t numIntervals = mHeader.numTransitions();
+        if (numIntervals < sSummaryFanout) return;
+
+        // level 0 combines intervals, every further level combines blocks of the level below
+        std::vector<Summary> level((numIntervals + sSummaryFanout - 1) / sSummaryFanout);
+        for (uint64_t i = 0; i < numIntervals; i++)
+            addInterval(level[i / sSummaryFanout], i);
+        mSummaryLevels.push_back(std::move(level));
+
+        while (mSummaryLevels.back().size() >= sSummaryFanout)
+        {
+            const std::vector<Summary>& below = mSummaryLevels.back();
+            std::vector<Summary> above((below.size() + sSummaryFanout - 1) / sSummaryFanout);
+            for (uint64_t i = 0; i < below.size(); i++)
+                above[i / sSummaryFanout].add(below[i]);
+            mSummaryLevels.push_back(std::move(above));
+        }
+    }
+
+    SaleaeMappedFile::Summary SaleaeMappedFile::get_summary(uint64_t i0, uint64_t i1)
+    {
+        Summary retval;
+        if (!good()) return retval;
+        std::call_once(mSummaryFlag, [this]() { buildSummary(); });
+
+        if (i1 > mHeader.numTransitions()) i1 = mHeader.numTransitions();
+        uint64_t i = i0;
+        while (i < i1)
+        {
+            // take the largest aligned block which does not exceed i1
+            uint64_t blockSize = 1;
+            int level = -1;
+            while (level + 1 < (int) mSummaryLevels.size()
+                   && i % (blockSize * sSummaryFanout) == 0
+                   && i + blockSize * sSummaryFanout <= i1)
+            {
+                blockSize *= sSummaryFanout;
+                ++level;
+            }
+
+            if (level < 0)
+                addInterval(retval, i);
+            else
+                retval.add(mSummaryLevels[level][i / blockSize]);
+            i += blockSize;
+        }
+        return retval;
+    }
+
     SaleaeOutputFile::SaleaeOutputFile(const std::string &filename, int index_)
         : std::ofstream(filename, std::ios::binary), mIndex(index_), mFilename(filename), mStatus(SaleaeStatus::Ok),
           mFirstValue(true), mLastWrittenValue(0), mLastWrittenTime(0)
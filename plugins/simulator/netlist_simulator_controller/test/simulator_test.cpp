@@ -9,6 +9,7 @@
 #include "hal_core/utilities/log.h"
 #include "netlist_simulator_controller/netlist_simulator_controller.h"
 #include "netlist_simulator_controller/plugin_netlist_simulator_controller.h"
+#include "netlist_simulator_controller/saleae_file.h"
 #include "netlist_simulator_controller/simulation_engine.h"
 #include "netlist_simulator_controller/simulation_input.h"
 #include "netlist_simulator_controller/wave_data.h"
@@ -18,6 +19,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <random>
 #include <string>
 #include <thread>
 
@@ -577,6 +579,124 @@ namespace hal
         TEST_END
     }
 
+    TEST_F(SimulatorTest, counter_levelized)
+    {
+        // return;
+        TEST_START
+
+        auto plugin = plugin_manager::get_plugin_instance<NetlistSimulatorControllerPlugin>("netlist_simulator_controller");
+
+        auto sim_ctrl_levelized = plugin->create_simulator_controller("counter_levelized_simulator");
+        auto levelized_engine   = sim_ctrl_levelized->create_simulation_engine("hal_levelized_simulator");
+        EXPECT_TRUE(sim_ctrl_levelized->get_state() == NetlistSimulatorController::SimulationState::NoGatesSelected);
+        EXPECT_TRUE(levelized_engine->get_state() == SimulationEngine::State::Preparing);
+
+        auto sim_ctrl_reference = plugin->create_simulator_controller("counter_levelized_reference");
+
+        //path to netlist
+        std::string path_netlist = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/counter/counternetlist_flattened_by_hal.vhd";
+        if (!utils::file_exists(path_netlist))
+            FAIL() << "netlist for counter-test not found: " << path_netlist;
+
+        //create netlist from path
+        auto lib = gate_library_manager::get_gate_library_by_name("XILINX_UNISIM");
+        if (lib == nullptr)
+        {
+            FAIL() << "XILINX_UNISIM gate library not found";
+        }
+
+        std::unique_ptr<Netlist> nl;
+        {
+            NO_COUT_BLOCK;
+            nl = netlist_parser_manager::parse(path_netlist, lib);
+            if (nl == nullptr)
+            {
+                FAIL() << "netlist couldn't be parsed";
+            }
+        }
+
+        //path to vcd
+        std::string path_vcd = utils::get_base_directory().string() + "/bin/hal_plugins/test-files/counter/dump.vcd";
+        if (!utils::file_exists(path_vcd))
+            FAIL() << "dump for counter-test not found: " << path_vcd;
+
+        //prepare simulation
+        sim_ctrl_levelized->add_gates(nl->get_gates());
+        sim_ctrl_levelized->set_no_clock_used();
+        EXPECT_TRUE(sim_ctrl_levelized->get_state() == NetlistSimulatorController::SimulationState::ParameterSetup);
+
+        sim_ctrl_reference->add_gates(nl->get_gates());
+
+        Net* clock = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock"; }).begin());
+        sim_ctrl_levelized->add_clock_period(clock, 10000);
+
+        //read vcd
+        EXPECT_TRUE(sim_ctrl_reference->import_vcd(path_vcd, NetlistSimulatorController::FilterInputFlag::CompleteNetlist));
+
+        // retrieve nets
+        Net* reset          = *(nl->get_nets([](const Net* net) { return net->get_name() == "Reset"; }).begin());
+        Net* Clock_enable_B = *(nl->get_nets([](const Net* net) { return net->get_name() == "Clock_enable_B"; }).begin());
+        //        Net* output_0       = *(nl->get_nets([](const Net* net) { return net->get_name() == "Output_0"; }).begin());
+        //        Net* output_1       = *(nl->get_nets([](const Net* net) { return net->get_name() == "Output_1"; }).begin());
+        //        Net* output_2       = *(nl->get_nets([](const Net* net) { return net->get_name() == "Output_2"; }).begin());
+        //        Net* output_3       = *(nl->get_nets([](const Net* net) { return net->get_name() == "Output_3"; }).begin());
+
+        //start simulation
+        {
+            measure_block_time("simulation");
+            //testbench
+            sim_ctrl_levelized->set_input(Clock_enable_B, BooleanFunction::Value::ONE);    //#Clock_enable_B <= '1';
+            sim_ctrl_levelized->set_input(reset, BooleanFunction::Value::ZERO);            //#Reset <= '0';
+            sim_ctrl_levelized->simulate(40 * 1000);                                       //#WAIT FOR 40 NS; -> simulate 4 clock cycle  - cycle 0, 1, 2, 3
+
+            sim_ctrl_levelized->set_input(Clock_enable_B, BooleanFunction::Value::ZERO);    //#Clock_enable_B <= '0';
+            sim_ctrl_levelized->simulate(110 * 1000);                                       //#WAIT FOR 110 NS; -> simulate 11 clock cycle  - cycle 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14
+
+            sim_ctrl_levelized->set_input(reset, BooleanFunction::Value::ONE);    //#Reset <= '1';
+            sim_ctrl_levelized->simulate(20 * 1000);                              //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 15, 16
+
+            sim_ctrl_levelized->set_input(reset, BooleanFunction::Value::ZERO);    //#Reset <= '0';
+            sim_ctrl_levelized->simulate(70 * 1000);                               //#WAIT FOR 70 NS; -> simulate 7 clock cycle  - cycle 17, 18, 19, 20, 21, 22, 23
+
+            sim_ctrl_levelized->set_input(Clock_enable_B, BooleanFunction::Value::ONE);    //#Clock_enable_B <= '1';
+            sim_ctrl_levelized->simulate(23 * 1000);                                       //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 24, 25
+
+            sim_ctrl_levelized->set_input(reset, BooleanFunction::Value::ONE);    //#Reset <= '1';
+            sim_ctrl_levelized->simulate(20 * 1000);                              //#WAIT FOR 20 NS; -> simulate 2 clock cycle  - cycle 26, 27
+                //#3 additional traces á 10 NS to get 300 NS simulation time
+            sim_ctrl_levelized->simulate(17 * 1000);    //# remaining 17 NS to simulate 300 NS in total
+
+            sim_ctrl_levelized->run_simulation();
+
+            EXPECT_FALSE(levelized_engine->get_state() == SimulationEngine::State::Failed);
+
+            while (levelized_engine->get_state() == SimulationEngine::State::Running)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            }
+        }
+
+        if (levelized_engine->get_state() == SimulationEngine::State::Failed)
+        {
+            dump_engine_log(levelized_engine->get_working_directory());
+            FAIL() << "engine failed";
+        }
+
+        EXPECT_TRUE(levelized_engine->get_state() == SimulationEngine::State::Done);
+        EXPECT_FALSE(sim_ctrl_levelized->get_state() == NetlistSimulatorController::SimulationState::EngineFailed);
+
+        sim_ctrl_levelized->get_results();
+
+        // TODO @ Jörn: LOAD ALL WAVES TO MEMORY
+        EXPECT_TRUE(sim_ctrl_levelized->get_waves()->size() == (int)nl->get_nets().size());
+        EXPECT_TRUE(sim_ctrl_reference->get_waves()->size() == (int)nl->get_nets().size());
+
+        //Test if maps are equal
+        bool equal = cmp_sim_data(sim_ctrl_reference.get(), sim_ctrl_levelized.get());
+        EXPECT_TRUE(equal);
+        TEST_END
+    }
+
     TEST_F(SimulatorTest, toycipher)
     {
         // return;
@@ -1373,4 +1493,75 @@ namespace hal
         EXPECT_TRUE(equal);
         TEST_END
     }
+
+    TEST_F(SimulatorTest, saleae_mapped_file)
+    {
+        TEST_START
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "hal_saleae_mapped_file.bin";
+
+        // plain format alternates between 0 and 1, coded format may contain X and Z
+        for (bool coded : {false, true})
+        {
+            std::mt19937 rng(coded ? 1 : 0);
+            std::vector<std::pair<u64, int>> events = {{0, 0}};
+            for (u32 i = 0; i < 100000; i++)
+            {
+                int val = coded ? (int)(rng() % 4) - 2 : 1 - events.back().second;
+                if (val == events.back().second)
+                    continue;
+                events.push_back({events.back().first + 1 + rng() % 20, val});
+            }
+
+            {
+                SaleaeDataBuffer sdb(events.size());
+                for (u64 i = 0; i < events.size(); i++)
+                {
+                    sdb.mTimeArray[i]  = events.at(i).first;
+                    sdb.mValueArray[i] = events.at(i).second;
+                }
+                SaleaeOutputFile sof(path.string(), 0);
+                sof.put_data(&sdb);
+                sof.close();
+            }
+
+            SaleaeMappedFile smf(path.string());
+            ASSERT_TRUE(smf.good());
+            EXPECT_EQ(smf.header()->storageFormat(), coded ? SaleaeHeader::Coded : SaleaeHeader::Uint64);
+            ASSERT_EQ(smf.get_num_events(), events.size());
+            for (u64 i = 0; i < events.size(); i++)
+            {
+                EXPECT_EQ(smf.get_time(i), events.at(i).first);
+                EXPECT_EQ(smf.get_value(i), events.at(i).second);
+            }
+
+            for (u32 k = 0; k < 1000; k++)
+            {
+                u64 t   = rng() % (events.back().first + 10);
+                auto it = std::upper_bound(events.begin(), events.end(), std::make_pair(t, 2)) - 1;
+                EXPECT_EQ(smf.find_event(t), it - events.begin());
+                EXPECT_EQ(smf.get_int_value(t), it->second);
+
+                u64 i0 = rng() % events.size();
+                u64 i1 = i0 + rng() % (events.size() - i0);
+                SaleaeMappedFile::Summary expected;
+                for (u64 i = i0; i < i1; i++)
+                {
+                    u64 dt = events.at(i + 1).first - events.at(i).first;
+                    if (events.at(i).second < 0)
+                        expected.mTimeUndefined += dt;
+                    else
+                        expected.mTimeAtValue[events.at(i).second] += dt;
+                    expected.mNumIntervals++;
+                }
+                SaleaeMappedFile::Summary summary = smf.get_summary(i0, i1);
+                EXPECT_EQ(summary.mTimeAtValue[0], expected.mTimeAtValue[0]);
+                EXPECT_EQ(summary.mTimeAtValue[1], expected.mTimeAtValue[1]);
+                EXPECT_EQ(summary.mTimeUndefined, expected.mTimeUndefined);
+                EXPECT_EQ(summary.mNumIntervals, expected.mNumIntervals);
+            }
+        }
+
+        std::filesystem::remove(path);
+        TEST_END
+    }
 }    // namespace hal
@@ -30,11 +30,13 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist_parser/netlist_parser.h"
+#include "hal_core/utilities/memory_mapped_file.h"
 #include "hal_core/utilities/special_strings.h"
 #include "hal_core/utilities/token_stream.h"
 
+#include <deque>
 #include <optional>
-#include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -67,6 +69,14 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
 
+        /**
+         * Set the number of threads used to parse and expand the modules of the netlist in parallel.
+         * The resulting netlist does not depend on the number of threads.
+         *
+         * @param[in] num_threads - The number of threads, 0 to use all hardware threads.
+         */
+        void set_num_threads(const u32 num_threads);
+
     private:
         using identifier_t        = std::string;
         using ranged_identifier_t = std::pair<std::string, std::vector<std::vector<u32>>>;
@@ -147,7 +157,7 @@ namespace hal
             std::vector<std::unique_ptr<VerilogPort>> m_ports;
             std::map<std::string, VerilogPort*> m_ports_by_identifier;
             std::map<std::string, VerilogPort*> m_ports_by_expression;
-            std::map<std::string, std::string> m_expanded_port_identifiers_to_expressions;
+            std::map<std::string, std::string, std::less<>> m_expanded_port_identifiers_to_expressions;
 
             // signals
             std::vector<std::unique_ptr<VerilogSignal>> m_signals;
@@ -162,8 +172,9 @@ namespace hal
             std::map<std::string, VerilogInstance*> m_instances_by_name;
         };
 
-        std::stringstream m_fs;
+        MemoryMappedFile m_file;
         std::filesystem::path m_path;
+        u32 m_num_threads = 0;
 
         // temporary netlist
         Netlist* m_netlist = nullptr;
@@ -173,26 +184,27 @@ namespace hal
         std::unordered_map<std::string, VerilogModule*> m_modules_by_name;
         std::string m_last_module;
 
-        // token stream of entire input file
-        TokenStream<std::string> m_token_stream;
+        // token stream of entire input file, tokens are views into the mapped file or into the owned tokens
+        TokenStream<std::string_view> m_token_stream;
+        std::deque<std::string> m_owned_tokens;
 
         // some caching
         std::unordered_map<std::string, GateType*> m_gate_types;
         std::unordered_map<std::string, GateType*> m_vcc_gate_types;
         std::unordered_map<std::string, GateType*> m_gnd_gate_types;
         std::unordered_map<Net*, std::vector<std::pair<Module*, u32>>> m_module_port_by_net;
-        std::unordered_map<Module*, std::vector<std::tuple<std::string, Net*>>> m_module_ports;
+        std::unordered_map<Module*, std::vector<std::tuple<std::string_view, Net*>>> m_module_ports;
 
-        // unique aliases
+        // unique aliases, names are views into the intermediate format or into the names of the created nets
         std::unordered_map<std::string, u32> m_module_instantiation_count;
-        std::unordered_map<std::string, u32> m_instance_name_occurences;
-        std::unordered_map<std::string, u32> m_net_name_occurences;
+        std::unordered_map<const VerilogModule*, u32> m_remaining_instantiations;
+        std::unordered_map<std::string_view, u32> m_instance_name_occurences;
+        std::unordered_map<std::string_view, u32> m_net_name_occurences;
 
         // nets
         Net* m_zero_net;
         Net* m_one_net;
-        std::unordered_map<std::string, Net*> m_net_by_name;
-        std::vector<std::pair<std::string, std::string>> m_nets_to_merge;
+        std::vector<std::pair<Net*, Net*>> m_nets_to_merge;
 
         // parser settings
         const std::string instance_name_seperator = "/";
@@ -200,32 +212,41 @@ namespace hal
         // parse HDL into intermediate format
         void tokenize();
         Result<std::monostate> parse_tokens();
-        Result<std::monostate> parse_module(std::vector<VerilogDataEntry>& attributes);
-        void parse_port_list(VerilogModule* module);
-        Result<std::monostate> parse_port_declaration_list(VerilogModule* module);
-        Result<std::monostate> parse_port_definition(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_signal_definition(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_assignment(VerilogModule* module);
-        Result<std::monostate> parse_defparam(VerilogModule* module);
-        void parse_attribute(std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_instance(VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
-        Result<std::monostate> parse_port_assign(VerilogInstance* instance);
-        Result<std::vector<VerilogDataEntry>> parse_parameter_assign();
+        Result<std::unique_ptr<VerilogModule>> parse_module(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes);
+        void parse_port_list(TokenStream<std::string_view>& stream, VerilogModule* module);
+        Result<std::monostate> parse_port_declaration_list(TokenStream<std::string_view>& stream, VerilogModule* module);
+        Result<std::monostate> parse_port_definition(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
+        Result<std::monostate> parse_signal_definition(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
+        Result<std::monostate> parse_assignment(TokenStream<std::string_view>& stream, VerilogModule* module);
+        Result<std::monostate> parse_defparam(TokenStream<std::string_view>& stream, VerilogModule* module);
+        void parse_attribute(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes);
+        Result<std::monostate> parse_instance(TokenStream<std::string_view>& stream, VerilogModule* module, std::vector<VerilogDataEntry>& attributes);
+        Result<std::monostate> parse_port_assign(TokenStream<std::string_view>& stream, VerilogInstance* instance);
+        Result<std::vector<VerilogDataEntry>> parse_parameter_assign(TokenStream<std::string_view>& stream);
+        Result<std::monostate> expand_module(VerilogModule* verilog_module) const;
+        Result<std::monostate> expand_module_port_assignments(VerilogModule* verilog_module) const;
+        void release_module(VerilogModule* verilog_module) const;
 
         // construct netlist from intermediate format
         Result<std::monostate> construct_netlist(VerilogModule* top_module);
-        Result<Module*>
-            instantiate_module(const std::string& instance_name, VerilogModule* verilog_module, Module* parent, const std::unordered_map<std::string, std::string>& parent_module_assignments);
+        void expand_gate_pin_assignments(VerilogModule* verilog_module) const;
+        void release_gate_pin_assignments(VerilogModule* verilog_module) const;
+        void release_instantiation_data();
+        Result<Module*> instantiate_module(const std::string& instance_name,
+                                           VerilogModule* verilog_module,
+                                           Module* parent,
+                                           const std::string& parent_prefix,
+                                           const std::unordered_map<std::string_view, Net*>& parent_module_assignments);
 
         // helper functions
-        std::string get_unique_alias(const std::string& parent_name, const std::string& name, const std::unordered_map<std::string, u32>& name_occurences) const;
-        std::vector<u32> parse_range(TokenStream<std::string>& stream) const;
+        std::string get_unique_alias(const std::string& parent_prefix, const std::string& name, const std::unordered_map<std::string_view, u32>& name_occurences) const;
+        std::vector<u32> parse_range(TokenStream<std::string_view>& stream) const;
         void expand_ranges_recursively(std::vector<std::string>& expanded_names, const std::string& current_name, const std::vector<std::vector<u32>>& ranges, u32 dimension) const;
         std::vector<std::string> expand_ranges(const std::string& name, const std::vector<std::vector<u32>>& ranges) const;
         Result<std::vector<BooleanFunction::Value>> get_binary_vector(std::string value) const;
-        Result<std::string> get_hex_from_literal(const Token<std::string>& value_token) const;
-        Result<std::pair<std::string, std::string>> parse_parameter_value(const Token<std::string>& value_token) const;
-        Result<std::vector<VerilogParser::assignment_t>> parse_assignment_expression(TokenStream<std::string>&& stream) const;
+        Result<std::string> get_hex_from_literal(const Token<std::string_view>& value_token) const;
+        Result<std::pair<std::string, std::string>> parse_parameter_value(const Token<std::string_view>& value_token) const;
+        Result<std::vector<VerilogParser::assignment_t>> parse_assignment_expression(TokenStream<std::string_view>&& stream) const;
         std::vector<std::string> expand_assignment_expression(VerilogModule* verilog_module, const std::vector<assignment_t>& vars) const;
     };
 }    // namespace hal
@@ -8,32 +8,71 @@
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
+#include <atomic>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <queue>
+#include <sstream>
+#include <thread>
 
 namespace hal
 {
     namespace
     {
+        /**
+         * Run a task for every index in [0, num_tasks) on up to num_threads threads, handing out indices in ascending order.
+         * A thread count of 0 uses all hardware threads.
+         */
+        void run_in_parallel(const u32 num_tasks, u32 num_threads, const std::function<void(u32)>& task)
+        {
+            std::atomic<u32> next_task_idx = 0;
+            const auto work                = [&]() {
+                for (u32 task_idx = next_task_idx++; task_idx < num_tasks; task_idx = next_task_idx++)
+                {
+                    task(task_idx);
+                }
+            };
+
+            if (num_threads == 0)
+            {
+                num_threads = std::thread::hardware_concurrency();
+            }
+            num_threads = std::max(1u, std::min(num_threads, num_tasks));
 
+            if (num_threads == 1)
+            {
+                work();
+            }
+            else
+            {
+                std::vector<std::thread> workers;
+                for (u32 i = 0; i < num_threads; i++)
+                {
+                    workers.emplace_back(work);
+                }
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
+        }
     }    // namespace
 
+    void VerilogParser::set_num_threads(const u32 num_threads)
+    {
+        m_num_threads = num_threads;
+    }
+
     Result<std::monostate> VerilogParser::parse(const std::filesystem::path& file_path)
     {
         m_path = file_path;
         m_modules.clear();
         m_modules_by_name.clear();
 
+        if (auto res = m_file.map(file_path); res.is_error())
         {
-            std::ifstream ifs;
-            ifs.open(file_path.string(), std::ifstream::in);
-            if (!ifs.is_open())
-            {
-                return ERR("could not parse Verilog file '" + m_path.string() + "' : unable to open file");
-            }
-            m_fs << ifs.rdbuf();
-            ifs.close();
+            return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + m_path.string() + "' : unable to open file");
         }
 
         // tokenize file
@@ -47,7 +86,7 @@ namespace hal
                 return ERR_APPEND(res.get_error(), "could not parse Verilog file '" + file_path.string() + "': unable to parse tokens");
             }
         }
-        catch (TokenStream<std::string>::TokenStreamException& e)
+        catch (TokenStream<std::string_view>::TokenStreamException& e)
         {
             if (e.line_number != (u32)-1)
             {
@@ -59,171 +98,221 @@ namespace hal
             }
         }
 
+        // the intermediate format owns all strings, hence the tokens and the file are no longer needed
+        m_token_stream = TokenStream<std::string_view>();
+        m_owned_tokens.clear();
+        m_file.unmap();
+
         if (m_modules.empty())
         {
             return ERR("could not parse Verilog file '" + m_path.string() + "': does not contain any modules");
         }
 
         // expand module port identifiers, signals, and assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        const u32 num_modules = m_modules.size();
+        std::vector<std::optional<Result<std::monostate>>> results(num_modules);
+        run_in_parallel(num_modules, m_num_threads, [&](const u32 module_idx) { results[module_idx] = expand_module(m_modules[module_idx].get()); });
+        for (auto& res : results)
+        {
+            if (res->is_error())
+            {
+                return std::move(res.value());
+            }
+        }
+
+        // expand module port assignments, which requires the expanded port identifiers of all instantiated modules
+        run_in_parallel(num_modules, m_num_threads, [&](const u32 module_idx) { results[module_idx] = expand_module_port_assignments(m_modules[module_idx].get()); });
+        for (auto& res : results)
+        {
+            if (res->is_error())
+            {
+                return std::move(res.value());
+            }
+        }
+
+        // release everything that has been expanded and is not needed for instantiation
+        for (const auto& verilog_module : m_modules)
+        {
+            release_module(verilog_module.get());
+        }
+
+        return OK({});
+    }
+
+    void VerilogParser::release_module(VerilogModule* verilog_module) const
+    {
+        verilog_module->m_ports_by_identifier.clear();
+        std::vector<VerilogAssignment>().swap(verilog_module->m_assignments);
+        verilog_module->m_instances_by_name.clear();
+
+        for (const auto& instance : verilog_module->m_instances)
         {
-            // expand port identifiers
-            for (const auto& port : verilog_module->m_ports)
+            if (instance->m_is_module)
             {
-                if (port->m_expression == port->m_identifier)
+                std::vector<VerilogPortAssignment>().swap(instance->m_port_assignments);
+            }
+        }
+    }
+
+    Result<std::monostate> VerilogParser::expand_module(VerilogModule* verilog_module) const
+    {
+        // expand port identifiers
+        for (const auto& port : verilog_module->m_ports)
+        {
+            if (port->m_expression == port->m_identifier)
+            {
+                if (!port->m_ranges.empty())
                 {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers = {port->m_identifier};
-                    }
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
                 }
                 else
                 {
-                    if (!port->m_ranges.empty())
-                    {
-                        port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                        auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
-
-                        std::transform(port->m_expanded_identifiers.begin(),
-                                       port->m_expanded_identifiers.end(),
-                                       expanded_expression.begin(),
-                                       std::inserter(verilog_module->m_expanded_port_identifiers_to_expressions, verilog_module->m_expanded_port_identifiers_to_expressions.end()),
-                                       std::make_pair<const std::string&, const std::string&>);
-                    }
-                    else
-                    {
-                        port->m_expanded_identifiers                                                   = {port->m_identifier};
-                        verilog_module->m_expanded_port_identifiers_to_expressions[port->m_identifier] = port->m_expression;
-                    }
+                    port->m_expanded_identifiers = {port->m_identifier};
                 }
             }
-
-            // expand signals
-            for (auto& signal : verilog_module->m_signals)
+            else
             {
-                if (!signal->m_ranges.empty())
+                if (!port->m_ranges.empty())
                 {
-                    signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                    auto expanded_expression     = expand_ranges(port->m_expression, port->m_ranges);
+
+                    std::transform(port->m_expanded_identifiers.begin(),
+                                   port->m_expanded_identifiers.end(),
+                                   expanded_expression.begin(),
+                                   std::inserter(verilog_module->m_expanded_port_identifiers_to_expressions, verilog_module->m_expanded_port_identifiers_to_expressions.end()),
+                                   std::make_pair<const std::string&, const std::string&>);
                 }
                 else
                 {
-                    signal->m_expanded_names = std::vector<std::string>({signal->m_name});
+                    port->m_expanded_identifiers                                                   = {port->m_identifier};
+                    verilog_module->m_expanded_port_identifiers_to_expressions[port->m_identifier] = port->m_expression;
                 }
             }
+        }
 
-            // expand assignments
-            for (auto& assignment : verilog_module->m_assignments)
+        // expand signals
+        for (auto& signal : verilog_module->m_signals)
+        {
+            if (!signal->m_ranges.empty())
             {
-                const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
-                const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
-                if (left_signals.empty() || right_signals.empty())
-                {
-                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
-                }
+                signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+            }
+            else
+            {
+                signal->m_expanded_names = std::vector<std::string>({signal->m_name});
+            }
+        }
+
+        // expand assignments
+        for (auto& assignment : verilog_module->m_assignments)
+        {
+            const std::vector<std::string> left_signals  = expand_assignment_expression(verilog_module, assignment.m_variable);
+            const std::vector<std::string> right_signals = expand_assignment_expression(verilog_module, assignment.m_assignment);
+            if (left_signals.empty() || right_signals.empty())
+            {
+                return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand assignments within module '" + verilog_module->m_name + "'");
+            }
 
-                u32 left_size  = left_signals.size();
-                u32 right_size = right_signals.size();
-                if (left_size <= right_size)
+            u32 left_size  = left_signals.size();
+            u32 right_size = right_signals.size();
+            if (left_size <= right_size)
+            {
+                // cut off redundant bits
+                for (u32 i = 0; i < left_size; i++)
                 {
-                    // cut off redundant bits
-                    for (u32 i = 0; i < left_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
                 }
-                else
+            }
+            else
+            {
+                for (u32 i = 0; i < right_size; i++)
                 {
-                    for (u32 i = 0; i < right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
+                }
 
-                    // implicit "0"
-                    for (u32 i = 0; i < left_size - right_size; i++)
-                    {
-                        verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
-                    }
+                // implicit "0"
+                for (u32 i = 0; i < left_size - right_size; i++)
+                {
+                    verilog_module->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i + right_size), "'0'"));
                 }
             }
         }
 
-        // expand module port assignments
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        return OK({});
+    }
+
+    Result<std::monostate> VerilogParser::expand_module_port_assignments(VerilogModule* verilog_module) const
+    {
+        for (auto& instance : verilog_module->m_instances)
         {
-            for (auto& instance : verilog_module->m_instances)
+            if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
             {
-                if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
+                instance->m_is_module = true;
+                if (!instance->m_port_assignments.empty())
                 {
-                    instance->m_is_module = true;
-                    if (!instance->m_port_assignments.empty())
+                    // all port assignments by name
+                    if (instance->m_port_assignments.front().m_port_name.has_value())
                     {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port_name.has_value())
+                        for (const auto& port_assignment : instance->m_port_assignments)
                         {
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                            const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
                             {
-                                const std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
+                                VerilogPort* port;
+                                if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
+                                    port_it == module_it->second->m_ports_by_identifier.end())
                                 {
-                                    VerilogPort* port;
-                                    if (const auto port_it = module_it->second->m_ports_by_identifier.find(port_assignment.m_port_name.value());
-                                        port_it == module_it->second->m_ports_by_identifier.end())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
-                                                   + "' as it is not a port of module '" + module_it->first + "'");
-                                    }
-                                    else
-                                    {
-                                        port = port_it->second;
-                                    }
-                                    const std::vector<std::string>& left_port = port->m_expanded_identifiers;
-                                    if (left_port.empty())
-                                    {
-                                        return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to assign signal to port '" + port_assignment.m_port_name.value()
+                                               + "' as it is not a port of module '" + module_it->first + "'");
+                                }
+                                else
+                                {
+                                    port = port_it->second;
+                                }
+                                const std::vector<std::string>& left_port = port->m_expanded_identifiers;
+                                if (left_port.empty())
+                                {
+                                    return ERR("could not parse Verilog file '" + m_path.string() + "': unable to expand port assignment");
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
-                        // all port assignments by order
-                        else
+                    }
+                    // all port assignments by order
+                    else
+                    {
+                        std::vector<std::string> ports;
+                        for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
                         {
-                            std::vector<std::string> ports;
-                            for (const auto& port : m_modules_by_name.at(instance->m_type)->m_ports)
-                            {
-                                ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                            }
+                            ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
+                        }
 
-                            auto port_it = ports.begin();
+                        auto port_it = ports.begin();
 
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
                             {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
+                                std::vector<std::string> left_port;
 
-                                    for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
-                                    {
-                                        left_port.push_back(*port_it++);
-                                    }
+                                for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
+                                {
+                                    left_port.push_back(*port_it++);
+                                }
 
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
 
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
@@ -248,22 +337,10 @@ namespace hal
         m_gate_types.clear();
         m_gnd_gate_types.clear();
         m_vcc_gate_types.clear();
-        m_module_instantiation_count.clear();
-        m_instance_name_occurences.clear();
-        m_net_name_occurences.clear();
-        m_net_by_name.clear();
-        m_nets_to_merge.clear();
-        m_module_ports.clear();
-        m_module_port_by_net.clear();
+        release_instantiation_data();
         for (const auto& verilog_module : m_modules)
         {
-            for (const auto& instance : verilog_module->m_instances)
-            {
-                if (!instance->m_is_module)
-                {
-                    instance->m_expanded_port_assignments.clear();
-                }
-            }
+            release_gate_pin_assignments(verilog_module.get());
         }
 
         // buffer gate types
@@ -277,14 +354,12 @@ namespace hal
         {
             return ERR("could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': failed to create zero net");
         }
-        m_net_by_name[m_zero_net->get_name()] = m_zero_net;
 
         m_one_net = m_netlist->create_net("'1'");
         if (m_one_net == nullptr)
         {
             return ERR("could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': failed to create one net");
         }
-        m_net_by_name[m_one_net->get_name()] = m_one_net;
 
         // TODO: This tries to find the topmodule by searching for a module that is not referenced by any other module. This fails when there are multiple of those modules (for example with unused modules). There is also a top=1 flag that is set bz yosys for example that we could check first, before using this approach.
         std::map<std::string, u32> module_name_to_refereneces;
@@ -321,9 +396,12 @@ namespace hal
         // construct the netlist with the the top module
         VerilogModule* top_module = m_modules_by_name.at(top_module_candidates.front());
 
-        if (const auto res = construct_netlist(top_module); res.is_error())
+        auto construct_res = construct_netlist(top_module);
+        release_instantiation_data();
+        if (construct_res.is_error())
         {
-            return ERR_APPEND(res.get_error(), "could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': unable to construct netlist");
+            return ERR_APPEND(construct_res.get_error(),
+                              "could not instantiate Verilog netlist '" + m_path.string() + "' with gate library '" + gate_library->get_name() + "': unable to construct netlist");
         }
 
         // delete unused nets
@@ -359,24 +437,76 @@ namespace hal
 
     void VerilogParser::tokenize()
     {
-        const std::string delimiters = "`,()[]{}\\#*: ;=./";
-        std::string current_token;
-        u32 line_number = 0;
+        const std::string_view delimiters = "`,()[]{}\\#*: ;=./";
+        const std::string_view data       = m_file.get_data();
+        u32 line_number                   = 0;
+
+        // the current token is a view into the file as long as its characters are contiguous, and an owned string otherwise
+        u64 token_begin = 0;
+        u64 token_end   = 0;
+        std::string owned_token;
+        bool is_owned = false;
 
-        std::string line;
         char prev_char  = 0;
         bool in_string  = false;
         bool escaped    = false;
         bool in_comment = false;
 
-        std::vector<Token<std::string>> parsed_tokens;
-        while (std::getline(m_fs, line))
+        std::vector<Token<std::string_view>> parsed_tokens;
+        m_owned_tokens.clear();
+
+        auto append_char = [&](u64 pos) {
+            if (!is_owned && token_begin != token_end && token_end != pos)
+            {
+                owned_token.assign(data.substr(token_begin, token_end - token_begin));
+                is_owned = true;
+            }
+
+            if (is_owned)
+            {
+                owned_token += data[pos];
+            }
+            else
+            {
+                if (token_begin == token_end)
+                {
+                    token_begin = pos;
+                }
+                token_end = pos + 1;
+            }
+        };
+        auto current_token_empty = [&]() { return is_owned ? owned_token.empty() : token_begin == token_end; };
+        auto take_current_token  = [&]() -> std::string_view {
+            std::string_view token;
+            if (is_owned)
+            {
+                token = m_owned_tokens.emplace_back(std::move(owned_token));
+                owned_token.clear();
+                is_owned = false;
+            }
+            else
+            {
+                token = data.substr(token_begin, token_end - token_begin);
+            }
+            token_begin = token_end = 0;
+            return token;
+        };
+
+        u64 line_begin = 0;
+        while (line_begin < data.size())
         {
+            u64 line_end = data.find('\n', line_begin);
+            if (line_end == std::string_view::npos)
+            {
+                line_end = data.size();
+            }
+
             line_number++;
-            // this->remove_comments(line, multi_line_comment);
 
-            for (char c : line)
+            for (u64 pos = line_begin; pos < line_end; pos++)
             {
+                const char c = data[pos];
+
                 // deal with comments
                 if (in_comment)
                 {
@@ -405,26 +535,34 @@ namespace hal
                     in_string = !in_string;
                 }
 
-                if (!in_comment && ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped || in_string))
+                if (!in_comment && ((!std::isspace(c) && delimiters.find(c) == std::string_view::npos) || escaped || in_string))
                 {
-                    current_token += c;
+                    append_char(pos);
                 }
                 else
                 {
                     // deal with floats
-                    if (!current_token.empty())
+                    if (!current_token_empty())
                     {
-                        if (parsed_tokens.size() > 1 && utils::is_digits(parsed_tokens.at(parsed_tokens.size() - 2).string) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
-                            && utils::is_digits(current_token))
+                        const std::string_view current_token = take_current_token();
+                        if (parsed_tokens.size() > 1 && utils::is_digits(std::string(parsed_tokens.at(parsed_tokens.size() - 2).string)) && parsed_tokens.at(parsed_tokens.size() - 1) == "."
+                            && utils::is_digits(std::string(current_token)))
                         {
                             parsed_tokens.pop_back();
-                            parsed_tokens.back() += "." + current_token;
+                            std::string_view& integral = parsed_tokens.back().string;
+                            if (integral.data() + integral.size() + 1 == current_token.data())
+                            {
+                                integral = std::string_view(integral.data(), integral.size() + 1 + current_token.size());
+                            }
+                            else
+                            {
+                                integral = m_owned_tokens.emplace_back(std::string(integral) + "." + std::string(current_token));
+                            }
                         }
                         else
                         {
                             parsed_tokens.emplace_back(line_number, current_token);
                         }
-                        current_token.clear();
                     }
 
                     if (!parsed_tokens.empty())
@@ -461,15 +599,16 @@ namespace hal
 
                     if (!std::isspace(c))
                     {
-                        parsed_tokens.emplace_back(line_number, std::string(1, c));
+                        parsed_tokens.emplace_back(line_number, data.substr(pos, 1));
                     }
                 }
             }
-            if (!current_token.empty())
+            if (!current_token_empty())
             {
-                parsed_tokens.emplace_back(line_number, current_token);
-                current_token.clear();
+                parsed_tokens.emplace_back(line_number, take_current_token());
             }
+
+            line_begin = line_end + 1;
         }
 
         m_token_stream = TokenStream(parsed_tokens, {"(", "["}, {")", "]"});
@@ -477,14 +616,17 @@ namespace hal
 
     Result<std::monostate> VerilogParser::parse_tokens()
     {
+        // split the token stream at module boundaries, since every module can be parsed independently
+        std::vector<TokenStream<std::string_view>> module_streams;
+        std::vector<std::vector<VerilogDataEntry>> module_attributes;
+        std::vector<u32> line_numbers;
         std::vector<VerilogDataEntry> attributes;
-        u32 line_number;
 
         while (m_token_stream.remaining() > 0)
         {
             if (m_token_stream.peek() == "(*")
             {
-                parse_attribute(attributes);
+                parse_attribute(m_token_stream, attributes);
             }
             else if (m_token_stream.peek() == "`")
             {
@@ -493,32 +635,84 @@ namespace hal
             }
             else
             {
-                line_number = m_token_stream.peek().number;
-                if (auto res = parse_module(attributes); res.is_error())
+                const u32 begin = m_token_stream.position();
+                u32 end         = m_token_stream.find_next("endmodule", TokenStream<std::string_view>::END_OF_STREAM, false);
+                end             = (end < m_token_stream.size()) ? end + 1 : m_token_stream.size();
+
+                std::vector<Token<std::string_view>> module_tokens;
+                module_tokens.reserve(end - begin);
+                for (u32 i = begin; i < end; i++)
                 {
-                    return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse module (line " + std::to_string(line_number) + ")");
+                    module_tokens.push_back(m_token_stream.at(i));
                 }
+                m_token_stream.set_position(end);
+
+                module_streams.emplace_back(module_tokens, std::vector<std::string_view>({"(", "["}), std::vector<std::string_view>({")", "]"}));
+                module_attributes.push_back(std::move(attributes));
+                line_numbers.push_back(module_tokens.front().number);
+                attributes.clear();
             }
         }
 
+        // make sure the log channel exists before it is used concurrently
+        LOG_CHANNEL("verilog_parser");
+
+        const u32 num_modules = module_streams.size();
+        std::vector<std::optional<Result<std::unique_ptr<VerilogModule>>>> results(num_modules);
+        std::vector<std::exception_ptr> exceptions(num_modules);
+
+        run_in_parallel(num_modules, m_num_threads, [&](const u32 module_idx) {
+            try
+            {
+                results[module_idx] = parse_module(module_streams[module_idx], module_attributes[module_idx]);
+            }
+            catch (...)
+            {
+                exceptions[module_idx] = std::current_exception();
+            }
+        });
+
+        // merge in file order to report the first error and to keep the module order deterministic
+        for (u32 module_idx = 0; module_idx < num_modules; module_idx++)
+        {
+            if (exceptions[module_idx] != nullptr)
+            {
+                std::rethrow_exception(exceptions[module_idx]);
+            }
+
+            auto& res = results[module_idx].value();
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not parse tokens: unable to parse module (line " + std::to_string(line_numbers[module_idx]) + ")");
+            }
+
+            std::unique_ptr<VerilogModule> verilog_module = res.get();
+            const std::string& module_name                = verilog_module->m_name;
+
+            // verify module name
+            if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
+            {
+                return ERR("could not parse tokens: unable to parse module '" + module_name + "' (line " + std::to_string(verilog_module->m_line_number)
+                           + "): a module with the same name already exists (line " + std::to_string(it->second->m_line_number) + ")");
+            }
+
+            // add to collection of modules
+            m_modules_by_name[module_name] = verilog_module.get();
+            m_last_module                  = module_name;
+            m_modules.push_back(std::move(verilog_module));
+        }
+
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_module(std::vector<VerilogDataEntry>& attributes)
+    Result<std::unique_ptr<VerilogParser::VerilogModule>> VerilogParser::parse_module(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes)
     {
         std::set<std::string> port_names;
         std::vector<VerilogDataEntry> internal_attributes;
 
-        m_token_stream.consume("module", true);
-        const u32 line_number         = m_token_stream.peek().number;
-        const std::string module_name = m_token_stream.consume();
-
-        // verify entity name
-        if (const auto it = m_modules_by_name.find(module_name); it != m_modules_by_name.end())
-        {
-            return ERR("could not parse module '" + module_name + "' (line " + std::to_string(line_number) + "): a module with the same name already exists (line "
-                       + std::to_string(it->second->m_line_number) + ")");
-        }
+        stream.consume("module", true);
+        const u32 line_number         = stream.peek().number;
+        const std::string module_name = std::string(stream.consume().string);
 
         auto verilog_module               = std::make_unique<VerilogModule>();
         VerilogModule* verilog_module_raw = verilog_module.get();
@@ -526,44 +720,44 @@ namespace hal
         verilog_module_raw->m_name        = module_name;
 
         // parse parameter list
-        if (m_token_stream.consume("#("))
+        if (stream.consume("#("))
         {
             // TODO add support for parameter parsing
-            m_token_stream.consume_until(")");
-            m_token_stream.consume(")", true);
+            stream.consume_until(")");
+            stream.consume(")", true);
             log_warning("verilog_parser", "could not parse parameter list provided for module '{}'.", module_name);
         }
 
         // parse port (declaration) list
-        m_token_stream.consume("(", true);
-        Token<std::string> next_token = m_token_stream.peek();
+        stream.consume("(", true);
+        Token<std::string_view> next_token = stream.peek();
         if (next_token == "input" || next_token == "output" || next_token == "inout")
         {
-            if (auto res = parse_port_declaration_list(verilog_module_raw); res.is_error())
+            if (auto res = parse_port_declaration_list(stream, verilog_module_raw); res.is_error())
             {
                 return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse port declaration list (line " + std::to_string(line_number) + ")");
             }
         }
         else
         {
-            parse_port_list(verilog_module_raw);
+            parse_port_list(stream, verilog_module_raw);
         }
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
-        next_token = m_token_stream.peek();
+        next_token = stream.peek();
         while (next_token != "endmodule")
         {
             if (next_token == "input" || next_token == "output" || next_token == "inout")
             {
-                if (auto res = parse_port_definition(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_port_definition(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse port definition (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "wire" || next_token == "tri")
             {
-                if (auto res = parse_signal_definition(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_signal_definition(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse signal definition (line " + std::to_string(line_number) + ")");
                 }
@@ -571,40 +765,40 @@ namespace hal
             else if (next_token == "parameter")
             {
                 // TODO add support for parameter parsing
-                m_token_stream.consume_until(";");
-                m_token_stream.consume(";", true);
+                stream.consume_until(";");
+                stream.consume(";", true);
                 log_warning("verilog_parser", "could not parse parameter provided for module '{}'.", module_name);
             }
             else if (next_token == "assign")
             {
-                if (auto res = parse_assignment(verilog_module_raw); res.is_error())
+                if (auto res = parse_assignment(stream, verilog_module_raw); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse assignment (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "defparam")
             {
-                if (auto res = parse_defparam(verilog_module_raw); res.is_error())
+                if (auto res = parse_defparam(stream, verilog_module_raw); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse defparam (line " + std::to_string(line_number) + ")");
                 }
             }
             else if (next_token == "(*")
             {
-                parse_attribute(internal_attributes);
+                parse_attribute(stream, internal_attributes);
             }
             else
             {
-                if (auto res = parse_instance(verilog_module_raw, internal_attributes); res.is_error())
+                if (auto res = parse_instance(stream, verilog_module_raw, internal_attributes); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse module '" + module_name + "': unable to parse instance (line " + std::to_string(line_number) + ")");
                 }
             }
 
-            next_token = m_token_stream.peek();
+            next_token = stream.peek();
         }
 
-        m_token_stream.consume("endmodule", true);
+        stream.consume("endmodule", true);
 
         // assign attributes to entity
         if (!attributes.empty())
@@ -613,22 +807,17 @@ namespace hal
             attributes.clear();
         }
 
-        // add to collection of entities
-        m_modules.push_back(std::move(verilog_module));
-        m_modules_by_name[module_name] = verilog_module_raw;
-        m_last_module                  = module_name;
-
-        return OK({});
+        return OK(std::move(verilog_module));
     }
 
-    void VerilogParser::parse_port_list(VerilogModule* verilog_module)
+    void VerilogParser::parse_port_list(TokenStream<std::string_view>& stream, VerilogModule* verilog_module)
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        TokenStream<std::string_view> ports_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
-            Token<std::string> next_token = ports_stream.consume();
+            Token<std::string_view> next_token = ports_stream.consume();
             auto port                     = std::make_unique<VerilogPort>();
 
             if (next_token == ".")
@@ -652,19 +841,19 @@ namespace hal
         }
     }
 
-    Result<std::monostate> VerilogParser::parse_port_declaration_list(VerilogModule* verilog_module)
+    Result<std::monostate> VerilogParser::parse_port_declaration_list(TokenStream<std::string_view>& stream, VerilogModule* verilog_module)
     {
-        TokenStream<std::string> ports_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        TokenStream<std::string_view> ports_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         while (ports_stream.remaining() > 0)
         {
             // direction
-            const Token<std::string> direction_token = ports_stream.consume();
-            PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+            const Token<std::string_view> direction_token = ports_stream.consume();
+            PinDirection direction                   = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
             if (direction == PinDirection::none || direction == PinDirection::internal)
             {
-                return ERR("could not parse port declaration list: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+                return ERR("could not parse port declaration list: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
             }
 
             // ranges
@@ -680,7 +869,7 @@ namespace hal
             // port expressions
             do
             {
-                const Token<std::string> next_token = ports_stream.peek();
+                const Token<std::string_view> next_token = ports_stream.peek();
                 if (next_token == "input" || next_token == "output" || next_token == "inout")
                 {
                     break;
@@ -688,7 +877,7 @@ namespace hal
                 ports_stream.consume();
 
                 auto port                          = std::make_unique<VerilogPort>();
-                const std::string& port_expression = next_token.string;
+                const std::string port_expression(next_token.string);
                 port->m_identifier                 = port_expression;
                 port->m_expression                 = port_expression;
                 port->m_direction                  = direction;
@@ -718,22 +907,22 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_port_definition(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_port_definition(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
     {
         // port direction
-        const Token<std::string> direction_token = m_token_stream.consume();
-        PinDirection direction                   = enum_from_string<PinDirection>(direction_token.string, PinDirection::none);
+        const Token<std::string_view> direction_token = stream.consume();
+        PinDirection direction                   = enum_from_string<PinDirection>(std::string(direction_token.string), PinDirection::none);
         if (direction == PinDirection::none || direction == PinDirection::internal)
         {
-            return ERR("could not parse port definition: invalid direction '" + direction_token.string + "' (line " + std::to_string(direction_token.number) + ")");
+            return ERR("could not parse port definition: invalid direction '" + std::string(direction_token.string) + "' (line " + std::to_string(direction_token.number) + ")");
         }
 
         // ranges
         std::vector<std::vector<u32>> ranges;
-        while (m_token_stream.consume("["))
+        while (stream.consume("["))
         {
-            const std::vector<u32> range = parse_range(m_token_stream);
-            m_token_stream.consume("]", true);
+            const std::vector<u32> range = parse_range(stream);
+            stream.consume("]", true);
 
             ranges.emplace_back(range);
         }
@@ -741,8 +930,8 @@ namespace hal
         // port expressions
         do
         {
-            Token<std::string> port_expression_token = m_token_stream.consume();
-            std::string port_expression              = port_expression_token.string;
+            Token<std::string_view> port_expression_token = stream.consume();
+            std::string port_expression              = std::string(port_expression_token.string);
 
             VerilogPort* port;
             if (const auto it = verilog_module->m_ports_by_expression.find(port_expression); it == verilog_module->m_ports_by_expression.end())
@@ -779,21 +968,21 @@ namespace hal
                 auto* signal = signal_it->second;
                 signal->m_attributes.insert(signal->m_attributes.end(), attributes.begin(), attributes.end());
             }
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
         attributes.clear();
 
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_signal_definition(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_signal_definition(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
     {
         // consume "wire" or "tri"
-        u32 line_number = m_token_stream.consume().number;
+        u32 line_number = stream.consume().number;
 
-        TokenStream<std::string> signal_stream = m_token_stream.extract_until(";");
-        m_token_stream.consume(";", true);
+        TokenStream<std::string_view> signal_stream = stream.extract_until(";");
+        stream.consume(";", true);
 
         // extract bounds
         std::vector<std::vector<u32>> ranges;
@@ -808,11 +997,11 @@ namespace hal
         // extract names
         do
         {
-            Token<std::string> signal_name = signal_stream.consume();
+            Token<std::string_view> signal_name = signal_stream.consume();
             if (signal_stream.remaining() > 0 && signal_stream.peek() == "=")
             {
                 VerilogAssignment assignment;
-                assignment.m_variable.push_back(signal_name);
+                assignment.m_variable.push_back(std::string(signal_name.string));
                 signal_stream.consume("=", true);
                 if (auto res = parse_assignment_expression(signal_stream.extract_until(",")); res.is_error())
                 {
@@ -826,7 +1015,7 @@ namespace hal
             }
 
             // create signal if not already implicitly declared otherwise
-            if (const auto signal_it = verilog_module->m_signals_by_name.find(signal_name.string); signal_it == verilog_module->m_signals_by_name.end())
+            if (const auto signal_it = verilog_module->m_signals_by_name.find(std::string(signal_name.string)); signal_it == verilog_module->m_signals_by_name.end())
             {
                 auto signal    = std::make_unique<VerilogSignal>();
                 signal->m_name = signal_name.string;
@@ -835,7 +1024,7 @@ namespace hal
                     signal->m_ranges = ranges;
                 }
                 signal->m_attributes.insert(signal->m_attributes.end(), attributes.begin(), attributes.end());
-                verilog_module->m_signals_by_name[signal_name.string] = signal.get();
+                verilog_module->m_signals_by_name[std::string(signal_name.string)] = signal.get();
                 verilog_module->m_signals.push_back(std::move(signal));
             }
             else
@@ -851,13 +1040,13 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_assignment(VerilogModule* verilog_module)
+    Result<std::monostate> VerilogParser::parse_assignment(TokenStream<std::string_view>& stream, VerilogModule* verilog_module)
     {
-        m_token_stream.consume("assign", true);
-        u32 line_number = m_token_stream.peek().number;
+        stream.consume("assign", true);
+        u32 line_number = stream.peek().number;
         VerilogAssignment assignment;
 
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until("=")); res.is_error())
+        if (auto res = parse_assignment_expression(stream.extract_until("=")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -865,9 +1054,9 @@ namespace hal
         {
             assignment.m_variable = res.get();
         }
-        m_token_stream.consume("=", true);
+        stream.consume("=", true);
 
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until(";")); res.is_error())
+        if (auto res = parse_assignment_expression(stream.extract_until(";")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -902,25 +1091,25 @@ namespace hal
                 }
             }
         }
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
         verilog_module->m_assignments.push_back(std::move(assignment));
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_defparam(VerilogModule* module)
+    Result<std::monostate> VerilogParser::parse_defparam(TokenStream<std::string_view>& stream, VerilogModule* module)
     {
-        m_token_stream.consume("defparam", true);
-        std::string instance_name = m_token_stream.consume().string;
-        m_token_stream.consume(".", true);
+        stream.consume("defparam", true);
+        std::string instance_name = std::string(stream.consume().string);
+        stream.consume(".", true);
 
         if (const auto inst_it = module->m_instances_by_name.find(instance_name); inst_it != module->m_instances_by_name.end())
         {
             VerilogDataEntry param;
-            param.m_name = m_token_stream.consume().string;
-            m_token_stream.consume("=", true);
+            param.m_name = stream.consume().string;
+            stream.consume("=", true);
 
-            if (const auto res = parse_parameter_value(m_token_stream.consume()); res.is_ok())
+            if (const auto res = parse_parameter_value(stream.consume()); res.is_ok())
             {
                 const auto value = res.get();
                 param.m_type     = value.first;
@@ -934,28 +1123,28 @@ namespace hal
         }
         else
         {
-            m_token_stream.consume(";", true);
+            stream.consume(";", true);
             return ERR("could not parse defparam: no instance with name '" + instance_name + "' exists within module '" + module->m_name + "'");
         }
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
         return OK({});
     }
 
-    void VerilogParser::parse_attribute(std::vector<VerilogDataEntry>& attributes)
+    void VerilogParser::parse_attribute(TokenStream<std::string_view>& stream, std::vector<VerilogDataEntry>& attributes)
     {
-        m_token_stream.consume("(*", true);
+        stream.consume("(*", true);
 
         // extract attributes
         do
         {
             VerilogDataEntry attribute;
-            attribute.m_name = m_token_stream.consume().string;
+            attribute.m_name = stream.consume().string;
 
             // attribute value specified?
-            if (m_token_stream.consume("="))
+            if (stream.consume("="))
             {
-                attribute.m_value = m_token_stream.consume();
+                attribute.m_value = stream.consume();
 
                 // remove "
                 if (attribute.m_value[0] == '\"' && attribute.m_value.back() == '\"')
@@ -966,21 +1155,21 @@ namespace hal
 
             attributes.push_back(std::move(attribute));
 
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume("*)", true);
+        stream.consume("*)", true);
     }
 
-    Result<std::monostate> VerilogParser::parse_instance(VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
+    Result<std::monostate> VerilogParser::parse_instance(TokenStream<std::string_view>& stream, VerilogModule* verilog_module, std::vector<VerilogDataEntry>& attributes)
     {
         auto instance    = std::make_unique<VerilogInstance>();
-        u32 line_number  = m_token_stream.peek().number;
-        instance->m_type = m_token_stream.consume().string;
+        u32 line_number  = stream.peek().number;
+        instance->m_type = stream.consume().string;
 
         // parse generics map
-        if (m_token_stream.consume("#("))
+        if (stream.consume("#("))
         {
-            if (auto res = parse_parameter_assign(); res.is_error())
+            if (auto res = parse_parameter_assign(stream); res.is_error())
             {
                 return ERR_APPEND(res.get_error(), "could not parse instance of type '" + instance->m_type + "': unable to parse parameter assignment (line " + std::to_string(line_number) + ")");
             }
@@ -991,10 +1180,10 @@ namespace hal
         }
 
         // parse instance name
-        instance->m_name = m_token_stream.consume().string;
+        instance->m_name = stream.consume().string;
 
         // parse port map
-        if (auto res = parse_port_assign(instance.get()); res.is_error())
+        if (auto res = parse_port_assign(stream, instance.get()); res.is_error())
         {
             return ERR_APPEND(res.get_error(),
                               "could not parse instance '" + instance->m_name + "' of type '" + instance->m_type + "': unable to parse port assignment (line " + std::to_string(line_number) + ")");
@@ -1010,20 +1199,20 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VerilogParser::parse_port_assign(VerilogInstance* instance)
+    Result<std::monostate> VerilogParser::parse_port_assign(TokenStream<std::string_view>& stream, VerilogInstance* instance)
     {
-        u32 line_number = m_token_stream.peek().number;
-        m_token_stream.consume("(", true);
-        u32 line_end = m_token_stream.find_next(";");
-        if (m_token_stream.peek() == ".")
+        u32 line_number = stream.peek().number;
+        stream.consume("(", true);
+        u32 line_end = stream.find_next(";");
+        if (stream.peek() == ".")
         {
             do
             {
-                m_token_stream.consume(".");
+                stream.consume(".");
                 VerilogPortAssignment port_assignment;
-                port_assignment.m_port_name = m_token_stream.consume().string;
-                m_token_stream.consume("(", true);
-                if (auto res = parse_assignment_expression(m_token_stream.extract_until(")")); res.is_error())
+                port_assignment.m_port_name = stream.consume().string;
+                stream.consume("(", true);
+                if (auto res = parse_assignment_expression(stream.extract_until(")")); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse port assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
                 }
@@ -1031,20 +1220,20 @@ namespace hal
                 {
                     port_assignment.m_assignment = res.get();
                 }
-                m_token_stream.consume(")", true);
+                stream.consume(")", true);
                 if (port_assignment.m_assignment.empty())
                 {
                     continue;
                 }
                 instance->m_port_assignments.push_back(std::move(port_assignment));
-            } while (m_token_stream.consume(",", false));
+            } while (stream.consume(",", false));
         }
         else
         {
             do
             {
                 VerilogPortAssignment port_assignment;
-                if (auto res = parse_assignment_expression(m_token_stream.extract_until(",", line_end - 1)); res.is_error())
+                if (auto res = parse_assignment_expression(stream.extract_until(",", line_end - 1)); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse port assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
                 }
@@ -1057,29 +1246,29 @@ namespace hal
                     continue;
                 }
                 instance->m_port_assignments.push_back(std::move(port_assignment));
-            } while (m_token_stream.consume(",", false));
+            } while (stream.consume(",", false));
         }
 
-        m_token_stream.consume(")", true);
-        m_token_stream.consume(";", true);
+        stream.consume(")", true);
+        stream.consume(";", true);
 
         return OK({});
     }
 
-    Result<std::vector<VerilogParser::VerilogDataEntry>> VerilogParser::parse_parameter_assign()
+    Result<std::vector<VerilogParser::VerilogDataEntry>> VerilogParser::parse_parameter_assign(TokenStream<std::string_view>& stream)
     {
         std::vector<VerilogDataEntry> generics;
 
         do
         {
-            if (m_token_stream.consume(".", false))
+            if (stream.consume(".", false))
             {
-                const Token<std::string> lhs = m_token_stream.join_until("(", "");
-                m_token_stream.consume("(", true);
-                const Token<std::string> rhs = m_token_stream.join_until(")", "");
-                m_token_stream.consume(")", true);
+                const Token<std::string> lhs = stream.join_until("(", "");
+                stream.consume("(", true);
+                const Token<std::string> rhs = stream.join_until(")", "");
+                stream.consume(")", true);
 
-                if (const auto res = parse_parameter_value(rhs); res.is_ok())
+                if (const auto res = parse_parameter_value(Token<std::string_view>(rhs.number, rhs.string)); res.is_ok())
                 {
                     const auto value = res.get();
                     generics.push_back(VerilogDataEntry({lhs.string, value.first, value.second}));
@@ -1089,9 +1278,9 @@ namespace hal
                     log_warning("verilog_parser", "{}", res.get_error().get());
                 }
             }
-        } while (m_token_stream.consume(",", false));
+        } while (stream.consume(",", false));
 
-        m_token_stream.consume(")", true);
+        stream.consume(")", true);
 
         return OK(generics);
     }
@@ -1119,9 +1308,7 @@ namespace hal
             // collect and count all net names in the netlist
             for (const auto& s : module->m_signals)
             {
-                std::vector<std::string> expanded_names;
-                expand_ranges_recursively(expanded_names, s->m_name, s->m_ranges, 0);
-                for (const auto& net_name : expanded_names)
+                for (const auto& net_name : s->m_expanded_names)
                 {
                     m_net_name_occurences[net_name]++;
                 }
@@ -1139,104 +1326,26 @@ namespace hal
             }
         }
 
-        for (auto& [module_name, verilog_module] : m_modules_by_name)
+        // detect unused modules
+        for (const auto& [module_name, verilog_module] : m_modules_by_name)
         {
-            // detect unused modules
-            if (m_module_instantiation_count[module_name] == 0)
+            if (const auto it = m_module_instantiation_count.find(module_name); it == m_module_instantiation_count.end())
             {
                 log_warning("verilog_parser", "module '{}' has been defined in the netlist but is not instantiated.", module_name);
-                continue;
             }
-
-            // expand gate pin assignments
-            for (const auto& instance : verilog_module->m_instances)
+            else
             {
-                if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
-                {
-                    if (!instance->m_port_assignments.empty())
-                    {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port_name.has_value())
-                        {
-                            // cache pin groups
-                            std::unordered_map<std::string, std::vector<std::string>> pin_groups;
-                            for (const auto pin_group : gate_type_it->second->get_pin_groups())
-                            {
-                                const auto pins = pin_group->get_pins();
-                                for (auto it = pins.rbegin(); it != pins.rend(); it++)
-                                {
-                                    const auto* pin = *it;
-                                    pin_groups[pin_group->get_name()].push_back(pin->get_name());
-                                }
-                            }
-
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
-
-                                    const auto& port_name = port_assignment.m_port_name.value();
-                                    if (const auto group_it = pin_groups.find(port_name); group_it != pin_groups.end())
-                                    {
-                                        left_port = group_it->second;
-                                    }
-                                    else
-                                    {
-                                        left_port.push_back(port_name);
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                        // all port assignments by order
-                        else
-                        {
-                            // cache pins
-                            std::vector<std::string> pins = gate_type_it->second->get_pin_names();
-                            auto pin_it                   = pins.begin();
-
-                            for (const auto& port_assignment : instance->m_port_assignments)
-                            {
-                                std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
-                                if (!right_port.empty())
-                                {
-                                    std::vector<std::string> left_port;
-
-                                    for (u32 i = 0; i < right_port.size() && pin_it != pins.end(); i++)
-                                    {
-                                        left_port.push_back(*pin_it++);
-                                    }
-
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+                m_remaining_instantiations[verilog_module] = it->second;
             }
         }
 
         // for the top module, generate global i/o signals for all ports
-        std::unordered_map<std::string, std::string> top_assignments;
+        std::unordered_map<std::string_view, Net*> top_assignments;
         for (const auto& port : top_module->m_ports)
         {
             for (const auto& expanded_port_identifier : port->m_expanded_identifiers)
             {
                 const auto signal_name = get_unique_alias("", expanded_port_identifier + "__GLOBAL_IO__", m_net_name_occurences);
-                m_net_name_occurences[signal_name]++;
 
                 Net* global_port_net = m_netlist->create_net(signal_name);
                 if (global_port_net == nullptr)
@@ -1244,10 +1353,10 @@ namespace hal
                     return ERR("could not construct netlist: failed to create global I/O net '" + signal_name + "'");
                 }
 
-                m_net_by_name[signal_name] = global_port_net;
+                m_net_name_occurences[global_port_net->get_name()]++;
 
                 // assign global port nets to ports of top module
-                top_assignments[expanded_port_identifier] = signal_name;
+                top_assignments[expanded_port_identifier] = global_port_net;
 
                 if (port->m_direction == PinDirection::input || port->m_direction == PinDirection::inout)
                 {
@@ -1267,23 +1376,27 @@ namespace hal
             }
         }
 
-        if (auto res = instantiate_module("top_module", top_module, nullptr, top_assignments); res.is_error())
+        if (auto res = instantiate_module("top_module", top_module, nullptr, "", top_assignments); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not construct netlist: unable to instantiate top module");
         }
 
-        // merge nets without gates in between them
-        std::unordered_map<std::string, std::string> merged_nets;
-        std::unordered_map<std::string, std::vector<std::string>> master_to_slaves;
+        // the name occurences refer to the names of nets that may be deleted while merging
+        std::unordered_map<std::string_view, u32>().swap(m_instance_name_occurences);
+        std::unordered_map<std::string_view, u32>().swap(m_net_name_occurences);
+
+        // merge nets without gates in between them, deleted slave nets are only used as keys and never dereferenced
+        std::unordered_map<Net*, Net*> merged_nets;
+        std::unordered_map<Net*, std::vector<std::pair<Net*, std::string>>> master_to_slaves;
 
-        for (auto& [master, slave] : m_nets_to_merge)
+        for (auto [master_net, slave_net] : m_nets_to_merge)
         {
             // check if master net has already been merged into other net
             while (true)
             {
-                if (const auto master_it = merged_nets.find(master); master_it != merged_nets.end())
+                if (const auto master_it = merged_nets.find(master_net); master_it != merged_nets.end())
                 {
-                    master = master_it->second;
+                    master_net = master_it->second;
                 }
                 else
                 {
@@ -1294,9 +1407,9 @@ namespace hal
             // check if slave net has already been merged into other net
             while (true)
             {
-                if (const auto slave_it = merged_nets.find(slave); slave_it != merged_nets.end())
+                if (const auto slave_it = merged_nets.find(slave_net); slave_it != merged_nets.end())
                 {
-                    slave = slave_it->second;
+                    slave_net = slave_it->second;
                 }
                 else
                 {
@@ -1304,22 +1417,13 @@ namespace hal
                 }
             }
 
-            auto master_net = m_net_by_name.at(master);
-            auto slave_net  = m_net_by_name.at(slave);
-
             if (master_net == slave_net)
             {
                 continue;
             }
             else if (slave_net == m_zero_net || slave_net == m_one_net)
             {
-                auto* tmp_net = master_net;
-                master_net    = slave_net;
-                slave_net     = tmp_net;
-
-                auto tmp_name = master;
-                master        = slave;
-                slave         = tmp_name;
+                std::swap(master_net, slave_net);
             }
 
             // merge sources
@@ -1397,34 +1501,34 @@ namespace hal
                 m_module_port_by_net.erase(it);
             }
 
+            master_to_slaves[master_net].push_back(std::make_pair(slave_net, slave_net->get_name()));
+            merged_nets[slave_net] = master_net;
             m_netlist->delete_net(slave_net);
-            m_net_by_name.erase(slave);
-            merged_nets[slave] = master;
-            master_to_slaves[master].push_back(slave);
         }
+        std::vector<std::pair<Net*, Net*>>().swap(m_nets_to_merge);
 
         // annotate all surviving master nets with the net names that where merged into them
         for (auto& master_net : m_netlist->get_nets())
         {
-            const auto master_name = master_net->get_name();
-
-            if (const auto m2s_it = master_to_slaves.find(master_name); m2s_it != master_to_slaves.end())
+            if (const auto m2s_it = master_to_slaves.find(master_net); m2s_it != master_to_slaves.end())
             {
                 std::vector<std::vector<std::string>> merged_slaves;
                 auto current_slaves = m2s_it->second;
 
                 while (!current_slaves.empty())
                 {
-                    std::vector<std::string> next_slaves;
-                    for (const auto& s : current_slaves)
+                    std::vector<std::pair<Net*, std::string>> next_slaves;
+                    std::vector<std::string> current_names;
+                    for (const auto& [s, name] : current_slaves)
                     {
                         if (const auto m2s_inner_it = master_to_slaves.find(s); m2s_inner_it != master_to_slaves.end())
                         {
                             next_slaves.insert(next_slaves.end(), m2s_inner_it->second.begin(), m2s_inner_it->second.end());
                         }
+                        current_names.push_back(name);
                     }
 
-                    merged_slaves.push_back(current_slaves);
+                    merged_slaves.push_back(current_names);
                     current_slaves = next_slaves;
                     next_slaves.clear();
                 }
@@ -1522,10 +1626,10 @@ namespace hal
                     continue;
                 }
 
-                if (auto res = module->create_pin(port_name, port_net); res.is_error())
+                if (auto res = module->create_pin(std::string(port_name), port_net); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(),
-                                      "could not construct netlist: failed to create pin '" + port_name + "' at net '" + port_net->get_name() + "' with ID " + std::to_string(port_net->get_id())
+                                      "could not construct netlist: failed to create pin '" + std::string(port_name) + "' at net '" + port_net->get_name() + "' with ID " + std::to_string(port_net->get_id())
                                           + " within module '" + module->get_name() + "' with ID " + std::to_string(module->get_id()));
                 }
             }
@@ -1535,29 +1639,139 @@ namespace hal
         return OK({});
     }
 
+    void VerilogParser::expand_gate_pin_assignments(VerilogModule* verilog_module) const
+    {
+        for (const auto& instance : verilog_module->m_instances)
+        {
+            if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
+            {
+                if (!instance->m_port_assignments.empty())
+                {
+                    // all port assignments by name
+                    if (instance->m_port_assignments.front().m_port_name.has_value())
+                    {
+                        // cache pin groups
+                        std::unordered_map<std::string, std::vector<std::string>> pin_groups;
+                        for (const auto pin_group : gate_type_it->second->get_pin_groups())
+                        {
+                            const auto pins = pin_group->get_pins();
+                            for (auto it = pins.rbegin(); it != pins.rend(); it++)
+                            {
+                                const auto* pin = *it;
+                                pin_groups[pin_group->get_name()].push_back(pin->get_name());
+                            }
+                        }
+
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
+                            {
+                                std::vector<std::string> left_port;
+
+                                const auto& port_name = port_assignment.m_port_name.value();
+                                if (const auto group_it = pin_groups.find(port_name); group_it != pin_groups.end())
+                                {
+                                    left_port = group_it->second;
+                                }
+                                else
+                                {
+                                    left_port.push_back(port_name);
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
+                                }
+                            }
+                        }
+                    }
+                    // all port assignments by order
+                    else
+                    {
+                        // cache pins
+                        std::vector<std::string> pins = gate_type_it->second->get_pin_names();
+                        auto pin_it                   = pins.begin();
+
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            std::vector<std::string> right_port = expand_assignment_expression(verilog_module, port_assignment.m_assignment);
+                            if (!right_port.empty())
+                            {
+                                std::vector<std::string> left_port;
+
+                                for (u32 i = 0; i < right_port.size() && pin_it != pins.end(); i++)
+                                {
+                                    left_port.push_back(*pin_it++);
+                                }
+
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void VerilogParser::release_gate_pin_assignments(VerilogModule* verilog_module) const
+    {
+        for (const auto& instance : verilog_module->m_instances)
+        {
+            if (!instance->m_is_module)
+            {
+                std::vector<std::pair<std::string, std::string>>().swap(instance->m_expanded_port_assignments);
+            }
+        }
+    }
+
+    void VerilogParser::release_instantiation_data()
+    {
+        m_module_instantiation_count.clear();
+        m_remaining_instantiations.clear();
+        m_instance_name_occurences.clear();
+        m_net_name_occurences.clear();
+        m_nets_to_merge.clear();
+        m_module_ports.clear();
+        m_module_port_by_net.clear();
+    }
+
     Result<Module*> VerilogParser::instantiate_module(const std::string& instance_identifier,
                                                       VerilogModule* verilog_module,
                                                       Module* parent,
-                                                      const std::unordered_map<std::string, std::string>& parent_module_assignments)
+                                                      const std::string& parent_prefix,
+                                                      const std::unordered_map<std::string_view, Net*>& parent_module_assignments)
     {
-        std::unordered_map<std::string, std::string> signal_alias;
-        std::unordered_map<std::string, std::string> instance_alias;
+        // nets of the module, keyed by their (expanded) names within the Verilog module
+        std::unordered_map<std::string_view, Net*> signal_alias;
 
         // TODO check parent module assignments for port aliases
 
-        const std::string parent_name       = (parent == nullptr) ? "" : parent->get_name();
-        instance_alias[instance_identifier] = get_unique_alias(parent_name, instance_identifier, m_instance_name_occurences);
+        // expand the gate pin assignments on the first instantiation of the module, they are released again after the last one
+        if (m_remaining_instantiations.at(verilog_module) == m_module_instantiation_count.at(verilog_module->m_name))
+        {
+            expand_gate_pin_assignments(verilog_module);
+        }
+
+        const std::string instance_alias = get_unique_alias(parent_prefix, instance_identifier, m_instance_name_occurences);
 
         // create netlist module
         Module* module;
         if (parent == nullptr)
         {
             module = m_netlist->get_top_module();
-            module->set_name(instance_alias.at(instance_identifier));
+            module->set_name(instance_alias);
         }
         else
         {
-            module = m_netlist->create_module(instance_alias.at(instance_identifier), parent);
+            module = m_netlist->create_module(instance_alias, parent);
         }
 
         std::string instance_type = verilog_module->m_name;
@@ -1567,6 +1781,9 @@ namespace hal
         }
         module->set_type(instance_type);
 
+        // all names within the module share the same hierarchical prefix
+        const std::string prefix = instance_alias.empty() ? "" : instance_alias + instance_name_seperator;
+
         // assign entity-level attributes
         for (const VerilogDataEntry& attribute : verilog_module->m_attributes)
         {
@@ -1589,8 +1806,8 @@ namespace hal
             {
                 if (const auto it = parent_module_assignments.find(expanded_port_identifier); it != parent_module_assignments.end())
                 {
-                    Net* port_net = m_net_by_name.at(it->second);
-                    m_module_ports[module].push_back(std::make_tuple(expanded_port_identifier, port_net));
+                    Net* port_net = it->second;
+                    m_module_ports[module].push_back(std::make_tuple(std::string_view(expanded_port_identifier), port_net));
                     m_module_port_by_net[port_net].push_back(std::make_pair(module, m_module_ports[module].size() - 1));
                 }
             }
@@ -1601,21 +1818,20 @@ namespace hal
         {
             for (const auto& expanded_name : signal->m_expanded_names)
             {
-                std::string unique_net_name = get_unique_alias(module->get_name(), expanded_name, m_net_name_occurences);
-                if (unique_net_name != expanded_name)
-                {
-                    m_net_name_occurences[unique_net_name]++;
-                }
-                signal_alias[expanded_name] = unique_net_name;
+                const std::string unique_net_name = get_unique_alias(prefix, expanded_name, m_net_name_occurences);
 
                 // create new net for the signal
-                Net* signal_net = m_netlist->create_net(signal_alias.at(expanded_name));
+                Net* signal_net = m_netlist->create_net(unique_net_name);
                 if (signal_net == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create net '" + expanded_name + "'");
                 }
 
-                m_net_by_name[signal_alias.at(expanded_name)] = signal_net;
+                if (unique_net_name != expanded_name)
+                {
+                    m_net_name_occurences[signal_net->get_name()]++;
+                }
+                signal_alias[expanded_name] = signal_net;
 
                 // assign signal attributes
                 for (const VerilogDataEntry& attribute : signal->m_attributes)
@@ -1635,14 +1851,14 @@ namespace hal
         }
 
         // schedule assigned nets for merging
-        for (const auto& [left_expanded_signal, right_expanded_signal] : verilog_module->m_expanded_assignments)
+        for (const auto& [a, b] : verilog_module->m_expanded_assignments)
         {
-            std::string a = left_expanded_signal;
-            std::string b = right_expanded_signal;
+            Net* a_net;
+            Net* b_net;
 
             if (const auto alias_it = signal_alias.find(a); alias_it != signal_alias.end())
             {
-                a = alias_it->second;
+                a_net = alias_it->second;
             }
             else
             {
@@ -1651,24 +1867,32 @@ namespace hal
 
             if (const auto alias_it = signal_alias.find(b); alias_it != signal_alias.end())
             {
-                b = alias_it->second;
+                b_net = alias_it->second;
             }
             else if (b == "'Z'" || b == "'X'")
             {
                 continue;
             }
-            else if (b != "'0'" && b != "'1'")
+            else if (b == "'0'")
+            {
+                b_net = m_zero_net;
+            }
+            else if (b == "'1'")
+            {
+                b_net = m_one_net;
+            }
+            else
             {
                 return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '" + b + "'");
             }
 
-            m_nets_to_merge.push_back(std::make_pair(a, b));
+            m_nets_to_merge.push_back(std::make_pair(a_net, b_net));
         }
 
         // schedule assigned port nets for merging
-        for (const auto& [port_identifier, net_name] : parent_module_assignments)
+        for (const auto& [port_identifier, port_net] : parent_module_assignments)
         {
-            std::string signal_name;
+            std::string_view signal_name;
             if (const auto expr_it = verilog_module->m_expanded_port_identifiers_to_expressions.find(port_identifier); expr_it == verilog_module->m_expanded_port_identifiers_to_expressions.end())
             {
                 signal_name = port_identifier;
@@ -1681,12 +1905,12 @@ namespace hal
             // TODO handle identifier != expression
             if (const auto alias_it = signal_alias.find(signal_name); alias_it != signal_alias.end())
             {
-                const bool swap = net_name.find("__GLOBAL_IO__") == std::string::npos;
-                m_nets_to_merge.push_back(swap ? std::make_pair(net_name, alias_it->second) : std::make_pair(alias_it->second, net_name));
+                const bool swap = port_net->get_name().find("__GLOBAL_IO__") == std::string::npos;
+                m_nets_to_merge.push_back(swap ? std::make_pair(port_net, alias_it->second) : std::make_pair(alias_it->second, port_net));
             }
             else
             {
-                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '" + signal_name + "'");
+                return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to find alias for net '" + std::string(signal_name) + "'");
             }
         }
 
@@ -1696,8 +1920,8 @@ namespace hal
             // will later hold either module or gate, so attributes can be assigned properly
             DataContainer* container = nullptr;
 
-            // assign actual signal names to ports
-            std::unordered_map<std::string, std::string> instance_assignments;
+            // assign actual nets to ports
+            std::unordered_map<std::string_view, Net*> instance_assignments;
 
             // if the instance is another entity, recursively instantiate it
             if (auto module_it = m_modules_by_name.find(instance->m_type); module_it != m_modules_by_name.end())
@@ -1709,9 +1933,13 @@ namespace hal
                     {
                         instance_assignments[port] = alias_it->second;
                     }
-                    else if (assignment == "'0'" || assignment == "'1'")
+                    else if (assignment == "'0'")
                     {
-                        instance_assignments[port] = assignment;
+                        instance_assignments[port] = m_zero_net;
+                    }
+                    else if (assignment == "'1'")
+                    {
+                        instance_assignments[port] = m_one_net;
                     }
                     else if (assignment == "'Z'" || assignment == "'X'" || assignment.empty())
                     {
@@ -1723,7 +1951,7 @@ namespace hal
                     }
                 }
 
-                if (auto res = instantiate_module(instance->m_name, module_it->second, module, instance_assignments); res.is_error())
+                if (auto res = instantiate_module(instance->m_name, module_it->second, module, prefix, instance_assignments); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(),
                                       "could not create instance '" + instance_identifier + "' of type '" + instance_type + "': unable to create instance '" + instance->m_name + "' of type '"
@@ -1738,8 +1966,7 @@ namespace hal
             else if (const auto gate_type_it = m_gate_types.find(instance->m_type); gate_type_it != m_gate_types.end())
             {
                 // create the new gate
-                instance_alias[instance->m_name] = get_unique_alias(module->get_name(), instance->m_name, m_instance_name_occurences);
-                Gate* new_gate                   = m_netlist->create_gate(gate_type_it->second, instance_alias.at(instance->m_name));
+                Gate* new_gate = m_netlist->create_gate(gate_type_it->second, get_unique_alias(prefix, instance->m_name, m_instance_name_occurences));
                 if (new_gate == nullptr)
                 {
                     return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to create gate '" + instance->m_name + "'");
@@ -1774,15 +2001,20 @@ namespace hal
                 // expand pin assignments
                 for (const auto& [pin, assignment] : instance->m_expanded_port_assignments)
                 {
-                    std::string signal;
+                    // get the respective net for the assignment
+                    Net* current_net;
 
                     if (const auto alias_it = signal_alias.find(assignment); alias_it != signal_alias.end())
                     {
-                        signal = alias_it->second;
+                        current_net = alias_it->second;
                     }
-                    else if (assignment == "'0'" || assignment == "'1'")
+                    else if (assignment == "'0'")
                     {
-                        signal = assignment;
+                        current_net = m_zero_net;
+                    }
+                    else if (assignment == "'1'")
+                    {
+                        current_net = m_one_net;
                     }
                     else if (assignment == "'Z'" || assignment == "'X'")
                     {
@@ -1794,51 +2026,40 @@ namespace hal
                                    + instance->m_name + "' of type '" + instance->m_type + "' as the assignment is invalid");
                     }
 
-                    // get the respective net for the assignment
-                    if (const auto net_it = m_net_by_name.find(signal); net_it == m_net_by_name.end())
-                    {
-                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign signal'" + signal + "' to pin '" + pin
-                                   + "' as the signal has not been declared");
-                    }
-                    else
-                    {
-                        Net* current_net = net_it->second;
-
-                        // add net src/dst by pin types
-                        bool is_input  = false;
-                        bool is_output = false;
+                    // add net src/dst by pin types
+                    bool is_input  = false;
+                    bool is_output = false;
 
-                        if (const auto it = pin_names_map.find(pin); it != pin_names_map.end())
+                    if (const auto it = pin_names_map.find(pin); it != pin_names_map.end())
+                    {
+                        PinDirection direction = it->second->get_direction();
+                        if (direction == PinDirection::input || direction == PinDirection::inout)
                         {
-                            PinDirection direction = it->second->get_direction();
-                            if (direction == PinDirection::input || direction == PinDirection::inout)
-                            {
-                                is_input = true;
-                            }
-
-                            if (direction == PinDirection::output || direction == PinDirection::inout)
-                            {
-                                is_output = true;
-                            }
+                            is_input = true;
                         }
 
-                        if (!is_input && !is_output)
+                        if (direction == PinDirection::output || direction == PinDirection::inout)
                         {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign net '" + signal + "' to pin '" + pin
-                                       + "' as it is not a pin of gate '" + new_gate->get_name() + "' of type '" + new_gate->get_type()->get_name() + "'");
+                            is_output = true;
                         }
+                    }
 
-                        if (is_output && !current_net->add_source(new_gate, pin))
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a source to gate '"
-                                       + new_gate->get_name() + "' via pin '" + pin + "'");
-                        }
+                    if (!is_input && !is_output)
+                    {
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to assign net '" + current_net->get_name() + "' to pin '" + pin
+                                   + "' as it is not a pin of gate '" + new_gate->get_name() + "' of type '" + new_gate->get_type()->get_name() + "'");
+                    }
 
-                        if (is_input && !current_net->add_destination(new_gate, pin))
-                        {
-                            return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + signal + "' as a destination to gate '"
-                                       + new_gate->get_name() + "' via pin '" + pin + "'");
-                        }
+                    if (is_output && !current_net->add_source(new_gate, pin))
+                    {
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + current_net->get_name() + "' as a source to gate '"
+                                   + new_gate->get_name() + "' via pin '" + pin + "'");
+                    }
+
+                    if (is_input && !current_net->add_destination(new_gate, pin))
+                    {
+                        return ERR("could not create instance '" + instance_identifier + "' of type '" + instance_type + "': failed to add net '" + current_net->get_name() + "' as a destination to gate '"
+                                   + new_gate->get_name() + "' via pin '" + pin + "'");
                     }
                 }
             }
@@ -1883,6 +2104,11 @@ namespace hal
             }
         }
 
+        if (--m_remaining_instantiations.at(verilog_module) == 0)
+        {
+            release_gate_pin_assignments(verilog_module);
+        }
+
         return OK(module);
     }
 
@@ -1930,46 +2156,49 @@ namespace hal
     }    // namespace
 
     // generate a unique name for a gate/module instance
-    std::string VerilogParser::get_unique_alias(const std::string& parent_name, const std::string& name, const std::unordered_map<std::string, u32>& name_occurences) const
+    std::string VerilogParser::get_unique_alias(const std::string& parent_prefix, const std::string& name, const std::unordered_map<std::string_view, u32>& name_occurences) const
     {
-        std::string unique_alias = name;
-
-        if (!parent_name.empty())
+        // if there is no other instance with that name, we omit the name prefix
+        if (parent_prefix.empty())
         {
-            // if there is no other instance with that name, we omit the name prefix
-
-            auto instance_name_it = name_occurences.find(name);
+            return name;
+        }
 
-            int cnt = 0;
+        auto instance_name_it = name_occurences.find(name);
+        if (instance_name_it == name_occurences.end() || instance_name_it->second <= 1)
+        {
+            return name;
+        }
 
-            // it is OK if base name (first loop cnt=0) is already in name_occurences once
-            // unique_alias (cnt > 0) must not be in name_occurences
-            while (instance_name_it != name_occurences.end() && (cnt || instance_name_it->second > 1))
+        // it is OK if base name (first loop cnt=0) is already in name_occurences once
+        // unique_alias (cnt > 0) must not be in name_occurences
+        std::string unique_alias = name;
+        int cnt                  = 0;
+        while (instance_name_it != name_occurences.end() && (cnt || instance_name_it->second > 1))
+        {
+            std::string extension;
+            if (cnt++)
             {
-                std::string extension;
-                if (cnt++)
-                {
-                    extension = "_u" + std::to_string(cnt);
-                }
-                unique_alias     = parent_name + instance_name_seperator + unique_alias + extension;
-                instance_name_it = name_occurences.find(unique_alias);
+                extension = "_u" + std::to_string(cnt);
             }
+            unique_alias     = parent_prefix + unique_alias + extension;
+            instance_name_it = name_occurences.find(unique_alias);
         }
 
         return unique_alias;
     }
 
-    std::vector<u32> VerilogParser::parse_range(TokenStream<std::string>& stream) const
+    std::vector<u32> VerilogParser::parse_range(TokenStream<std::string_view>& stream) const
     {
         if (stream.remaining() == 1)
         {
-            return {(u32)std::stoi(stream.consume().string)};
+            return {(u32)std::stoi(std::string(stream.consume().string))};
         }
 
         // MSB to LSB
-        const int end = std::stoi(stream.consume().string);
+        const int end = std::stoi(std::string(stream.consume().string));
         stream.consume(":", true);
-        const int start = std::stoi(stream.consume().string);
+        const int start = std::stoi(std::string(stream.consume().string));
 
         const int direction = (start <= end) ? 1 : -1;
 
@@ -2137,10 +2366,10 @@ namespace hal
         return OK(result);
     }
 
-    Result<std::string> VerilogParser::get_hex_from_literal(const Token<std::string>& value_token) const
+    Result<std::string> VerilogParser::get_hex_from_literal(const Token<std::string_view>& value_token) const
     {
         const u32 line_number   = value_token.number;
-        const std::string value = utils::to_upper(utils::replace(value_token.string, std::string("_"), std::string("")));
+        const std::string value = utils::to_upper(utils::replace(std::string(value_token.string), std::string("_"), std::string("")));
 
         i32 len = -1;
         std::string prefix;
@@ -2232,31 +2461,32 @@ namespace hal
         return OK(ss.str());
     }
 
-    Result<std::pair<std::string, std::string>> VerilogParser::parse_parameter_value(const Token<std::string>& value_token) const
+    Result<std::pair<std::string, std::string>> VerilogParser::parse_parameter_value(const Token<std::string_view>& value_token) const
     {
         std::pair<std::string, std::string> value;
+        const std::string token_string(value_token.string);
 
-        if (utils::is_integer(value_token.string))
+        if (utils::is_integer(token_string))
         {
             value.first  = "integer";
-            value.second = value_token.string;
+            value.second = token_string;
         }
-        else if (utils::is_floating_point(value_token.string))
+        else if (utils::is_floating_point(token_string))
         {
             value.first  = "floating_point";
-            value.second = value_token.string;
+            value.second = token_string;
         }
-        else if (value_token.string[0] == '\"' && value_token.string.back() == '\"')
+        else if (token_string[0] == '\"' && token_string.back() == '\"')
         {
             value.first  = "string";
-            value.second = value_token.string.substr(1, value_token.string.size() - 2);
+            value.second = token_string.substr(1, token_string.size() - 2);
         }
-        else if (isdigit(value_token.string[0]) || value_token.string[0] == '\'')
+        else if (isdigit(token_string[0]) || token_string[0] == '\'')
         {
             if (const auto res = get_hex_from_literal(value_token); res.is_error())
             {
                 return ERR_APPEND(res.get_error(),
-                                  "could not parse parameter value: failed to convert '" + value_token.string + "' to hexadecimal value (line " + std::to_string(value_token.number) + ")");
+                                  "could not parse parameter value: failed to convert '" + token_string + "' to hexadecimal value (line " + std::to_string(value_token.number) + ")");
             }
             else
             {
@@ -2274,15 +2504,15 @@ namespace hal
         }
         else
         {
-            return ERR("could not parse parameter value: failed to identify data type of parameter '" + value_token.string + "' (line " + std::to_string(value_token.number) + ")");
+            return ERR("could not parse parameter value: failed to identify data type of parameter '" + token_string + "' (line " + std::to_string(value_token.number) + ")");
         }
 
         return OK(value);
     }
 
-    Result<std::vector<VerilogParser::assignment_t>> VerilogParser::parse_assignment_expression(TokenStream<std::string>&& stream) const
+    Result<std::vector<VerilogParser::assignment_t>> VerilogParser::parse_assignment_expression(TokenStream<std::string_view>&& stream) const
     {
-        std::vector<TokenStream<std::string>> parts;
+        std::vector<TokenStream<std::string_view>> parts;
 
         if (stream.size() == 0)
         {
@@ -2293,7 +2523,7 @@ namespace hal
         {
             stream.consume("{", true);
 
-            TokenStream<std::string> assignment_list_str = stream.extract_until("}");
+            TokenStream<std::string_view> assignment_list_str = stream.extract_until("}");
             stream.consume("}", true);
 
             do
@@ -2311,15 +2541,15 @@ namespace hal
 
         for (auto it = parts.rbegin(); it != parts.rend(); it++)
         {
-            TokenStream<std::string>& part_stream = *it;
+            TokenStream<std::string_view>& part_stream = *it;
 
-            const Token<std::string> signal_name_token = part_stream.consume();
-            std::string signal_name                    = signal_name_token.string;
+            const Token<std::string_view> signal_name_token = part_stream.consume();
+            std::string signal_name(signal_name_token.string);
 
             // (3) NUMBER
             if (isdigit(signal_name[0]) || signal_name[0] == '\'')
             {
-                if (auto res = get_binary_vector(signal_name_token); res.is_error())
+                if (auto res = get_binary_vector(signal_name); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(), "could not parse assignment expression: unable to convert token to binary vector");
                 }
@@ -2339,7 +2569,7 @@ namespace hal
                     std::vector<std::vector<u32>> ranges;
                     do
                     {
-                        TokenStream<std::string> range_str = part_stream.extract_until("]");
+                        TokenStream<std::string_view> range_str = part_stream.extract_until("]");
                         ranges.emplace_back(parse_range(range_str));
                         part_stream.consume("]", true);
                     } while (part_stream.consume("[", false));
@@ -4,7 +4,10 @@
 #include "gate_library_test_utils.h"
 
 #include <bitset>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 namespace hal {
 
@@ -3368,4 +3371,245 @@ namespace hal {
             }
         TEST_END
     }
+
+    /**
+     * Testing that parsing the modules of a netlist in parallel yields the same netlist regardless of the number of threads.
+     *
+     * Functions: parse, set_num_threads
+     */
+    TEST_F(VerilogParserTest, check_parallel_parsing) 
+    {
+        TEST_START
+        {
+            // a top module instantiating many child modules, each consisting of a chain of gates
+            const auto create_netlist_input = [](const u32 num_modules, const u32 num_gates) {
+                std::stringstream netlist_input;
+                for (u32 m = 0; m < num_modules; m++)
+                {
+                    netlist_input << "(* child_attribute = \"child_" << m << "\" *)\n"
+                                  << "module MODULE_CHILD_" << m << " (child_in, child_out);\n"
+                                  << "  input [1:0] child_in;\n"
+                                  << "  output child_out;\n"
+                                  << "  wire [" << num_gates << ":0] chain;\n"
+                                  << "  assign chain[0] = child_in[0];\n";
+                    for (u32 g = 0; g < num_gates; g++)
+                    {
+                        netlist_input << "  AND2 gate_" << g << " (.I0(chain[" << g << "]), .I1(child_in[1]), .O(chain[" << g + 1 << "]));\n";
+                    }
+                    netlist_input << "  BUF gate_out (.I(chain[" << num_gates << "]), .O(child_out));\n"
+                                  << "endmodule\n";
+                }
+                netlist_input << "module MODULE_TOP (net_global_in, net_global_out);\n"
+                              << "  input [1:0] net_global_in;\n"
+                              << "  output [" << num_modules - 1 << ":0] net_global_out;\n";
+                for (u32 m = 0; m < num_modules; m++)
+                {
+                    netlist_input << "  MODULE_CHILD_" << m << " child_" << m << " (.child_in(net_global_in), .child_out(net_global_out[" << m << "]));\n";
+                }
+                netlist_input << "endmodule\n";
+                return netlist_input.str();
+            };
+
+            // gate and net names repeat across modules, hence objects are compared by ID
+            const auto dump_netlist = [](const Netlist* nl) {
+                std::stringstream dump;
+                for (const Gate* gate : nl->get_gates())
+                {
+                    dump << "gate " << gate->get_id() << " " << gate->get_name() << " " << gate->get_type()->get_name() << " " << gate->get_module()->get_id() << "\n";
+                }
+                for (const Net* net : nl->get_nets())
+                {
+                    dump << "net " << net->get_id() << " " << net->get_name();
+                    for (const Endpoint* ep : net->get_sources())
+                    {
+                        dump << " " << ep->get_gate()->get_id() << ":" << ep->get_pin()->get_name();
+                    }
+                    dump << " ->";
+                    for (const Endpoint* ep : net->get_destinations())
+                    {
+                        dump << " " << ep->get_gate()->get_id() << ":" << ep->get_pin()->get_name();
+                    }
+                    dump << "\n";
+                }
+                for (const Module* mod : nl->get_modules())
+                {
+                    dump << "module " << mod->get_id() << " " << mod->get_name() << " " << mod->get_type() << " " << (mod->is_top_module() ? 0 : mod->get_parent_module()->get_id()) << "\n";
+                }
+                return dump.str();
+            };
+
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+
+            {
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", create_netlist_input(24, 16));
+
+                VerilogParser reference_parser;
+                reference_parser.set_num_threads(1);
+                auto reference_res = reference_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(reference_res.is_ok());
+                std::unique_ptr<Netlist> reference_nl = reference_res.get();
+                ASSERT_NE(reference_nl, nullptr);
+                EXPECT_EQ(reference_nl->get_gates().size(), 24 * 17);
+                EXPECT_EQ(reference_nl->get_modules().size(), 25);
+                const std::string reference_dump = dump_netlist(reference_nl.get());
+
+                for (u32 num_threads : {2, 4, 16, 0})
+                {
+                    VerilogParser verilog_parser;
+                    verilog_parser.set_num_threads(num_threads);
+                    auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                    ASSERT_TRUE(nl_res.is_ok());
+                    std::unique_ptr<Netlist> nl = nl_res.get();
+                    ASSERT_NE(nl, nullptr);
+                    EXPECT_EQ(dump_netlist(nl.get()), reference_dump) << num_threads << " threads";
+                }
+            }
+            {
+                // the first error in file order is reported
+                NO_COUT_TEST_BLOCK;
+                std::string netlist_input = create_netlist_input(8, 4);
+                netlist_input += "module MODULE_CHILD_3 (a);\n  input a;\nendmodule\n";
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", netlist_input);
+
+                VerilogParser verilog_parser;
+                verilog_parser.set_num_threads(4);
+                auto nl_res = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                ASSERT_TRUE(nl_res.is_error());
+                EXPECT_NE(nl_res.get_error().get().find("MODULE_CHILD_3"), std::string::npos);
+            }
+            {
+                // scaling with the number of threads
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", create_netlist_input(256, 256));
+
+                for (u32 num_threads : {1, 4, 16})
+                {
+                    VerilogParser verilog_parser;
+                    verilog_parser.set_num_threads(num_threads);
+                    const auto begin_time = std::chrono::steady_clock::now();
+                    EXPECT_TRUE(verilog_parser.parse(verilog_file).is_ok());
+                    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin_time;
+                    std::cout << "[          ] parsing 256 modules with " << num_threads << " threads: " << duration.count() << "s" << std::endl;
+                }
+            }
+        }
+        TEST_END
+    }
+
+    TEST_F(VerilogParserTest, check_hierarchical_instantiation) 
+    {
+        TEST_START
+        {
+            // a top module instantiating middle modules, each instantiating the same leaf module
+            const auto create_netlist_input = [](const u32 num_mids, const u32 num_leaves, const u32 num_gates) {
+                std::stringstream netlist_input;
+                netlist_input << "module LEAF (leaf_in, leaf_out);\n"
+                              << "  input [1:0] leaf_in;\n"
+                              << "  output leaf_out;\n"
+                              << "  wire [" << num_gates << ":0] chain;\n"
+                              << "  assign chain[0] = leaf_in[0];\n";
+                for (u32 g = 0; g < num_gates; g++)
+                {
+                    netlist_input << "  AND2 gate_" << g << " (.I0(chain[" << g << "]), .I1(leaf_in[1]), .O(chain[" << g + 1 << "]));\n";
+                }
+                netlist_input << "  assign leaf_out = chain[" << num_gates << "];\n"
+                              << "endmodule\n"
+                              << "module MID (mid_in, mid_out);\n"
+                              << "  input [1:0] mid_in;\n"
+                              << "  output [" << num_leaves - 1 << ":0] mid_out;\n";
+                for (u32 l = 0; l < num_leaves; l++)
+                {
+                    netlist_input << "  LEAF leaf_" << l << " (.leaf_in(mid_in), .leaf_out(mid_out[" << l << "]));\n";
+                }
+                netlist_input << "endmodule\n"
+                              << "module TOP (net_global_in, net_global_out);\n"
+                              << "  input [1:0] net_global_in;\n"
+                              << "  output [" << num_mids * num_leaves - 1 << ":0] net_global_out;\n";
+                for (u32 m = 0; m < num_mids; m++)
+                {
+                    netlist_input << "  MID mid_" << m << " (.mid_in(net_global_in), .mid_out(net_global_out[" << (m + 1) * num_leaves - 1 << ":" << m * num_leaves << "]));\n";
+                }
+                netlist_input << "endmodule\n";
+                return netlist_input.str();
+            };
+
+            // peak resident set size in kB as reported by the kernel, 0 if not available; writing 5 to 'clear_refs' resets the peak
+            const auto reset_peak_rss = []() { std::ofstream("/proc/self/clear_refs") << "5"; };
+            const auto get_peak_rss = []() -> u64 {
+                std::ifstream status("/proc/self/status");
+                std::string line;
+                while (std::getline(status, line))
+                {
+                    if (line.rfind("VmHWM:", 0) == 0)
+                    {
+                        return std::stoull(line.substr(6));
+                    }
+                }
+                return 0;
+            };
+
+            const GateLibrary* gate_lib = test_utils::get_gate_library();
+
+            {
+                // repeated names are prefixed with the names of the enclosing instances, a parser can be instantiated repeatedly
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", create_netlist_input(2, 3, 4));
+
+                VerilogParser verilog_parser;
+                ASSERT_TRUE(verilog_parser.parse(verilog_file).is_ok());
+
+                std::vector<std::unique_ptr<Netlist>> netlists;
+                for (u32 i = 0; i < 2; i++)
+                {
+                    auto nl_res = verilog_parser.instantiate(gate_lib);
+                    ASSERT_TRUE(nl_res.is_ok());
+                    std::unique_ptr<Netlist> nl = nl_res.get();
+                    ASSERT_NE(nl, nullptr);
+
+                    EXPECT_EQ(nl->get_gates().size(), 2 * 3 * 4);
+                    EXPECT_EQ(nl->get_modules().size(), 1 + 2 + 2 * 3);
+                    EXPECT_EQ(nl->get_nets().size(), 2 + 2 * 3 * 4);
+
+                    const std::vector<Gate*> gates = nl->get_gates(test_utils::gate_name_filter("mid_1/leaf_2/gate_3"));
+                    ASSERT_EQ(gates.size(), 1);
+                    EXPECT_EQ(gates.front()->get_module()->get_name(), "mid_1/leaf_2");
+                    EXPECT_EQ(gates.front()->get_module()->get_parent_module()->get_name(), "mid_1");
+
+                    const std::vector<Net*> nets = nl->get_nets(test_utils::net_name_filter("mid_0/leaf_1/chain(2)"));
+                    ASSERT_EQ(nets.size(), 1);
+                    EXPECT_EQ(nets.front()->get_sources().size(), 1);
+                    EXPECT_EQ(nets.front()->get_destinations().size(), 1);
+
+                    netlists.push_back(std::move(nl));
+                }
+                for (const Gate* gate : netlists.at(0)->get_gates())
+                {
+                    const Gate* other_gate = netlists.at(1)->get_gate_by_id(gate->get_id());
+                    ASSERT_NE(other_gate, nullptr);
+                    EXPECT_EQ(gate->get_name(), other_gate->get_name());
+                    EXPECT_EQ(gate->get_module()->get_id(), other_gate->get_module()->get_id());
+                }
+                for (const Net* net : netlists.at(0)->get_nets())
+                {
+                    const Net* other_net = netlists.at(1)->get_net_by_id(net->get_id());
+                    ASSERT_NE(other_net, nullptr);
+                    EXPECT_EQ(net->get_name(), other_net->get_name());
+                    EXPECT_EQ(net->get_num_of_sources(), other_net->get_num_of_sources());
+                    EXPECT_EQ(net->get_num_of_destinations(), other_net->get_num_of_destinations());
+                }
+            }
+            {
+                // peak memory usage
+                auto verilog_file = test_utils::create_sandbox_file("netlist.v", create_netlist_input(8, 16, 16));
+
+                VerilogParser verilog_parser;
+                reset_peak_rss();
+                const auto begin_time = std::chrono::steady_clock::now();
+                auto nl_res           = verilog_parser.parse_and_instantiate(verilog_file, gate_lib);
+                const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin_time;
+                ASSERT_TRUE(nl_res.is_ok());
+                EXPECT_EQ(nl_res.get()->get_gates().size(), 8 * 16 * 16);
+                std::cout << "[          ] instantiating 2048 gates: " << duration.count() << "s, peak RSS " << get_peak_rss() << " kB" << std::endl;
+            }
+        }
+        TEST_END
+    }
 } // namespace hal
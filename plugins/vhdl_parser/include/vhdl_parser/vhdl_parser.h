@@ -67,6 +67,14 @@ namespace hal
          */
         Result<std::unique_ptr<Netlist>> instantiate(const GateLibrary* gate_library) override;
 
+        /**
+         * Set the number of threads used to parse architecture bodies and to expand the entities of the netlist in parallel.
+         * The resulting netlist does not depend on the number of threads.
+         *
+         * @param[in] num_threads - The number of threads, 0 to use all hardware threads.
+         */
+        void set_num_threads(const u32 num_threads);
+
     private:
         using ci_string           = core_strings::CaseInsensitiveString;
         using identifier_t        = ci_string;
@@ -171,8 +179,17 @@ namespace hal
 
         using attribute_buffer_t = std::map<AttributeTarget, std::map<ci_string, VhdlDataEntry>>;
 
+        struct VhdlArchitectureBody
+        {
+            VhdlEntity* m_entity;
+            u32 m_line_number;
+            TokenStream<ci_string> m_tokens;
+            attribute_buffer_t m_attribute_buffer;
+        };
+
         std::stringstream m_fs;
         std::filesystem::path m_path;
+        u32 m_num_threads = 0;
 
         // temporary netlist
         Netlist* m_netlist = nullptr;
@@ -217,15 +234,18 @@ namespace hal
         Result<std::monostate> parse_entity();
         Result<std::monostate> parse_port_definitons(VhdlEntity* vhdl_entity);
         Result<std::monostate> parse_attribute();
-        Result<std::monostate> parse_architecture();
+        Result<std::monostate> parse_architecture(std::vector<VhdlArchitectureBody>& architecture_bodies);
         Result<std::monostate> parse_architecture_header(VhdlEntity* vhdl_entity);
         Result<std::monostate> parse_signal_definition(VhdlEntity* vhdl_entity);
-        Result<std::monostate> parse_architecture_body(VhdlEntity* vhdl_entity);
-        Result<std::monostate> parse_assignment(VhdlEntity* vhdl_entity);
-        Result<std::monostate> parse_instance(VhdlEntity* vhdl_entity);
-        Result<std::monostate> parse_port_assign(VhdlInstance* instance);
-        Result<std::monostate> parse_generic_assign(VhdlInstance* instance);
-        Result<std::monostate> assign_attributes(VhdlEntity* vhdl_entity);
+        Result<std::monostate> parse_architecture_body_and_attributes(VhdlArchitectureBody& architecture_body);
+        Result<std::monostate> parse_architecture_body(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity);
+        Result<std::monostate> parse_assignment(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity);
+        Result<std::monostate> parse_instance(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity);
+        Result<std::monostate> parse_port_assign(TokenStream<ci_string>& stream, VhdlInstance* instance);
+        Result<std::monostate> parse_generic_assign(TokenStream<ci_string>& stream, VhdlInstance* instance);
+        Result<std::monostate> assign_attributes(VhdlEntity* vhdl_entity, const attribute_buffer_t& attribute_buffer);
+        Result<std::monostate> expand_entity(VhdlEntity* vhdl_entity) const;
+        Result<std::monostate> expand_entity_port_assignments(VhdlEntity* vhdl_entity) const;
 
         // construct netlist from intermediate format
         Result<std::monostate> construct_netlist(VhdlEntity* top_entity);
@@ -8,17 +8,61 @@
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
+#include <atomic>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <queue>
+#include <thread>
 
 namespace hal
 {
     namespace
     {
+        /**
+         * Run a task for every index in [0, num_tasks) on up to num_threads threads, handing out indices in ascending order.
+         * A thread count of 0 uses all hardware threads.
+         */
+        void run_in_parallel(const u32 num_tasks, u32 num_threads, const std::function<void(u32)>& task)
+        {
+            std::atomic<u32> next_task_idx = 0;
+            const auto work                = [&]() {
+                for (u32 task_idx = next_task_idx++; task_idx < num_tasks; task_idx = next_task_idx++)
+                {
+                    task(task_idx);
+                }
+            };
 
+            if (num_threads == 0)
+            {
+                num_threads = std::thread::hardware_concurrency();
+            }
+            num_threads = std::max(1u, std::min(num_threads, num_tasks));
+
+            if (num_threads == 1)
+            {
+                work();
+            }
+            else
+            {
+                std::vector<std::thread> workers;
+                for (u32 i = 0; i < num_threads; i++)
+                {
+                    workers.emplace_back(work);
+                }
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
+        }
     }    // namespace
 
+    void VHDLParser::set_num_threads(const u32 num_threads)
+    {
+        m_num_threads = num_threads;
+    }
+
     Result<std::monostate> VHDLParser::parse(const std::filesystem::path& file_path)
     {
         m_path = file_path;
@@ -65,168 +109,192 @@ namespace hal
             return ERR("could not parse VHDL file '" + m_path.string() + "': it does not contain any entities");
         }
 
-        // expand module port identifiers, signals, and assignments
-        for (auto& [entity_name, vhdl_entity] : m_entities_by_name)
+        // expand entity port identifiers, signals, and assignments
+        const u32 num_entities = m_entities.size();
+        std::vector<std::optional<Result<std::monostate>>> results(num_entities);
+        run_in_parallel(num_entities, m_num_threads, [&](const u32 entity_idx) { results[entity_idx] = expand_entity(m_entities[entity_idx].get()); });
+        for (auto& res : results)
         {
-            // expand port identifiers
-            for (const auto& port : vhdl_entity->m_ports)
+            if (res->is_error())
             {
-                if (!port->m_ranges.empty())
-                {
-                    port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
-                    vhdl_entity->m_expanded_port_identifiers.insert(port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                }
-                else
-                {
-                    port->m_expanded_identifiers = {port->m_identifier};
-                    vhdl_entity->m_expanded_port_identifiers.insert(port->m_identifier);
-                }
+                return std::move(res.value());
             }
+        }
 
-            // expand signals
-            for (auto& signal : vhdl_entity->m_signals)
+        // expand entity port assignments, which requires the expanded port identifiers of all instantiated entities
+        run_in_parallel(num_entities, m_num_threads, [&](const u32 entity_idx) { results[entity_idx] = expand_entity_port_assignments(m_entities[entity_idx].get()); });
+        for (auto& res : results)
+        {
+            if (res->is_error())
             {
-                if (!signal->m_ranges.empty())
-                {
-                    signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
-                }
-                else
-                {
-                    signal->m_expanded_names = std::vector<ci_string>({signal->m_name});
-                }
+                return std::move(res.value());
             }
+        }
+
+        return OK({});
+    }
 
-            // expand assignments
-            for (auto& assignment : vhdl_entity->m_assignments)
+    Result<std::monostate> VHDLParser::expand_entity(VhdlEntity* vhdl_entity) const
+    {
+        // expand port identifiers
+        for (const auto& port : vhdl_entity->m_ports)
+        {
+            if (!port->m_ranges.empty())
             {
-                auto left_res = expand_assignment_expression(vhdl_entity, assignment.m_variable);
-                if (left_res.is_error())
-                {
-                    return ERR_APPEND(left_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand signal assignment");
-                }
-                const std::vector<ci_string> left_signals = left_res.get();
+                port->m_expanded_identifiers = expand_ranges(port->m_identifier, port->m_ranges);
+                vhdl_entity->m_expanded_port_identifiers.insert(port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
+            }
+            else
+            {
+                port->m_expanded_identifiers = {port->m_identifier};
+                vhdl_entity->m_expanded_port_identifiers.insert(port->m_identifier);
+            }
+        }
 
-                auto right_res = expand_assignment_expression(vhdl_entity, assignment.m_assignment);
-                if (right_res.is_error())
-                {
-                    return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand signal assignment");
-                }
-                const std::vector<ci_string> right_signals = right_res.get();
+        // expand signals
+        for (auto& signal : vhdl_entity->m_signals)
+        {
+            if (!signal->m_ranges.empty())
+            {
+                signal->m_expanded_names = expand_ranges(signal->m_name, signal->m_ranges);
+            }
+            else
+            {
+                signal->m_expanded_names = std::vector<ci_string>({signal->m_name});
+            }
+        }
 
-                u32 left_size  = left_signals.size();
-                u32 right_size = right_signals.size();
-                if (left_signals.empty() || right_signals.empty())
-                {
-                    return ERR("could not parse VHDL file '" + m_path.string() + "': failed to expand assignments within entity '" + core_strings::to<std::string>(entity_name) + "'");
-                }
-                else if (left_size != right_size)
-                {
-                    return ERR("could not parse VHDL file '" + m_path.string() + "': assignment width mismatch within entity '" + core_strings::to<std::string>(entity_name) + "'");
-                }
-                else
+        // expand assignments
+        for (auto& assignment : vhdl_entity->m_assignments)
+        {
+            auto left_res = expand_assignment_expression(vhdl_entity, assignment.m_variable);
+            if (left_res.is_error())
+            {
+                return ERR_APPEND(left_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand signal assignment");
+            }
+            const std::vector<ci_string> left_signals = left_res.get();
+
+            auto right_res = expand_assignment_expression(vhdl_entity, assignment.m_assignment);
+            if (right_res.is_error())
+            {
+                return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand signal assignment");
+            }
+            const std::vector<ci_string> right_signals = right_res.get();
+
+            u32 left_size  = left_signals.size();
+            u32 right_size = right_signals.size();
+            if (left_signals.empty() || right_signals.empty())
+            {
+                return ERR("could not parse VHDL file '" + m_path.string() + "': failed to expand assignments within entity '" + core_strings::to<std::string>(vhdl_entity->m_name) + "'");
+            }
+            else if (left_size != right_size)
+            {
+                return ERR("could not parse VHDL file '" + m_path.string() + "': assignment width mismatch within entity '" + core_strings::to<std::string>(vhdl_entity->m_name) + "'");
+            }
+            else
+            {
+                for (u32 i = 0; i < right_size; i++)
                 {
-                    for (u32 i = 0; i < right_size; i++)
-                    {
-                        vhdl_entity->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
-                    }
+                    vhdl_entity->m_expanded_assignments.push_back(std::make_pair(left_signals.at(i), right_signals.at(i)));
                 }
             }
         }
 
-        // expand entity port assignments
-        for (auto& [entity_name, vhdl_entity] : m_entities_by_name)
+        return OK({});
+    }
+
+    Result<std::monostate> VHDLParser::expand_entity_port_assignments(VhdlEntity* vhdl_entity) const
+    {
+        for (auto& instance : vhdl_entity->m_instances)
         {
-            for (auto& instance : vhdl_entity->m_instances)
+            if (auto entity_it = m_entities_by_name.find(instance->m_type); entity_it != m_entities_by_name.end())
             {
-                if (auto entity_it = m_entities_by_name.find(instance->m_type); entity_it != m_entities_by_name.end())
-                {
-                    instance->m_is_entity = true;
+                instance->m_is_entity = true;
 
-                    if (!instance->m_port_assignments.empty())
+                if (!instance->m_port_assignments.empty())
+                {
+                    // all port assignments by name
+                    if (instance->m_port_assignments.front().m_port.has_value())
                     {
-                        // all port assignments by name
-                        if (instance->m_port_assignments.front().m_port.has_value())
+                        for (const auto& port_assignment : instance->m_port_assignments)
                         {
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                            auto right_res = expand_assignment_expression(vhdl_entity, port_assignment.m_assignment);
+                            if (right_res.is_error())
                             {
-                                auto right_res = expand_assignment_expression(vhdl_entity, port_assignment.m_assignment);
-                                if (right_res.is_error())
-                                {
-                                    return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
-                                }
-                                const std::vector<ci_string> right_port = right_res.get();
-                                if (!right_port.empty())
+                                return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                            }
+                            const std::vector<ci_string> right_port = right_res.get();
+                            if (!right_port.empty())
+                            {
+                                std::vector<ci_string> left_port;
+                                if (const identifier_t* identifier = std::get_if<identifier_t>(&(port_assignment.m_port.value())); identifier != nullptr)
                                 {
-                                    std::vector<ci_string> left_port;
-                                    if (const identifier_t* identifier = std::get_if<identifier_t>(&(port_assignment.m_port.value())); identifier != nullptr)
+                                    if (const auto it = entity_it->second->m_ports_by_identifier.find(*identifier); it != entity_it->second->m_ports_by_identifier.end())
                                     {
-                                        if (const auto it = entity_it->second->m_ports_by_identifier.find(*identifier); it != entity_it->second->m_ports_by_identifier.end())
-                                        {
-                                            left_port = it->second->m_expanded_identifiers;
-                                        }
-                                        else
-                                        {
-                                            return ERR("could not parse VHDL file '" + m_path.string() + "': unable to assign signal to port '" + core_strings::to<std::string>(*identifier)
-                                                       + "' as it is not a port of entity '" + core_strings::to<std::string>(entity_it->first) + "'");
-                                        }
-                                    }
-                                    else if (const ranged_identifier_t* ranged_identifier = std::get_if<ranged_identifier_t>(&(port_assignment.m_port.value())); ranged_identifier != nullptr)
-                                    {
-                                        left_port = expand_ranges(ranged_identifier->first, ranged_identifier->second);
+                                        left_port = it->second->m_expanded_identifiers;
                                     }
                                     else
                                     {
-                                        return ERR("could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                                        return ERR("could not parse VHDL file '" + m_path.string() + "': unable to assign signal to port '" + core_strings::to<std::string>(*identifier)
+                                                   + "' as it is not a port of entity '" + core_strings::to<std::string>(entity_it->first) + "'");
                                     }
+                                }
+                                else if (const ranged_identifier_t* ranged_identifier = std::get_if<ranged_identifier_t>(&(port_assignment.m_port.value())); ranged_identifier != nullptr)
+                                {
+                                    left_port = expand_ranges(ranged_identifier->first, ranged_identifier->second);
+                                }
+                                else
+                                {
+                                    return ERR("could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                                }
 
-                                    if (left_port.empty())
-                                    {
-                                        return ERR("could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
-                                    }
+                                if (left_port.empty())
+                                {
+                                    return ERR("could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                                }
 
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
 
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
-                        // all port assignments by order
-                        else
+                    }
+                    // all port assignments by order
+                    else
+                    {
+                        std::vector<ci_string> ports;
+                        for (const auto& port : m_entities_by_name.at(instance->m_type)->m_ports)
                         {
-                            std::vector<ci_string> ports;
-                            for (const auto& port : m_entities_by_name.at(instance->m_type)->m_ports)
-                            {
-                                ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
-                            }
+                            ports.insert(ports.end(), port->m_expanded_identifiers.begin(), port->m_expanded_identifiers.end());
+                        }
 
-                            auto port_it = ports.begin();
+                        auto port_it = ports.begin();
 
-                            for (const auto& port_assignment : instance->m_port_assignments)
+                        for (const auto& port_assignment : instance->m_port_assignments)
+                        {
+                            auto right_res = expand_assignment_expression(vhdl_entity, port_assignment.m_assignment);
+                            if (right_res.is_error())
                             {
-                                auto right_res = expand_assignment_expression(vhdl_entity, port_assignment.m_assignment);
-                                if (right_res.is_error())
+                                return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                            }
+                            const std::vector<ci_string> right_port = right_res.get();
+                            if (!right_port.empty())
+                            {
+                                std::vector<ci_string> left_port;
+
+                                for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
                                 {
-                                    return ERR_APPEND(right_res.get_error(), "could not parse VHDL file '" + m_path.string() + "': unable to expand entity port assignment");
+                                    left_port.push_back(*port_it++);
                                 }
-                                const std::vector<ci_string> right_port = right_res.get();
-                                if (!right_port.empty())
-                                {
-                                    std::vector<ci_string> left_port;
 
-                                    for (u32 i = 0; i < right_port.size() && port_it != ports.end(); i++)
-                                    {
-                                        left_port.push_back(*port_it++);
-                                    }
+                                u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
 
-                                    u32 max_size = right_port.size() <= left_port.size() ? right_port.size() : left_port.size();
-
-                                    for (u32 i = 0; i < max_size; i++)
-                                    {
-                                        instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
-                                    }
+                                for (u32 i = 0; i < max_size; i++)
+                                {
+                                    instance->m_expanded_port_assignments.push_back(std::make_pair(left_port.at(i), right_port.at(i)));
                                 }
                             }
                         }
@@ -510,34 +578,102 @@ namespace hal
 
     Result<std::monostate> VHDLParser::parse_tokens()
     {
-        while (m_token_stream.remaining() > 0)
+        // libraries, entities, and architecture headers are parsed in file order, architecture bodies are collected and parsed independently afterwards
+        std::vector<VhdlArchitectureBody> architecture_bodies;
+        std::exception_ptr sequential_exception;
+        std::optional<Result<std::monostate>> sequential_result;
+
+        try
+        {
+            sequential_result = [this, &architecture_bodies]() -> Result<std::monostate> {
+                while (m_token_stream.remaining() > 0)
+                {
+                    if (m_token_stream.peek() == "library" || m_token_stream.peek() == "use")
+                    {
+                        parse_library();
+                    }
+                    else if (m_token_stream.peek() == "entity")
+                    {
+                        if (const auto res = parse_entity(); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "could not parse tokens");
+                        }
+                    }
+                    else if (m_token_stream.peek() == "architecture")
+                    {
+                        if (const auto res = parse_architecture(architecture_bodies); res.is_error())
+                        {
+                            return ERR_APPEND(res.get_error(), "could not parse tokens");
+                        }
+                    }
+                    else
+                    {
+                        return ERR("could not parse tokens: unexpected token '" + core_strings::to<std::string>(m_token_stream.peek().string) + "' in global scope (line "
+                                   + std::to_string(m_token_stream.peek().number) + ")");
+                    }
+                }
+
+                return OK({});
+            }();
+        }
+        catch (...)
+        {
+            sequential_exception = std::current_exception();
+        }
+
+        // architectures of the same entity are parsed in file order by the same thread
+        std::vector<std::vector<u32>> body_indices_by_entity;
+        std::unordered_map<VhdlEntity*, u32> entity_indices;
+        for (u32 body_idx = 0; body_idx < architecture_bodies.size(); body_idx++)
         {
-            if (m_token_stream.peek() == "library" || m_token_stream.peek() == "use")
+            const auto [it, inserted] = entity_indices.emplace(architecture_bodies[body_idx].m_entity, body_indices_by_entity.size());
+            if (inserted)
             {
-                parse_library();
+                body_indices_by_entity.emplace_back();
             }
-            else if (m_token_stream.peek() == "entity")
+            body_indices_by_entity[it->second].push_back(body_idx);
+        }
+
+        std::vector<std::optional<Result<std::monostate>>> results(architecture_bodies.size());
+        std::vector<std::exception_ptr> exceptions(architecture_bodies.size());
+
+        run_in_parallel(body_indices_by_entity.size(), m_num_threads, [&](const u32 entity_idx) {
+            for (const u32 body_idx : body_indices_by_entity[entity_idx])
             {
-                if (const auto res = parse_entity(); res.is_error())
+                try
                 {
-                    return ERR_APPEND(res.get_error(), "could not parse tokens");
+                    results[body_idx] = parse_architecture_body_and_attributes(architecture_bodies[body_idx]);
                 }
-            }
-            else if (m_token_stream.peek() == "architecture")
-            {
-                if (const auto res = parse_architecture(); res.is_error())
+                catch (...)
                 {
-                    return ERR_APPEND(res.get_error(), "could not parse tokens");
+                    exceptions[body_idx] = std::current_exception();
+                }
+                if (exceptions[body_idx] != nullptr || results[body_idx]->is_error())
+                {
+                    break;
                 }
             }
-            else
+        });
+
+        // report the first error in file order, all collected architectures precede the point at which the sequential parsing stopped
+        for (u32 body_idx = 0; body_idx < architecture_bodies.size(); body_idx++)
+        {
+            if (exceptions[body_idx] != nullptr)
+            {
+                std::rethrow_exception(exceptions[body_idx]);
+            }
+            if (results[body_idx].has_value() && results[body_idx]->is_error())
             {
-                return ERR("could not parse tokens: unexpected token '" + core_strings::to<std::string>(m_token_stream.peek().string) + "' in global scope (line "
-                           + std::to_string(m_token_stream.peek().number) + ")");
+                return ERR_APPEND(results[body_idx]->get_error(), "could not parse tokens");
             }
         }
 
-        return OK({});
+        if (sequential_exception != nullptr)
+        {
+            std::rethrow_exception(sequential_exception);
+        }
+
+        return std::move(sequential_result.value());
     }
 
     void VHDLParser::parse_library()
@@ -783,7 +919,7 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_architecture()
+    Result<std::monostate> VHDLParser::parse_architecture(std::vector<VhdlArchitectureBody>& architecture_bodies)
     {
         m_token_stream.consume("architecture", true);
         m_token_stream.consume();
@@ -807,19 +943,41 @@ namespace hal
             {
                 return ERR_APPEND(res.get_error(), "could not parse architecture: unable to parse architecture header (line " + std::to_string(line_number) + ")");
             }
-            if (const auto res = parse_architecture_body(vhdl_entity); res.is_error())
-            {
-                return ERR_APPEND(res.get_error(), "could not parse architecture: unable to parse architecture body (line " + std::to_string(line_number) + ")");
-            }
-            if (const auto res = assign_attributes(vhdl_entity); res.is_error())
+
+            // the body ends with the first 'end' on the outermost level, which is followed by the architecture name and ';'
+            const u32 begin = m_token_stream.position();
+            u32 end         = m_token_stream.find_next("end");
+            end             = (end < m_token_stream.size()) ? std::min(end + 3, m_token_stream.size()) : m_token_stream.size();
+
+            std::vector<Token<ci_string>> body_tokens;
+            body_tokens.reserve(end - begin);
+            for (u32 i = begin; i < end; i++)
             {
-                return ERR_APPEND(res.get_error(), "could not parse architecture: unable to assign attributes (line " + std::to_string(line_number) + ")");
+                body_tokens.push_back(m_token_stream.at(i));
             }
+            m_token_stream.set_position(end);
+
+            // the body is parsed and the attributes are assigned later on, possibly in parallel to other architectures
+            architecture_bodies.push_back({vhdl_entity, line_number, TokenStream<ci_string>(body_tokens, {"("}, {")"}), m_attribute_buffer});
 
             return OK({});
         }
     }
 
+    Result<std::monostate> VHDLParser::parse_architecture_body_and_attributes(VhdlArchitectureBody& architecture_body)
+    {
+        if (const auto res = parse_architecture_body(architecture_body.m_tokens, architecture_body.m_entity); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse architecture: unable to parse architecture body (line " + std::to_string(architecture_body.m_line_number) + ")");
+        }
+        if (const auto res = assign_attributes(architecture_body.m_entity, architecture_body.m_attribute_buffer); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not parse architecture: unable to assign attributes (line " + std::to_string(architecture_body.m_line_number) + ")");
+        }
+
+        return OK({});
+    }
+
     Result<std::monostate> VHDLParser::parse_architecture_header(VhdlEntity* vhdl_entity)
     {
         auto next_token = m_token_stream.peek();
@@ -907,17 +1065,17 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_architecture_body(VhdlEntity* vhdl_entity)
+    Result<std::monostate> VHDLParser::parse_architecture_body(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity)
     {
-        m_token_stream.consume("begin", true);
-        auto next_token = m_token_stream.peek();
+        stream.consume("begin", true);
+        auto next_token = stream.peek();
 
         while (next_token != "end")
         {
             // new instance found
-            if (m_token_stream.peek(1) == ":")
+            if (stream.peek(1) == ":")
             {
-                if (const auto res = parse_instance(vhdl_entity); res.is_error())
+                if (const auto res = parse_instance(stream, vhdl_entity); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(),
                                       "could not parse architecture body of entity '" + core_strings::to<std::string>(vhdl_entity->m_name) + "': unable to parse instance (line "
@@ -925,9 +1083,9 @@ namespace hal
                 }
             }
             // not in instance -> has to be a direct assignment
-            else if (m_token_stream.find_next("<=") < m_token_stream.find_next(";"))
+            else if (stream.find_next("<=") < stream.find_next(";"))
             {
-                if (const auto res = parse_assignment(vhdl_entity); res.is_error())
+                if (const auto res = parse_assignment(stream, vhdl_entity); res.is_error())
                 {
                     return ERR_APPEND(res.get_error(),
                                       "could not parse architecture body of entity '" + core_strings::to<std::string>(vhdl_entity->m_name) + "': unable to parse assignment (line "
@@ -937,25 +1095,25 @@ namespace hal
             else
             {
                 return ERR("could not parse architecture body of entity '" + core_strings::to<std::string>(vhdl_entity->m_name) + "': unexpected token '"
-                           + core_strings::to<std::string>(m_token_stream.peek().string) + "' (line " + std::to_string(next_token.number) + ")");
+                           + core_strings::to<std::string>(stream.peek().string) + "' (line " + std::to_string(next_token.number) + ")");
             }
 
-            next_token = m_token_stream.peek();
+            next_token = stream.peek();
         }
 
-        m_token_stream.consume("end", true);
-        m_token_stream.consume();
-        m_token_stream.consume(";", true);
+        stream.consume("end", true);
+        stream.consume();
+        stream.consume(";", true);
 
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_assignment(VhdlEntity* vhdl_entity)
+    Result<std::monostate> VHDLParser::parse_assignment(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity)
     {
-        u32 line_number = m_token_stream.peek().number;
+        u32 line_number = stream.peek().number;
         VhdlAssignment assignment;
 
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until("<=")); res.is_error())
+        if (auto res = parse_assignment_expression(stream.extract_until("<=")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -963,8 +1121,8 @@ namespace hal
         {
             assignment.m_variable = res.get();
         }
-        m_token_stream.consume("<=", true);
-        if (auto res = parse_assignment_expression(m_token_stream.extract_until(";")); res.is_error())
+        stream.consume("<=", true);
+        if (auto res = parse_assignment_expression(stream.extract_until(";")); res.is_error())
         {
             return ERR_APPEND(res.get_error(), "could not parse assignment: unable to parse assignment expression (line " + std::to_string(line_number) + ")");
         }
@@ -972,24 +1130,24 @@ namespace hal
         {
             assignment.m_assignment = res.get();
         }
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
         vhdl_entity->m_assignments.push_back(std::move(assignment));
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_instance(VhdlEntity* vhdl_entity)
+    Result<std::monostate> VHDLParser::parse_instance(TokenStream<ci_string>& stream, VhdlEntity* vhdl_entity)
     {
         auto instance    = std::make_unique<VhdlInstance>();
-        u32 line_number  = m_token_stream.peek().number;
-        instance->m_name = m_token_stream.consume();
-        m_token_stream.consume(":", true);
+        u32 line_number  = stream.peek().number;
+        instance->m_name = stream.consume();
+        stream.consume(":", true);
 
         // remove prefix from type
-        if (m_token_stream.peek() == "entity")
+        if (stream.peek() == "entity")
         {
-            m_token_stream.consume("entity", true);
-            instance->m_type = m_token_stream.consume();
+            stream.consume("entity", true);
+            instance->m_type = stream.consume();
             if (const size_t pos = instance->m_type.find('.'); pos != std::string::npos)
             {
                 instance->m_type = instance->m_type.substr(pos + 1);
@@ -1000,14 +1158,14 @@ namespace hal
                            + core_strings::to<std::string>(instance->m_type) + "' does not exist (line " + std::to_string(line_number) + ")");
             }
         }
-        else if (m_token_stream.peek() == "component")
+        else if (stream.peek() == "component")
         {
-            m_token_stream.consume("component", true);
-            instance->m_type = m_token_stream.consume();
+            stream.consume("component", true);
+            instance->m_type = stream.consume();
         }
         else
         {
-            instance->m_type = m_token_stream.consume();
+            instance->m_type = stream.consume();
             ci_string prefix;
 
             // find longest matching library prefix
@@ -1026,10 +1184,10 @@ namespace hal
             }
         }
 
-        if (m_token_stream.consume("generic"))
+        if (stream.consume("generic"))
         {
-            line_number = m_token_stream.peek().number;
-            if (const auto res = parse_generic_assign(instance.get()); res.is_error())
+            line_number = stream.peek().number;
+            if (const auto res = parse_generic_assign(stream, instance.get()); res.is_error())
             {
                 return ERR_APPEND(res.get_error(),
                                   "could not parse instance '" + core_strings::to<std::string>(instance->m_name) + "' of type '" + core_strings::to<std::string>(instance->m_type)
@@ -1037,9 +1195,9 @@ namespace hal
             }
         }
 
-        if (m_token_stream.peek() == "port")
+        if (stream.peek() == "port")
         {
-            if (const auto res = parse_port_assign(instance.get()); res.is_error())
+            if (const auto res = parse_port_assign(stream, instance.get()); res.is_error())
             {
                 return ERR_APPEND(res.get_error(),
                                   "could not parse instance '" + core_strings::to<std::string>(instance->m_name) + "' of type '" + core_strings::to<std::string>(instance->m_type)
@@ -1050,19 +1208,19 @@ namespace hal
         vhdl_entity->m_instances_by_name[instance->m_name] = instance.get();
         vhdl_entity->m_instances.push_back(std::move(instance));
 
-        m_token_stream.consume(";", true);
+        stream.consume(";", true);
 
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_port_assign(VhdlInstance* instance)
+    Result<std::monostate> VHDLParser::parse_port_assign(TokenStream<ci_string>& stream, VhdlInstance* instance)
     {
-        u32 line_number = m_token_stream.peek().number;
-        m_token_stream.consume("port", true);
-        m_token_stream.consume("map", true);
-        m_token_stream.consume("(", true);
-        TokenStream<ci_string> port_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        u32 line_number = stream.peek().number;
+        stream.consume("port", true);
+        stream.consume("map", true);
+        stream.consume("(", true);
+        TokenStream<ci_string> port_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         if (port_stream.find_next("=>") != TokenStream<ci_string>::END_OF_STREAM)
         {
@@ -1134,12 +1292,12 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::parse_generic_assign(VhdlInstance* instance)
+    Result<std::monostate> VHDLParser::parse_generic_assign(TokenStream<ci_string>& stream, VhdlInstance* instance)
     {
-        m_token_stream.consume("map", true);
-        m_token_stream.consume("(", true);
-        TokenStream<ci_string> generic_stream = m_token_stream.extract_until(")");
-        m_token_stream.consume(")", true);
+        stream.consume("map", true);
+        stream.consume("(", true);
+        TokenStream<ci_string> generic_stream = stream.extract_until(")");
+        stream.consume(")", true);
 
         while (generic_stream.remaining() > 0)
         {
@@ -1207,9 +1365,9 @@ namespace hal
         return OK({});
     }
 
-    Result<std::monostate> VHDLParser::assign_attributes(VhdlEntity* vhdl_entity)
+    Result<std::monostate> VHDLParser::assign_attributes(VhdlEntity* vhdl_entity, const attribute_buffer_t& attribute_buffer)
     {
-        for (const auto& [target_class, attributes] : m_attribute_buffer)
+        for (const auto& [target_class, attributes] : attribute_buffer)
         {
             // entity attributes
             if (target_class == AttributeTarget::ENTITY)
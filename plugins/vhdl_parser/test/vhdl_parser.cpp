@@ -3,7 +3,9 @@
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
+#include <chrono>
 #include <filesystem>
+#include <sstream>
 
 namespace hal {
 
@@ -2743,4 +2745,152 @@ namespace hal {
             }
         TEST_END
     }
+    /**
+     * Testing that parsing the architectures of a netlist in parallel yields the same netlist regardless of the number of threads.
+     *
+     * Functions: parse, set_num_threads
+     */
+    TEST_F(VHDLParserTest, check_parallel_parsing) {
+
+        TEST_START
+            {
+                // a top entity instantiating many child entities, each consisting of a chain of gates
+                const auto create_netlist_input = [](const u32 num_entities, const u32 num_gates) {
+                    std::stringstream netlist_input;
+                    for (u32 e = 0; e < num_entities; e++)
+                    {
+                        netlist_input << "entity MODULE_CHILD_" << e << " is\n"
+                                      << "  attribute child_attribute : string;\n"
+                                      << "  attribute child_attribute of MODULE_CHILD_" << e << " : entity is \"child_" << e << "\";\n"
+                                      << "  port (\n"
+                                      << "    child_in : in STD_LOGIC_VECTOR(1 downto 0);\n"
+                                      << "    child_out : out STD_LOGIC\n"
+                                      << "  );\n"
+                                      << "end MODULE_CHILD_" << e << ";\n"
+                                      << "architecture STRUCTURE of MODULE_CHILD_" << e << " is\n"
+                                      << "  signal chain : STD_LOGIC_VECTOR(" << num_gates << " downto 0);\n"
+                                      << "  attribute gate_attribute : string;\n"
+                                      << "  attribute gate_attribute of gate_0 : label is \"first\";\n"
+                                      << "begin\n"
+                                      << "  chain(0) <= child_in(0);\n";
+                        for (u32 g = 0; g < num_gates; g++)
+                        {
+                            netlist_input << "  gate_" << g << " : AND2 port map (I0 => chain(" << g << "), I1 => child_in(1), O => chain(" << g + 1 << "));\n";
+                        }
+                        netlist_input << "  gate_out : BUF port map (I => chain(" << num_gates << "), O => child_out);\n"
+                                      << "end STRUCTURE;\n";
+                    }
+                    netlist_input << "entity MODULE_TOP is\n"
+                                  << "  port (\n"
+                                  << "    net_global_in : in STD_LOGIC_VECTOR(1 downto 0);\n"
+                                  << "    net_global_out : out STD_LOGIC_VECTOR(" << num_entities - 1 << " downto 0)\n"
+                                  << "  );\n"
+                                  << "end MODULE_TOP;\n"
+                                  << "architecture STRUCTURE of MODULE_TOP is\n"
+                                  << "begin\n";
+                    for (u32 e = 0; e < num_entities; e++)
+                    {
+                        netlist_input << "  child_" << e << " : entity work.MODULE_CHILD_" << e << " port map (child_in => net_global_in, child_out => net_global_out(" << e << "));\n";
+                    }
+                    netlist_input << "end STRUCTURE;\n";
+                    return netlist_input.str();
+                };
+
+                // gate and net names repeat across entities, hence objects are compared by ID
+                const auto dump_netlist = [](const Netlist* nl) {
+                    std::stringstream dump;
+                    for (const Gate* gate : nl->get_gates())
+                    {
+                        dump << "gate " << gate->get_id() << " " << gate->get_name() << " " << gate->get_type()->get_name() << " " << gate->get_module()->get_id();
+                        for (const auto& [key, value] : gate->get_data_map())
+                        {
+                            dump << " " << std::get<1>(key) << "=" << std::get<1>(value);
+                        }
+                        dump << "\n";
+                    }
+                    for (const Net* net : nl->get_nets())
+                    {
+                        dump << "net " << net->get_id() << " " << net->get_name();
+                        for (const Endpoint* ep : net->get_sources())
+                        {
+                            dump << " " << ep->get_gate()->get_id() << ":" << ep->get_pin()->get_name();
+                        }
+                        dump << " ->";
+                        for (const Endpoint* ep : net->get_destinations())
+                        {
+                            dump << " " << ep->get_gate()->get_id() << ":" << ep->get_pin()->get_name();
+                        }
+                        dump << "\n";
+                    }
+                    for (const Module* mod : nl->get_modules())
+                    {
+                        dump << "module " << mod->get_id() << " " << mod->get_name() << " " << mod->get_type() << " " << (mod->is_top_module() ? 0 : mod->get_parent_module()->get_id()) << "\n";
+                    }
+                    return dump.str();
+                };
+
+                const GateLibrary* gate_lib = test_utils::get_gate_library();
+
+                {
+                    std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", create_netlist_input(24, 16));
+
+                    VHDLParser reference_parser;
+                    reference_parser.set_num_threads(1);
+                    auto reference_res = reference_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                    ASSERT_TRUE(reference_res.is_ok());
+                    std::unique_ptr<Netlist> reference_nl = reference_res.get();
+                    ASSERT_NE(reference_nl, nullptr);
+                    EXPECT_EQ(reference_nl->get_gates().size(), 24 * 17);
+                    EXPECT_EQ(reference_nl->get_modules().size(), 25);
+                    const std::string reference_dump = dump_netlist(reference_nl.get());
+
+                    for (u32 num_threads : {2, 4, 16, 0})
+                    {
+                        VHDLParser vhdl_parser;
+                        vhdl_parser.set_num_threads(num_threads);
+                        auto nl_res = vhdl_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                        ASSERT_TRUE(nl_res.is_ok());
+                        std::unique_ptr<Netlist> nl = nl_res.get();
+                        ASSERT_NE(nl, nullptr);
+                        EXPECT_EQ(dump_netlist(nl.get()), reference_dump) << num_threads << " threads";
+                    }
+                }
+                {
+                    // the first error in file order is reported, even if later architectures fail as well
+                    NO_COUT_TEST_BLOCK;
+                    std::string netlist_input = create_netlist_input(8, 4);
+                    netlist_input += "architecture BROKEN_A of MODULE_CHILD_1 is\nbegin\n  gate_x : entity work.UNKNOWN_A port map (I => net_x);\nend BROKEN_A;\n";
+                    netlist_input += "architecture BROKEN_B of MODULE_CHILD_5 is\nbegin\n  gate_x : entity work.UNKNOWN_B port map (I => net_x);\nend BROKEN_B;\n";
+                    netlist_input += "architecture BROKEN_C of UNKNOWN_C is\nbegin\nend BROKEN_C;\n";
+                    std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", netlist_input);
+
+                    VHDLParser reference_parser;
+                    reference_parser.set_num_threads(1);
+                    auto reference_res = reference_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                    ASSERT_TRUE(reference_res.is_error());
+
+                    VHDLParser vhdl_parser;
+                    vhdl_parser.set_num_threads(4);
+                    auto nl_res = vhdl_parser.parse_and_instantiate(vhdl_file, gate_lib);
+                    ASSERT_TRUE(nl_res.is_error());
+                    EXPECT_EQ(nl_res.get_error().get(), reference_res.get_error().get());
+                    EXPECT_NE(nl_res.get_error().get().find("UNKNOWN_A"), std::string::npos);
+                }
+                {
+                    // scaling with the number of threads
+                    std::filesystem::path vhdl_file = test_utils::create_sandbox_file("netlist.vhd", create_netlist_input(256, 256));
+
+                    for (u32 num_threads : {1, 4, 16})
+                    {
+                        VHDLParser vhdl_parser;
+                        vhdl_parser.set_num_threads(num_threads);
+                        const auto begin_time = std::chrono::steady_clock::now();
+                        EXPECT_TRUE(vhdl_parser.parse(vhdl_file).is_ok());
+                        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin_time;
+                        std::cout << "[          ] parsing 256 architectures with " << num_threads << " threads: " << duration.count() << "s" << std::endl;
+                    }
+                }
+            }
+        TEST_END
+    }
 } //namespace hal
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/expression_store.h"
 #include "hal_core/netlist/netlist.h"
 #include "z3++.h"
 
@@ -65,6 +66,17 @@ namespace hal
          */
         Result<BooleanFunction> to_bf(const z3::expr& e);
 
+        /**
+         * @brief Translates a z3 expression into an equivalent shared expression of the given store.
+         * 
+         * In contrast to `to_bf`, sub-expressions that are shared within the z3 expression are translated only once and remain shared, so the result is linear in the size of the z3 expression.
+         * 
+         * @param[in] e - The expression to translate.
+         * @param[in] store - The expression store to create the expression in.
+         * @returns A shared expression equivalent to the z3 expression.
+         */
+        Result<SharedExpression> to_shared_expression(const z3::expr& e, ExpressionStore& store);
+
         /**
          * @brief Translates a z3 expression into an equivalent smt2 representation. 
          * 
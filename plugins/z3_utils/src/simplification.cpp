@@ -381,7 +381,7 @@ namespace hal
             std::vector<std::vector<BooleanFunction::Value>> values;
             for (const auto& parameter : p)
             {
-                values.emplace_back(parameter.get_top_level_node().constant);
+                values.emplace_back(parameter.get_top_level_node().constant());
             }
 
             switch (node.type)
@@ -2,11 +2,13 @@
 
 #include "hal_core/netlist/decorators/boolean_function_net_decorator.h"
 #include "hal_core/utilities/log.h"
+#include "hal_core/utilities/utils.h"
 #include "z3_api.h"
 #include "z3_utils/converter/cpp_converter.h"
 #include "z3_utils/converter/verilog_converter.h"
 
 #include <sstream>
+#include <unordered_map>
 
 namespace hal
 {
@@ -32,13 +34,14 @@ namespace hal
                         return {true, context.bv_val(node.index, node.size)};
                     case BooleanFunction::NodeType::Constant: {
                         std::vector<u8> bits;
-                        for (u32 i = 0; i < node.constant.size(); i++)
+                        const auto value = node.constant();
+                        for (u32 i = 0; i < value.size(); i++)
                         {
-                            if (node.constant.at(i) == BooleanFunction::Value::ONE)
+                            if (value.at(i) == BooleanFunction::Value::ONE)
                             {
                                 bits.push_back(1);
                             }
-                            else if (node.constant.at(i) == BooleanFunction::Value::ZERO)
+                            else if (value.at(i) == BooleanFunction::Value::ZERO)
                             {
                                 bits.push_back(0);
                             }
@@ -51,11 +54,11 @@ namespace hal
                         return {true, context.bv_val(bits.size(), reinterpret_cast<bool*>(bits.data()))};
                     }
                     case BooleanFunction::NodeType::Variable: {
-                        if (auto it = var2expr.find(node.variable); it != var2expr.end())
+                        if (auto it = var2expr.find(node.variable()); it != var2expr.end())
                         {
                             return {true, it->second};
                         }
-                        return {true, context.bv_const(node.variable.c_str(), node.size)};
+                        return {true, context.bv_const(node.variable().c_str(), node.size)};
                     }
 
                     case BooleanFunction::NodeType::And:
@@ -446,6 +449,89 @@ namespace hal
             return to_bf_internal(e, cache);
         }
 
+        Result<SharedExpression> to_shared_expression(const z3::expr& e, ExpressionStore& store)
+        {
+            // translates every distinct z3 node exactly once by applying its declaration to placeholder variables, translating this single node using to_bf, and then substituting the placeholders with the already translated arguments
+            // the placeholder prefix is extended until no variable of the expression starts with it, so placeholders never share a name with a variable
+            const std::set<std::string> variable_names = get_variable_names(e);
+            const auto is_prefix_in_use                = [&variable_names](const std::string& prefix) {
+                const auto it = variable_names.lower_bound(prefix);
+                return it != variable_names.end() && utils::starts_with(*it, prefix);
+            };
+            std::string placeholder_prefix = "__z3_utils_arg_";
+            while (is_prefix_in_use(placeholder_prefix))
+            {
+                placeholder_prefix = "_" + placeholder_prefix;
+            }
+
+            std::unordered_map<u32, SharedExpression> translated;
+            std::vector<std::pair<z3::expr, bool>> stack = {{e, false}};
+            while (!stack.empty())
+            {
+                auto [current, expanded] = stack.back();
+                stack.pop_back();
+                if (translated.find(current.id()) != translated.end())
+                {
+                    continue;
+                }
+
+                if (!current.is_app() || current.num_args() == 0)
+                {
+                    const auto bf_res = to_bf(current);
+                    if (bf_res.is_error())
+                    {
+                        return ERR_APPEND(bf_res.get_error(), "could not translate z3 expression to shared expression: failed to translate leaf");
+                    }
+                    const auto expr_res = store.get_expression(bf_res.get());
+                    if (expr_res.is_error())
+                    {
+                        return ERR_APPEND(expr_res.get_error(), "could not translate z3 expression to shared expression: failed to create expression for leaf");
+                    }
+                    translated.emplace(current.id(), expr_res.get());
+                    continue;
+                }
+
+                if (!expanded)
+                {
+                    stack.emplace_back(current, true);
+                    for (u32 i = 0; i < current.num_args(); i++)
+                    {
+                        stack.emplace_back(current.arg(i), false);
+                    }
+                    continue;
+                }
+
+                z3::expr_vector placeholders(current.ctx());
+                std::map<std::string, SharedExpression> substitutions;
+                for (u32 i = 0; i < current.num_args(); i++)
+                {
+                    const auto arg               = current.arg(i);
+                    const std::string placeholder = placeholder_prefix + std::to_string(i);
+                    placeholders.push_back(arg.is_bv() ? current.ctx().bv_const(placeholder.c_str(), arg.get_sort().bv_size()) : current.ctx().constant(placeholder.c_str(), arg.get_sort()));
+                    substitutions.emplace(placeholder, translated.at(arg.id()));
+                }
+
+                const auto bf_res = to_bf(current.decl()(placeholders));
+                if (bf_res.is_error())
+                {
+                    return ERR_APPEND(bf_res.get_error(), "could not translate z3 expression to shared expression: failed to translate operation '" + current.decl().name().str() + "'");
+                }
+                const auto node_res = store.get_expression(bf_res.get());
+                if (node_res.is_error())
+                {
+                    return ERR_APPEND(node_res.get_error(), "could not translate z3 expression to shared expression: failed to create expression for operation '" + current.decl().name().str() + "'");
+                }
+                const auto expr_res = store.substitute(node_res.get(), substitutions);
+                if (expr_res.is_error())
+                {
+                    return ERR_APPEND(expr_res.get_error(), "could not translate z3 expression to shared expression: failed to substitute arguments of operation '" + current.decl().name().str() + "'");
+                }
+                translated.emplace(current.id(), expr_res.get());
+            }
+
+            return OK(translated.at(e.id()));
+        }
+
         std::string to_smt2(const z3::expr& e)
         {
             auto s = z3::solver(e.ctx());
@@ -293,4 +293,34 @@ namespace hal
 
         TEST_END
     }
+
+    TEST_F(Z3UtilsTest, check_shared_expression_translation)
+    {
+        TEST_START
+        {
+            // variables that look like the placeholders used during the translation must be left intact
+            auto ctx = z3::context();
+            ExpressionStore store;
+
+            const auto a  = BooleanFunction::Var("__z3_utils_arg_0", 4);
+            const auto b  = BooleanFunction::Var("__z3_utils_arg_1", 4);
+            const auto c  = BooleanFunction::Var("C", 4);
+            const auto bf = ((a & b) | c) ^ (b + a);
+
+            const auto expected_res = store.get_expression(bf);
+            ASSERT_TRUE(expected_res.is_ok());
+            const auto expected = expected_res.get();
+
+            const auto translated_res = z3_utils::to_shared_expression(z3_utils::from_bf(bf, ctx), store);
+            ASSERT_TRUE(translated_res.is_ok());
+            const auto translated = translated_res.get();
+            EXPECT_EQ(translated, expected);
+
+            const auto bf_res = translated.to_boolean_function();
+            ASSERT_TRUE(bf_res.is_ok());
+            EXPECT_EQ(bf_res.get(), bf);
+        }
+
+        TEST_END
+    }
 }    // namespace hal
@@ -1,8 +1,10 @@
 #include "hal_core/netlist/boolean_function.h"
 
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
 #include "hal_core/netlist/boolean_function/parser.h"
 #include "hal_core/netlist/boolean_function/simplification.h"
 #include "hal_core/netlist/boolean_function/symbolic_execution.h"
+#include "hal_core/utilities/intern_table.h"
 #include "hal_core/utilities/log.h"
 #include "hal_core/utilities/utils.h"
 
@@ -888,7 +890,7 @@ namespace hal
         {
             if (node.is_variable())
             {
-                variable_names.insert(node.variable);
+                variable_names.insert(node.variable());
             }
         }
         return variable_names;
@@ -1166,7 +1168,7 @@ namespace hal
         auto substitute_variable = [substitutions](const auto& node, auto&& operands) -> BooleanFunction {
             if (node.is_variable())
             {
-                if (auto repl_it = substitutions.find(node.variable); repl_it != substitutions.end())
+                if (auto repl_it = substitutions.find(node.variable()); repl_it != substitutions.end())
                 {
                     return repl_it->second.clone();
                 }
@@ -1260,7 +1262,7 @@ namespace hal
         {
             if (auto value = result.get(); value.is_constant())
             {
-                return OK(value.get_top_level_node().constant);
+                return OK(value.get_top_level_node().constant());
             }
             return OK(std::vector<BooleanFunction::Value>(this->size(), BooleanFunction::Value::X));
         }
@@ -1303,7 +1305,17 @@ namespace hal
             return OK(std::vector<std::vector<Value>>(1, std::vector<Value>(1 << variables.size(), Value::X)));
         }
 
-        // (4.2) safety-check in case the number of variables is too large to process
+        // (4.2) evaluate 64 rows at once if the function can be compiled,
+        //       i.e., if it can be evaluated exactly using two-valued logic
+        if (variables.size() <= 16)
+        {
+            if (auto compiled = CompiledBooleanFunction::compile(*this, variables); compiled.is_ok())
+            {
+                return compiled.get().compute_truth_table();
+            }
+        }
+
+        // (4.3) safety-check in case the number of variables is too large to process
         if (variables.size() > 10)
         {
             return ERR("could not compute truth table for Boolean function '" + this->to_string() + "': unable to generate truth-table with more than 10 variables");
@@ -1444,20 +1456,21 @@ namespace hal
                 case BooleanFunction::NodeType::Constant: {
                     // since our constants are defined as arbitrary bit-vectors,
                     // we have to concat each bit just to be on the safe side
-                    auto constant = context.bv_val(node.constant.front(), 1);
-                    for (u32 i = 1; i < node.constant.size(); i++)
+                    const auto value = node.constant();
+                    auto constant    = context.bv_val(value.front(), 1);
+                    for (u32 i = 1; i < value.size(); i++)
                     {
-                        const auto bit = node.constant.at(i);
+                        const auto bit = value.at(i);
                         constant       = z3::concat(context.bv_val(bit, 1), constant);
                     }
                     return {true, constant};
                 }
                 case BooleanFunction::NodeType::Variable: {
-                    if (auto it = var2expr.find(node.variable); it != var2expr.end())
+                    if (auto it = var2expr.find(node.variable()); it != var2expr.end())
                     {
                         return {true, it->second};
                     }
-                    return {true, context.bv_const(node.variable.c_str(), node.size)};
+                    return {true, context.bv_const(node.variable().c_str(), node.size)};
                 }
 
                 case BooleanFunction::NodeType::And:
@@ -1606,29 +1619,70 @@ namespace hal
         return coverage;
     }
 
+    namespace
+    {
+        struct ConstantHash
+        {
+            std::size_t operator()(const std::vector<BooleanFunction::Value>& value) const
+            {
+                std::size_t hash = value.size();
+                for (const auto v : value)
+                {
+                    hash = hash * 31 + static_cast<std::size_t>(v + 2);
+                }
+                return hash;
+            }
+        };
+
+        /// Global table of all variable names used within Boolean function nodes.
+        InternTable<std::string>& get_variable_table()
+        {
+            static InternTable<std::string> table;
+            return table;
+        }
+
+        /// Global table of all constants that cannot be packed into the node payload.
+        InternTable<std::vector<BooleanFunction::Value>, ConstantHash>& get_constant_table()
+        {
+            static InternTable<std::vector<BooleanFunction::Value>, ConstantHash> table;
+            return table;
+        }
+    }    // namespace
+
     BooleanFunction::Node BooleanFunction::Node::Operation(u16 _type, u16 _size)
     {
-        return Node(_type, _size, {}, {}, {});
+        return Node(_type, _size, {}, false, {});
     }
 
     BooleanFunction::Node BooleanFunction::Node::Constant(const std::vector<BooleanFunction::Value> _constant)
     {
-        return Node(NodeType::Constant, _constant.size(), _constant, {}, {});
+        if (_constant.size() <= 64 && std::all_of(_constant.begin(), _constant.end(), [](auto v) { return v == BooleanFunction::Value::ZERO || v == BooleanFunction::Value::ONE; }))
+        {
+            u64 bits = 0;
+            for (u32 i = 0; i < _constant.size(); i++)
+            {
+                bits |= static_cast<u64>(_constant[i]) << i;
+            }
+            return Node(NodeType::Constant, _constant.size(), {}, false, bits);
+        }
+
+        return Node(NodeType::Constant, _constant.size(), {}, true, get_constant_table().intern(_constant));
     }
 
     BooleanFunction::Node BooleanFunction::Node::Index(u16 _index, u16 _size)
     {
-        return Node(NodeType::Index, _size, {}, _index, {});
+        return Node(NodeType::Index, _size, _index, false, {});
     }
 
     BooleanFunction::Node BooleanFunction::Node::Variable(const std::string _variable, u16 _size)
     {
-        return Node(NodeType::Variable, _size, {}, {}, _variable);
+        return Node(NodeType::Variable, _size, {}, false, get_variable_table().intern(_variable));
     }
 
     bool BooleanFunction::Node::operator==(const Node& other) const
     {
-        return std::tie(this->type, this->size, this->constant, this->index, this->variable) == std::tie(other.type, other.size, other.constant, other.index, other.variable);
+        // interning guarantees a canonical payload, hence there is no need to resolve constants or variable names
+        return std::tie(this->type, this->size, this->index, this->m_interned, this->m_payload) == std::tie(other.type, other.size, other.index, other.m_interned, other.m_payload);
     }
 
     bool BooleanFunction::Node::operator!=(const Node& other) const
@@ -1638,12 +1692,118 @@ namespace hal
 
     bool BooleanFunction::Node::operator<(const Node& other) const
     {
-        return std::tie(this->type, this->size, this->constant, this->index, this->variable) < std::tie(other.type, other.size, other.constant, other.index, other.variable);
+        if (std::tie(this->type, this->size) != std::tie(other.type, other.size))
+        {
+            return std::tie(this->type, this->size) < std::tie(other.type, other.size);
+        }
+
+        // resolve operands so that the order does not depend on the order of interning
+        if (this->is_constant() && *this != other)
+        {
+            if (!this->m_interned && !other.m_interned)
+            {
+                // lexicographic order starting from the least significant bit, with ZERO < ONE
+                const u64 lowest_difference = (this->m_payload ^ other.m_payload) & (~(this->m_payload ^ other.m_payload) + 1);
+                return (this->m_payload & lowest_difference) == 0;
+            }
+            return this->constant() < other.constant();
+        }
+
+        if (this->index != other.index)
+        {
+            return this->index < other.index;
+        }
+
+        if (this->is_variable() && this->m_payload != other.m_payload)
+        {
+            return this->variable() < other.variable();
+        }
+
+        return false;
     }
 
     BooleanFunction::Node BooleanFunction::Node::clone() const
     {
-        return Node(this->type, this->size, this->constant, this->index, this->variable);
+        return *this;
+    }
+
+    std::vector<BooleanFunction::Value> BooleanFunction::Node::constant() const
+    {
+        if (!this->is_constant())
+        {
+            return {};
+        }
+
+        if (this->m_interned)
+        {
+            return get_constant_table().get(this->m_payload);
+        }
+
+        std::vector<BooleanFunction::Value> value;
+        value.reserve(this->size);
+        for (u16 i = 0; i < this->size; i++)
+        {
+            value.push_back(((this->m_payload >> i) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
+        }
+        return value;
+    }
+
+    const std::string& BooleanFunction::Node::variable() const
+    {
+        static const std::string empty_variable;
+        if (!this->is_variable())
+        {
+            return empty_variable;
+        }
+
+        return get_variable_table().get(this->m_payload);
+    }
+
+    Result<std::monostate> BooleanFunction::Node::set_constant(const std::vector<BooleanFunction::Value>& value)
+    {
+        if (!this->is_constant())
+        {
+            return ERR("could not set constant value: node is not of type 'Constant'");
+        }
+
+        // the value is only packed if it can be restored from the bit-size of the node
+        if (value.size() == this->size && value.size() <= 64
+            && std::all_of(value.begin(), value.end(), [](auto v) { return v == BooleanFunction::Value::ZERO || v == BooleanFunction::Value::ONE; }))
+        {
+            u64 bits = 0;
+            for (u32 i = 0; i < value.size(); i++)
+            {
+                bits |= static_cast<u64>(value[i]) << i;
+            }
+            this->m_interned = false;
+            this->m_payload  = bits;
+        }
+        else
+        {
+            this->m_interned = true;
+            this->m_payload  = get_constant_table().intern(value);
+        }
+        return OK({});
+    }
+
+    Result<std::monostate> BooleanFunction::Node::set_variable(const std::string& variable)
+    {
+        if (!this->is_variable())
+        {
+            return ERR("could not set variable name: node is not of type 'Variable'");
+        }
+
+        this->m_payload = get_variable_table().intern(variable);
+        return OK({});
+    }
+
+    BooleanFunction::Value BooleanFunction::Node::get_constant_bit(u16 position) const
+    {
+        if (this->m_interned)
+        {
+            return get_constant_table().get(this->m_payload)[position];
+        }
+        return ((this->m_payload >> position) & 1) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO;
     }
 
     std::string BooleanFunction::Node::to_string() const
@@ -1652,9 +1812,10 @@ namespace hal
         {
             case NodeType::Constant: {
                 std::string str;
-                for (const auto& value : this->constant)
+                str.reserve(this->size);
+                for (u16 i = this->size; i-- != 0;)
                 {
-                    str = enum_to_string(value) + str;
+                    str += enum_to_string(this->get_constant_bit(i));
                 }
                 return "0b" + str;
             }
@@ -1662,7 +1823,7 @@ namespace hal
             case NodeType::Index:
                 return std::to_string(this->index);
             case NodeType::Variable:
-                return this->variable;
+                return this->variable();
 
             case NodeType::And:
                 return "&";
@@ -1726,6 +1887,12 @@ namespace hal
         }
     }
 
+    std::size_t BooleanFunction::Node::hash() const
+    {
+        std::size_t h = (static_cast<std::size_t>(this->type) << 32) ^ (static_cast<std::size_t>(this->size) << 16) ^ this->index ^ (this->m_interned ? 0x9e3779b97f4a7c15 : 0);
+        return h ^ (this->m_payload + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2));
+    }
+
     u16 BooleanFunction::Node::get_arity() const
     {
         return BooleanFunction::Node::get_arity_of_type(this->type);
@@ -1759,23 +1926,35 @@ namespace hal
 
     bool BooleanFunction::Node::has_constant_value(const std::vector<Value>& value) const
     {
-        return this->is_constant() && (this->constant == value);
+        if (!this->is_constant() || this->size != value.size())
+        {
+            return false;
+        }
+
+        if (this->m_interned)
+        {
+            return get_constant_table().get(this->m_payload) == value;
+        }
+
+        for (u16 i = 0; i < this->size; i++)
+        {
+            if (value[i] != this->get_constant_bit(i))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     bool BooleanFunction::Node::has_constant_value(u64 value) const
     {
-        if (!this->is_constant())
+        if (!this->is_constant() || this->m_interned)
         {
             return false;
         }
 
-        auto bv_value = std::vector<BooleanFunction::Value>({});
-        bv_value.reserve(this->size);
-        for (auto i = 0u; i < this->constant.size(); i++)
-        {
-            bv_value.emplace_back((value & (1 << i)) ? BooleanFunction::Value::ONE : BooleanFunction::Value::ZERO);
-        }
-        return this->constant == bv_value;
+        const u64 mask = (this->size >= 64) ? ~u64(0) : ((u64(1) << this->size) - 1);
+        return this->m_payload == (value & mask);
     }
 
     Result<std::vector<BooleanFunction::Value>> BooleanFunction::Node::get_constant_value() const
@@ -1785,7 +1964,7 @@ namespace hal
             return ERR("Node is not a constant");
         }
 
-        return OK(this->constant);
+        return OK(this->constant());
     }
 
     Result<u64> BooleanFunction::Node::get_constant_value_u64() const
@@ -1800,19 +1979,13 @@ namespace hal
             return ERR("Node constant has size > 64");
         }
 
-        if (std::any_of(this->constant.begin(), this->constant.end(), [](auto v) { return v != BooleanFunction::Value::ONE && v != BooleanFunction::Value::ZERO; }))
+        // constants of up to 64 bits are only interned if they contain undefined or high-impedance bits
+        if (this->m_interned)
         {
             return ERR("Node constant is undefined or high-impedance");
         }
 
-        u64 val = 0;
-        for (auto it = this->constant.rbegin(); it != this->constant.rend(); it++)
-        {
-            val <<= 1;
-            val |= *it;
-        }
-
-        return OK(val);
+        return OK(this->m_payload);
     }
 
     bool BooleanFunction::Node::is_index() const
@@ -1842,7 +2015,7 @@ namespace hal
 
     bool BooleanFunction::Node::has_variable_name(const std::string& value) const
     {
-        return this->is_variable() && (this->variable == value);
+        return this->is_variable() && (this->variable() == value);
     }
 
     Result<std::string> BooleanFunction::Node::get_variable_name() const
@@ -1852,7 +2025,7 @@ namespace hal
             return ERR("Node is not a variable");
         }
 
-        return OK(this->variable);
+        return OK(this->variable());
     }
 
     bool BooleanFunction::Node::is_operation() const
@@ -1871,8 +2044,7 @@ namespace hal
                || (this->type == NodeType::Eq);
     }
 
-    BooleanFunction::Node::Node(u16 _type, u16 _size, std::vector<BooleanFunction::Value> _constant, u16 _index, std::string _variable)
-        : type(_type), size(_size), constant(_constant), index(_index), variable(_variable)
+    BooleanFunction::Node::Node(u16 _type, u16 _size, u16 _index, bool _interned, u64 _payload) : type(_type), size(_size), index(_index), m_interned(_interned), m_payload(_payload)
     {
     }
 
@@ -0,0 +1,471 @@
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace hal
+{
+    Result<std::unordered_map<std::string, u32>>
+        CompiledBooleanFunction::initialize_inputs(const std::set<std::string>& names, const std::vector<std::string>& variables, const std::vector<BooleanFunction::Node>& variable_nodes)
+    {
+        m_variables = variables.empty() ? std::vector<std::string>(names.begin(), names.end()) : variables;
+
+        std::unordered_map<std::string, u32> variable_to_index;
+        for (u32 i = 0; i < m_variables.size(); i++)
+        {
+            if (!variable_to_index.emplace(m_variables[i], i).second)
+            {
+                return ERR("variable '" + m_variables[i] + "' occurs more than once in the variable order");
+            }
+        }
+
+        m_variable_sizes = std::vector<u16>(m_variables.size(), 0);
+        for (const auto& node : variable_nodes)
+        {
+            const auto it = variable_to_index.find(node.variable());
+            if (it == variable_to_index.end())
+            {
+                return ERR("variable '" + node.variable() + "' is missing from the variable order");
+            }
+
+            u16& variable_size = m_variable_sizes[it->second];
+            if (variable_size != 0 && variable_size != node.size)
+            {
+                return ERR("variable '" + node.variable() + "' is used with different sizes");
+            }
+            variable_size = node.size;
+        }
+
+        std::unordered_map<std::string, u32> variable_offsets;
+        for (u32 i = 0; i < m_variables.size(); i++)
+        {
+            if (m_variable_sizes[i] == 0)
+            {
+                m_variable_sizes[i] = 1;
+            }
+            variable_offsets.emplace(m_variables[i], m_num_input_bits);
+            m_num_input_bits += m_variable_sizes[i];
+        }
+        m_registers.resize(m_num_input_bits, 0);
+
+        return OK(variable_offsets);
+    }
+
+    Result<CompiledBooleanFunction::Operand>
+        CompiledBooleanFunction::compile_node(const BooleanFunction::Node& node, const Operand* p, const std::unordered_map<std::string, u32>& variable_offsets)
+    {
+        if (node.is_constant())
+        {
+            Operand operand = {(u32)m_registers.size(), node.size, false, 0};
+            for (const auto value : node.constant())
+            {
+                if (value != BooleanFunction::Value::ZERO && value != BooleanFunction::Value::ONE)
+                {
+                    return ERR("constants with undefined or high-impedance values are not supported");
+                }
+                m_registers.push_back((value == BooleanFunction::Value::ONE) ? ~u64(0) : u64(0));
+            }
+            return OK(operand);
+        }
+        if (node.is_index())
+        {
+            return OK({0, node.size, true, node.index});
+        }
+        if (node.is_variable())
+        {
+            return OK({variable_offsets.at(node.variable()), node.size, false, 0});
+        }
+
+        const u16 arity         = node.get_arity();
+        Instruction instruction = {node.type, node.size, (u32)m_registers.size(), {0, 0, 0}, {0, 0, 0}, {0, 0}};
+        for (u16 i = 0; i < arity; i++)
+        {
+            instruction.src[i]      = p[i].offset;
+            instruction.src_size[i] = p[i].size;
+        }
+
+        bool valid = true;
+        switch (node.type)
+        {
+            case BooleanFunction::NodeType::Not:
+                valid = !p[0].is_index && p[0].size == node.size;
+                break;
+            case BooleanFunction::NodeType::Add:
+            case BooleanFunction::NodeType::Sub:
+                // mirror constant propagation, which truncates sums and differences of 33 to 64 bits to 32 bits
+                if (node.size > 32 && node.size <= 64)
+                {
+                    return ERR("arithmetic on " + std::to_string(node.size) + "-bit values is not supported");
+                }
+                [[fallthrough]];
+            case BooleanFunction::NodeType::And:
+            case BooleanFunction::NodeType::Or:
+            case BooleanFunction::NodeType::Xor:
+            case BooleanFunction::NodeType::Mul:
+                valid = !p[0].is_index && !p[1].is_index && p[0].size == node.size && p[1].size == node.size;
+                break;
+            case BooleanFunction::NodeType::Concat:
+                valid = !p[0].is_index && !p[1].is_index && p[0].size + p[1].size == node.size;
+                break;
+            case BooleanFunction::NodeType::Slice:
+                instruction.param[0] = p[1].index;
+                instruction.param[1] = p[2].index;
+                valid = !p[0].is_index && p[1].is_index && p[2].is_index && p[1].index <= p[2].index && p[2].index < p[0].size && node.size == p[2].index - p[1].index + 1;
+                break;
+            case BooleanFunction::NodeType::Zext:
+            case BooleanFunction::NodeType::Sext:
+                valid = !p[0].is_index && p[1].is_index && p[0].size > 0 && p[0].size <= node.size;
+                break;
+            case BooleanFunction::NodeType::Eq:
+            case BooleanFunction::NodeType::Sle:
+            case BooleanFunction::NodeType::Slt:
+            case BooleanFunction::NodeType::Ule:
+            case BooleanFunction::NodeType::Ult:
+                valid = !p[0].is_index && !p[1].is_index && p[0].size == p[1].size && p[0].size > 0 && node.size == 1;
+                break;
+            case BooleanFunction::NodeType::Ite:
+                valid = !p[0].is_index && !p[1].is_index && !p[2].is_index && p[0].size == 1 && p[1].size == node.size && p[2].size == node.size;
+                break;
+            default:
+                return ERR("operation '" + node.to_string() + "' is not supported");
+        }
+        if (!valid)
+        {
+            return ERR("invalid operands for operation '" + node.to_string() + "'");
+        }
+
+        m_registers.resize(m_registers.size() + node.size, 0);
+        m_program.push_back(instruction);
+        return OK({instruction.dst, node.size, false, 0});
+    }
+
+    Result<CompiledBooleanFunction> CompiledBooleanFunction::compile(const BooleanFunction& function, const std::vector<std::string>& variables)
+    {
+        if (function.is_empty())
+        {
+            return ERR("could not compile Boolean function: Boolean function is empty");
+        }
+
+        CompiledBooleanFunction compiled;
+
+        std::vector<BooleanFunction::Node> variable_nodes;
+        std::copy_if(function.get_nodes().begin(), function.get_nodes().end(), std::back_inserter(variable_nodes), [](const auto& node) { return node.is_variable(); });
+
+        const auto offsets_res = compiled.initialize_inputs(function.get_variable_names(), variables, variable_nodes);
+        if (offsets_res.is_error())
+        {
+            return ERR_APPEND(offsets_res.get_error(), "could not compile Boolean function '" + function.to_string() + "'");
+        }
+        const auto variable_offsets = offsets_res.get();
+
+        // translate the nodes in reverse polish notation into instructions that each write to a freshly allocated register range
+        std::vector<Operand> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            const u16 arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not compile Boolean function '" + function.to_string() + "': Boolean function is malformed");
+            }
+
+            const auto operand_res = compiled.compile_node(node, stack.data() + stack.size() - arity, variable_offsets);
+            if (operand_res.is_error())
+            {
+                return ERR_APPEND(operand_res.get_error(), "could not compile Boolean function '" + function.to_string() + "'");
+            }
+            stack.resize(stack.size() - arity);
+            stack.push_back(operand_res.get());
+        }
+
+        if (stack.size() != 1 || stack.back().is_index)
+        {
+            return ERR("could not compile Boolean function '" + function.to_string() + "': Boolean function is malformed");
+        }
+
+        compiled.m_output = stack.back().offset;
+        compiled.m_size   = stack.back().size;
+
+        return OK(std::move(compiled));
+    }
+
+    Result<CompiledBooleanFunction> CompiledBooleanFunction::compile(const SharedExpression& expression, const std::vector<std::string>& variables)
+    {
+        if (expression.is_empty())
+        {
+            return ERR("could not compile shared expression: expression is empty");
+        }
+
+        // (1) collect all distinct sub-expressions in post-order, i.e., operands before the expressions using them
+        std::vector<SharedExpression> order;
+        std::vector<BooleanFunction::Node> variable_nodes;
+        {
+            std::unordered_set<SharedExpression> visited;
+            std::vector<std::pair<SharedExpression, bool>> stack = {{expression, false}};
+            while (!stack.empty())
+            {
+                auto [current, expanded] = stack.back();
+                stack.pop_back();
+                if (expanded)
+                {
+                    order.push_back(current);
+                    continue;
+                }
+                if (!visited.insert(current).second)
+                {
+                    continue;
+                }
+                if (current.get_node().is_variable())
+                {
+                    variable_nodes.push_back(current.get_node());
+                }
+                stack.emplace_back(current, true);
+                for (auto& operand : current.get_operands())
+                {
+                    stack.emplace_back(std::move(operand), false);
+                }
+            }
+        }
+
+        CompiledBooleanFunction compiled;
+
+        const auto offsets_res = compiled.initialize_inputs(expression.get_variable_names(), variables, variable_nodes);
+        if (offsets_res.is_error())
+        {
+            return ERR_APPEND(offsets_res.get_error(), "could not compile shared expression");
+        }
+        const auto variable_offsets = offsets_res.get();
+
+        // (2) compile every distinct sub-expression once
+        std::unordered_map<SharedExpression, Operand> compiled_operands;
+        std::vector<Operand> operands;
+        for (const auto& current : order)
+        {
+            operands.clear();
+            for (const auto& operand : current.get_operands())
+            {
+                operands.push_back(compiled_operands.at(operand));
+            }
+
+            const auto operand_res = compiled.compile_node(current.get_node(), operands.data(), variable_offsets);
+            if (operand_res.is_error())
+            {
+                return ERR_APPEND(operand_res.get_error(), "could not compile shared expression");
+            }
+            compiled_operands.emplace(current, operand_res.get());
+        }
+
+        const auto& result = compiled_operands.at(expression);
+        if (result.is_index)
+        {
+            return ERR("could not compile shared expression: expression is an index");
+        }
+
+        compiled.m_output = result.offset;
+        compiled.m_size   = result.size;
+
+        return OK(std::move(compiled));
+    }
+
+    const std::vector<std::string>& CompiledBooleanFunction::get_variables() const
+    {
+        return m_variables;
+    }
+
+    const std::vector<u16>& CompiledBooleanFunction::get_variable_sizes() const
+    {
+        return m_variable_sizes;
+    }
+
+    u32 CompiledBooleanFunction::get_num_input_bits() const
+    {
+        return m_num_input_bits;
+    }
+
+    u16 CompiledBooleanFunction::size() const
+    {
+        return m_size;
+    }
+
+    void CompiledBooleanFunction::evaluate(const u64* inputs, u64* outputs) const
+    {
+        u64* r = m_registers.data();
+        std::copy(inputs, inputs + m_num_input_bits, r);
+
+        for (const auto& ins : m_program)
+        {
+            u64* dst      = r + ins.dst;
+            const u64* p0 = r + ins.src[0];
+            const u64* p1 = r + ins.src[1];
+            const u64* p2 = r + ins.src[2];
+
+            switch (ins.type)
+            {
+                case BooleanFunction::NodeType::And:
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        dst[i] = p0[i] & p1[i];
+                    }
+                    break;
+                case BooleanFunction::NodeType::Or:
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        dst[i] = p0[i] | p1[i];
+                    }
+                    break;
+                case BooleanFunction::NodeType::Not:
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        dst[i] = ~p0[i];
+                    }
+                    break;
+                case BooleanFunction::NodeType::Xor:
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        dst[i] = p0[i] ^ p1[i];
+                    }
+                    break;
+                case BooleanFunction::NodeType::Add:
+                case BooleanFunction::NodeType::Sub: {
+                    // ripple-carry adder, subtraction is computed as p0 + ~p1 + 1
+                    const u64 invert = (ins.type == BooleanFunction::NodeType::Sub) ? ~u64(0) : u64(0);
+                    u64 carry        = invert;
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        const u64 a = p0[i];
+                        const u64 b = p1[i] ^ invert;
+                        const u64 x = a ^ b;
+                        dst[i]      = x ^ carry;
+                        carry       = (a & b) | (x & carry);
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::Mul: {
+                    // shift-and-add multiplier truncated to the operand size
+                    std::fill(dst, dst + ins.size, 0);
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        u64 carry = 0;
+                        for (u16 j = 0; j < ins.size - i; j++)
+                        {
+                            const u64 a = dst[i + j];
+                            const u64 b = p0[i] & p1[j];
+                            const u64 x = a ^ b;
+                            dst[i + j]  = x ^ carry;
+                            carry       = (a & b) | (x & carry);
+                        }
+                    }
+                    break;
+                }
+                case BooleanFunction::NodeType::Concat:
+                    std::copy(p1, p1 + ins.src_size[1], dst);
+                    std::copy(p0, p0 + ins.src_size[0], dst + ins.src_size[1]);
+                    break;
+                case BooleanFunction::NodeType::Slice:
+                    std::copy(p0 + ins.param[0], p0 + ins.param[0] + ins.size, dst);
+                    break;
+                case BooleanFunction::NodeType::Zext:
+                case BooleanFunction::NodeType::Sext: {
+                    const u64 extension = (ins.type == BooleanFunction::NodeType::Sext) ? p0[ins.src_size[0] - 1] : u64(0);
+                    std::copy(p0, p0 + ins.src_size[0], dst);
+                    std::fill(dst + ins.src_size[0], dst + ins.size, extension);
+                    break;
+                }
+                case BooleanFunction::NodeType::Eq: {
+                    u64 differ = 0;
+                    for (u16 i = 0; i < ins.src_size[0]; i++)
+                    {
+                        differ |= p0[i] ^ p1[i];
+                    }
+                    dst[0] = ~differ;
+                    break;
+                }
+                case BooleanFunction::NodeType::Sle:
+                case BooleanFunction::NodeType::Slt:
+                case BooleanFunction::NodeType::Ule:
+                case BooleanFunction::NodeType::Ult: {
+                    // compare from the least significant bit upwards, more significant bits override the result whenever they differ
+                    const bool is_signed = (ins.type == BooleanFunction::NodeType::Sle || ins.type == BooleanFunction::NodeType::Slt);
+                    u64 less             = (ins.type == BooleanFunction::NodeType::Sle || ins.type == BooleanFunction::NodeType::Ule) ? ~u64(0) : u64(0);
+                    const u16 msb        = ins.src_size[0] - 1;
+                    for (u16 i = 0; i <= msb; i++)
+                    {
+                        const u64 equal = ~(p0[i] ^ p1[i]);
+                        const u64 lower = (is_signed && i == msb) ? (p0[i] & ~p1[i]) : (~p0[i] & p1[i]);
+                        less            = lower | (equal & less);
+                    }
+                    dst[0] = less;
+                    break;
+                }
+                case BooleanFunction::NodeType::Ite: {
+                    const u64 condition = p0[0];
+                    for (u16 i = 0; i < ins.size; i++)
+                    {
+                        dst[i] = (condition & p1[i]) | (~condition & p2[i]);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        std::copy(r + m_output, r + m_output + m_size, outputs);
+    }
+
+    Result<std::vector<u64>> CompiledBooleanFunction::evaluate(const std::vector<u64>& inputs) const
+    {
+        if (inputs.size() != m_num_input_bits)
+        {
+            return ERR("could not evaluate compiled Boolean function: expected " + std::to_string(m_num_input_bits) + " input words but got " + std::to_string(inputs.size()));
+        }
+
+        std::vector<u64> outputs(m_size);
+        evaluate(inputs.data(), outputs.data());
+        return OK(outputs);
+    }
+
+    Result<std::vector<std::vector<BooleanFunction::Value>>> CompiledBooleanFunction::compute_truth_table() const
+    {
+        if (std::any_of(m_variable_sizes.begin(), m_variable_sizes.end(), [](u16 size) { return size != 1; }))
+        {
+            return ERR("could not compute truth table of compiled Boolean function: unable to generate a truth-table for Boolean function with variables of > 1-bit");
+        }
+        if (m_variables.size() > 32)
+        {
+            return ERR("could not compute truth table of compiled Boolean function: unable to generate truth-table with more than 32 variables");
+        }
+
+        // lane patterns of the first six variables within a block of 64 rows
+        static constexpr u64 lane_patterns[6] = {0xAAAAAAAAAAAAAAAA, 0xCCCCCCCCCCCCCCCC, 0xF0F0F0F0F0F0F0F0, 0xFF00FF00FF00FF00, 0xFFFF0000FFFF0000, 0xFFFFFFFF00000000};
+
+        const u32 num_variables = m_variables.size();
+        const u64 num_rows      = u64(1) << num_variables;
+
+        std::vector<std::vector<BooleanFunction::Value>> truth_table(m_size, std::vector<BooleanFunction::Value>(num_rows, BooleanFunction::Value::ZERO));
+        std::vector<u64> inputs(num_variables);
+        std::vector<u64> outputs(m_size);
+
+        for (u64 block = 0; block * num_lanes < num_rows; block++)
+        {
+            for (u32 i = 0; i < num_variables; i++)
+            {
+                inputs[i] = (i < 6) ? lane_patterns[i] : (((block >> (i - 6)) & 1) ? ~u64(0) : u64(0));
+            }
+
+            evaluate(inputs.data(), outputs.data());
+
+            const u64 base      = block * num_lanes;
+            const u32 num_valid = (u32)std::min<u64>(num_lanes, num_rows - base);
+            for (u16 k = 0; k < m_size; k++)
+            {
+                auto& column = truth_table[k];
+                for (u32 lane = 0; lane < num_valid; lane++)
+                {
+                    column[base + lane] = static_cast<BooleanFunction::Value>((outputs[k] >> lane) & 1);
+                }
+            }
+        }
+
+        return OK(truth_table);
+    }
+}    // namespace hal
@@ -0,0 +1,447 @@
+#include "hal_core/netlist/boolean_function/expression_store.h"
+
+#include <array>
+#include <limits>
+#include <unordered_map>
+
+namespace hal
+{
+    struct SharedExpression::Entry
+    {
+        BooleanFunction::Node node;
+        std::array<Entry*, 3> operands{};
+        u16 arity{};
+        u32 references{};
+        std::size_t hash{};
+        ExpressionStore* store{};
+    };
+
+    namespace
+    {
+        std::size_t compute_entry_hash(const BooleanFunction::Node& node, const std::array<SharedExpression::Entry*, 3>& operands, u16 arity)
+        {
+            std::size_t h = node.hash();
+            for (u16 i = 0; i < arity; i++)
+            {
+                h ^= std::hash<const void*>{}(operands[i]) + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+            }
+            return h;
+        }
+    }    // namespace
+
+    SharedExpression::SharedExpression(Entry* entry) : m_entry(entry)
+    {
+        if (m_entry != nullptr)
+        {
+            m_entry->references++;
+        }
+    }
+
+    SharedExpression::SharedExpression(const SharedExpression& other) : SharedExpression(other.m_entry)
+    {
+    }
+
+    SharedExpression::SharedExpression(SharedExpression&& other) noexcept : m_entry(other.m_entry)
+    {
+        other.m_entry = nullptr;
+    }
+
+    SharedExpression& SharedExpression::operator=(const SharedExpression& other)
+    {
+        if (m_entry != other.m_entry)
+        {
+            SharedExpression tmp(other);
+            std::swap(m_entry, tmp.m_entry);
+        }
+        return *this;
+    }
+
+    SharedExpression& SharedExpression::operator=(SharedExpression&& other) noexcept
+    {
+        if (this != &other)
+        {
+            SharedExpression tmp(std::move(other));
+            std::swap(m_entry, tmp.m_entry);
+        }
+        return *this;
+    }
+
+    SharedExpression::~SharedExpression()
+    {
+        if (m_entry != nullptr && --m_entry->references == 0)
+        {
+            m_entry->store->release(m_entry);
+        }
+    }
+
+    bool SharedExpression::operator==(const SharedExpression& other) const
+    {
+        return m_entry == other.m_entry;
+    }
+
+    bool SharedExpression::operator!=(const SharedExpression& other) const
+    {
+        return m_entry != other.m_entry;
+    }
+
+    bool SharedExpression::is_empty() const
+    {
+        return m_entry == nullptr;
+    }
+
+    const BooleanFunction::Node& SharedExpression::get_node() const
+    {
+        return m_entry->node;
+    }
+
+    u16 SharedExpression::size() const
+    {
+        return (m_entry != nullptr) ? m_entry->node.size : 0;
+    }
+
+    std::vector<SharedExpression> SharedExpression::get_operands() const
+    {
+        std::vector<SharedExpression> operands;
+        if (m_entry != nullptr)
+        {
+            operands.reserve(m_entry->arity);
+            for (u16 i = 0; i < m_entry->arity; i++)
+            {
+                operands.push_back(SharedExpression(m_entry->operands[i]));
+            }
+        }
+        return operands;
+    }
+
+    u64 SharedExpression::get_num_unique_nodes() const
+    {
+        if (m_entry == nullptr)
+        {
+            return 0;
+        }
+
+        std::unordered_set<const Entry*> visited = {m_entry};
+        std::vector<const Entry*> stack          = {m_entry};
+        while (!stack.empty())
+        {
+            const Entry* current = stack.back();
+            stack.pop_back();
+            for (u16 i = 0; i < current->arity; i++)
+            {
+                if (visited.insert(current->operands[i]).second)
+                {
+                    stack.push_back(current->operands[i]);
+                }
+            }
+        }
+        return visited.size();
+    }
+
+    u64 SharedExpression::get_expanded_length() const
+    {
+        if (m_entry == nullptr)
+        {
+            return 0;
+        }
+
+        // post-order traversal so that the lengths of all operands are known before their parent is handled
+        std::unordered_map<const Entry*, u64> lengths;
+        std::vector<std::pair<const Entry*, bool>> stack = {{m_entry, false}};
+        while (!stack.empty())
+        {
+            auto [current, expanded] = stack.back();
+            stack.pop_back();
+            if (lengths.find(current) != lengths.end())
+            {
+                continue;
+            }
+
+            if (!expanded)
+            {
+                stack.emplace_back(current, true);
+                for (u16 i = 0; i < current->arity; i++)
+                {
+                    stack.emplace_back(current->operands[i], false);
+                }
+                continue;
+            }
+
+            u64 length = 1;
+            for (u16 i = 0; i < current->arity; i++)
+            {
+                const u64 operand_length = lengths.at(current->operands[i]);
+                length                   = (operand_length > std::numeric_limits<u64>::max() - length) ? std::numeric_limits<u64>::max() : length + operand_length;
+            }
+            lengths.emplace(current, length);
+        }
+        return lengths.at(m_entry);
+    }
+
+    std::set<std::string> SharedExpression::get_variable_names() const
+    {
+        std::set<std::string> names;
+        if (m_entry == nullptr)
+        {
+            return names;
+        }
+
+        std::unordered_set<const Entry*> visited = {m_entry};
+        std::vector<const Entry*> stack          = {m_entry};
+        while (!stack.empty())
+        {
+            const Entry* current = stack.back();
+            stack.pop_back();
+            if (current->node.is_variable())
+            {
+                names.insert(current->node.variable());
+            }
+            for (u16 i = 0; i < current->arity; i++)
+            {
+                if (visited.insert(current->operands[i]).second)
+                {
+                    stack.push_back(current->operands[i]);
+                }
+            }
+        }
+        return names;
+    }
+
+    Result<BooleanFunction> SharedExpression::to_boolean_function() const
+    {
+        if (m_entry == nullptr)
+        {
+            return ERR("could not convert expression to Boolean function: expression is empty");
+        }
+
+        // emit nodes in reverse polish notation, i.e., operands from left to right followed by their parent
+        std::vector<BooleanFunction::Node> nodes;
+        std::vector<std::pair<const Entry*, bool>> stack = {{m_entry, false}};
+        while (!stack.empty())
+        {
+            auto [current, expanded] = stack.back();
+            stack.pop_back();
+            if (expanded || current->arity == 0)
+            {
+                nodes.push_back(current->node);
+                continue;
+            }
+
+            stack.emplace_back(current, true);
+            for (u16 i = current->arity; i > 0; i--)
+            {
+                stack.emplace_back(current->operands[i - 1], false);
+            }
+        }
+
+        if (auto res = BooleanFunction::build(std::move(nodes)); res.is_error())
+        {
+            return ERR_APPEND(res.get_error(), "could not convert expression to Boolean function: failed to build Boolean function");
+        }
+        else
+        {
+            return res;
+        }
+    }
+
+    std::size_t SharedExpression::hash() const
+    {
+        return (m_entry != nullptr) ? m_entry->hash : 0;
+    }
+
+    std::size_t ExpressionStore::EntryHash::operator()(const SharedExpression::Entry* entry) const
+    {
+        return entry->hash;
+    }
+
+    bool ExpressionStore::EntryEqual::operator()(const SharedExpression::Entry* lhs, const SharedExpression::Entry* rhs) const
+    {
+        // operands are hash-consed themselves, hence comparing their addresses suffices
+        return lhs->arity == rhs->arity && lhs->operands == rhs->operands && lhs->node == rhs->node;
+    }
+
+    ExpressionStore::~ExpressionStore()
+    {
+        for (auto* entry : m_entries)
+        {
+            delete entry;
+        }
+    }
+
+    Result<SharedExpression> ExpressionStore::get_expression(const BooleanFunction::Node& node, const std::vector<SharedExpression>& operands)
+    {
+        const u16 arity = node.get_arity();
+        if (arity != operands.size())
+        {
+            return ERR("could not get expression for node '" + node.to_string() + "': expected " + std::to_string(arity) + " operands but got " + std::to_string(operands.size()));
+        }
+
+        SharedExpression::Entry key{node};
+        key.arity = arity;
+        for (u16 i = 0; i < arity; i++)
+        {
+            if (operands[i].m_entry == nullptr || operands[i].m_entry->store != this)
+            {
+                return ERR("could not get expression for node '" + node.to_string() + "': operand " + std::to_string(i) + " is empty or belongs to a different store");
+            }
+            key.operands[i] = operands[i].m_entry;
+        }
+        key.hash = compute_entry_hash(key.node, key.operands, key.arity);
+
+        if (const auto it = m_entries.find(&key); it != m_entries.end())
+        {
+            return OK(SharedExpression(*it));
+        }
+
+        auto* entry  = new SharedExpression::Entry(std::move(key));
+        entry->store = this;
+        for (u16 i = 0; i < arity; i++)
+        {
+            entry->operands[i]->references++;
+        }
+        m_entries.insert(entry);
+        return OK(SharedExpression(entry));
+    }
+
+    Result<SharedExpression> ExpressionStore::get_expression(const BooleanFunction& function)
+    {
+        if (function.is_empty())
+        {
+            return ERR("could not get expression for Boolean function: Boolean function is empty");
+        }
+
+        std::vector<SharedExpression> stack;
+        for (const auto& node : function.get_nodes())
+        {
+            const u16 arity = node.get_arity();
+            if (stack.size() < arity)
+            {
+                return ERR("could not get expression for Boolean function '" + function.to_string() + "': Boolean function is malformed");
+            }
+
+            std::vector<SharedExpression> operands(std::make_move_iterator(stack.end() - arity), std::make_move_iterator(stack.end()));
+            stack.resize(stack.size() - arity);
+
+            if (auto res = get_expression(node, operands); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not get expression for Boolean function '" + function.to_string() + "'");
+            }
+            else
+            {
+                stack.push_back(res.get());
+            }
+        }
+
+        if (stack.size() != 1)
+        {
+            return ERR("could not get expression for Boolean function '" + function.to_string() + "': Boolean function is malformed");
+        }
+        return OK(std::move(stack.back()));
+    }
+
+    Result<SharedExpression> ExpressionStore::substitute(const SharedExpression& expression, const std::map<std::string, SharedExpression>& substitutions)
+    {
+        if (expression.m_entry == nullptr || expression.m_entry->store != this)
+        {
+            return ERR("could not substitute variables: expression is empty or belongs to a different store");
+        }
+
+        for (const auto& [name, substitution] : substitutions)
+        {
+            if (substitution.m_entry == nullptr || substitution.m_entry->store != this)
+            {
+                return ERR("could not substitute variable '" + name + "': substitution is empty or belongs to a different store");
+            }
+        }
+
+        // post-order traversal that rewrites every distinct sub-expression at most once
+        std::unordered_map<const SharedExpression::Entry*, SharedExpression> rewritten;
+        std::vector<std::pair<SharedExpression::Entry*, bool>> stack = {{expression.m_entry, false}};
+        while (!stack.empty())
+        {
+            auto [current, expanded] = stack.back();
+            stack.pop_back();
+            if (rewritten.find(current) != rewritten.end())
+            {
+                continue;
+            }
+
+            if (current->node.is_variable())
+            {
+                const auto it = substitutions.find(current->node.variable());
+                if (it != substitutions.end() && it->second.size() != current->node.size)
+                {
+                    return ERR("could not substitute variable '" + it->first + "': variable has bit-size " + std::to_string(current->node.size) + ", but substitution has bit-size "
+                               + std::to_string(it->second.size()));
+                }
+                rewritten.emplace(current, (it != substitutions.end()) ? it->second : SharedExpression(current));
+                continue;
+            }
+
+            if (current->arity == 0)
+            {
+                rewritten.emplace(current, SharedExpression(current));
+                continue;
+            }
+
+            if (!expanded)
+            {
+                stack.emplace_back(current, true);
+                for (u16 i = 0; i < current->arity; i++)
+                {
+                    stack.emplace_back(current->operands[i], false);
+                }
+                continue;
+            }
+
+            bool changed = false;
+            std::vector<SharedExpression> operands;
+            operands.reserve(current->arity);
+            for (u16 i = 0; i < current->arity; i++)
+            {
+                const auto& operand = rewritten.at(current->operands[i]);
+                changed |= (operand.m_entry != current->operands[i]);
+                operands.push_back(operand);
+            }
+
+            if (!changed)
+            {
+                rewritten.emplace(current, SharedExpression(current));
+            }
+            else if (auto res = get_expression(current->node, operands); res.is_error())
+            {
+                return ERR_APPEND(res.get_error(), "could not substitute variables");
+            }
+            else
+            {
+                rewritten.emplace(current, res.get());
+            }
+        }
+
+        return OK(rewritten.at(expression.m_entry));
+    }
+
+    u64 ExpressionStore::size() const
+    {
+        return m_entries.size();
+    }
+
+    void ExpressionStore::release(SharedExpression::Entry* entry)
+    {
+        // release iteratively to avoid deep recursion on long operand chains
+        std::vector<SharedExpression::Entry*> stack = {entry};
+        while (!stack.empty())
+        {
+            SharedExpression::Entry* current = stack.back();
+            stack.pop_back();
+            m_entries.erase(current);
+            for (u16 i = 0; i < current->arity; i++)
+            {
+                if (--current->operands[i]->references == 0)
+                {
+                    stack.push_back(current->operands[i]);
+                }
+            }
+            delete current;
+        }
+    }
+}    // namespace hal
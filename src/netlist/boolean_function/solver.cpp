@@ -475,7 +475,7 @@ namespace hal
                         {
                             if (node.is_variable())
                             {
-                                inputs.insert(std::make_tuple(node.variable, node.size));
+                                inputs.insert(std::make_tuple(node.variable(), node.size));
                             }
                         }
                     }
@@ -485,7 +485,7 @@ namespace hal
                         {
                             if (node.is_variable())
                             {
-                                inputs.insert(std::make_tuple(node.variable, node.size));
+                                inputs.insert(std::make_tuple(node.variable(), node.size));
                             }
                         }
                     }
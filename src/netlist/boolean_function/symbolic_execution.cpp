@@ -561,13 +561,13 @@ namespace hal
             switch (node.type)
             {
                 case BooleanFunction::NodeType::Constant: {
-                    return OK(BooleanFunction::Const(node.constant));
+                    return OK(BooleanFunction::Const(node.constant()));
                 }
                 case BooleanFunction::NodeType::Index: {
                     return OK(BooleanFunction::Index(node.index, node.size));
                 }
                 case BooleanFunction::NodeType::Variable: {
-                    return OK(this->state.get(BooleanFunction::Var(node.variable, node.size)));
+                    return OK(this->state.get(BooleanFunction::Var(node.variable(), node.size)));
                 }
                 case BooleanFunction::NodeType::And: {
                     // X & 0   =>   0
@@ -1290,7 +1290,7 @@ namespace hal
             std::vector<std::vector<BooleanFunction::Value>> values;
             for (const auto& parameter : p)
             {
-                values.emplace_back(parameter.get_top_level_node().constant);
+                values.emplace_back(parameter.get_top_level_node().constant());
             }
 
             switch (node.type)
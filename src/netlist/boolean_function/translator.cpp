@@ -60,7 +60,7 @@ namespace hal
                 switch (node.type)
                 {
                     case BooleanFunction::NodeType::Constant: {
-                        if (auto str = const2str(node.constant); str.is_ok())
+                        if (auto str = const2str(node.constant()); str.is_ok())
                         {
                             return OK(std::string("(_ bv") + str.get() + " " + std::to_string(node.size) + ")");
                         }
@@ -70,7 +70,7 @@ namespace hal
                     case BooleanFunction::NodeType::Index:
                         return OK(std::to_string(node.index));
                     case BooleanFunction::NodeType::Variable:
-                        return OK(node.variable);
+                        return OK(node.variable());
 
                     case BooleanFunction::NodeType::And:
                         return OK("(bvand " + p[0] + " " + p[1] + ")");
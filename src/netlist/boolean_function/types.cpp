@@ -266,7 +266,7 @@ namespace hal
             {
                 if (node.is_variable())
                 {
-                    const auto var_name = node.variable;
+                    const auto var_name = node.variable();
                     if (auto it = model.find(var_name); it != model.end())
                     {
                         const auto constant = BooleanFunction::Const(std::get<0>(it->second), std::get<1>(it->second));
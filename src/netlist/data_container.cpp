@@ -1,12 +1,143 @@
 #include "hal_core/netlist/data_container.h"
 
+#include "hal_core/utilities/intern_table.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+#include <mutex>
+
 namespace hal
 {
+    namespace
+    {
+        InternTable<std::string>& get_string_table()
+        {
+            // categories, keys, and data types are shared by all data containers of all netlists
+            // the table is never destroyed so that data containers of static objects can still release it on exit, its contents are freed once no data container holds an entry
+            static auto* table = new InternTable<std::string>();
+            return *table;
+        }
+
+        struct StringTableUsers
+        {
+            std::mutex mutex;
+            u64 count = 0;
+        };
+
+        StringTableUsers& get_string_table_users()
+        {
+            static auto* users = new StringTableUsers();
+            return *users;
+        }
+
+        // must be called before a data container that holds no entries interns its first entry
+        void acquire_string_table()
+        {
+            auto& users = get_string_table_users();
+            std::lock_guard<std::mutex> lock(users.mutex);
+            users.count++;
+        }
+
+        // must be called once a data container that held entries holds no entries anymore
+        void release_string_table()
+        {
+            auto& users = get_string_table_users();
+            std::lock_guard<std::mutex> lock(users.mutex);
+            if (--users.count == 0)
+            {
+                get_string_table().clear();
+            }
+        }
+
+        struct EntryOrder
+        {
+            template<typename Entry>
+            bool operator()(const Entry& entry, const std::pair<u32, u32>& id) const
+            {
+                return std::make_pair(entry.category, entry.key) < id;
+            }
+        };
+
+        template<typename Entries>
+        auto find_entry(Entries& data, const std::string& category, const std::string& key) -> decltype(data.begin())
+        {
+            if (data.empty())
+            {
+                return data.end();
+            }
+
+            // a category or key that has never been interned cannot be part of any entry
+            const auto& table      = get_string_table();
+            const auto category_id = table.find(category);
+            const auto key_id      = table.find(key);
+            if (!category_id.has_value() || !key_id.has_value())
+            {
+                return data.end();
+            }
+
+            const std::pair<u32, u32> id = {category_id.value(), key_id.value()};
+            const auto it                = std::lower_bound(data.begin(), data.end(), id, EntryOrder());
+            if (it != data.end() && it->category == id.first && it->key == id.second)
+            {
+                return it;
+            }
+            return data.end();
+        }
+    }    // namespace
+
+    DataContainer::DataContainer(const DataContainer& other) : m_data(other.m_data)
+    {
+        if (!m_data.empty())
+        {
+            acquire_string_table();
+        }
+    }
+
+    DataContainer& DataContainer::operator=(const DataContainer& other)
+    {
+        if (this != &other)
+        {
+            if (m_data.empty() && !other.m_data.empty())
+            {
+                acquire_string_table();
+            }
+            const bool was_empty = m_data.empty();
+            m_data               = other.m_data;
+            m_data_revision++;
+            if (!was_empty && m_data.empty())
+            {
+                release_string_table();
+            }
+        }
+        return *this;
+    }
+
+    DataContainer::~DataContainer()
+    {
+        if (!m_data.empty())
+        {
+            release_string_table();
+        }
+    }
+
     bool DataContainer::operator==(const DataContainer& other) const
     {
-        return m_data == other.get_data_map();
+        if (m_data.size() != other.m_data.size())
+        {
+            return false;
+        }
+
+        // both containers are sorted by the same identifiers
+        for (u32 i = 0; i < m_data.size(); i++)
+        {
+            const Entry& a = m_data[i];
+            const Entry& b = other.m_data[i];
+            if (a.category != b.category || a.key != b.key || a.data_type != b.data_type || a.value != b.value)
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     bool DataContainer::operator!=(const DataContainer& other) const
@@ -22,7 +153,26 @@ namespace hal
             return false;
         }
 
-        m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
+        if (m_data.empty())
+        {
+            acquire_string_table();
+        }
+
+        auto& table                  = get_string_table();
+        const std::pair<u32, u32> id = {table.intern(category), table.intern(key)};
+        const u32 data_type          = table.intern(value_data_type);
+
+        auto it = std::lower_bound(m_data.begin(), m_data.end(), id, EntryOrder());
+        if (it != m_data.end() && it->category == id.first && it->key == id.second)
+        {
+            it->data_type = data_type;
+            it->value     = value;
+        }
+        else
+        {
+            m_data.insert(it, Entry{id.first, id.second, data_type, value});
+        }
+        m_data_revision++;
 
         //notify_updated();
 
@@ -46,15 +196,20 @@ namespace hal
             return false;
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
+        auto it = find_entry(m_data, category, key);
         if (it == m_data.end())
         {
             log_debug("netlist", "no key ('{}', '{}') found.", category, key);
             return true;
         }
 
-        auto deleted_value = std::get<1>(it->second);
+        auto deleted_value = std::move(it->value);
         m_data.erase(it);
+        m_data_revision++;
+        if (m_data.empty())
+        {
+            release_string_table();
+        }
 
         //notify_updated();
 
@@ -69,14 +224,40 @@ namespace hal
         return true;
     }
 
-    const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& DataContainer::get_data_map() const
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> DataContainer::get_data_map() const
     {
-        return m_data;
+        const auto& table = get_string_table();
+
+        std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> map;
+        for (const Entry& entry : m_data)
+        {
+            map.emplace(std::make_tuple(table.get(entry.category), table.get(entry.key)), std::make_tuple(table.get(entry.data_type), entry.value));
+        }
+        return map;
     }
 
     void DataContainer::set_data_map(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& map)
     {
-        m_data = map;
+        const bool was_empty = m_data.empty();
+        if (was_empty && !map.empty())
+        {
+            acquire_string_table();
+        }
+
+        auto& table = get_string_table();
+
+        m_data.clear();
+        m_data.reserve(map.size());
+        for (const auto& [id, content] : map)
+        {
+            m_data.push_back(Entry{table.intern(std::get<0>(id)), table.intern(std::get<1>(id)), table.intern(std::get<0>(content)), std::get<1>(content)});
+        }
+        std::sort(m_data.begin(), m_data.end(), [](const Entry& a, const Entry& b) { return std::tie(a.category, a.key) < std::tie(b.category, b.key); });
+        m_data_revision++;
+        if (!was_empty && m_data.empty())
+        {
+            release_string_table();
+        }
     }
 
     bool DataContainer::has_data(const std::string& category, const std::string& key) const
@@ -86,12 +267,7 @@ namespace hal
             return false;
         }
 
-        if (auto it = m_data.find(std::make_tuple(category, key)); it == m_data.end())
-        {
-            return false;
-        }
-
-        return true;
+        return find_entry(m_data, category, key) != m_data.end();
     }
 
     std::tuple<std::string, std::string> DataContainer::get_data(const std::string& category, const std::string& key) const
@@ -102,13 +278,13 @@ namespace hal
             return std::make_tuple("", "");
         }
 
-        auto it = m_data.find(std::make_tuple(category, key));
-        if (it == m_data.end())
+        if (const auto it = find_entry(m_data, category, key); it != m_data.end())
         {
-            log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
-            return std::make_tuple("", "");
+            return std::make_tuple(get_string_table().get(it->data_type), it->value);
         }
-        return it->second;
+
+        log_debug("netlist", "no value stored for key ('{}', '{}').", category, key);
+        return std::make_tuple("", "");
     }
 
 }    // namespace hal
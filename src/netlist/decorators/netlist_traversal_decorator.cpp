@@ -49,7 +49,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, previous.size() + 1))
                 {
@@ -175,7 +175,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, previous.size() + 1))
                 {
@@ -293,7 +293,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 if (max_depth != 0 && current_depth > max_depth)
                 {
@@ -394,7 +394,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 auto entry_pin = entry_ep->get_pin();
                 auto* gate     = entry_ep->get_gate();
@@ -530,7 +530,7 @@ namespace hal
         std::map<Gate*, std::set<Gate*>> seq_gate_map;
         std::unordered_map<const Net*, std::set<Gate*>> cache = {};
 
-        for (auto* sg : m_netlist.get_gates([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); }))
+        for (auto* sg : m_netlist.get_gates_view([](const Gate* g) { return g->get_type()->has_property(GateTypeProperty::sequential); }))
         {
             if (const auto res = this->get_next_sequential_gates(sg, successors, forbidden_pins, &cache); res.is_ok())
             {
@@ -576,7 +576,7 @@ namespace hal
             visited.insert(current);
 
             bool added = false;
-            for (const auto* entry_ep : successors ? current->get_destinations() : current->get_sources())
+            for (const auto* entry_ep : successors ? current->get_destinations_view() : current->get_sources_view())
             {
                 auto* gate            = entry_ep->get_gate();
                 const auto* entry_pin = entry_ep->get_pin();
@@ -729,7 +729,7 @@ namespace hal
                             continue;
                         }
 
-                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations() : exit_ep->get_net()->get_sources())
+                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations_view() : exit_ep->get_net()->get_sources_view())
                         {
                             if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, distance))
                             {
@@ -864,7 +864,7 @@ namespace hal
                             continue;
                         }
 
-                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations() : exit_ep->get_net()->get_sources())
+                        for (const auto& entry_ep : (direction == PinDirection::output) ? exit_ep->get_net()->get_destinations_view() : exit_ep->get_net()->get_sources_view())
                         {
                             if (entry_endpoint_filter != nullptr && !entry_endpoint_filter(entry_ep, distance))
                             {
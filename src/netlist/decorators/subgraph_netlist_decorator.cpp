@@ -287,6 +287,104 @@ namespace hal
             return OK(bf);
         }
 
+        Result<SharedExpression> subgraph_expression_recursive(ExpressionStore& store,
+                                                               const Net* n,
+                                                               const std::vector<const Gate*>& subgraph_gates,
+                                                               std::map<std::pair<u32, const GatePin*>, SharedExpression>& gate_cache,
+                                                               std::unordered_set<const Net*>& on_stack)
+        {
+            if (on_stack.find(n) != on_stack.end())
+            {
+                return ERR("could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": subgraph contains a cycle!");
+            }
+
+            const std::vector<Endpoint*> sources = n->get_sources();
+
+            // net is multi driven
+            if (sources.size() > 1)
+            {
+                return ERR("could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot handle multi driven nets! Encountered at net "
+                           + std::to_string(n->get_id()) + ".");
+            }
+
+            // net has no source or source is not in subgraph gates
+            if (sources.empty() || (sources.front()->get_gate() != nullptr && std::find(subgraph_gates.begin(), subgraph_gates.end(), sources.front()->get_gate()) == subgraph_gates.end()))
+            {
+                const auto net_dec = BooleanFunctionNetDecorator(*n);
+                return store.get_expression(net_dec.get_boolean_variable());
+            }
+
+            const Endpoint* src_ep = sources.front();
+
+            if (src_ep->get_gate() == nullptr)
+            {
+                return ERR("could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": gate at source for net " + std::to_string(n->get_id())
+                           + " is null.");
+            }
+
+            const Gate* src_gate = src_ep->get_gate();
+
+            if (const auto it = gate_cache.find({src_gate->get_id(), src_ep->get_pin()}); it != gate_cache.end())
+            {
+                return OK(it->second);
+            }
+
+            const auto bf_res = src_gate->get_resolved_boolean_function(src_ep->get_pin());
+            if (bf_res.is_error())
+            {
+                return ERR_APPEND(bf_res.get_error(), "could not get subgraph expression of net " + n->get_name() + " with ID " + std::to_string(n->get_id()) + ": failed to get function of gate.");
+            }
+            BooleanFunction gate_func = bf_res.get().simplify_local();
+
+            on_stack.insert(n);
+
+            std::map<std::string, SharedExpression> input_to_expr;
+
+            for (const std::string& in_net_str : gate_func.get_variable_names())
+            {
+                auto in_net_res = BooleanFunctionNetDecorator::get_net_from(src_gate->get_netlist(), in_net_str);
+                if (in_net_res.is_error())
+                {
+                    return ERR_APPEND(in_net_res.get_error(),
+                                      "could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": cannot find in_net " + in_net_str + " at gate "
+                                          + std::to_string(src_gate->get_id()) + "!");
+                }
+
+                auto input_expr_res = subgraph_expression_recursive(store, in_net_res.get(), subgraph_gates, gate_cache, on_stack);
+                if (input_expr_res.is_error())
+                {
+                    // NOTE since this can lead to a deep recursion we dont append the error and instead just forward this.
+                    return input_expr_res;
+                }
+
+                input_to_expr.insert({in_net_str, input_expr_res.get()});
+            }
+
+            auto gate_expr_res = store.get_expression(gate_func);
+            if (gate_expr_res.is_error())
+            {
+                return ERR_APPEND(gate_expr_res.get_error(),
+                                  "could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": failed to create expression for gate function "
+                                      + gate_func.to_string() + ".");
+            }
+
+            auto res = store.substitute(gate_expr_res.get(), input_to_expr);
+            if (res.is_error())
+            {
+                return ERR_APPEND(res.get_error(),
+                                  "could not get subgraph expression of net '" + n->get_name() + "' with ID " + std::to_string(n->get_id()) + ": failed to substitute inputs for gate function "
+                                      + gate_func.to_string() + ".");
+            }
+
+            on_stack.erase(n);
+
+            auto expr = res.get();
+
+            gate_cache.insert({{src_gate->get_id(), src_ep->get_pin()}, expr});
+
+            return OK(expr);
+        }
+
         Result<std::set<const Net*>> subgraph_function_inputs_recursive(const Net* n,
                                                                         const std::vector<const Gate*>& subgraph_gates,
                                                                         std::map<std::pair<u32, const GatePin*>, std::set<const Net*>>& gate_cache,
@@ -478,6 +576,57 @@ namespace hal
         }
     }
 
+    Result<SharedExpression> SubgraphNetlistDecorator::get_subgraph_expression(ExpressionStore& store,
+                                                                               const std::vector<const Gate*>& subgraph_gates,
+                                                                               const Net* subgraph_output,
+                                                                               std::map<std::pair<u32, const GatePin*>, SharedExpression>& cache) const
+    {
+        // check validity of subgraph_gates
+        if (subgraph_output == nullptr)
+        {
+            return ERR("could not get subgraph expression: net is a 'nullptr'");
+        }
+        else if (subgraph_gates.empty())
+        {
+            return ERR("could not get subgraph expression of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": subgraph contains no gates");
+        }
+        else if (std::any_of(subgraph_gates.begin(), subgraph_gates.end(), [](const Gate* g) { return g == nullptr; }))
+        {
+            return ERR("could not get subgraph expression of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id())
+                       + ": subgraph contains a gate that is a 'nullptr'");
+        }
+        else if (subgraph_output->get_num_of_sources() > 1)
+        {
+            return ERR("could not get subgraph expression of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has more than one source");
+        }
+        else if (subgraph_output->is_global_input_net())
+        {
+            const auto net_dec = BooleanFunctionNetDecorator(*subgraph_output);
+            return store.get_expression(net_dec.get_boolean_variable());
+        }
+        else if (subgraph_output->get_num_of_sources() == 0)
+        {
+            return ERR("could not get subgraph expression of net '" + subgraph_output->get_name() + "' with ID " + std::to_string(subgraph_output->get_id()) + ": net has no sources");
+        }
+
+        std::unordered_set<const Net*> on_stack;
+
+        return subgraph_expression_recursive(store, subgraph_output, subgraph_gates, cache, on_stack);
+    }
+
+    Result<SharedExpression> SubgraphNetlistDecorator::get_subgraph_expression(ExpressionStore& store, const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output) const
+    {
+        std::map<std::pair<u32, const GatePin*>, SharedExpression> cache;
+        if (auto res = get_subgraph_expression(store, subgraph_gates, subgraph_output, cache); res.is_error())
+        {
+            return ERR(res.get_error());
+        }
+        else
+        {
+            return res;
+        }
+    }
+
     Result<std::set<const Net*>> SubgraphNetlistDecorator::get_subgraph_function_inputs(const std::vector<const Gate*>& subgraph_gates, const Net* subgraph_output) const
     {
         // check validity of subgraph_gates
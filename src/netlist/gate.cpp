@@ -41,6 +41,56 @@ static u64 bitreverse(u64 n)
 
 namespace hal
 {
+    GateNeighborView::GateNeighborView(const std::vector<Endpoint*>& gate_endpoints, bool successors, Filter filter)
+        : m_begin(gate_endpoints.data()), m_end(gate_endpoints.data() + gate_endpoints.size()), m_successors(successors), m_filter(std::move(filter))
+    {
+    }
+
+    GateNeighborView::iterator::iterator(const GateNeighborView* view, bool is_end) : m_view(view)
+    {
+        if (is_end)
+        {
+            m_outer = view->m_end;
+            return;
+        }
+
+        m_outer = view->m_begin;
+        load_inner();
+        skip();
+    }
+
+    void GateNeighborView::iterator::load_inner()
+    {
+        if (m_outer == m_view->m_end)
+        {
+            m_inner     = nullptr;
+            m_inner_end = nullptr;
+            return;
+        }
+
+        const Net* net                          = (*m_outer)->get_net();
+        const std::vector<Endpoint*>& neighbors = m_view->m_successors ? net->m_destinations : net->m_sources;
+        m_inner                                 = neighbors.data();
+        m_inner_end                             = neighbors.data() + neighbors.size();
+    }
+
+    void GateNeighborView::iterator::skip()
+    {
+        while (m_outer != m_view->m_end)
+        {
+            for (; m_inner != m_inner_end; ++m_inner)
+            {
+                if (!m_view->m_filter || m_view->m_filter((*m_outer)->get_pin(), *m_inner))
+                {
+                    return;
+                }
+            }
+
+            ++m_outer;
+            load_inner();
+        }
+    }
+
     Gate::Gate(NetlistInternalManager* mgr, EventHandler* event_handler, const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
         : m_internal_manager(mgr), m_id(id), m_name(name), m_type(gt), m_x(x), m_y(y), m_event_handler(event_handler)
     {
@@ -369,17 +419,50 @@ namespace hal
     {
         UNUSED(pin);
 
+        if (const auto lut_function = get_cached_lut_function(); lut_function != nullptr)
+        {
+            return lut_function->function;
+        }
+        return BooleanFunction();
+    }
+
+    Result<u64> Gate::get_lut_truth_table() const
+    {
+        if (m_type->get_input_pins().size() > 6)
+        {
+            return ERR("could not get truth table of gate '" + m_name + "' with ID " + std::to_string(m_id) + ": gate has more than six input pins");
+        }
+
+        const auto lut_function = get_cached_lut_function();
+        if (lut_function == nullptr)
+        {
+            return ERR("could not get truth table of gate '" + m_name + "' with ID " + std::to_string(m_id) + ": gate is not a LUT or has an invalid configuration");
+        }
+        return OK(lut_function->truth_table);
+    }
+
+    std::shared_ptr<const CachedLUTFunction> Gate::get_cached_lut_function() const
+    {
+        // the function only has to be derived again if the INIT data may have changed
+        {
+            std::lock_guard<std::mutex> lock(m_internal_manager->m_lut_function_mutex);
+            if (m_lut_function != nullptr && m_lut_function_revision == m_data_revision)
+            {
+                return m_lut_function;
+            }
+        }
+
         LUTComponent* lut_component = m_type->get_component_as<LUTComponent>([](const GateTypeComponent* component) { return component->get_type() == GateTypeComponent::ComponentType::lut; });
         if (lut_component == nullptr)
         {
-            return BooleanFunction();
+            return nullptr;
         }
 
         InitComponent* init_component =
             lut_component->get_component_as<InitComponent>([](const GateTypeComponent* component) { return component->get_type() == GateTypeComponent::ComponentType::init; });
         if (init_component == nullptr)
         {
-            return BooleanFunction();
+            return nullptr;
         }
 
         const std::string& category  = init_component->get_init_category();
@@ -388,110 +471,112 @@ namespace hal
         auto is_ascending            = lut_component->is_init_ascending();
         std::vector<GatePin*> inputs = m_type->get_input_pins();
 
-        auto result = BooleanFunction::Const(BooleanFunction::Value::ZERO);
-
-        if (config_str.empty())
-        {
-            return result;
-        }
-
-        if (inputs.size() > 6)
-        {
-            log_error("gate", "LUT gate '{}' with ID {} in netlist with ID {} has more than six input pins, which is currently not supported.", m_name, m_id, m_internal_manager->m_netlist->get_id());
-            return BooleanFunction();
-        }
-
         u64 config = 0;
-        try
-        {
-            config = std::stoull(config_str, nullptr, 16);
-        }
-        catch (std::invalid_argument& ex)
+        if (!config_str.empty())
         {
-            log_error("gate",
-                      "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which is not a hex value.",
-                      m_name,
-                      m_id,
-                      m_internal_manager->m_netlist->get_id(),
-                      config_str);
-            return BooleanFunction();
-        }
-        catch (std::out_of_range& ex)
-        {
-            log_error("gate",
-                      "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which has to many hex digits.",
-                      m_name,
-                      m_id,
-                      m_internal_manager->m_netlist->get_id(),
-                      config_str);
-            return BooleanFunction();
-        }
-
-        u32 max_config_size = 1 << inputs.size();
+            if (inputs.size() > 6)
+            {
+                log_error("gate", "LUT gate '{}' with ID {} in netlist with ID {} has more than six input pins, which is currently not supported.", m_name, m_id, m_internal_manager->m_netlist->get_id());
+                return nullptr;
+            }
 
-        if (is_ascending)
-        {
-            config = bitreverse(config) >> (64 - max_config_size);
-        }
+            try
+            {
+                config = std::stoull(config_str, nullptr, 16);
+            }
+            catch (std::invalid_argument& ex)
+            {
+                log_error("gate",
+                          "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which is not a hex value.",
+                          m_name,
+                          m_id,
+                          m_internal_manager->m_netlist->get_id(),
+                          config_str);
+                return nullptr;
+            }
+            catch (std::out_of_range& ex)
+            {
+                log_error("gate",
+                          "LUT gate '{}' with ID {} in netlist with ID {} has invalid configuration string of '{}', which has to many hex digits.",
+                          m_name,
+                          m_id,
+                          m_internal_manager->m_netlist->get_id(),
+                          config_str);
+                return nullptr;
+            }
 
-        auto cache_key = std::make_pair(inputs, config);
-        auto& cache    = m_internal_manager->m_lut_function_cache;
+            u32 max_config_size = 1 << inputs.size();
 
-        if (auto it = cache.find(cache_key); it != cache.end())
-        {
-            return it->second;
-        }
+            if (is_ascending)
+            {
+                config = bitreverse(config) >> (64 - max_config_size);
+            }
 
-        u32 config_size = 0;
-        {
-            u64 tmp = config;
-            while (tmp != 0)
+            u32 config_size = 0;
             {
-                config_size++;
-                tmp >>= 1;
+                u64 tmp = config;
+                while (tmp != 0)
+                {
+                    config_size++;
+                    tmp >>= 1;
+                }
             }
-        }
 
-        if (config_size > max_config_size)
-        {
-            log_error("gate",
-                      "LUT gate '{}' with ID {} in netlist with ID {} supports a configuration string of up to {} bits, but '{}' comprises {} bits instead.",
-                      m_name,
-                      m_id,
-                      m_internal_manager->m_netlist->get_id(),
-                      max_config_size,
-                      config_str,
-                      config_str.size() * 4);
-            return BooleanFunction();
+            if (config_size > max_config_size)
+            {
+                log_error("gate",
+                          "LUT gate '{}' with ID {} in netlist with ID {} supports a configuration string of up to {} bits, but '{}' comprises {} bits instead.",
+                          m_name,
+                          m_id,
+                          m_internal_manager->m_netlist->get_id(),
+                          max_config_size,
+                          config_str,
+                          config_str.size() * 4);
+                return nullptr;
+            }
         }
 
-        for (u32 i = 0; config != 0 && i < max_config_size; i++)
+        // functions are shared among all gates of the same type with the same configuration
+        std::lock_guard<std::mutex> lock(m_internal_manager->m_lut_function_mutex);
+        auto& cache = m_internal_manager->m_lut_function_cache;
+        auto it     = cache.find(std::make_pair(m_type, config));
+        if (it == cache.end())
         {
-            u8 bit = (config & 1);
-            config >>= 1;
-            if (bit == 1)
+            auto result = BooleanFunction::Const(BooleanFunction::Value::ZERO);
+            u64 bits    = config;
+            for (u32 i = 0; bits != 0; i++)
             {
-                auto conjunction  = BooleanFunction::Const(1, 1);
-                auto input_values = i;
-                for (auto input : inputs)
+                u8 bit = (bits & 1);
+                bits >>= 1;
+                if (bit == 1)
                 {
-                    if ((input_values & 1) == 1)
-                    {
-                        conjunction &= BooleanFunction::Var(input->get_name());
-                    }
-                    else
+                    auto conjunction  = BooleanFunction::Const(1, 1);
+                    auto input_values = i;
+                    for (auto input : inputs)
                     {
-                        conjunction &= ~BooleanFunction::Var(input->get_name());
+                        if ((input_values & 1) == 1)
+                        {
+                            conjunction &= BooleanFunction::Var(input->get_name());
+                        }
+                        else
+                        {
+                            conjunction &= ~BooleanFunction::Var(input->get_name());
+                        }
+                        input_values >>= 1;
                     }
-                    input_values >>= 1;
+                    result |= conjunction;
                 }
-                result |= conjunction;
             }
+
+            auto lut_function         = std::make_shared<CachedLUTFunction>();
+            lut_function->truth_table = config;
+            lut_function->function    = result.simplify();
+            it                        = cache.emplace(std::make_pair(m_type, config), std::move(lut_function)).first;
         }
 
-        auto f           = result.simplify();
-        cache[cache_key] = f;
-        return f;
+        m_lut_function          = it->second;
+        m_lut_function_revision = m_data_revision;
+        return m_lut_function;
     }
 
     bool Gate::add_boolean_function(const std::string& name, const BooleanFunction& func)
@@ -614,6 +699,11 @@ namespace hal
         return res;
     }
 
+    FilterView<Net*> Gate::get_fan_in_nets_view(const std::function<bool(Net*)>& filter) const
+    {
+        return FilterView<Net*>(m_in_nets, filter);
+    }
+
     Net* Gate::get_fan_in_net(const std::string& pin_name) const
     {
         auto ep = get_fan_in_endpoint(pin_name);
@@ -676,6 +766,11 @@ namespace hal
         return res;
     }
 
+    FilterView<Endpoint*> Gate::get_fan_in_endpoints_view(const std::function<bool(Endpoint*)>& filter) const
+    {
+        return FilterView<Endpoint*>(m_in_endpoints, filter);
+    }
+
     Endpoint* Gate::get_fan_in_endpoint(const std::string& pin_name) const
     {
         const GatePin* pin = m_type->get_pin_by_name(pin_name);
@@ -758,6 +853,11 @@ namespace hal
         return res;
     }
 
+    FilterView<Net*> Gate::get_fan_out_nets_view(const std::function<bool(Net*)>& filter) const
+    {
+        return FilterView<Net*>(m_out_nets, filter);
+    }
+
     Net* Gate::get_fan_out_net(const std::string& pin_name) const
     {
         auto ep = get_fan_out_endpoint(pin_name);
@@ -820,6 +920,11 @@ namespace hal
         return res;
     }
 
+    FilterView<Endpoint*> Gate::get_fan_out_endpoints_view(const std::function<bool(Endpoint*)>& filter) const
+    {
+        return FilterView<Endpoint*>(m_out_endpoints, filter);
+    }
+
     Endpoint* Gate::get_fan_out_endpoint(const std::string& pin_name) const
     {
         const GatePin* pin = m_type->get_pin_by_name(pin_name);
@@ -909,6 +1014,11 @@ namespace hal
         return result;
     }
 
+    GateNeighborView Gate::get_predecessors_view(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
+    {
+        return GateNeighborView(m_in_endpoints, false, filter);
+    }
+
     Endpoint* Gate::get_predecessor(const GatePin* pin) const
     {
         if (pin == nullptr)
@@ -989,6 +1099,11 @@ namespace hal
         return result;
     }
 
+    GateNeighborView Gate::get_successors_view(const std::function<bool(const GatePin* pin, Endpoint*)>& filter) const
+    {
+        return GateNeighborView(m_out_endpoints, true, filter);
+    }
+
     Endpoint* Gate::get_successor(const GatePin* pin) const
     {
         if (pin == nullptr)
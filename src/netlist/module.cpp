@@ -10,6 +10,67 @@
 
 namespace hal
 {
+    ModuleGatesView::ModuleGatesView(const Module* module, Filter filter, bool recursive) : m_module(module), m_filter(std::move(filter)), m_recursive(recursive)
+    {
+    }
+
+    ModuleGatesView::iterator::iterator(const ModuleGatesView* view, bool is_end) : m_view(view)
+    {
+        if (!is_end)
+        {
+            m_stack.push_back({view->m_module, 0, 0});
+            skip();
+        }
+    }
+
+    Gate* ModuleGatesView::iterator::operator*() const
+    {
+        const Frame& frame = m_stack.back();
+        return frame.module->m_gates[frame.gate_index];
+    }
+
+    ModuleGatesView::iterator& ModuleGatesView::iterator::operator++()
+    {
+        m_stack.back().gate_index++;
+        skip();
+        return *this;
+    }
+
+    bool ModuleGatesView::iterator::operator==(const iterator& other) const
+    {
+        if (m_stack.empty() || other.m_stack.empty())
+        {
+            return m_stack.empty() == other.m_stack.empty();
+        }
+        return m_stack.size() == other.m_stack.size() && m_stack.back().module == other.m_stack.back().module && m_stack.back().gate_index == other.m_stack.back().gate_index;
+    }
+
+    void ModuleGatesView::iterator::skip()
+    {
+        // pre-order traversal: first the gates of a module, then its submodules
+        while (!m_stack.empty())
+        {
+            Frame& frame      = m_stack.back();
+            const auto& gates = frame.module->m_gates;
+            for (; frame.gate_index < gates.size(); frame.gate_index++)
+            {
+                if (!m_view->m_filter || m_view->m_filter(gates[frame.gate_index]))
+                {
+                    return;
+                }
+            }
+
+            if (m_view->m_recursive && frame.submodule_index < frame.module->m_submodules.size())
+            {
+                const Module* submodule = frame.module->m_submodules[frame.submodule_index++];
+                m_stack.push_back({submodule, 0, 0});
+                continue;
+            }
+
+            m_stack.pop_back();
+        }
+    }
+
     Module::Module(NetlistInternalManager* internal_manager, EventHandler* event_handler, u32 id, Module* parent, const std::string& name)
     {
         m_internal_manager = internal_manager;
@@ -17,10 +78,9 @@ namespace hal
         m_parent           = parent;
         m_name             = name;
 
-        m_next_pin_id       = 1;
-        m_next_pin_group_id = 1;
-
         m_event_handler = event_handler;
+
+        update_ancestry();
     }
 
     bool Module::operator==(const Module& other) const
@@ -44,7 +104,7 @@ namespace hal
 
         for (Gate* other_gate : other.get_gates())
         {
-            if (const auto it = m_gates_map.find(other_gate->get_id()); it == m_gates_map.end() || *it->second != *other_gate)
+            if (const Gate* gate = get_gate_by_id(other_gate->get_id()); gate == nullptr || *gate != *other_gate)
             {
                 log_debug("module", "the modules with IDs {} and {} are not equal due to an unequal gates.", m_id, other.get_id());
                 return false;
@@ -158,11 +218,46 @@ namespace hal
 
     int Module::get_submodule_depth() const
     {
-        int retval      = 0;
-        const Module* p = this;
-        while ((p = p->get_parent_module()))
-            ++retval;
-        return retval;
+        return m_depth;
+    }
+
+    void Module::update_ancestry()
+    {
+        m_ancestors.clear();
+        if (m_parent == nullptr)
+        {
+            m_depth = 0;
+        }
+        else
+        {
+            m_depth = m_parent->m_depth + 1;
+
+            // the (2^(k+1))-th parent is the (2^k)-th parent of the (2^k)-th parent
+            m_ancestors.push_back(m_parent);
+            for (u32 k = 0; k < m_ancestors[k]->m_ancestors.size(); k++)
+            {
+                m_ancestors.push_back(m_ancestors[k]->m_ancestors[k]);
+            }
+        }
+
+        for (Module* sm : m_submodules)
+        {
+            sm->update_ancestry();
+        }
+    }
+
+    const Module* Module::get_ancestor(u32 distance) const
+    {
+        // requires distance to not exceed the depth of the module
+        const Module* res = this;
+        for (u32 k = 0; distance != 0; k++, distance >>= 1)
+        {
+            if (distance & 1)
+            {
+                res = res->m_ancestors[k];
+            }
+        }
+        return res;
     }
 
     bool Module::set_parent_module(Module* new_parent)
@@ -191,8 +286,7 @@ namespace hal
             return false;
         }
 
-        auto children = get_submodules(nullptr, true);
-        if (std::find(children.begin(), children.end(), new_parent) != children.end())
+        if (is_parent_module_of(new_parent, true))
         {
             new_parent->set_parent_module(m_parent);
         }
@@ -204,7 +298,7 @@ namespace hal
         {
             for (Net* net : get_nets(nullptr, true))
             {
-                if (auto res = m_parent->check_net(net, true); res.is_error())
+                if (auto res = m_internal_manager->schedule_net_check(m_parent, net); res.is_error())
                 {
                     log_error("module", "{}", res.get_error().get());
                 }
@@ -217,12 +311,13 @@ namespace hal
 
         m_parent->m_submodules_map[m_id] = this;
         m_parent->m_submodules.push_back(this);
+        update_ancestry();
 
         if (m_internal_manager->m_net_checks_enabled)
         {
             for (Net* net : get_nets(nullptr, true))
             {
-                if (auto res = m_parent->check_net(net, true); res.is_error())
+                if (auto res = m_internal_manager->schedule_net_check(m_parent, net); res.is_error())
                 {
                     log_error("module", "{}", res.get_error().get());
                 }
@@ -241,19 +336,16 @@ namespace hal
         {
             return false;
         }
-        for (auto sm : m_submodules)
+        if (!recursive)
         {
-            if (sm == module)
-            {
-                return true;
-            }
-            else if (recursive && sm->is_parent_module_of(module, true))
-            {
-                return true;
-            }
+            return module->m_parent == this;
+        }
+        if (module->m_depth <= m_depth)
+        {
+            return false;
         }
 
-        return false;
+        return module->get_ancestor(module->m_depth - m_depth) == this;
     }
 
     std::vector<Module*> Module::get_submodules(const std::function<bool(Module*)>& filter, bool recursive) const
@@ -292,16 +384,8 @@ namespace hal
         {
             return false;
         }
-        if (m_parent == module)
-        {
-            return true;
-        }
-        else if (recursive && m_parent->is_submodule_of(module, true))
-        {
-            return true;
-        }
 
-        return false;
+        return module->is_parent_module_of(this, recursive);
     }
 
     bool Module::contains_module(const Module* other, bool recursive) const
@@ -353,39 +437,23 @@ namespace hal
         {
             return false;
         }
-        bool success = std::find(m_gates.begin(), m_gates.end(), gate) != m_gates.end();
-        if (!success && recursive)
+
+        Module* owner = gate->get_module();
+        if (owner == this)
         {
-            for (auto sm : m_submodules)
-            {
-                if (sm->contains_gate(gate, true))
-                {
-                    return true;
-                }
-            }
+            return true;
         }
-        return success;
+        return recursive && owner != nullptr && is_parent_module_of(owner, true);
     }
 
     Gate* Module::get_gate_by_id(const u32 gate_id, bool recursive) const
     {
-        auto it = m_gates_map.find(gate_id);
-        if (it == m_gates_map.end())
+        Gate* gate = m_internal_manager->m_netlist->get_gate_by_id(gate_id);
+        if (!contains_gate(gate, recursive))
         {
-            if (recursive)
-            {
-                for (auto sm : m_submodules)
-                {
-                    auto res = sm->get_gate_by_id(gate_id, true);
-                    if (res != nullptr)
-                    {
-                        return res;
-                    }
-                }
-            }
             return nullptr;
         }
-        return it->second;
+        return gate;
     }
 
     const std::vector<Gate*>& Module::get_gates() const
@@ -425,6 +493,11 @@ namespace hal
         return res;
     }
 
+    ModuleGatesView Module::get_gates_view(const std::function<bool(Gate*)>& filter, bool recursive) const
+    {
+        return ModuleGatesView(this, filter, recursive);
+    }
+
     /*
      * ################################################################
      *      net functions
@@ -760,28 +833,12 @@ namespace hal
 
     u32 Module::get_unique_pin_id()
     {
-        if (!m_free_pin_ids.empty())
-        {
-            return *(m_free_pin_ids.begin());
-        }
-        while (m_used_pin_ids.find(m_next_pin_id) != m_used_pin_ids.end())
-        {
-            m_next_pin_id++;
-        }
-        return m_next_pin_id;
+        return m_pin_ids.get_unique_id();
     }
 
     u32 Module::get_unique_pin_group_id()
     {
-        if (!m_free_pin_group_ids.empty())
-        {
-            return *(m_free_pin_group_ids.begin());
-        }
-        while (m_used_pin_group_ids.find(m_next_pin_group_id) != m_used_pin_group_ids.end())
-        {
-            m_next_pin_group_id++;
-        }
-        return m_next_pin_group_id;
+        return m_pin_group_ids.get_unique_id();
     }
 
     Result<ModulePin*> Module::create_pin(const u32 id, const std::string& name, Net* net, PinType type, bool create_group, bool force_name)
@@ -1748,7 +1805,7 @@ namespace hal
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_ids.find(id) != m_used_pin_ids.end())
+        if (m_pin_ids.is_used(id))
         {
             return ERR("could not create pin '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1784,11 +1841,7 @@ namespace hal
         m_pin_names_map[name] = pin;
 
         // mark pin ID as used
-        if (auto free_id_it = m_free_pin_ids.find(id); free_id_it != m_free_pin_ids.end())
-        {
-            m_free_pin_ids.erase(free_id_it);
-        }
-        m_used_pin_ids.insert(id);
+        m_pin_ids.reserve(id);
 
         return OK(pin);
     }
@@ -1815,8 +1868,7 @@ namespace hal
         m_pins.erase(std::find_if(m_pins.begin(), m_pins.end(), [pin](const auto& p) { return p.get() == pin; }));
 
         // free pin ID
-        m_free_pin_ids.insert(del_id);
-        m_used_pin_ids.erase(del_id);
+        m_pin_ids.release(del_id);
 
         return true;
     }
@@ -1828,7 +1880,7 @@ namespace hal
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID 0 is invalid");
         }
-        if (m_used_pin_group_ids.find(id) != m_used_pin_group_ids.end())
+        if (m_pin_group_ids.is_used(id))
         {
             return ERR("could not create pin group '" + name + "' for module '" + m_name + "' with ID " + std::to_string(m_id) + ": ID " + std::to_string(id) + " is already taken");
         }
@@ -1857,11 +1909,7 @@ namespace hal
         m_pin_group_names_map[name] = pin_group;
 
         // mark pin group ID as used
-        if (auto free_id_it = m_free_pin_group_ids.find(id); free_id_it != m_free_pin_group_ids.end())
-        {
-            m_free_pin_group_ids.erase(free_id_it);
-        }
-        m_used_pin_group_ids.insert(id);
+        m_pin_group_ids.reserve(id);
 
         return OK(pin_group);
     }
@@ -1890,8 +1938,7 @@ namespace hal
         m_pin_groups.erase(std::find_if(m_pin_groups.begin(), m_pin_groups.end(), [pin_group](const auto& pg) { return pg.get() == pin_group; }));
 
         // free pin group ID
-        m_free_pin_group_ids.insert(del_id);
-        m_used_pin_group_ids.erase(del_id);
+        m_pin_group_ids.release(del_id);
 
         return true;
     }
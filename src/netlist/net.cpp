@@ -44,7 +44,7 @@ namespace hal
         }
 
         const std::vector<Endpoint*>& sources_n2 = other.get_sources();
-        for (const Endpoint* ep_n1 : m_sources_raw)
+        for (const Endpoint* ep_n1 : m_sources)
         {
             if (std::find_if(sources_n2.begin(), sources_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
                 == sources_n2.end())
@@ -55,7 +55,7 @@ namespace hal
         }
 
         const std::vector<Endpoint*>& destinations_n2 = other.get_destinations();
-        for (const Endpoint* ep_n1 : m_destinations_raw)
+        for (const Endpoint* ep_n1 : m_destinations)
         {
             if (std::find_if(
                     destinations_n2.begin(), destinations_n2.end(), [ep_n1](const Endpoint* ep_n2) { return *ep_n1->get_pin() == *ep_n2->get_pin() && *ep_n1->get_gate() == *ep_n2->get_gate(); })
@@ -147,7 +147,7 @@ namespace hal
 
     bool Net::remove_source(Gate* gate, const GatePin* pin)
     {
-        if (auto it = std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate, pin](auto ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }); it != m_sources_raw.end())
+        if (auto it = std::find_if(m_sources.begin(), m_sources.end(), [gate, pin](auto ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }); it != m_sources.end())
         {
             return m_internal_manager->net_remove_source(this, *it);
         }
@@ -192,7 +192,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_sources_raw.end();
+        return std::find_if(m_sources.begin(), m_sources.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_sources.end();
     }
 
     bool Net::is_a_source(const Gate* gate, const GatePin* pin) const
@@ -209,7 +209,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_sources_raw.begin(), m_sources_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }) != m_sources_raw.end();
+        return std::find_if(m_sources.begin(), m_sources.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }) != m_sources.end();
     }
 
     bool Net::is_a_source(const Gate* gate, const std::string& pin_name) const
@@ -240,18 +240,18 @@ namespace hal
             return false;
         }
 
-        return std::find(m_sources_raw.begin(), m_sources_raw.end(), ep) != m_sources_raw.end();
+        return std::find(m_sources.begin(), m_sources.end(), ep) != m_sources.end();
     }
 
     u32 Net::get_num_of_sources(const std::function<bool(Endpoint* ep)>& filter) const
     {
         if (!filter)
         {
-            return (u32)m_sources_raw.size();
+            return (u32)m_sources.size();
         }
 
         u32 num = 0;
-        for (auto dst : m_sources_raw)
+        for (auto dst : m_sources)
         {
             if (filter(dst))
             {
@@ -265,11 +265,11 @@ namespace hal
     {
         if (!filter)
         {
-            return m_sources_raw;
+            return m_sources;
         }
 
         std::vector<Endpoint*> srcs;
-        for (auto src : m_sources_raw)
+        for (auto src : m_sources)
         {
             if (!filter(src))
             {
@@ -280,6 +280,11 @@ namespace hal
         return srcs;
     }
 
+    FilterView<Endpoint*> Net::get_sources_view(const std::function<bool(Endpoint* ep)>& filter) const
+    {
+        return FilterView<Endpoint*>(m_sources, filter);
+    }
+
     Endpoint* Net::add_destination(Gate* gate, GatePin* pin)
     {
         return m_internal_manager->net_add_destination(this, gate, pin);
@@ -308,8 +313,8 @@ namespace hal
 
     bool Net::remove_destination(Gate* gate, const GatePin* pin)
     {
-        if (auto it = std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; });
-            it != m_destinations_raw.end())
+        if (auto it = std::find_if(m_destinations.begin(), m_destinations.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; });
+            it != m_destinations.end())
         {
             return m_internal_manager->net_remove_destination(this, *it);
         }
@@ -354,7 +359,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_destinations_raw.end();
+        return std::find_if(m_destinations.begin(), m_destinations.end(), [gate](const auto* ep) { return ep->get_gate() == gate; }) != m_destinations.end();
     }
 
     bool Net::is_a_destination(const Gate* gate, const GatePin* pin) const
@@ -371,7 +376,7 @@ namespace hal
             return false;
         }
 
-        return std::find_if(m_destinations_raw.begin(), m_destinations_raw.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }) != m_destinations_raw.end();
+        return std::find_if(m_destinations.begin(), m_destinations.end(), [gate, pin](const auto* ep) { return ep->get_gate() == gate && *ep->get_pin() == *pin; }) != m_destinations.end();
     }
 
     bool Net::is_a_destination(const Gate* gate, const std::string& pin_name) const
@@ -402,18 +407,18 @@ namespace hal
             return false;
         }
 
-        return std::find(m_destinations_raw.begin(), m_destinations_raw.end(), ep) != m_destinations_raw.end();
+        return std::find(m_destinations.begin(), m_destinations.end(), ep) != m_destinations.end();
     }
 
     u32 Net::get_num_of_destinations(const std::function<bool(Endpoint* ep)>& filter) const
     {
         if (!filter)
         {
-            return (u32)m_destinations_raw.size();
+            return (u32)m_destinations.size();
         }
 
         u32 num = 0;
-        for (auto dst : m_destinations_raw)
+        for (auto dst : m_destinations)
         {
             if (filter(dst))
             {
@@ -427,11 +432,11 @@ namespace hal
     {
         if (!filter)
         {
-            return m_destinations_raw;
+            return m_destinations;
         }
 
         std::vector<Endpoint*> dsts;
-        for (auto dst : m_destinations_raw)
+        for (auto dst : m_destinations)
         {
             if (!filter(dst))
             {
@@ -442,6 +447,11 @@ namespace hal
         return dsts;
     }
 
+    FilterView<Endpoint*> Net::get_destinations_view(const std::function<bool(Endpoint* ep)>& filter) const
+    {
+        return FilterView<Endpoint*>(m_destinations, filter);
+    }
+
     bool Net::is_unrouted() const
     {
         return ((m_sources.size() == 0) || (m_destinations.size() == 0));
@@ -15,10 +15,6 @@ namespace hal
         m_event_handler    = std::make_unique<EventHandler>();
         m_manager          = new NetlistInternalManager(this, m_event_handler.get());
         m_netlist_id       = 1;
-        m_next_gate_id     = 1;
-        m_next_net_id      = 1;
-        m_next_module_id   = 1;
-        m_next_grouping_id = 1;
         m_top_module       = nullptr;    // this triggers the internal manager to allow creation of a module without parent
         m_top_module       = create_module("top_module", nullptr);
     }
@@ -50,7 +46,7 @@ namespace hal
 
         for (const Net* net : other.get_nets())
         {
-            if (const auto it = m_nets_map.find(net->get_id()); it == m_nets_map.end() || *it->second != *net)
+            if (const Net* own_net = m_nets.get(net->get_id()); own_net == nullptr || *own_net != *net)
             {
                 log_info("netlist", "the netlists with IDs {} and {} are not equal due to unequal nets.", m_netlist_id, other.get_id());
                 return false;
@@ -159,15 +155,7 @@ namespace hal
 
     u32 Netlist::get_unique_gate_id()
     {
-        if (!m_free_gate_ids.empty())
-        {
-            return *(m_free_gate_ids.begin());
-        }
-        while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-        {
-            m_next_gate_id++;
-        }
-        return m_next_gate_id;
+        return m_gate_ids.get_unique_id();
     }
 
     Gate* Netlist::create_gate(const u32 id, GateType* gt, const std::string& name, i32 x, i32 y)
@@ -187,14 +175,14 @@ namespace hal
 
     bool Netlist::is_gate_in_netlist(const Gate* gate) const
     {
-        return gate != nullptr && m_gates_set.find(gate) != m_gates_set.end();
+        return m_gates.contains(gate);
     }
 
     Gate* Netlist::get_gate_by_id(const u32 gate_id) const
     {
-        if (auto it = m_gates_map.find(gate_id); it != m_gates_map.end())
+        if (Gate* gate = m_gates.get(gate_id); gate != nullptr)
         {
-            return it->second.get();
+            return gate;
         }
 
         log_debug("netlist", "there is no gate with ID {} in the netlist with ID {}.", gate_id, m_netlist_id);
@@ -203,17 +191,22 @@ namespace hal
 
     const std::vector<Gate*>& Netlist::get_gates() const
     {
-        return m_gates;
+        return m_gates.objects();
+    }
+
+    FilterView<Gate*, const Gate*> Netlist::get_gates_view(const std::function<bool(const Gate*)>& filter) const
+    {
+        return FilterView<Gate*, const Gate*>(m_gates.objects(), filter);
     }
 
     std::vector<Gate*> Netlist::get_gates(const std::function<bool(const Gate*)>& filter) const
     {
         if (!filter)
         {
-            return m_gates;
+            return m_gates.objects();
         }
         std::vector<Gate*> res;
-        for (Gate* g : m_gates)
+        for (Gate* g : m_gates.objects())
         {
             if (!filter(g))
             {
@@ -319,15 +312,7 @@ namespace hal
 
     u32 Netlist::get_unique_net_id()
     {
-        if (!m_free_net_ids.empty())
-        {
-            return *(m_free_net_ids.begin());
-        }
-        while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-        {
-            m_next_net_id++;
-        }
-        return m_next_net_id;
+        return m_net_ids.get_unique_id();
     }
 
     Net* Netlist::create_net(const u32 id, const std::string& name)
@@ -347,14 +332,14 @@ namespace hal
 
     bool Netlist::is_net_in_netlist(const Net* n) const
     {
-        return n != nullptr && m_nets_set.find(n) != m_nets_set.end();
+        return m_nets.contains(n);
     }
 
     Net* Netlist::get_net_by_id(u32 net_id) const
     {
-        if (auto it = m_nets_map.find(net_id); it != m_nets_map.end())
+        if (Net* net = m_nets.get(net_id); net != nullptr)
         {
-            return it->second.get();
+            return net;
         }
 
         log_debug("netlist", "there is no net with ID {} in the netlist with ID {}.", net_id, m_netlist_id);
@@ -363,17 +348,22 @@ namespace hal
 
     const std::vector<Net*>& Netlist::get_nets() const
     {
-        return m_nets;
+        return m_nets.objects();
+    }
+
+    FilterView<Net*, const Net*> Netlist::get_nets_view(const std::function<bool(const Net*)>& filter) const
+    {
+        return FilterView<Net*, const Net*>(m_nets.objects(), filter);
     }
 
     std::vector<Net*> Netlist::get_nets(const std::function<bool(const Net*)>& filter) const
     {
         if (!filter)
         {
-            return m_nets;
+            return m_nets.objects();
         }
         std::vector<Net*> res;
-        for (auto net : m_nets)
+        for (auto net : m_nets.objects())
         {
             if (!filter(net))
             {
@@ -565,6 +555,21 @@ namespace hal
         m_manager->m_net_checks_enabled = enable_checks;
     }
 
+    void Netlist::begin_batch()
+    {
+        m_manager->begin_batch();
+    }
+
+    bool Netlist::commit_batch()
+    {
+        return m_manager->commit_batch();
+    }
+
+    bool Netlist::is_batch_active() const
+    {
+        return m_manager->m_batch_depth > 0;
+    }
+
     /*
      * ################################################################
      *      module functions
@@ -573,15 +578,7 @@ namespace hal
 
     u32 Netlist::get_unique_module_id()
     {
-        if (!m_free_module_ids.empty())
-        {
-            return *(m_free_module_ids.begin());
-        }
-        while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-        {
-            m_next_module_id++;
-        }
-        return m_next_module_id;
+        return m_module_ids.get_unique_id();
     }
 
     Module* Netlist::create_module(const u32 id, const std::string& name, Module* parent, const std::vector<Gate*>& gates)
@@ -657,15 +654,7 @@ namespace hal
 
     u32 Netlist::get_unique_grouping_id()
     {
-        if (!m_free_grouping_ids.empty())
-        {
-            return *(m_free_grouping_ids.begin());
-        }
-        while (m_used_grouping_ids.find(m_next_grouping_id) != m_used_grouping_ids.end())
-        {
-            m_next_grouping_id++;
-        }
-        return m_next_grouping_id;
+        return m_grouping_ids.get_unique_id();
     }
 
     Grouping* Netlist::create_grouping(const u32 id, const std::string& name)
@@ -730,122 +719,122 @@ namespace hal
 
     u32 Netlist::get_next_gate_id() const
     {
-        return m_next_gate_id;
+        return m_gate_ids.get_next_id();
     }
 
     void Netlist::set_next_gate_id(const u32 id)
     {
-        m_next_gate_id = id;
+        m_gate_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_gate_ids() const
     {
-        return m_used_gate_ids;
+        return m_gate_ids.get_used_ids();
     }
 
     void Netlist::set_used_gate_ids(const std::set<u32> ids)
     {
-        m_used_gate_ids = ids;
+        m_gate_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_gate_ids() const
     {
-        return m_free_gate_ids;
+        return m_gate_ids.get_free_ids();
     }
 
     void Netlist::set_free_gate_ids(const std::set<u32> ids)
     {
-        m_free_gate_ids = ids;
+        m_gate_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_net_id() const
     {
-        return m_next_net_id;
+        return m_net_ids.get_next_id();
     }
 
     void Netlist::set_next_net_id(const u32 id)
     {
-        m_next_net_id = id;
+        m_net_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_net_ids() const
     {
-        return m_used_net_ids;
+        return m_net_ids.get_used_ids();
     }
 
     void Netlist::set_used_net_ids(const std::set<u32> ids)
     {
-        m_used_net_ids = ids;
+        m_net_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_net_ids() const
     {
-        return m_free_net_ids;
+        return m_net_ids.get_free_ids();
     }
 
     void Netlist::set_free_net_ids(const std::set<u32> ids)
     {
-        m_free_net_ids = ids;
+        m_net_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_module_id() const
     {
-        return m_next_module_id;
+        return m_module_ids.get_next_id();
     }
 
     void Netlist::set_next_module_id(const u32 id)
     {
-        m_next_module_id = id;
+        m_module_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_module_ids() const
     {
-        return m_used_module_ids;
+        return m_module_ids.get_used_ids();
     }
 
     void Netlist::set_used_module_ids(const std::set<u32> ids)
     {
-        m_used_module_ids = ids;
+        m_module_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_module_ids() const
     {
-        return m_free_module_ids;
+        return m_module_ids.get_free_ids();
     }
 
     void Netlist::set_free_module_ids(const std::set<u32> ids)
     {
-        m_free_module_ids = ids;
+        m_module_ids.set_free_ids(ids);
     }
 
     u32 Netlist::get_next_grouping_id() const
     {
-        return m_next_grouping_id;
+        return m_grouping_ids.get_next_id();
     }
 
     void Netlist::set_next_grouping_id(const u32 id)
     {
-        m_next_grouping_id = id;
+        m_grouping_ids.set_next_id(id);
     }
 
     std::set<u32> Netlist::get_used_grouping_ids() const
     {
-        return m_used_grouping_ids;
+        return m_grouping_ids.get_used_ids();
     }
 
     void Netlist::set_used_grouping_ids(const std::set<u32> ids)
     {
-        m_used_grouping_ids = ids;
+        m_grouping_ids.set_used_ids(ids);
     }
 
     std::set<u32> Netlist::get_free_grouping_ids() const
     {
-        return m_free_grouping_ids;
+        return m_grouping_ids.get_free_ids();
     }
 
     void Netlist::set_free_grouping_ids(const std::set<u32> ids)
     {
-        m_free_grouping_ids = ids;
+        m_grouping_ids.set_free_ids(ids);
     }
 
     /*
@@ -859,6 +848,11 @@ namespace hal
         m_manager->clear_caches();
     }
 
+    std::shared_ptr<const NetlistCSR> Netlist::get_csr() const
+    {
+        return m_manager->get_csr();
+    }
+
     bool Netlist::load_gate_locations_from_data(const std::string& data_category, const std::pair<std::string, std::string>& data_identifiers)
     {
         std::string category;
@@ -876,7 +870,7 @@ namespace hal
         }
 
         u32 failed = 0;
-        for (Gate* gate : m_gates)
+        for (Gate* gate : m_gates.objects())
         {
             if (gate->has_data(category, identifiers.first))
             {
@@ -0,0 +1,287 @@
+#include "hal_core/netlist/netlist_csr.h"
+
+#include "hal_core/netlist/endpoint.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+
+
+namespace hal
+{
+    namespace
+    {
+        // IDs are usually allocated densely by the netlist, but may be chosen freely by the user
+        bool is_dense(u32 max_id, u32 num_objects)
+        {
+            return (u64)max_id <= 4 * (u64)num_objects + 1024;
+        }
+
+        void insert_index(std::vector<u32>& dense, std::unordered_map<u32, u32>& sparse, u32 id, u32 index)
+        {
+            if (id < dense.size())
+            {
+                dense[id] = index;
+            }
+            else
+            {
+                sparse[id] = index;
+            }
+        }
+
+        u32 find_index(const std::vector<u32>& dense, const std::unordered_map<u32, u32>& sparse, u32 id)
+        {
+            if (id < dense.size())
+            {
+                return dense[id];
+            }
+            if (const auto it = sparse.find(id); it != sparse.end())
+            {
+                return it->second;
+            }
+            return NetlistCSR::invalid_index;
+        }
+    }    // namespace
+
+    NetlistCSR::NetlistCSR(const Netlist* nl) : m_netlist(nl)
+    {
+        m_gates = nl->get_gates();
+        m_nets  = nl->get_nets();
+
+        const u32 num_gates = m_gates.size();
+        const u32 num_nets  = m_nets.size();
+
+        u32 max_gate_id = 0;
+        for (const Gate* gate : m_gates)
+        {
+            max_gate_id = std::max(max_gate_id, gate->get_id());
+        }
+        u32 max_net_id = 0;
+        for (const Net* net : m_nets)
+        {
+            max_net_id = std::max(max_net_id, net->get_id());
+        }
+
+        if (is_dense(max_gate_id, num_gates))
+        {
+            m_gate_indices.assign(max_gate_id + 1, invalid_index);
+        }
+        else
+        {
+            m_sparse_gate_indices.reserve(num_gates);
+        }
+        if (is_dense(max_net_id, num_nets))
+        {
+            m_net_indices.assign(max_net_id + 1, invalid_index);
+        }
+        else
+        {
+            m_sparse_net_indices.reserve(num_nets);
+        }
+        m_gate_flags.resize(num_gates);
+
+        // gate type properties are looked up once per gate type
+        std::unordered_map<const GateType*, u8> type_flags;
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            const Gate* gate = m_gates[i];
+            insert_index(m_gate_indices, m_sparse_gate_indices, gate->get_id(), i);
+
+            const GateType* type = gate->get_type();
+            auto it              = type_flags.find(type);
+            if (it == type_flags.end())
+            {
+                u8 flags = 0;
+                if (type->has_property(GateTypeProperty::sequential))
+                {
+                    flags |= GateFlags::sequential;
+                }
+                if (type->has_property(GateTypeProperty::combinational))
+                {
+                    flags |= GateFlags::combinational;
+                }
+                it = type_flags.emplace(type, flags).first;
+            }
+            m_gate_flags[i] = it->second;
+        }
+
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            insert_index(m_net_indices, m_sparse_net_indices, m_nets[i]->get_id(), i);
+        }
+
+        // gate x net adjacency, the endpoints are only visited once from the gates while the number of endpoints per net is counted
+        m_fan_in_offsets.resize(num_gates + 1);
+        m_fan_out_offsets.resize(num_gates + 1);
+        m_source_offsets.assign(num_nets + 1, 0);
+        m_destination_offsets.assign(num_nets + 1, 0);
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            const Gate* gate = m_gates[i];
+
+            m_fan_in_offsets[i] = m_fan_in_nets.size();
+            for (const Endpoint* ep : gate->get_fan_in_endpoints())
+            {
+                const u32 net = find_index(m_net_indices, m_sparse_net_indices, ep->get_net()->get_id());
+                m_fan_in_nets.push_back({net, ep->get_pin()->get_type()});
+                m_destination_offsets[net + 1]++;
+            }
+
+            m_fan_out_offsets[i] = m_fan_out_nets.size();
+            for (const Endpoint* ep : gate->get_fan_out_endpoints())
+            {
+                const u32 net = find_index(m_net_indices, m_sparse_net_indices, ep->get_net()->get_id());
+                m_fan_out_nets.push_back({net, ep->get_pin()->get_type()});
+                m_source_offsets[net + 1]++;
+            }
+        }
+        m_fan_in_offsets[num_gates]  = m_fan_in_nets.size();
+        m_fan_out_offsets[num_gates] = m_fan_out_nets.size();
+
+        // net x gate adjacency by counting sort, hence without visiting any endpoint again
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            m_source_offsets[i + 1] += m_source_offsets[i];
+            m_destination_offsets[i + 1] += m_destination_offsets[i];
+        }
+        m_sources.resize(m_fan_out_nets.size());
+        m_destinations.resize(m_fan_in_nets.size());
+
+        std::vector<u32> source_positions(m_source_offsets.begin(), m_source_offsets.end() - 1);
+        std::vector<u32> destination_positions(m_destination_offsets.begin(), m_destination_offsets.end() - 1);
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            for (u32 j = m_fan_in_offsets[i]; j < m_fan_in_offsets[i + 1]; j++)
+            {
+                m_destinations[destination_positions[m_fan_in_nets[j].net]++] = {i, m_fan_in_nets[j].pin_type};
+            }
+            for (u32 j = m_fan_out_offsets[i]; j < m_fan_out_offsets[i + 1]; j++)
+            {
+                m_sources[source_positions[m_fan_out_nets[j].net]++] = {i, m_fan_out_nets[j].pin_type};
+            }
+        }
+
+        // gate x gate adjacency
+        u64 num_edges = 0;
+        for (u32 i = 0; i < num_nets; i++)
+        {
+            num_edges += (u64)(m_source_offsets[i + 1] - m_source_offsets[i]) * (m_destination_offsets[i + 1] - m_destination_offsets[i]);
+        }
+        m_predecessors.reserve(num_edges);
+        m_successors.reserve(num_edges);
+
+        m_predecessor_offsets.resize(num_gates + 1);
+        m_successor_offsets.resize(num_gates + 1);
+        for (u32 i = 0; i < num_gates; i++)
+        {
+            m_predecessor_offsets[i] = m_predecessors.size();
+            for (u32 j = m_fan_in_offsets[i]; j < m_fan_in_offsets[i + 1]; j++)
+            {
+                const u32 net = m_fan_in_nets[j].net;
+                for (u32 k = m_source_offsets[net]; k < m_source_offsets[net + 1]; k++)
+                {
+                    m_predecessors.push_back({m_sources[k].gate, net, m_sources[k].pin_type});
+                }
+            }
+
+            m_successor_offsets[i] = m_successors.size();
+            for (u32 j = m_fan_out_offsets[i]; j < m_fan_out_offsets[i + 1]; j++)
+            {
+                const u32 net = m_fan_out_nets[j].net;
+                for (u32 k = m_destination_offsets[net]; k < m_destination_offsets[net + 1]; k++)
+                {
+                    m_successors.push_back({m_destinations[k].gate, net, m_destinations[k].pin_type});
+                }
+            }
+        }
+        m_predecessor_offsets[num_gates] = m_predecessors.size();
+        m_successor_offsets[num_gates]   = m_successors.size();
+    }
+
+    const Netlist* NetlistCSR::get_netlist() const
+    {
+        return m_netlist;
+    }
+
+    u32 NetlistCSR::get_num_gates() const
+    {
+        return m_gates.size();
+    }
+
+    u32 NetlistCSR::get_num_nets() const
+    {
+        return m_nets.size();
+    }
+
+    Gate* NetlistCSR::get_gate(u32 index) const
+    {
+        return m_gates[index];
+    }
+
+    Net* NetlistCSR::get_net(u32 index) const
+    {
+        return m_nets[index];
+    }
+
+    u32 NetlistCSR::get_gate_index(const Gate* gate) const
+    {
+        if (gate == nullptr)
+        {
+            return invalid_index;
+        }
+
+        // the gate may belong to another netlist or may have been replaced after the snapshot was taken
+        const u32 index = find_index(m_gate_indices, m_sparse_gate_indices, gate->get_id());
+        return (index != invalid_index && m_gates[index] == gate) ? index : invalid_index;
+    }
+
+    u32 NetlistCSR::get_net_index(const Net* net) const
+    {
+        if (net == nullptr)
+        {
+            return invalid_index;
+        }
+
+        const u32 index = find_index(m_net_indices, m_sparse_net_indices, net->get_id());
+        return (index != invalid_index && m_nets[index] == net) ? index : invalid_index;
+    }
+
+    bool NetlistCSR::is_sequential(u32 index) const
+    {
+        return (m_gate_flags[index] & GateFlags::sequential) != 0;
+    }
+
+    bool NetlistCSR::is_combinational(u32 index) const
+    {
+        return (m_gate_flags[index] & GateFlags::combinational) != 0;
+    }
+
+    NetlistCSR::Span<NetlistCSR::NetConnection> NetlistCSR::get_fan_in_nets(u32 index) const
+    {
+        return Span<NetConnection>(m_fan_in_nets.data() + m_fan_in_offsets[index], m_fan_in_nets.data() + m_fan_in_offsets[index + 1]);
+    }
+
+    NetlistCSR::Span<NetlistCSR::NetConnection> NetlistCSR::get_fan_out_nets(u32 index) const
+    {
+        return Span<NetConnection>(m_fan_out_nets.data() + m_fan_out_offsets[index], m_fan_out_nets.data() + m_fan_out_offsets[index + 1]);
+    }
+
+    NetlistCSR::Span<NetlistCSR::Edge> NetlistCSR::get_predecessors(u32 index) const
+    {
+        return Span<Edge>(m_predecessors.data() + m_predecessor_offsets[index], m_predecessors.data() + m_predecessor_offsets[index + 1]);
+    }
+
+    NetlistCSR::Span<NetlistCSR::Edge> NetlistCSR::get_successors(u32 index) const
+    {
+        return Span<Edge>(m_successors.data() + m_successor_offsets[index], m_successors.data() + m_successor_offsets[index + 1]);
+    }
+
+    NetlistCSR::Span<NetlistCSR::GateConnection> NetlistCSR::get_sources(u32 index) const
+    {
+        return Span<GateConnection>(m_sources.data() + m_source_offsets[index], m_sources.data() + m_source_offsets[index + 1]);
+    }
+
+    NetlistCSR::Span<NetlistCSR::GateConnection> NetlistCSR::get_destinations(u32 index) const
+    {
+        return Span<GateConnection>(m_destinations.data() + m_destination_offsets[index], m_destinations.data() + m_destination_offsets[index + 1]);
+    }
+}    // namespace hal
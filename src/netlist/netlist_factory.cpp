@@ -64,7 +64,7 @@ namespace hal
                 }
             }
 
-            if (netlist_file.extension() == ".hal")
+            if (netlist_file.extension() == ".hal" || netlist_file.extension() == ".halb")
             {
                 return netlist_serializer::deserialize_from_file(netlist_file, lib);
             }
@@ -93,7 +93,7 @@ namespace hal
                 return nullptr;
             }
 
-            if (netlist_file.extension() == ".hal")
+            if (netlist_file.extension() == ".hal" || netlist_file.extension() == ".halb")
             {
                 return netlist_serializer::deserialize_from_file(netlist_file, gate_library);
             }
@@ -134,7 +134,7 @@ namespace hal
 
             auto extension = netlist_file.extension();
 
-            if (extension == ".hal")
+            if (extension == ".hal" || extension == ".halb")
             {
                 return netlist_serializer::deserialize_from_file(netlist_file);
             }
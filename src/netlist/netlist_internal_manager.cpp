@@ -8,9 +8,12 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/netlist_csr.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/utilities/log.h"
 
+#include <algorithm>
+
 namespace hal
 {
     NetlistInternalManager::NetlistInternalManager(Netlist* nl, EventHandler* eh)
@@ -42,64 +45,60 @@ namespace hal
         c_netlist->set_device_name(nl->get_device_name());
         c_netlist->set_input_filename(nl->get_input_filename());
 
+        // the copy is not observed by anyone yet, hence gates, nets, and endpoints are cloned in bulk without per-object checks and events
+        NetlistInternalManager* c_manager = c_netlist->m_manager;
+        EventHandler* c_event_handler     = c_netlist->m_event_handler.get();
+
         // copy nets
-        for (const Net* net : nl->m_nets)
+        for (const Net* net : nl->m_nets.objects())
         {
-            Net* c_net = c_netlist->create_net(net->m_id, net->m_name);
-            if (c_net == nullptr)
-            {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied net '" + net->m_name + "' with ID " + std::to_string(net->m_id));
-            }
+            Net* c_net = c_netlist->m_nets.emplace(net->m_id, [&](void* memory) { return new (memory) Net(c_manager, c_event_handler, net->m_id, net->m_name); });
+            c_net->m_sources.reserve(net->m_sources.size());
+            c_net->m_destinations.reserve(net->m_destinations.size());
             c_net->m_data = net->m_data;
         }
 
-        // copy gates
-        for (const Gate* gate : nl->m_gates)
+        // copy gates including their endpoints, keeping the order of the fan-in and fan-out of every gate
+        for (const Gate* gate : nl->m_gates.objects())
         {
-            Gate* c_gate = c_netlist->create_gate(gate->m_id, gate->m_type, gate->m_name, gate->m_x, gate->m_y);
-            if (c_gate == nullptr)
+            Gate* c_gate = c_netlist->m_gates.emplace(gate->m_id, [&](void* memory) { return new (memory) Gate(c_manager, c_event_handler, gate->m_id, gate->m_type, gate->m_name, gate->m_x, gate->m_y); });
+            c_gate->m_functions = gate->m_functions;
+            c_gate->m_data      = gate->m_data;
+
+            c_gate->m_in_endpoints.reserve(gate->m_in_endpoints.size());
+            c_gate->m_in_nets.reserve(gate->m_in_nets.size());
+            for (const Endpoint* ep : gate->m_in_endpoints)
             {
-                return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied gate '" + gate->m_name + "' with ID " + std::to_string(gate->m_id));
+                Net* c_net = c_netlist->m_nets.get(ep->get_net()->m_id);
+                c_gate->m_in_endpoints.push_back(c_netlist->m_endpoints.emplace([&](void* memory) { return new (memory) Endpoint(c_gate, ep->get_pin(), c_net, true); }));
+                c_gate->m_in_nets.push_back(c_net);
             }
 
-            for (const auto& [name, func] : gate->get_boolean_functions(true))
+            c_gate->m_out_endpoints.reserve(gate->m_out_endpoints.size());
+            c_gate->m_out_nets.reserve(gate->m_out_nets.size());
+            for (const Endpoint* ep : gate->m_out_endpoints)
             {
-                c_gate->add_boolean_function(name, func);
+                Net* c_net = c_netlist->m_nets.get(ep->get_net()->m_id);
+                c_gate->m_out_endpoints.push_back(c_netlist->m_endpoints.emplace([&](void* memory) { return new (memory) Endpoint(c_gate, ep->get_pin(), c_net, false); }));
+                c_gate->m_out_nets.push_back(c_net);
             }
+        }
 
-            for (const Endpoint* in_point : gate->get_fan_in_endpoints())
+        // attach the endpoints to their nets, keeping the order of the sources and destinations of every net
+        auto find_endpoint = [](const std::vector<Endpoint*>& endpoints, const GatePin* pin) {
+            return *std::find_if(endpoints.begin(), endpoints.end(), [pin](const Endpoint* ep) { return ep->get_pin() == pin; });
+        };
+        for (const Net* net : nl->m_nets.objects())
+        {
+            Net* c_net = c_netlist->m_nets.get(net->m_id);
+            for (const Endpoint* ep : net->m_sources)
             {
-                const auto net_id = in_point->get_net()->m_id;
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-                if (c_net == nullptr)
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied net by ID " + std::to_string(net_id));
-                }
-
-                if (!c_net->add_destination(c_gate, in_point->get_pin()))
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to add destination to copied net '" + c_net->m_name + "' with ID "
-                               + std::to_string(c_net->m_id));
-                }
+                c_net->m_sources.push_back(find_endpoint(c_netlist->m_gates.get(ep->get_gate()->m_id)->m_out_endpoints, ep->get_pin()));
             }
-
-            for (const Endpoint* out_point : gate->get_fan_out_endpoints())
+            for (const Endpoint* ep : net->m_destinations)
             {
-                const auto net_id = out_point->get_net()->m_id;
-                auto c_net        = c_netlist->get_net_by_id(net_id);
-                if (c_net == nullptr)
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied net by ID " + std::to_string(net_id));
-                }
-
-                if (!c_net->add_source(c_gate, out_point->get_pin()))
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to add source to copied net '" + c_net->m_name + "' with ID "
-                               + std::to_string(c_net->m_id));
-                }
+                c_net->m_destinations.push_back(find_endpoint(c_netlist->m_gates.get(ep->get_gate()->m_id)->m_in_endpoints, ep->get_pin()));
             }
-
-            c_gate->m_data = gate->m_data;
         }
 
         // copy modules
@@ -108,25 +107,13 @@ namespace hal
             // ignore top module, since this is already created by the constructor
             if (module->m_id == 1)
             {
-                c_netlist->m_top_module->m_data = module->get_data_map();
+                c_netlist->m_top_module->m_data = module->m_data;
                 c_netlist->m_top_module->m_type = module->m_type;
                 continue;
             }
 
-            std::vector<Gate*> c_gates;
-            for (const Gate* gate : module->m_gates)
-            {
-                // find gates of module in the copied netlist by id
-                Gate* c_gate = c_netlist->get_gate_by_id(gate->m_id);
-                if (c_gate == nullptr)
-                {
-                    return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to get copied gate by ID " + std::to_string(gate->m_id));
-                }
-                c_gates.push_back(c_gate);
-            }
-
             // create all modules with the top module as parent module and update later
-            Module* c_module = c_netlist->create_module(module->m_id, module->m_name, c_netlist->m_top_module, c_gates);
+            Module* c_module = c_manager->create_module(module->m_id, c_netlist->m_top_module, module->m_name);
             if (c_module == nullptr)
             {
                 return ERR("could not copy netlist with ID " + std::to_string(nl->get_id()) + ": failed to create copied module '" + module->m_name + "' with ID " + std::to_string(module->m_id));
@@ -158,6 +145,17 @@ namespace hal
             }
         }
 
+        // assign gates to modules, keeping the order of the gates of every module
+        for (const Module* module : nl->m_modules)
+        {
+            Module* c_module = c_netlist->get_module_by_id(module->m_id);
+            c_module->m_gates.reserve(module->m_gates.size());
+            for (const Gate* gate : module->m_gates)
+            {
+                c_manager->module_insert_gate(c_module, c_netlist->m_gates.get(gate->m_id));
+            }
+        }
+
         // copy groupings
         for (const Grouping* grouping : nl->m_groupings)
         {
@@ -214,27 +212,36 @@ namespace hal
         c_netlist->m_file_name   = nl->m_file_name;
 
         // update ids last, after all the creation
-        c_netlist->m_next_gate_id  = nl->m_next_gate_id;
-        c_netlist->m_used_gate_ids = nl->m_used_gate_ids;
-        c_netlist->m_free_gate_ids = nl->m_free_gate_ids;
-
-        c_netlist->m_next_net_id  = nl->m_next_net_id;
-        c_netlist->m_used_net_ids = nl->m_used_net_ids;
-        c_netlist->m_free_net_ids = nl->m_free_net_ids;
-
-        c_netlist->m_next_module_id  = nl->m_next_module_id;
-        c_netlist->m_used_module_ids = nl->m_used_module_ids;
-        c_netlist->m_free_module_ids = nl->m_free_module_ids;
-
-        c_netlist->m_next_grouping_id  = nl->m_next_grouping_id;
-        c_netlist->m_used_grouping_ids = nl->m_used_grouping_ids;
-        c_netlist->m_free_grouping_ids = nl->m_free_grouping_ids;
+        c_netlist->m_gate_ids     = nl->m_gate_ids;
+        c_netlist->m_net_ids      = nl->m_net_ids;
+        c_netlist->m_module_ids   = nl->m_module_ids;
+        c_netlist->m_grouping_ids = nl->m_grouping_ids;
+
+        // the nets of the modules can be copied unless net checks are disabled or pending in the original netlist
+        const bool module_nets_up_to_date = nl->m_manager->m_net_checks_enabled && nl->m_manager->m_batch_depth == 0;
+        auto copy_nets                    = [&c_netlist](const std::unordered_set<Net*>& nets, std::unordered_set<Net*>& c_nets) {
+            c_nets.reserve(nets.size());
+            for (Net* net : nets)
+            {
+                c_nets.insert(c_netlist->m_nets.get(net->m_id));
+            }
+        };
 
         // copy module port names
         for (Module* module : nl->m_modules)
         {
             Module* c_module = c_netlist->get_module_by_id(module->m_id);
-            c_module->update_nets();
+            if (module_nets_up_to_date)
+            {
+                copy_nets(module->m_nets, c_module->m_nets);
+                copy_nets(module->m_input_nets, c_module->m_input_nets);
+                copy_nets(module->m_output_nets, c_module->m_output_nets);
+                copy_nets(module->m_internal_nets, c_module->m_internal_nets);
+            }
+            else
+            {
+                c_module->update_nets();
+            }
 
             for (const std::unique_ptr<PinGroup<ModulePin>>& pin_group : module->m_pin_groups)
             {
@@ -283,7 +290,7 @@ namespace hal
             log_error("gate", "ID 0 represents an invalid gate ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+        if (m_netlist->m_gate_ids.is_used(id))
         {
             log_error("gate", "gate ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -304,27 +311,12 @@ namespace hal
             return nullptr;
         }
 
-        auto new_gate = std::unique_ptr<Gate>(new Gate(this, m_event_handler, id, gt, name, x, y));
+        m_netlist->m_gate_ids.reserve(id);
 
-        auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-        if (free_id_it != m_netlist->m_free_gate_ids.end())
-        {
-            m_netlist->m_free_gate_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_gate_ids.insert(id);
-
-        // add gate to top module
-        new_gate->m_module = m_netlist->m_top_module;
+        auto raw = m_netlist->m_gates.emplace(id, [&](void* memory) { return new (memory) Gate(this, m_event_handler, id, gt, name, x, y); });
+        m_csr_cache.reset();
 
-        auto raw = new_gate.get();
-
-        m_netlist->m_gates_map[id] = std::move(new_gate);
-        m_netlist->m_gates_set.insert(raw);
-        m_netlist->m_gates.push_back(raw);
-
-        m_netlist->m_top_module->m_gates_map[id] = raw;
-        m_netlist->m_top_module->m_gates.push_back(raw);
+        module_insert_gate(m_netlist->m_top_module, raw);
 
         // notify
         m_event_handler->notify(ModuleEvent::event::gate_assigned, m_netlist->m_top_module, id);
@@ -367,22 +359,19 @@ namespace hal
         m_netlist->unmark_vcc_gate(gate);
 
         // remove gate from modules
-        gate->m_module->m_gates_map.erase(gate->m_module->m_gates_map.find(gate->get_id()));
-        utils::unordered_vector_erase(gate->m_module->m_gates, gate);
+        module_erase_gate(gate->m_module, gate);
 
-        auto it  = m_netlist->m_gates_map.find(gate->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_gates_map.erase(it);
-        m_netlist->m_gates_set.erase(gate);
-        utils::unordered_vector_erase(m_netlist->m_gates, gate);
+        m_netlist->m_gates.detach(gate);
+        m_csr_cache.reset();
 
         // free ids
-        m_netlist->m_free_gate_ids.insert(gate->get_id());
-        m_netlist->m_used_gate_ids.erase(gate->get_id());
+        m_netlist->m_gate_ids.release(gate->get_id());
 
         m_event_handler->notify(ModuleEvent::event::gate_removed, gate->m_module, gate->get_id());
         m_event_handler->notify(GateEvent::event::removed, gate);
 
+        m_netlist->m_gates.destroy(gate);
+
         return true;
     }
 
@@ -402,7 +391,7 @@ namespace hal
             log_error("net", "ID 0 represents an invalid net ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+        if (m_netlist->m_net_ids.is_used(id))
         {
             log_error("net", "net ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -413,21 +402,11 @@ namespace hal
             return nullptr;
         }
 
-        auto new_net = std::unique_ptr<Net>(new Net(this, m_event_handler, id, name));
-
-        auto free_id_it = m_netlist->m_free_net_ids.find(id);
-        if (free_id_it != m_netlist->m_free_net_ids.end())
-        {
-            m_netlist->m_free_net_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_net_ids.insert(id);
+        m_netlist->m_net_ids.reserve(id);
 
         // add net to netlist
-        auto raw                  = new_net.get();
-        m_netlist->m_nets_map[id] = std::move(new_net);
-        m_netlist->m_nets_set.insert(raw);
-        m_netlist->m_nets.push_back(raw);
+        auto raw = m_netlist->m_nets.emplace(id, [&](void* memory) { return new (memory) Net(this, m_event_handler, id, name); });
+        m_csr_cache.reset();
 
         // notify
         m_event_handler->notify(NetEvent::event::created, raw);
@@ -442,7 +421,7 @@ namespace hal
             return false;
         }
 
-        auto dsts = net->m_destinations_raw;
+        auto dsts = net->m_destinations;
         for (auto dst : dsts)
         {
             if (!this->net_remove_destination(net, dst))
@@ -451,7 +430,7 @@ namespace hal
             }
         }
 
-        auto srcs = net->m_sources_raw;
+        auto srcs = net->m_sources;
         for (auto src : srcs)
         {
             if (!this->net_remove_source(net, src))
@@ -471,17 +450,15 @@ namespace hal
         m_netlist->unmark_global_output_net(net);
 
         // remove net from netlist
-        auto it  = m_netlist->m_nets_map.find(net->get_id());
-        auto ptr = std::move(it->second);
-        m_netlist->m_nets_map.erase(it);
-        m_netlist->m_nets_set.erase(net);
-        utils::unordered_vector_erase(m_netlist->m_nets, net);
+        m_netlist->m_nets.detach(net);
+        m_csr_cache.reset();
 
-        m_netlist->m_free_net_ids.insert(net->get_id());
-        m_netlist->m_used_net_ids.erase(net->get_id());
+        m_netlist->m_net_ids.release(net->get_id());
 
         m_event_handler->notify(NetEvent::event::removed, net);
 
+        m_netlist->m_nets.destroy(net);
+
         return true;
     }
 
@@ -530,17 +507,16 @@ namespace hal
             return nullptr;
         }
 
-        auto new_endpoint     = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, false));
-        auto new_endpoint_raw = new_endpoint.get();
-        net->m_sources.push_back(std::move(new_endpoint));
-        net->m_sources_raw.push_back(new_endpoint_raw);
+        auto new_endpoint_raw = m_netlist->m_endpoints.emplace([&](void* memory) { return new (memory) Endpoint(gate, pin, net, false); });
+        m_csr_cache.reset();
+        net->m_sources.push_back(new_endpoint_raw);
         gate->m_out_endpoints.push_back(new_endpoint_raw);
         gate->m_out_nets.push_back(net);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
         {
-            if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+            if (const auto res = schedule_net_check(gate->get_module(), net); res.is_error())
             {
                 log_error("net", "{}", res.get_error().get());
                 return nullptr;
@@ -548,7 +524,7 @@ namespace hal
 
             for (Endpoint* ep : net->get_destinations())
             {
-                if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = schedule_net_check(ep->get_gate()->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return nullptr;
@@ -573,14 +549,14 @@ namespace hal
         bool removed = false;
         for (u32 i = 0; i < net->m_sources.size(); ++i)
         {
-            if (net->m_sources_raw[i] == ep)
+            if (net->m_sources[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_out_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_out_nets, net);
-                net->m_sources[i] = std::move(net->m_sources.back());
+                net->m_sources[i] = net->m_sources.back();
                 net->m_sources.pop_back();
-                net->m_sources_raw[i] = net->m_sources_raw.back();
-                net->m_sources_raw.pop_back();
+                m_netlist->m_endpoints.erase(ep);
+                m_csr_cache.reset();
                 m_event_handler->notify(NetEvent::event::src_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -603,7 +579,7 @@ namespace hal
             // update internal nets and port nets
             if (m_net_checks_enabled)
             {
-                if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = schedule_net_check(gate->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return false;
@@ -611,7 +587,7 @@ namespace hal
 
                 for (Endpoint* dst : net->get_destinations())
                 {
-                    if (const auto res = dst->get_gate()->get_module()->check_net(net, true); res.is_error())
+                    if (const auto res = schedule_net_check(dst->get_gate()->get_module(), net); res.is_error())
                     {
                         log_error("net", "{}", res.get_error().get());
                         return false;
@@ -668,17 +644,16 @@ namespace hal
             return nullptr;
         }
 
-        std::unique_ptr<Endpoint> new_endpoint = std::unique_ptr<Endpoint>(new Endpoint(gate, pin, net, true));
-        Endpoint* new_endpoint_raw             = new_endpoint.get();
-        net->m_destinations.push_back(std::move(new_endpoint));
-        net->m_destinations_raw.push_back(new_endpoint_raw);
+        Endpoint* new_endpoint_raw = m_netlist->m_endpoints.emplace([&](void* memory) { return new (memory) Endpoint(gate, pin, net, true); });
+        m_csr_cache.reset();
+        net->m_destinations.push_back(new_endpoint_raw);
         gate->m_in_endpoints.push_back(new_endpoint_raw);
         gate->m_in_nets.push_back(net);
 
         // update internal nets and port nets
         if (m_net_checks_enabled)
         {
-            if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+            if (const auto res = schedule_net_check(gate->get_module(), net); res.is_error())
             {
                 log_error("net", "{}", res.get_error().get());
                 return nullptr;
@@ -686,7 +661,7 @@ namespace hal
 
             for (Endpoint* ep : net->get_sources())
             {
-                if (const auto res = ep->get_gate()->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = schedule_net_check(ep->get_gate()->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return nullptr;
@@ -710,14 +685,14 @@ namespace hal
         bool removed = false;
         for (u32 i = 0; i < net->m_destinations.size(); ++i)
         {
-            if (net->m_destinations_raw[i] == ep)
+            if (net->m_destinations[i] == ep)
             {
                 utils::unordered_vector_erase(gate->m_in_endpoints, ep);
                 utils::unordered_vector_erase(gate->m_in_nets, net);
-                net->m_destinations[i] = std::move(net->m_destinations.back());
+                net->m_destinations[i] = net->m_destinations.back();
                 net->m_destinations.pop_back();
-                net->m_destinations_raw[i] = net->m_destinations_raw.back();
-                net->m_destinations_raw.pop_back();
+                m_netlist->m_endpoints.erase(ep);
+                m_csr_cache.reset();
                 m_event_handler->notify(NetEvent::event::dst_removed, net, gate->get_id());
                 removed = true;
                 break;
@@ -739,7 +714,7 @@ namespace hal
         {    // update internal nets and port nets
             if (m_net_checks_enabled)
             {
-                if (const auto res = gate->get_module()->check_net(net, true); res.is_error())
+                if (const auto res = schedule_net_check(gate->get_module(), net); res.is_error())
                 {
                     log_error("net", "{}", res.get_error().get());
                     return false;
@@ -747,7 +722,7 @@ namespace hal
 
                 for (Endpoint* src : net->get_sources())
                 {
-                    if (const auto res = src->get_gate()->get_module()->check_net(net, true); res.is_error())
+                    if (const auto res = schedule_net_check(src->get_gate()->get_module(), net); res.is_error())
                     {
                         log_error("net", "{}", res.get_error().get());
                         return false;
@@ -770,7 +745,7 @@ namespace hal
             log_error("module", "ID 0 represents an invalid module ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+        if (m_netlist->m_module_ids.is_used(id))
         {
             log_error("module", "module ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -793,13 +768,7 @@ namespace hal
 
         auto m = std::unique_ptr<Module>(new Module(this, m_event_handler, id, parent, name));
 
-        auto free_id_it = m_netlist->m_free_module_ids.find(id);
-        if (free_id_it != m_netlist->m_free_module_ids.end())
-        {
-            m_netlist->m_free_module_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_module_ids.insert(id);
+        m_netlist->m_module_ids.reserve(id);
 
         auto raw                     = m.get();
         m_netlist->m_modules_map[id] = std::move(m);
@@ -855,6 +824,7 @@ namespace hal
             m_event_handler->notify(ModuleEvent::event::submodule_removed, sm->get_parent_module(), sm->get_id());
 
             sm->m_parent = to_remove->m_parent;
+            sm->update_ancestry();
 
             m_event_handler->notify(ModuleEvent::event::parent_changed, sm, 0);
             m_event_handler->notify(ModuleEvent::event::submodule_added, to_remove->m_parent, sm->get_id());
@@ -871,8 +841,8 @@ namespace hal
         m_netlist->m_modules_set.erase(to_remove);
         utils::unordered_vector_erase(m_netlist->m_modules, to_remove);
 
-        m_netlist->m_free_module_ids.insert(to_remove->get_id());
-        m_netlist->m_used_module_ids.erase(to_remove->get_id());
+        m_netlist->m_module_ids.release(to_remove->get_id());
+        m_pending_net_checks.erase(to_remove);
 
         m_event_handler->notify(ModuleEvent::event::removed, to_remove);
         return true;
@@ -939,16 +909,10 @@ namespace hal
         {
             // remove gate from old module
             Module* prev_mod = g->m_module;
-            const auto it    = prev_mod->m_gates_map.find(g->get_id());
-            assert(it != prev_mod->m_gates_map.end());
-            prev_mod->m_gates_map.erase(it);
-
-            utils::unordered_vector_erase(prev_mod->m_gates, g);
+            module_erase_gate(prev_mod, g);
 
             // move gate to new module
-            module->m_gates_map[g->get_id()] = g;
-            module->m_gates.push_back(g);
-            g->m_module = module;
+            module_insert_gate(module, g);
 
             // collect affected nets
             std::vector<Net*> fan_in = g->get_fan_in_nets();
@@ -977,7 +941,7 @@ namespace hal
             {
                 for (Net* net : nets)
                 {
-                    if (const auto res = affected_module->check_net(net, true); res.is_error())
+                    if (const auto res = schedule_net_check(affected_module, net); res.is_error())
                     {
                         log_error("module", "{}", res.get_error().get());
                         return false;
@@ -997,6 +961,11 @@ namespace hal
 
     bool NetlistInternalManager::module_check_net(Module* module, Net* net, bool recursive)
     {
+        if (recursive)
+        {
+            return schedule_net_check(module, net).is_ok();
+        }
+
         if (const auto res = module->check_net(net, recursive); res.is_error())
         {
             return false;
@@ -1004,6 +973,117 @@ namespace hal
         return true;
     }
 
+    void NetlistInternalManager::module_insert_gate(Module* module, Gate* gate)
+    {
+        gate->m_module       = module;
+        gate->m_module_index = module->m_gates.size();
+        module->m_gates.push_back(gate);
+    }
+
+    void NetlistInternalManager::module_erase_gate(Module* module, Gate* gate)
+    {
+        assert(gate->m_module == module && module->m_gates[gate->m_module_index] == gate);
+
+        // swap with the last gate of the module to remove in constant time
+        Gate* last                            = module->m_gates.back();
+        module->m_gates[gate->m_module_index] = last;
+        last->m_module_index                  = gate->m_module_index;
+        module->m_gates.pop_back();
+    }
+
+    //######################################################################
+    //###                      batched net checks                        ###
+    //######################################################################
+
+    Result<std::monostate> NetlistInternalManager::schedule_net_check(Module* module, Net* net)
+    {
+        if (m_batch_depth == 0)
+        {
+            return module->check_net(net, true);
+        }
+
+        m_pending_net_checks[module].insert(net);
+        return OK({});
+    }
+
+    void NetlistInternalManager::begin_batch()
+    {
+        m_batch_depth++;
+    }
+
+    bool NetlistInternalManager::commit_batch()
+    {
+        if (m_batch_depth == 0)
+        {
+            log_error("netlist", "cannot commit batch in netlist with ID {} as no batch has been started.", m_netlist->m_netlist_id);
+            return false;
+        }
+
+        if (--m_batch_depth > 0)
+        {
+            return true;
+        }
+
+        auto pending = std::move(m_pending_net_checks);
+        m_pending_net_checks.clear();
+
+        if (!m_net_checks_enabled)
+        {
+            return true;
+        }
+
+        // a net that is dirty within a module is also dirty within all of its ancestors, merge them so that every (module, net) pair is checked exactly once
+        std::unordered_map<Module*, std::unordered_set<Net*>> nets_to_check;
+        for (auto& [module, nets] : pending)
+        {
+            if (!m_netlist->is_module_in_netlist(module))
+            {
+                continue;
+            }
+
+            for (Module* m = module; m != nullptr; m = m->m_parent)
+            {
+                nets_to_check[m].insert(nets.begin(), nets.end());
+            }
+        }
+
+        // process modules and nets in ID order to keep pin creation deterministic
+        std::vector<Module*> modules;
+        modules.reserve(nets_to_check.size());
+        for (const auto& [module, nets] : nets_to_check)
+        {
+            modules.push_back(module);
+        }
+        std::sort(modules.begin(), modules.end(), [](const Module* a, const Module* b) { return a->get_id() < b->get_id(); });
+
+        bool success = true;
+        for (Module* module : modules)
+        {
+            const auto& net_set = nets_to_check.at(module);
+            std::vector<Net*> nets;
+            nets.reserve(net_set.size());
+            for (Net* net : net_set)
+            {
+                if (m_netlist->is_net_in_netlist(net))
+                {
+                    nets.push_back(net);
+                }
+            }
+            std::sort(nets.begin(), nets.end(), [](const Net* a, const Net* b) { return a->get_id() < b->get_id(); });
+
+            for (Net* net : nets)
+            {
+                if (const auto res = module->check_net(net, false); res.is_error())
+                {
+                    log_error("netlist", "{}", res.get_error().get());
+                    success = false;
+                }
+            }
+        }
+
+        return success;
+    }
+
     //######################################################################
     //###                      groupings                                 ###
     //######################################################################
@@ -1015,7 +1095,7 @@ namespace hal
             log_error("grouping", "ID 0 represents an invalid grouping ID.");
             return nullptr;
         }
-        if (m_netlist->m_used_grouping_ids.find(id) != m_netlist->m_used_grouping_ids.end())
+        if (m_netlist->m_grouping_ids.is_used(id))
         {
             log_error("grouping", "grouping ID {} is already taken in netlist with ID {}.", id, m_netlist->m_netlist_id);
             return nullptr;
@@ -1028,13 +1108,7 @@ namespace hal
 
         auto new_grouping = std::unique_ptr<Grouping>(new Grouping(this, m_event_handler, id, name));
 
-        auto free_id_it = m_netlist->m_free_grouping_ids.find(id);
-        if (free_id_it != m_netlist->m_free_grouping_ids.end())
-        {
-            m_netlist->m_free_grouping_ids.erase(free_id_it);
-        }
-
-        m_netlist->m_used_grouping_ids.insert(id);
+        m_netlist->m_grouping_ids.reserve(id);
 
         auto raw = new_grouping.get();
 
@@ -1077,8 +1151,7 @@ namespace hal
         utils::unordered_vector_erase(m_netlist->m_groupings, grouping);
 
         // free ids
-        m_netlist->m_free_grouping_ids.insert(grouping->get_id());
-        m_netlist->m_used_grouping_ids.erase(grouping->get_id());
+        m_netlist->m_grouping_ids.release(grouping->get_id());
 
         // notify
         m_event_handler->notify(GroupingEvent::event::removed, grouping);
@@ -1302,6 +1375,23 @@ namespace hal
 
     void NetlistInternalManager::clear_caches()
     {
-        m_lut_function_cache.clear();
+        {
+            std::lock_guard<std::mutex> lock(m_lut_function_mutex);
+            m_lut_function_cache.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_csr_mutex);
+            m_csr_cache.reset();
+        }
+    }
+
+    std::shared_ptr<const NetlistCSR> NetlistInternalManager::get_csr()
+    {
+        std::lock_guard<std::mutex> lock(m_csr_mutex);
+        if (m_csr_cache == nullptr)
+        {
+            m_csr_cache = std::make_shared<const NetlistCSR>(m_netlist);
+        }
+        return m_csr_cache;
     }
 }    // namespace hal
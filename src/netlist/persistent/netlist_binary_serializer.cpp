@@ -0,0 +1,964 @@
+#include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/gate.h"
+#include "hal_core/netlist/gate_library/gate_library_manager.h"
+#include "hal_core/netlist/module.h"
+#include "hal_core/netlist/net.h"
+#include "hal_core/netlist/netlist.h"
+#include "hal_core/netlist/persistent/netlist_serializer.h"
+#include "hal_core/netlist/project_manager.h"
+#include "hal_core/utilities/log.h"
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <chrono>
+#include <fstream>
+#include <queue>
+
+#ifndef DURATION
+#define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
+#endif
+
+namespace hal
+{
+    namespace netlist_serializer
+    {
+        namespace
+        {
+            /*
+             * Layout of a `.halb` file (all integers little-endian):
+             *
+             *   header        magic "HALB", u32 format version, u32 flags, u64 offset of the string table
+             *   netlist       gate library, id, input file, design name, device name
+             *   gates         u32 count, then per gate: id, name, type, location, data, custom functions
+             *   vcc / gnd     u32 count and gate IDs each
+             *   nets          u32 count, then per net: id, name, sources, destinations, data
+             *   global nets   u32 count and net IDs each for global inputs and outputs
+             *   modules       u32 count, then per module in BFS order: id, name, type, parent, gate IDs, pin groups, data
+             *   string table  u32 count, then per string: u32 length and raw bytes
+             *
+             * Every string in the body is stored as a u32 index into the string table, so each distinct name,
+             * type, or data value is stored exactly once.
+             */
+            const char BINARY_FORMAT_MAGIC[4] = {'H', 'A', 'L', 'B'};
+            const u32 BINARY_FORMAT_VERSION   = 1;
+            const u64 BINARY_HEADER_SIZE      = 20;
+
+            // no flags are defined yet, the field is reserved for optional features such as compression
+            const u32 BINARY_KNOWN_FLAGS = 0;
+
+            class BinaryWriter
+            {
+            public:
+                explicit BinaryWriter(std::ostream& stream) : m_stream(stream)
+                {
+                }
+
+                void write_u8(u8 value)
+                {
+                    m_stream.put((char)value);
+                }
+
+                void write_u32(u32 value)
+                {
+                    char bytes[4];
+                    for (u32 i = 0; i < 4; i++)
+                    {
+                        bytes[i] = (char)((value >> (8 * i)) & 0xFF);
+                    }
+                    m_stream.write(bytes, sizeof(bytes));
+                }
+
+                void write_i32(i32 value)
+                {
+                    write_u32((u32)value);
+                }
+
+                void write_u64(u64 value)
+                {
+                    write_u32((u32)(value & 0xFFFFFFFF));
+                    write_u32((u32)(value >> 32));
+                }
+
+                void write_string(const std::string& str)
+                {
+                    auto [it, inserted] = m_string_ids.try_emplace(str, (u32)m_strings.size());
+                    if (inserted)
+                    {
+                        m_strings.push_back(&it->first);
+                    }
+                    write_u32(it->second);
+                }
+
+                void write_data(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data)
+                {
+                    write_u32((u32)data.size());
+                    for (const auto& [key, value] : data)
+                    {
+                        write_string(std::get<0>(key));
+                        write_string(std::get<1>(key));
+                        write_string(std::get<0>(value));
+                        write_string(std::get<1>(value));
+                    }
+                }
+
+                void write_string_table()
+                {
+                    write_u32((u32)m_strings.size());
+                    for (const std::string* str : m_strings)
+                    {
+                        write_u32((u32)str->size());
+                        m_stream.write(str->data(), str->size());
+                    }
+                }
+
+            private:
+                std::ostream& m_stream;
+
+                // keys of an unordered_map are never moved, so the table may point to them
+                std::unordered_map<std::string, u32> m_string_ids;
+                std::vector<const std::string*> m_strings;
+            };
+
+            class BinaryReader
+            {
+            public:
+                explicit BinaryReader(std::string_view data) : m_data(data)
+                {
+                }
+
+                bool failed() const
+                {
+                    return m_failed;
+                }
+
+                u64 position() const
+                {
+                    return m_pos;
+                }
+
+                void seek(u64 pos)
+                {
+                    if (pos > m_data.size())
+                    {
+                        m_failed = true;
+                        return;
+                    }
+                    m_pos = pos;
+                }
+
+                /**
+                 * Restrict all further reads to the data in front of `end`, e.g., to keep the body from reading into the string table.
+                 */
+                void limit(u64 end)
+                {
+                    if (end < m_pos || end > m_data.size())
+                    {
+                        m_failed = true;
+                        return;
+                    }
+                    m_data = m_data.substr(0, end);
+                }
+
+                std::string_view read_bytes(u64 size)
+                {
+                    if (m_failed || size > m_data.size() - m_pos)
+                    {
+                        m_failed = true;
+                        return {};
+                    }
+                    std::string_view bytes = m_data.substr(m_pos, size);
+                    m_pos += size;
+                    return bytes;
+                }
+
+                u8 read_u8()
+                {
+                    std::string_view bytes = read_bytes(1);
+                    return bytes.empty() ? 0 : (u8)bytes[0];
+                }
+
+                u32 read_u32()
+                {
+                    std::string_view bytes = read_bytes(4);
+                    u32 value              = 0;
+                    for (u32 i = 0; i < bytes.size(); i++)
+                    {
+                        value |= (u32)(u8)bytes[i] << (8 * i);
+                    }
+                    return value;
+                }
+
+                i32 read_i32()
+                {
+                    return (i32)read_u32();
+                }
+
+                u64 read_u64()
+                {
+                    const u64 low  = read_u32();
+                    const u64 high = read_u32();
+                    return low | (high << 32);
+                }
+
+                /**
+                 * Read an element count and verify that at least `min_element_size` bytes per element remain,
+                 * so that a corrupted count cannot trigger huge allocations.
+                 */
+                u32 read_count(u32 min_element_size)
+                {
+                    const u32 count = read_u32();
+                    if (!m_failed && (u64)count * min_element_size > m_data.size() - m_pos)
+                    {
+                        m_failed = true;
+                        return 0;
+                    }
+                    return count;
+                }
+
+                bool read_string_table()
+                {
+                    const u32 count = read_count(4);
+                    m_strings.reserve(count);
+                    for (u32 i = 0; i < count && !m_failed; i++)
+                    {
+                        const u32 length = read_u32();
+                        m_strings.push_back(read_bytes(length));
+                    }
+                    return !m_failed;
+                }
+
+                u32 read_string_id()
+                {
+                    const u32 id = read_u32();
+                    if (!m_failed && id >= m_strings.size())
+                    {
+                        m_failed = true;
+                        return 0;
+                    }
+                    return id;
+                }
+
+                std::string_view read_string()
+                {
+                    const u32 id = read_string_id();
+                    return m_failed ? std::string_view() : m_strings[id];
+                }
+
+                u32 string_count() const
+                {
+                    return (u32)m_strings.size();
+                }
+
+                std::string_view get_string(u32 id) const
+                {
+                    return m_strings.at(id);
+                }
+
+                void read_data(DataContainer* container)
+                {
+                    const u32 count = read_count(16);
+                    for (u32 i = 0; i < count && !m_failed; i++)
+                    {
+                        const std::string_view category = read_string();
+                        const std::string_view key      = read_string();
+                        const std::string_view type     = read_string();
+                        const std::string_view value    = read_string();
+                        if (!m_failed)
+                        {
+                            container->set_data(std::string(category), std::string(key), std::string(type), std::string(value));
+                        }
+                    }
+                }
+
+            private:
+                std::string_view m_data;
+                u64 m_pos     = 0;
+                bool m_failed = false;
+                std::vector<std::string_view> m_strings;
+            };
+
+            struct BinaryPinGroupInformation
+            {
+                struct PinInformation
+                {
+                    u32 id;
+                    std::string name;
+                    Net* net;
+                    PinType type;
+                };
+
+                u32 id;
+                std::string name;
+                PinDirection direction;
+                PinType type;
+                bool ascending;
+                bool ordered;
+                i32 start_index;
+                std::vector<PinInformation> pins;
+            };
+
+            void serialize_binary(const Netlist* nl, BinaryWriter& writer)
+            {
+                writer.write_string(nl->get_gate_library()->get_path().string());
+                writer.write_u32(nl->get_id());
+                writer.write_string(nl->get_input_filename().string());
+                writer.write_string(nl->get_design_name());
+                writer.write_string(nl->get_device_name());
+
+                {
+                    std::vector<Gate*> sorted = nl->get_gates();
+                    std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.write_u32((u32)sorted.size());
+                    for (const Gate* gate : sorted)
+                    {
+                        writer.write_u32(gate->get_id());
+                        writer.write_string(gate->get_name());
+                        writer.write_string(gate->get_type()->get_name());
+                        writer.write_u8(gate->has_location() ? 1 : 0);
+                        if (gate->has_location())
+                        {
+                            writer.write_i32(gate->get_location_x());
+                            writer.write_i32(gate->get_location_y());
+                        }
+                        writer.write_data(gate->get_data_map());
+
+                        const auto functions = gate->get_boolean_functions(true);
+                        writer.write_u32((u32)functions.size());
+                        for (const auto& [name, function] : functions)
+                        {
+                            writer.write_string(name);
+                            writer.write_string(function.to_string());
+                        }
+                    }
+
+                    std::vector<u32> vcc_ids;
+                    std::vector<u32> gnd_ids;
+                    for (const Gate* gate : sorted)
+                    {
+                        if (nl->is_vcc_gate(gate))
+                        {
+                            vcc_ids.push_back(gate->get_id());
+                        }
+                        if (nl->is_gnd_gate(gate))
+                        {
+                            gnd_ids.push_back(gate->get_id());
+                        }
+                    }
+                    for (const std::vector<u32>* ids : {&vcc_ids, &gnd_ids})
+                    {
+                        writer.write_u32((u32)ids->size());
+                        for (u32 id : *ids)
+                        {
+                            writer.write_u32(id);
+                        }
+                    }
+                }
+
+                {
+                    std::vector<Net*> sorted = nl->get_nets();
+                    std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+                    writer.write_u32((u32)sorted.size());
+                    for (const Net* net : sorted)
+                    {
+                        writer.write_u32(net->get_id());
+                        writer.write_string(net->get_name());
+                        for (std::vector<Endpoint*> endpoints : {net->get_sources(), net->get_destinations()})
+                        {
+                            std::sort(endpoints.begin(), endpoints.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
+                            writer.write_u32((u32)endpoints.size());
+                            for (const Endpoint* ep : endpoints)
+                            {
+                                writer.write_u32(ep->get_gate()->get_id());
+                                writer.write_u32(ep->get_pin()->get_id());
+                            }
+                        }
+                        writer.write_data(net->get_data_map());
+                    }
+
+                    std::vector<u32> in_ids;
+                    std::vector<u32> out_ids;
+                    for (const Net* net : sorted)
+                    {
+                        if (nl->is_global_input_net(net))
+                        {
+                            in_ids.push_back(net->get_id());
+                        }
+                        if (nl->is_global_output_net(net))
+                        {
+                            out_ids.push_back(net->get_id());
+                        }
+                    }
+                    for (const std::vector<u32>* ids : {&in_ids, &out_ids})
+                    {
+                        writer.write_u32((u32)ids->size());
+                        for (u32 id : *ids)
+                        {
+                            writer.write_u32(id);
+                        }
+                    }
+                }
+
+                {
+                    // module ids are not sorted to preserve hierarchy
+                    std::vector<const Module*> modules;
+                    std::queue<const Module*> q;
+                    q.push(nl->get_top_module());
+                    while (!q.empty())
+                    {
+                        const Module* module = q.front();
+                        q.pop();
+                        modules.push_back(module);
+                        for (const Module* sm : module->get_submodules())
+                        {
+                            q.push(sm);
+                        }
+                    }
+
+                    writer.write_u32((u32)modules.size());
+                    for (const Module* module : modules)
+                    {
+                        writer.write_u32(module->get_id());
+                        writer.write_string(module->get_name());
+                        writer.write_string(module->get_type());
+                        const Module* parent = module->get_parent_module();
+                        writer.write_u32((parent == nullptr) ? 0 : parent->get_id());
+
+                        std::vector<Gate*> sorted = module->get_gates(nullptr, false);
+                        std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+                        writer.write_u32((u32)sorted.size());
+                        for (const Gate* g : sorted)
+                        {
+                            writer.write_u32(g->get_id());
+                        }
+
+                        const auto pin_groups = module->get_pin_groups();
+                        writer.write_u32((u32)pin_groups.size());
+                        for (const PinGroup<ModulePin>* pin_group : pin_groups)
+                        {
+                            writer.write_u32(pin_group->get_id());
+                            writer.write_string(pin_group->get_name());
+                            writer.write_string(enum_to_string(pin_group->get_direction()));
+                            writer.write_string(enum_to_string(pin_group->get_type()));
+                            writer.write_u8(pin_group->is_ascending() ? 1 : 0);
+                            writer.write_u8(pin_group->is_ordered() ? 1 : 0);
+                            writer.write_i32(pin_group->get_start_index());
+
+                            const auto pins = pin_group->get_pins();
+                            writer.write_u32((u32)pins.size());
+                            for (const ModulePin* pin : pins)
+                            {
+                                writer.write_u32(pin->get_id());
+                                writer.write_string(pin->get_name());
+                                writer.write_string(enum_to_string(pin->get_type()));
+                                writer.write_u32(pin->get_net()->get_id());
+                            }
+                        }
+
+                        writer.write_data(module->get_data_map());
+                    }
+                }
+            }
+
+            GateLibrary* load_binary_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+
+                if (glib_path.is_relative())
+                {
+                    ProjectManager* pm = ProjectManager::instance();
+                    if (pm)
+                        glib_path = pm->get_project_directory() / glib_path;
+                }
+
+                if (GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string()); gatelib != nullptr)
+                {
+                    return gatelib;
+                }
+
+                // not found : try the other possible gate library extension
+                glib_path.replace_extension((glib_path.extension() == ".hgl") ? ".lib" : ".hgl");
+
+                GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string());
+                if (gatelib == nullptr)
+                {
+                    log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '{}'", gate_library_path);
+                    return nullptr;
+                }
+
+                log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                return gatelib;
+            }
+
+            std::unique_ptr<Netlist> deserialize_binary(BinaryReader& reader, GateLibrary* gatelib)
+            {
+                const std::string gate_library_path = std::string(reader.read_string());
+                if (reader.failed())
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist: unexpected end of file");
+                    return nullptr;
+                }
+
+                if (!gatelib)
+                {
+                    // no preferred gate library explicitly given
+                    gatelib = load_binary_gate_library(gate_library_path);
+                    if (gatelib == nullptr)
+                    {
+                        return nullptr;
+                    }
+                }
+
+                auto nl = std::make_unique<Netlist>(gatelib);
+
+                // disable automatically checking module nets
+                nl->enable_automatic_net_checks(false);
+
+                nl->set_id(reader.read_u32());
+                nl->set_input_filename(std::string(reader.read_string()));
+                nl->set_design_name(std::string(reader.read_string()));
+                nl->set_device_name(std::string(reader.read_string()));
+
+                // gates
+                const auto& gate_types = nl->get_gate_library()->get_gate_types();
+                std::vector<GateType*> gate_type_by_string_id(reader.string_count(), nullptr);
+
+                const u32 num_gates = reader.read_count(18);
+                for (u32 i = 0; i < num_gates && !reader.failed(); i++)
+                {
+                    const u32 gate_id           = reader.read_u32();
+                    const std::string gate_name = std::string(reader.read_string());
+                    const u32 type_id           = reader.read_string_id();
+                    i32 lx                      = -1;
+                    i32 ly                      = -1;
+                    if (reader.read_u8() != 0)
+                    {
+                        lx = reader.read_i32();
+                        ly = reader.read_i32();
+                    }
+                    if (reader.failed())
+                    {
+                        break;
+                    }
+
+                    // gate types are resolved once per distinct type string
+                    GateType*& gate_type = gate_type_by_string_id[type_id];
+                    if (gate_type == nullptr)
+                    {
+                        if (const auto it = gate_types.find(std::string(reader.get_string(type_id))); it != gate_types.end())
+                        {
+                            gate_type = it->second;
+                        }
+                        else
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize gate '{}' with ID {}: failed to find gate '{}' in gate library '{}'",
+                                      gate_name,
+                                      gate_id,
+                                      reader.get_string(type_id),
+                                      nl->get_gate_library()->get_name());
+                            return nullptr;
+                        }
+                    }
+
+                    Gate* gate = nl->create_gate(gate_id, gate_type, gate_name, lx, ly);
+                    if (gate == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize gate '{}' with ID {}: failed to create gate", gate_name, gate_id);
+                        return nullptr;
+                    }
+
+                    reader.read_data(gate);
+
+                    const u32 num_functions = reader.read_count(8);
+                    for (u32 j = 0; j < num_functions && !reader.failed(); j++)
+                    {
+                        const std::string function_name = std::string(reader.read_string());
+                        const std::string function_str  = std::string(reader.read_string());
+                        if (reader.failed())
+                        {
+                            break;
+                        }
+
+                        auto func = BooleanFunction::from_string(function_str);
+                        if (func.is_error())
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize gate '{}' with ID {}: failed to parse Boolean function from string\n{}",
+                                      gate_name,
+                                      gate_id,
+                                      func.get_error().get());
+                            return nullptr;
+                        }
+                        gate->add_boolean_function(function_name, func.get());
+                    }
+                }
+
+                for (bool vcc : {true, false})
+                {
+                    const u32 num_ids = reader.read_count(4);
+                    for (u32 i = 0; i < num_ids && !reader.failed(); i++)
+                    {
+                        Gate* gate = nl->get_gate_by_id(reader.read_u32());
+                        if (gate == nullptr || !(vcc ? nl->mark_vcc_gate(gate) : nl->mark_gnd_gate(gate)))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to mark {} gate", vcc ? "VCC" : "GND");
+                            return nullptr;
+                        }
+                    }
+                }
+
+                // nets
+                const u32 num_nets = reader.read_count(20);
+                for (u32 i = 0; i < num_nets && !reader.failed(); i++)
+                {
+                    const u32 net_id           = reader.read_u32();
+                    const std::string net_name = std::string(reader.read_string());
+                    if (reader.failed())
+                    {
+                        break;
+                    }
+
+                    Net* net = nl->create_net(net_id, net_name);
+                    if (net == nullptr)
+                    {
+                        log_error("netlist_persistent", "could not deserialize net '{}' with ID {}: failed to create net", net_name, net_id);
+                        return nullptr;
+                    }
+
+                    for (bool is_source : {true, false})
+                    {
+                        const u32 num_endpoints = reader.read_count(8);
+                        for (u32 j = 0; j < num_endpoints && !reader.failed(); j++)
+                        {
+                            const u32 gate_id = reader.read_u32();
+                            const u32 pin_id  = reader.read_u32();
+
+                            Gate* gate   = nl->get_gate_by_id(gate_id);
+                            GatePin* pin = (gate != nullptr) ? gate->get_type()->get_pin_by_id(pin_id) : nullptr;
+                            if (pin == nullptr)
+                            {
+                                log_error("netlist_persistent",
+                                          "could not deserialize net '{}' with ID {}: failed to get pin with ID {} of gate with ID {}",
+                                          net_name,
+                                          net_id,
+                                          pin_id,
+                                          gate_id);
+                                return nullptr;
+                            }
+
+                            if (is_source ? (net->add_source(gate, pin) == nullptr) : (net->add_destination(gate, pin) == nullptr))
+                            {
+                                log_error("netlist_persistent",
+                                          "could not deserialize net '{}' with ID {}: failed to add pin '{}' as {}",
+                                          net_name,
+                                          net_id,
+                                          pin->get_name(),
+                                          is_source ? "source" : "destination");
+                                return nullptr;
+                            }
+                        }
+                    }
+
+                    reader.read_data(net);
+                }
+
+                for (bool input : {true, false})
+                {
+                    const u32 num_ids = reader.read_count(4);
+                    for (u32 i = 0; i < num_ids && !reader.failed(); i++)
+                    {
+                        Net* net = nl->get_net_by_id(reader.read_u32());
+                        if (net == nullptr || !(input ? nl->mark_global_input_net(net) : nl->mark_global_output_net(net)))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to mark global {} net", input ? "input" : "output");
+                            return nullptr;
+                        }
+                    }
+                }
+
+                // modules
+                std::vector<std::pair<Module*, std::vector<BinaryPinGroupInformation>>> pin_group_cache;
+                const u32 num_modules = reader.read_count(28);
+                for (u32 i = 0; i < num_modules && !reader.failed(); i++)
+                {
+                    const u32 module_id           = reader.read_u32();
+                    const std::string module_name = std::string(reader.read_string());
+                    const std::string module_type = std::string(reader.read_string());
+                    const u32 parent_id           = reader.read_u32();
+                    if (reader.failed())
+                    {
+                        break;
+                    }
+
+                    Module* sm = nl->get_top_module();
+                    if (parent_id == 0)
+                    {
+                        // top_module must not be created but might be renamed
+                        if (module_name != sm->get_name())
+                        {
+                            sm->set_name(module_name);
+                        }
+                    }
+                    else
+                    {
+                        Module* parent = nl->get_module_by_id(parent_id);
+                        sm             = (parent != nullptr) ? nl->create_module(module_id, module_name, parent) : nullptr;
+                        if (sm == nullptr)
+                        {
+                            log_error("netlist_persistent", "could not deserialize module '{}' with ID {}: failed to create module", module_name, module_id);
+                            return nullptr;
+                        }
+                    }
+                    sm->set_type(module_type);
+
+                    const u32 num_module_gates = reader.read_count(4);
+                    std::vector<Gate*> gates;
+                    if (!sm->is_top_module())
+                    {
+                        gates.reserve(num_module_gates);
+                    }
+                    for (u32 j = 0; j < num_module_gates && !reader.failed(); j++)
+                    {
+                        const u32 gate_id = reader.read_u32();
+                        if (sm->is_top_module())
+                        {
+                            continue;
+                        }
+
+                        Gate* gate = nl->get_gate_by_id(gate_id);
+                        if (gate == nullptr)
+                        {
+                            log_error("netlist_persistent", "could not deserialize module '{}' with ID {}: failed to find gate with ID {}", module_name, module_id, gate_id);
+                            return nullptr;
+                        }
+                        gates.push_back(gate);
+                    }
+                    if (!gates.empty())
+                    {
+                        sm->assign_gates(gates);
+                    }
+
+                    // pins need to be cached until all modules have been instantiated
+                    auto& pin_groups         = pin_group_cache.emplace_back(sm, std::vector<BinaryPinGroupInformation>()).second;
+                    const u32 num_pin_groups = reader.read_count(26);
+                    for (u32 j = 0; j < num_pin_groups && !reader.failed(); j++)
+                    {
+                        BinaryPinGroupInformation& pin_group = pin_groups.emplace_back();
+                        pin_group.id                         = reader.read_u32();
+                        pin_group.name                       = std::string(reader.read_string());
+                        pin_group.direction                  = enum_from_string<PinDirection>(std::string(reader.read_string()), PinDirection::none);
+                        pin_group.type                       = enum_from_string<PinType>(std::string(reader.read_string()), PinType::none);
+                        pin_group.ascending                  = reader.read_u8() != 0;
+                        pin_group.ordered                    = reader.read_u8() != 0;
+                        pin_group.start_index                = reader.read_i32();
+
+                        const u32 num_pins = reader.read_count(16);
+                        pin_group.pins.reserve(num_pins);
+                        for (u32 k = 0; k < num_pins && !reader.failed(); k++)
+                        {
+                            BinaryPinGroupInformation::PinInformation& pin = pin_group.pins.emplace_back();
+                            pin.id                                        = reader.read_u32();
+                            pin.name                                      = std::string(reader.read_string());
+                            pin.type                                      = enum_from_string<PinType>(std::string(reader.read_string()), PinType::none);
+                            pin.net                                       = nl->get_net_by_id(reader.read_u32());
+                            if (!reader.failed() && pin.net == nullptr)
+                            {
+                                log_error("netlist_persistent", "could not deserialize pin '{}' of module '{}' with ID {}: failed to find net", pin.name, module_name, module_id);
+                                return nullptr;
+                            }
+                        }
+                    }
+
+                    reader.read_data(sm);
+                }
+
+                if (reader.failed())
+                {
+                    log_error("netlist_persistent", "could not deserialize netlist: unexpected end of file or invalid string reference");
+                    return nullptr;
+                }
+
+                // update module nets, internal nets, input nets, and output nets
+                for (Module* mod : nl->get_modules())
+                {
+                    mod->update_nets();
+                }
+
+                // load module pins (nets must have been updated beforehand)
+                for (const auto& [sm, pin_groups] : pin_group_cache)
+                {
+                    for (const BinaryPinGroupInformation& pg : pin_groups)
+                    {
+                        std::vector<ModulePin*> pins;
+                        pins.reserve(pg.pins.size());
+                        for (const BinaryPinGroupInformation::PinInformation& p : pg.pins)
+                        {
+                            if (auto res = sm->create_pin(p.id, p.name, p.net, p.type, false); res.is_error())
+                            {
+                                log_error("netlist_persistent",
+                                          "could not deserialize pin '{}' of module '{}' with ID {}: failed to create pin\n{}",
+                                          p.name,
+                                          sm->get_name(),
+                                          sm->get_id(),
+                                          res.get_error().get());
+                                return nullptr;
+                            }
+                            else
+                            {
+                                pins.push_back(res.get());
+                            }
+                        }
+
+                        if (auto res = sm->create_pin_group(pg.id, pg.name, pins, pg.direction, pg.type, pg.ascending, (u32)pg.start_index); res.is_error())
+                        {
+                            log_error("netlist_persistent",
+                                      "could not deserialize pin group '{}' of module '{}' with ID {}: failed to create pin group\n{}",
+                                      pg.name,
+                                      sm->get_name(),
+                                      sm->get_id(),
+                                      res.get_error().get());
+                            return nullptr;
+                        }
+                        else
+                        {
+                            res.get()->set_ordered(pg.ordered);
+                        }
+                    }
+                }
+
+                // re-enable automatically checking module nets
+                nl->enable_automatic_net_checks(true);
+
+                return nl;
+            }
+        }    // namespace
+
+        bool serialize_to_binary_file(const Netlist* nl, const std::filesystem::path& halb_file)
+        {
+            if (nl == nullptr)
+            {
+                return false;
+            }
+
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            std::filesystem::path serialize_to_dir = halb_file.parent_path();
+            if (serialize_to_dir.empty())
+                return false;
+
+            if (serialize_to_dir.is_relative())
+                serialize_to_dir = ProjectManager::instance()->get_project_directory() / serialize_to_dir;
+
+            // create directory if it got erased in the meantime
+            if (!std::filesystem::exists(serialize_to_dir))
+            {
+                std::error_code err;
+                if (!std::filesystem::create_directories(serialize_to_dir, err))
+                {
+                    log_error("netlist_persistent", "Could not create directory '{}', error was '{}'.", serialize_to_dir.string(), err.message());
+                    return false;
+                }
+            }
+
+            std::ofstream halb_file_stream(halb_file, std::ios::binary);
+            if (halb_file_stream.fail())
+            {
+                log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", halb_file.string());
+                return false;
+            }
+
+            BinaryWriter writer(halb_file_stream);
+
+            // the offset of the string table is patched once the body has been written
+            halb_file_stream.write(BINARY_FORMAT_MAGIC, sizeof(BINARY_FORMAT_MAGIC));
+            writer.write_u32(BINARY_FORMAT_VERSION);
+            writer.write_u32(0);
+            writer.write_u64(0);
+
+            serialize_binary(nl, writer);
+
+            const u64 string_table_offset = (u64)halb_file_stream.tellp();
+            writer.write_string_table();
+
+            halb_file_stream.seekp(BINARY_HEADER_SIZE - 8);
+            writer.write_u64(string_table_offset);
+
+            halb_file_stream.close();
+            if (halb_file_stream.fail())
+            {
+                log_error("netlist_persistent", "could not write file {}", halb_file.string());
+                return false;
+            }
+
+            log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+            return true;
+        }
+
+        std::unique_ptr<Netlist> deserialize_from_binary_file(const std::filesystem::path& halb_file, GateLibrary* gatelib)
+        {
+            auto begin_time = std::chrono::high_resolution_clock::now();
+
+            MemoryMappedFile file;
+            if (auto res = file.map(halb_file); res.is_error())
+            {
+                log_error("netlist_persistent", "unable to open '{}':\n{}", halb_file.string(), res.get_error().get());
+                return nullptr;
+            }
+
+            BinaryReader reader(file.get_data());
+            if (reader.read_bytes(sizeof(BINARY_FORMAT_MAGIC)) != std::string_view(BINARY_FORMAT_MAGIC, sizeof(BINARY_FORMAT_MAGIC)))
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': file is not a binary netlist", halb_file.string());
+                return nullptr;
+            }
+
+            const u32 version = reader.read_u32();
+            if (version != BINARY_FORMAT_VERSION)
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': unsupported binary format version {}", halb_file.string(), version);
+                return nullptr;
+            }
+
+            const u32 flags = reader.read_u32();
+            if ((flags & ~BINARY_KNOWN_FLAGS) != 0)
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': unsupported binary format flags {:#x}", halb_file.string(), flags);
+                return nullptr;
+            }
+
+            const u64 string_table_offset = reader.read_u64();
+            if (reader.failed() || string_table_offset < BINARY_HEADER_SIZE)
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': file header is corrupted", halb_file.string());
+                return nullptr;
+            }
+
+            reader.seek(string_table_offset);
+            if (!reader.read_string_table())
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': string table is corrupted", halb_file.string());
+                return nullptr;
+            }
+            reader.seek(BINARY_HEADER_SIZE);
+            reader.limit(string_table_offset);
+
+            auto netlist = deserialize_binary(reader, gatelib);
+            if (netlist == nullptr)
+            {
+                return nullptr;
+            }
+
+            if (reader.position() != string_table_offset)
+            {
+                log_error("netlist_persistent", "could not deserialize '{}': unexpected data after the last module", halb_file.string());
+                return nullptr;
+            }
+
+            log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", halb_file.string(), DURATION(begin_time));
+
+            return netlist;
+        }
+    }    // namespace netlist_serializer
+}    // namespace hal
+
+#undef DURATION
@@ -9,7 +9,8 @@
 #include "hal_core/netlist/project_manager.h"
 #include "hal_core/utilities/log.h"
 #include "rapidjson/filereadstream.h"
-#include "rapidjson/stringbuffer.h"
+#include "rapidjson/filewritestream.h"
+#include "rapidjson/reader.h"
 
 #define PRETTY_JSON_OUTPUT false
 #if PRETTY_JSON_OUTPUT
@@ -22,6 +23,7 @@
 #include <fstream>
 #include <queue>
 #include <sstream>
+#include <unordered_set>
 
 #ifndef DURATION
 #define DURATION(begin_time) ((double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - begin_time).count() / 1000)
@@ -38,7 +40,13 @@ namespace hal
             int encoded_format_version;
 
             // Ver 12 : location of gates
-#define JSON_STR_HELPER(x) rapidjson::Value{}.SetString(x.c_str(), x.length(), allocator)
+
+            // objects are written to the file as soon as they have been serialized
+#if PRETTY_JSON_OUTPUT
+            using JsonWriter = rapidjson::PrettyWriter<rapidjson::FileWriteStream>;
+#else
+            using JsonWriter = rapidjson::Writer<rapidjson::FileWriteStream>;
+#endif
 
 #define assert_availablility(MEMBER)                                                               \
     if (!root.HasMember(MEMBER))                                                                   \
@@ -72,19 +80,25 @@ namespace hal
             }    // namespace
 
             // serialize container data
-            rapidjson::Value serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data, JsonWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kArrayType);
+                if (data.empty())
+                {
+                    return;
+                }
+
+                writer.Key("data");
+                writer.StartArray();
                 for (const auto& it : data)
                 {
-                    rapidjson::Value entry(rapidjson::kArrayType);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.first)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<0>(it.second)), allocator);
-                    entry.PushBack(JSON_STR_HELPER(std::get<1>(it.second)), allocator);
-                    val.PushBack(entry, allocator);
+                    writer.StartArray();
+                    writer.String(std::get<0>(it.first));
+                    writer.String(std::get<1>(it.first));
+                    writer.String(std::get<0>(it.second));
+                    writer.String(std::get<1>(it.second));
+                    writer.EndArray();
                 }
-                return val;
+                writer.EndArray();
             }
 
             void deserialize_data(DataContainer* c, const rapidjson::Value& val)
@@ -96,12 +110,14 @@ namespace hal
             }
 
             // serialize endpoint
-            rapidjson::Value serialize(const Endpoint* ep, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const Endpoint* ep, JsonWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("gate_id", ep->get_gate()->get_id(), allocator);
-                val.AddMember("pin_id", ep->get_pin()->get_id(), allocator);
-                return val;
+                writer.StartObject();
+                writer.Key("gate_id");
+                writer.Uint(ep->get_gate()->get_id());
+                writer.Key("pin_id");
+                writer.Uint(ep->get_pin()->get_id());
+                writer.EndObject();
             }
 
             bool deserialize_destination(Netlist* nl, Net* net, const rapidjson::Value& val)
@@ -236,35 +252,38 @@ namespace hal
             }
 
             // serialize gate
-            rapidjson::Value serialize(const Gate* gate, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const Gate* gate, JsonWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", gate->get_id(), allocator);
-                val.AddMember("name", gate->get_name(), allocator);
-                val.AddMember("type", gate->get_type()->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(gate->get_id());
+                writer.Key("name");
+                writer.String(gate->get_name());
+                writer.Key("type");
+                writer.String(gate->get_type()->get_name());
                 if (gate->has_location())
                 {
-                    val.AddMember("location_x", gate->get_location_x(), allocator);
-                    val.AddMember("location_y", gate->get_location_y(), allocator);
+                    writer.Key("location_x");
+                    writer.Int(gate->get_location_x());
+                    writer.Key("location_y");
+                    writer.Int(gate->get_location_y());
                 }
-                auto data = serialize(gate->get_data_map(), allocator);
-                if (!data.Empty())
+                serialize(gate->get_data_map(), writer);
                 {
-                    val.AddMember("data", data, allocator);
-                }
-                {
-                    rapidjson::Value functions(rapidjson::kObjectType);
-                    for (const auto& [name, function] : gate->get_boolean_functions(true))
-                    {
-                        const std::string function_str = function.to_string();
-                        functions.AddMember(JSON_STR_HELPER(name), JSON_STR_HELPER(function_str), allocator);
-                    }
-                    if (functions.MemberCount() > 0)
+                    const auto functions = gate->get_boolean_functions(true);
+                    if (!functions.empty())
                     {
-                        val.AddMember("custom_functions", functions, allocator);
+                        writer.Key("custom_functions");
+                        writer.StartObject();
+                        for (const auto& [name, function] : functions)
+                        {
+                            writer.Key(name);
+                            writer.String(function.to_string());
+                        }
+                        writer.EndObject();
                     }
                 }
-                return val;
+                writer.EndObject();
             }
 
             bool deserialize_gate(Netlist* nl, const rapidjson::Value& val, const std::unordered_map<std::string, hal::GateType*>& gate_types)
@@ -320,46 +339,46 @@ namespace hal
             }
 
             // serialize net
-            rapidjson::Value serialize(const Net* net, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const Net* net, JsonWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", net->get_id(), allocator);
-                val.AddMember("name", net->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(net->get_id());
+                writer.Key("name");
+                writer.String(net->get_name());
 
                 {
-                    rapidjson::Value srcs(rapidjson::kArrayType);
                     std::vector<Endpoint*> sorted = net->get_sources();
                     std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* src : sorted)
+                    if (!sorted.empty())
                     {
-                        srcs.PushBack(serialize(src, allocator), allocator);
-                    }
-                    if (!srcs.Empty())
-                    {
-                        val.AddMember("srcs", srcs, allocator);
+                        writer.Key("srcs");
+                        writer.StartArray();
+                        for (const Endpoint* src : sorted)
+                        {
+                            serialize(src, writer);
+                        }
+                        writer.EndArray();
                     }
                 }
 
                 {
-                    rapidjson::Value dsts(rapidjson::kArrayType);
                     std::vector<Endpoint*> sorted = net->get_destinations();
                     std::sort(sorted.begin(), sorted.end(), [](Endpoint* lhs, Endpoint* rhs) { return lhs->get_gate()->get_id() < rhs->get_gate()->get_id(); });
-                    for (const Endpoint* dst : sorted)
+                    if (!sorted.empty())
                     {
-                        dsts.PushBack(serialize(dst, allocator), allocator);
-                    }
-                    if (!dsts.Empty())
-                    {
-                        val.AddMember("dsts", dsts, allocator);
+                        writer.Key("dsts");
+                        writer.StartArray();
+                        for (const Endpoint* dst : sorted)
+                        {
+                            serialize(dst, writer);
+                        }
+                        writer.EndArray();
                     }
                 }
 
-                auto data = serialize(net->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
-                }
-                return val;
+                serialize(net->get_data_map(), writer);
+                writer.EndObject();
             }
 
             bool deserialize_net(Netlist* nl, const rapidjson::Value& val)
@@ -406,71 +425,86 @@ namespace hal
             }
 
             // serialize module
-            rapidjson::Value serialize(const Module* module, rapidjson::Document::AllocatorType& allocator)
+            void serialize(const Module* module, JsonWriter& writer)
             {
-                rapidjson::Value val(rapidjson::kObjectType);
-                val.AddMember("id", module->get_id(), allocator);
-                val.AddMember("type", module->get_type(), allocator);
-                val.AddMember("name", module->get_name(), allocator);
+                writer.StartObject();
+                writer.Key("id");
+                writer.Uint(module->get_id());
+                writer.Key("type");
+                writer.String(module->get_type());
+                writer.Key("name");
+                writer.String(module->get_name());
+                writer.Key("parent");
                 Module* parent = module->get_parent_module();
                 if (parent == nullptr)
                 {
-                    val.AddMember("parent", 0, allocator);
+                    writer.Int(0);
                 }
                 else
                 {
-                    val.AddMember("parent", parent->get_id(), allocator);
+                    writer.Uint(parent->get_id());
                 }
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
                     std::vector<Gate*> sorted = module->get_gates(nullptr, false);
                     std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
-                    for (const Gate* g : sorted)
+                    if (!sorted.empty())
                     {
-                        gates.PushBack(g->get_id(), allocator);
-                    }
-                    if (!gates.Empty())
-                    {
-                        val.AddMember("gates", gates, allocator);
+                        writer.Key("gates");
+                        writer.StartArray();
+                        for (const Gate* g : sorted)
+                        {
+                            writer.Uint(g->get_id());
+                        }
+                        writer.EndArray();
                     }
                 }
                 {
-                    rapidjson::Value json_pin_groups(rapidjson::kArrayType);
-                    for (const PinGroup<ModulePin>* pin_group : module->get_pin_groups())
+                    const auto pin_groups = module->get_pin_groups();
+                    if (!pin_groups.empty())
                     {
-                        rapidjson::Value json_pin_group(rapidjson::kObjectType);
-                        json_pin_group.AddMember("id", pin_group->get_id(), allocator);
-                        json_pin_group.AddMember("name", pin_group->get_name(), allocator);
-                        json_pin_group.AddMember("direction", enum_to_string(pin_group->get_direction()), allocator);
-                        json_pin_group.AddMember("type", enum_to_string(pin_group->get_type()), allocator);
-                        json_pin_group.AddMember("ascending", pin_group->is_ascending(), allocator);
-                        json_pin_group.AddMember("ordered", pin_group->is_ordered(), allocator);
-                        json_pin_group.AddMember("start_index", pin_group->get_start_index(), allocator);
-                        rapidjson::Value json_pins(rapidjson::kArrayType);
-                        for (const ModulePin* pin : pin_group->get_pins())
+                        writer.Key("pin_groups");
+                        writer.StartArray();
+                        for (const PinGroup<ModulePin>* pin_group : pin_groups)
                         {
-                            rapidjson::Value json_pin(rapidjson::kObjectType);
-                            json_pin.AddMember("id", pin->get_id(), allocator);
-                            json_pin.AddMember("name", pin->get_name(), allocator);
-                            json_pin.AddMember("type", enum_to_string(pin->get_type()), allocator);
-                            json_pin.AddMember("net_id", pin->get_net()->get_id(), allocator);
-                            json_pins.PushBack(json_pin, allocator);
+                            writer.StartObject();
+                            writer.Key("id");
+                            writer.Uint(pin_group->get_id());
+                            writer.Key("name");
+                            writer.String(pin_group->get_name());
+                            writer.Key("direction");
+                            writer.String(enum_to_string(pin_group->get_direction()));
+                            writer.Key("type");
+                            writer.String(enum_to_string(pin_group->get_type()));
+                            writer.Key("ascending");
+                            writer.Bool(pin_group->is_ascending());
+                            writer.Key("ordered");
+                            writer.Bool(pin_group->is_ordered());
+                            writer.Key("start_index");
+                            writer.Int(pin_group->get_start_index());
+                            writer.Key("pins");
+                            writer.StartArray();
+                            for (const ModulePin* pin : pin_group->get_pins())
+                            {
+                                writer.StartObject();
+                                writer.Key("id");
+                                writer.Uint(pin->get_id());
+                                writer.Key("name");
+                                writer.String(pin->get_name());
+                                writer.Key("type");
+                                writer.String(enum_to_string(pin->get_type()));
+                                writer.Key("net_id");
+                                writer.Uint(pin->get_net()->get_id());
+                                writer.EndObject();
+                            }
+                            writer.EndArray();
+                            writer.EndObject();
                         }
-                        json_pin_group.AddMember("pins", json_pins, allocator);
-                        json_pin_groups.PushBack(json_pin_group, allocator);
-                    }
-                    if (!json_pin_groups.Empty())
-                    {
-                        val.AddMember("pin_groups", json_pin_groups, allocator);
+                        writer.EndArray();
                     }
                 }
 
-                auto data = serialize(module->get_data_map(), allocator);
-                if (!data.Empty())
-                {
-                    val.AddMember("data", data, allocator);
-                }
-                return val;
+                serialize(module->get_data_map(), writer);
+                writer.EndObject();
             }
 
             bool deserialize_module(Netlist* nl, const rapidjson::Value& val, std::unordered_map<Module*, std::vector<PinGroupInformation>>& pin_group_cache)
@@ -640,67 +674,103 @@ namespace hal
             }
 
             // serialize netlist
-            void serialize(const Netlist* nl, rapidjson::Document& document)
+            void serialize(const Netlist* nl, JsonWriter& writer)
             {
-                rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-                rapidjson::Value root(rapidjson::kObjectType);
-
-                root.AddMember("gate_library", nl->get_gate_library()->get_path().string(), allocator);
-                root.AddMember("id", nl->get_id(), allocator);
-                root.AddMember("input_file", nl->get_input_filename().string(), allocator);
-                root.AddMember("design_name", nl->get_design_name(), allocator);
-                root.AddMember("device_name", nl->get_device_name(), allocator);
+                writer.StartObject();
+                writer.Key("gate_library");
+                writer.String(nl->get_gate_library()->get_path().string());
+                writer.Key("id");
+                writer.Uint(nl->get_id());
+                writer.Key("input_file");
+                writer.String(nl->get_input_filename().string());
+                writer.Key("design_name");
+                writer.String(nl->get_design_name());
+                writer.Key("device_name");
+                writer.String(nl->get_device_name());
 
                 {
-                    rapidjson::Value gates(rapidjson::kArrayType);
-                    rapidjson::Value global_vccs(rapidjson::kArrayType);
-                    rapidjson::Value global_gnds(rapidjson::kArrayType);
                     std::vector<Gate*> sorted = nl->get_gates();
                     std::sort(sorted.begin(), sorted.end(), [](Gate* lhs, Gate* rhs) { return lhs->get_id() < rhs->get_id(); });
+
+                    std::vector<u32> global_vccs;
+                    std::vector<u32> global_gnds;
+                    writer.Key("gates");
+                    writer.StartArray();
                     for (const Gate* gate : sorted)
                     {
-                        gates.PushBack(serialize(gate, allocator), allocator);
+                        serialize(gate, writer);
 
                         if (nl->is_gnd_gate(gate))
                         {
-                            global_gnds.PushBack(gate->get_id(), allocator);
+                            global_gnds.push_back(gate->get_id());
                         }
 
                         if (nl->is_vcc_gate(gate))
                         {
-                            global_vccs.PushBack(gate->get_id(), allocator);
+                            global_vccs.push_back(gate->get_id());
                         }
                     }
-                    root.AddMember("gates", gates, allocator);
-                    root.AddMember("global_vcc", global_vccs, allocator);
-                    root.AddMember("global_gnd", global_gnds, allocator);
+                    writer.EndArray();
+
+                    writer.Key("global_vcc");
+                    writer.StartArray();
+                    for (u32 id : global_vccs)
+                    {
+                        writer.Uint(id);
+                    }
+                    writer.EndArray();
+
+                    writer.Key("global_gnd");
+                    writer.StartArray();
+                    for (u32 id : global_gnds)
+                    {
+                        writer.Uint(id);
+                    }
+                    writer.EndArray();
                 }
                 {
-                    rapidjson::Value nets(rapidjson::kArrayType);
-                    rapidjson::Value global_in(rapidjson::kArrayType);
-                    rapidjson::Value global_out(rapidjson::kArrayType);
                     std::vector<Net*> sorted = nl->get_nets();
                     std::sort(sorted.begin(), sorted.end(), [](Net* lhs, Net* rhs) { return lhs->get_id() < rhs->get_id(); });
+
+                    std::vector<u32> global_in;
+                    std::vector<u32> global_out;
+                    writer.Key("nets");
+                    writer.StartArray();
                     for (const Net* net : sorted)
                     {
-                        nets.PushBack(serialize(net, allocator), allocator);
+                        serialize(net, writer);
 
                         if (nl->is_global_input_net(net))
                         {
-                            global_in.PushBack(net->get_id(), allocator);
+                            global_in.push_back(net->get_id());
                         }
 
                         if (nl->is_global_output_net(net))
                         {
-                            global_out.PushBack(net->get_id(), allocator);
+                            global_out.push_back(net->get_id());
                         }
                     }
-                    root.AddMember("nets", nets, allocator);
-                    root.AddMember("global_in", global_in, allocator);
-                    root.AddMember("global_out", global_out, allocator);
+                    writer.EndArray();
+
+                    writer.Key("global_in");
+                    writer.StartArray();
+                    for (u32 id : global_in)
+                    {
+                        writer.Uint(id);
+                    }
+                    writer.EndArray();
+
+                    writer.Key("global_out");
+                    writer.StartArray();
+                    for (u32 id : global_out)
+                    {
+                        writer.Uint(id);
+                    }
+                    writer.EndArray();
                 }
                 {
-                    rapidjson::Value modules(rapidjson::kArrayType);
+                    writer.Key("modules");
+                    writer.StartArray();
 
                     // module ids are not sorted to preserve hierarchy
                     std::queue<const Module*> q;
@@ -710,17 +780,69 @@ namespace hal
                         const Module* module = q.front();
                         q.pop();
 
-                        modules.PushBack(serialize(module, allocator), allocator);
+                        serialize(module, writer);
 
                         for (const Module* sm : module->get_submodules())
                         {
                             q.push(sm);
                         }
                     }
-                    root.AddMember("modules", modules, allocator);
+                    writer.EndArray();
+                }
+
+                writer.EndObject();
+            }
+
+            GateLibrary* load_gate_library(const std::string& gate_library_path)
+            {
+                std::filesystem::path glib_path(gate_library_path);
+
+                if (glib_path.is_relative())
+                {
+                    ProjectManager* pm = ProjectManager::instance();
+                    if (pm)
+                        glib_path = pm->get_project_directory() / glib_path;
+                }
+                GateLibrary* gatelib = gate_library_manager::get_gate_library(glib_path.string());
+
+                if (gatelib == nullptr)
+                {
+                    // not found : try the other possible gate library extension
+                    if (glib_path.extension() == ".hgl")
+                    {
+                        glib_path.replace_extension(".lib");
+                    }
+                    else
+                    {
+                        glib_path.replace_extension(".hgl");
+                    }
+
+                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
+                    if (gatelib == nullptr)
+                    {
+                        log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + gate_library_path + "'");
+                        return nullptr;
+                    }
+                    else
+                    {
+                        log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", gate_library_path, glib_path.string());
+                    }
                 }
 
-                document.AddMember("netlist", root, document.GetAllocator());
+                return gatelib;
+            }
+
+            void set_encoded_format_version(int version)
+            {
+                encoded_format_version = version;
+                if (encoded_format_version < SERIALIZATION_FORMAT_VERSION)
+                {
+                    log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+                }
+                else if (encoded_format_version > SERIALIZATION_FORMAT_VERSION)
+                {
+                    log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+                }
             }
 
             std::unique_ptr<Netlist> deserialize(const rapidjson::Document& document, GateLibrary* gatelib)
@@ -741,38 +863,10 @@ namespace hal
                         return nullptr;
                     }
 
-                    std::filesystem::path glib_path(root["gate_library"].GetString());
-
-                    if (glib_path.is_relative())
-                    {
-                        ProjectManager* pm = ProjectManager::instance();
-                        if (pm)
-                            glib_path = pm->get_project_directory() / glib_path;
-                    }
-                    gatelib = gate_library_manager::get_gate_library(glib_path.string());
-
+                    gatelib = load_gate_library(root["gate_library"].GetString());
                     if (gatelib == nullptr)
                     {
-                        // not found : try the other possible gate library extension
-                        if (glib_path.extension() == ".hgl")
-                        {
-                            glib_path.replace_extension(".lib");
-                        }
-                        else
-                        {
-                            glib_path.replace_extension(".hgl");
-                        }
-
-                        gatelib = gate_library_manager::get_gate_library(glib_path.string());
-                        if (gatelib == nullptr)
-                        {
-                            log_critical("netlist_persistent", "could not deserialize netlist: failed to load gate library '" + std::string(root["gate_library"].GetString()) + "'");
-                            return nullptr;
-                        }
-                        else
-                        {
-                            log_info("netlist_persistent", "gate library '{}' required but using '{}' instead.", root["gate_library"].GetString(), glib_path.string());
-                        }
+                        return nullptr;
                     }
                 }
 
@@ -928,6 +1022,529 @@ namespace hal
                 return nl;
             }
 
+            /*
+             * SAX handler that creates the netlist while the file is being parsed.
+             * Members of the root node and of the 'netlist' node as well as single elements of the 'gates', 'nets', and 'modules' arrays
+             * are collected into small DOM values one at a time, handed to the functions above, and released before the next one is read.
+             * Hence, gates and nets are created as soon as they have been read and the complete document is never held in memory.
+             *
+             * The handler relies on the nodes being in the order written by the serializer. Otherwise, it aborts and requests the file to be
+             * deserialized as a complete document instead.
+             */
+            class NetlistReaderHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, NetlistReaderHandler>
+            {
+            public:
+                explicit NetlistReaderHandler(GateLibrary* gatelib) : m_gatelib(gatelib)
+                {
+                }
+
+                bool Null()
+                {
+                    rapidjson::Value value;
+                    return add_value(value);
+                }
+
+                bool Bool(bool b)
+                {
+                    rapidjson::Value value(b);
+                    return add_value(value);
+                }
+
+                bool Int(int i)
+                {
+                    rapidjson::Value value(i);
+                    return add_value(value);
+                }
+
+                bool Uint(unsigned u)
+                {
+                    rapidjson::Value value(u);
+                    return add_value(value);
+                }
+
+                bool Int64(int64_t i)
+                {
+                    rapidjson::Value value(i);
+                    return add_value(value);
+                }
+
+                bool Uint64(uint64_t u)
+                {
+                    rapidjson::Value value(u);
+                    return add_value(value);
+                }
+
+                bool Double(double d)
+                {
+                    rapidjson::Value value(d);
+                    return add_value(value);
+                }
+
+                bool String(const char* str, rapidjson::SizeType length, bool)
+                {
+                    rapidjson::Value value(str, length, m_allocator);
+                    return add_value(value);
+                }
+
+                bool Key(const char* str, rapidjson::SizeType length, bool)
+                {
+                    if (!m_stack.empty())
+                    {
+                        m_keys.emplace_back(str, length, m_allocator);
+                    }
+                    else if (m_depth == 1)
+                    {
+                        m_root_key.assign(str, length);
+                    }
+                    else if (m_depth == 2)
+                    {
+                        m_netlist_key.assign(str, length);
+                    }
+                    return true;
+                }
+
+                bool StartObject()
+                {
+                    return start_container(rapidjson::kObjectType);
+                }
+
+                bool EndObject(rapidjson::SizeType)
+                {
+                    return end_container();
+                }
+
+                bool StartArray()
+                {
+                    return start_container(rapidjson::kArrayType);
+                }
+
+                bool EndArray(rapidjson::SizeType)
+                {
+                    return end_container();
+                }
+
+                bool requires_document() const
+                {
+                    return m_requires_document;
+                }
+
+                std::unique_ptr<Netlist> take_netlist()
+                {
+                    if (!m_netlist_read)
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
+                        return nullptr;
+                    }
+                    return std::move(m_netlist);
+                }
+
+            private:
+                enum class Table
+                {
+                    none,
+                    gates,
+                    nets,
+                    modules
+                };
+
+                GateLibrary* m_gatelib;
+                std::unique_ptr<Netlist> m_netlist;
+                std::unordered_map<std::string, GateType*> m_gate_types;
+                std::unordered_map<Module*, std::vector<PinGroupInformation>> m_pin_group_cache;
+
+                // nesting depth of the root node (1), the 'netlist' node (2), and the 'gates', 'nets', or 'modules' array (3)
+                u32 m_depth = 0;
+                std::string m_root_key;
+                std::string m_netlist_key;
+                Table m_table = Table::none;
+
+                // DOM value that is currently being collected
+                rapidjson::MemoryPoolAllocator<> m_allocator;
+                std::vector<rapidjson::Value> m_stack;
+                std::vector<rapidjson::Value> m_keys;
+
+                std::unordered_set<std::string> m_read_nodes;
+                bool m_version_read      = false;
+                bool m_netlist_read      = false;
+                bool m_requires_document = false;
+
+                std::string m_gate_library_path;
+                u32 m_id = 0;
+                std::string m_input_file;
+                std::string m_design_name;
+                std::string m_device_name;
+
+                bool request_document()
+                {
+                    m_requires_document = true;
+                    return false;
+                }
+
+                bool start_container(rapidjson::Type type)
+                {
+                    if (!m_stack.empty())
+                    {
+                        m_stack.emplace_back(type);
+                        return true;
+                    }
+
+                    if (m_depth == 0)
+                    {
+                        if (type != rapidjson::kObjectType)
+                        {
+                            log_error("netlist_persistent", "invalid json string for deserialization");
+                            return false;
+                        }
+                        m_depth = 1;
+                        return true;
+                    }
+
+                    if (m_depth == 1 && type == rapidjson::kObjectType && m_root_key == "netlist")
+                    {
+                        m_depth = 2;
+                        return begin_netlist();
+                    }
+
+                    if (m_depth == 2 && type == rapidjson::kArrayType && (m_netlist_key == "gates" || m_netlist_key == "nets" || m_netlist_key == "modules"))
+                    {
+                        m_depth = 3;
+                        return begin_table();
+                    }
+
+                    m_stack.emplace_back(type);
+                    return true;
+                }
+
+                bool end_container()
+                {
+                    if (!m_stack.empty())
+                    {
+                        rapidjson::Value value;
+                        value.Swap(m_stack.back());
+                        m_stack.pop_back();
+                        return add_value(value);
+                    }
+
+                    m_depth--;
+                    if (m_depth == 2)
+                    {
+                        return end_table();
+                    }
+                    if (m_depth == 1)
+                    {
+                        return end_netlist();
+                    }
+                    return true;
+                }
+
+                bool add_value(rapidjson::Value& value)
+                {
+                    if (m_stack.empty())
+                    {
+                        return complete_value(value);
+                    }
+
+                    rapidjson::Value& parent = m_stack.back();
+                    if (parent.IsObject())
+                    {
+                        parent.AddMember(m_keys.back(), value, m_allocator);
+                        m_keys.pop_back();
+                    }
+                    else
+                    {
+                        parent.PushBack(value, m_allocator);
+                    }
+                    return true;
+                }
+
+                bool complete_value(rapidjson::Value& value)
+                {
+                    bool success = false;
+                    if (m_depth == 1)
+                    {
+                        success = read_root_member(value);
+                    }
+                    else if (m_depth == 2)
+                    {
+                        success = read_netlist_member(value);
+                    }
+                    else if (m_depth == 3)
+                    {
+                        success = read_table_element(value);
+                    }
+                    else
+                    {
+                        log_error("netlist_persistent", "invalid json string for deserialization");
+                    }
+
+                    // the value has been processed, so its memory is reused for the next one
+                    value.SetNull();
+                    m_allocator.Clear();
+                    return success;
+                }
+
+                bool read_root_member(const rapidjson::Value& value)
+                {
+                    if (m_root_key == "serialization_format_version")
+                    {
+                        set_encoded_format_version(value.GetUint());
+                        m_version_read = true;
+                    }
+                    else if (m_root_key == "netlist")
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: file has no 'netlist' node");
+                        return false;
+                    }
+                    return true;
+                }
+
+                bool begin_netlist()
+                {
+                    // the format version decides how pins are read and must therefore be known in advance
+                    if (!m_version_read)
+                    {
+                        return request_document();
+                    }
+                    return true;
+                }
+
+                bool read_netlist_member(const rapidjson::Value& value)
+                {
+                    const std::string& key = m_netlist_key;
+                    if (key == "gate_library")
+                    {
+                        m_gate_library_path = value.GetString();
+                    }
+                    else if (key == "id")
+                    {
+                        m_id = value.GetUint();
+                    }
+                    else if (key == "input_file")
+                    {
+                        m_input_file = value.GetString();
+                    }
+                    else if (key == "design_name")
+                    {
+                        m_design_name = value.GetString();
+                    }
+                    else if (key == "device_name")
+                    {
+                        m_device_name = value.GetString();
+                    }
+                    else if (key == "global_vcc" || key == "global_gnd")
+                    {
+                        if (m_read_nodes.find("gates") == m_read_nodes.end())
+                        {
+                            return request_document();
+                        }
+
+                        const bool vcc = (key == "global_vcc");
+                        for (auto& gate_node : value.GetArray())
+                        {
+                            Gate* gate = m_netlist->get_gate_by_id(gate_node.GetUint());
+                            if (!(vcc ? m_netlist->mark_vcc_gate(gate) : m_netlist->mark_gnd_gate(gate)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark {} gate", vcc ? "VCC" : "GND");
+                                return false;
+                            }
+                        }
+                    }
+                    else if (key == "global_in" || key == "global_out")
+                    {
+                        if (m_read_nodes.find("nets") == m_read_nodes.end())
+                        {
+                            return request_document();
+                        }
+
+                        const bool input = (key == "global_in");
+                        for (auto& net_node : value.GetArray())
+                        {
+                            Net* net = m_netlist->get_net_by_id(net_node.GetUint());
+                            if (!(input ? m_netlist->mark_global_input_net(net) : m_netlist->mark_global_output_net(net)))
+                            {
+                                log_error("netlist_persistent", "could not deserialize netlist: failed to mark global {} net", input ? "input" : "output");
+                                return false;
+                            }
+                        }
+                    }
+                    else if (key == "gates" || key == "nets" || key == "modules")
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: node '{}' is not an array", key);
+                        return false;
+                    }
+
+                    m_read_nodes.insert(key);
+                    return true;
+                }
+
+                bool begin_table()
+                {
+                    if (m_netlist_key == "gates")
+                    {
+                        if (!create_netlist())
+                        {
+                            return false;
+                        }
+                        m_table = Table::gates;
+                    }
+                    else if (m_netlist_key == "nets")
+                    {
+                        if (m_read_nodes.find("gates") == m_read_nodes.end())
+                        {
+                            return request_document();
+                        }
+                        m_table = Table::nets;
+                    }
+                    else
+                    {
+                        if (m_read_nodes.find("gates") == m_read_nodes.end() || m_read_nodes.find("nets") == m_read_nodes.end())
+                        {
+                            return request_document();
+                        }
+                        m_table = Table::modules;
+                    }
+                    return true;
+                }
+
+                bool create_netlist()
+                {
+                    if (!m_gatelib)
+                    {
+                        // no preferred gate library explicitly given
+                        if (m_read_nodes.find("gate_library") == m_read_nodes.end())
+                        {
+                            return request_document();
+                        }
+
+                        m_gatelib = load_gate_library(m_gate_library_path);
+                        if (m_gatelib == nullptr)
+                        {
+                            return false;
+                        }
+                    }
+
+                    m_netlist = std::make_unique<Netlist>(m_gatelib);
+
+                    // disable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(false);
+
+                    m_gate_types = m_netlist->get_gate_library()->get_gate_types();
+                    return true;
+                }
+
+                bool read_table_element(const rapidjson::Value& value)
+                {
+                    if (m_table == Table::gates)
+                    {
+                        if (!deserialize_gate(m_netlist.get(), value, m_gate_types))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize gate");
+                            return false;
+                        }
+                    }
+                    else if (m_table == Table::nets)
+                    {
+                        if (!deserialize_net(m_netlist.get(), value))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize net");
+                            return false;
+                        }
+                    }
+                    else if (m_table == Table::modules)
+                    {
+                        if (!deserialize_module(m_netlist.get(), value, m_pin_group_cache))
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module");
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                bool end_table()
+                {
+                    m_read_nodes.insert(m_netlist_key);
+                    m_table = Table::none;
+                    return true;
+                }
+
+                bool end_netlist()
+                {
+                    if (m_netlist == nullptr)
+                    {
+                        // the netlist is created once the gates are reached
+                        if (!m_gatelib && m_read_nodes.find("gate_library") == m_read_nodes.end())
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'gate_library'");
+                        }
+                        else
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node 'gates'");
+                        }
+                        return false;
+                    }
+
+                    for (const char* node : {"id", "input_file", "design_name", "device_name", "global_vcc", "global_gnd", "nets", "global_in", "global_out", "modules"})
+                    {
+                        if (m_read_nodes.find(node) == m_read_nodes.end())
+                        {
+                            log_error("netlist_persistent", "could not deserialize netlist: node 'netlist' has no node '{}'", node);
+                            return false;
+                        }
+                    }
+
+                    m_netlist->set_id(m_id);
+                    m_netlist->set_input_filename(m_input_file);
+                    m_netlist->set_design_name(m_design_name);
+                    m_netlist->set_device_name(m_device_name);
+
+                    // update module nets, internal nets, input nets, and output nets
+                    for (Module* mod : m_netlist->get_modules())
+                    {
+                        mod->update_nets();
+                    }
+
+                    // load module pins (nets must have been updated beforehand)
+                    if (!deserialize_module_pins(m_pin_group_cache))
+                    {
+                        log_error("netlist_persistent", "could not deserialize netlist: failed to deserialize module pins");
+                        return false;
+                    }
+
+                    // re-enable automatically checking module nets
+                    m_netlist->enable_automatic_net_checks(true);
+
+                    m_netlist_read = true;
+                    return true;
+                }
+            };
+
+            template<typename InputStream>
+            std::unique_ptr<Netlist> deserialize_stream(InputStream& is, GateLibrary* gatelib, bool& requires_document)
+            {
+                NetlistReaderHandler handler(gatelib);
+                rapidjson::Reader reader;
+                rapidjson::ParseResult result = reader.Parse<0>(is, handler);
+
+                if (handler.requires_document())
+                {
+                    requires_document = true;
+                    return nullptr;
+                }
+
+                if (result.IsError())
+                {
+                    // errors raised by the handler itself have already been logged
+                    if (result.Code() != rapidjson::kParseErrorTermination)
+                    {
+                        log_error("netlist_persistent", "invalid json string for deserialization");
+                    }
+                    return nullptr;
+                }
+
+                return handler.take_netlist();
+            }
+
             std::unique_ptr<Netlist> deserialize_document(rapidjson::Document& document, GateLibrary* gatelib, std::string source,
                                                           std::chrono::time_point<std::chrono::high_resolution_clock>& begin_time)
             {
@@ -939,15 +1556,7 @@ namespace hal
 
                 if (document.HasMember("serialization_format_version"))
                 {
-                    encoded_format_version = document["serialization_format_version"].GetUint();
-                    if (encoded_format_version < SERIALIZATION_FORMAT_VERSION)
-                    {
-                        log_warning("netlist_persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
-                    }
-                    else if (encoded_format_version > SERIALIZATION_FORMAT_VERSION)
-                    {
-                        log_warning("netlist_persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
-                    }
+                    set_encoded_format_version(document["serialization_format_version"].GetUint());
                 }
                 else
                 {
@@ -974,6 +1583,11 @@ namespace hal
                 return false;
             }
 
+            if (hal_file.extension() == ".halb")
+            {
+                return serialize_to_binary_file(nl, hal_file);
+            }
+
             auto begin_time = std::chrono::high_resolution_clock::now();
 
             std::filesystem::path serialize_to_dir = hal_file.parent_path();
@@ -994,32 +1608,31 @@ namespace hal
                 }
             }
 
-            std::ofstream hal_file_stream;
-            hal_file_stream.open(hal_file.string());
-            if (hal_file_stream.fail())
+            FILE* pFile = fopen(hal_file.string().c_str(), "wb");
+            if (pFile == NULL)
             {
                 log_error("netlist_persistent", "could not open or create file {}: please verify that the file and the containing directory is writable", hal_file.string());
                 return false;
             }
 
-            rapidjson::Document document;
-            document.SetObject();
-
-            document.AddMember("serialization_format_version", SERIALIZATION_FORMAT_VERSION, document.GetAllocator());
-
-            serialize(nl, document);
-
-            rapidjson::StringBuffer strbuf;
-#if PRETTY_JSON_OUTPUT == 1
-            rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
-#else
-            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
-#endif
-            document.Accept(writer);
-
-            hal_file_stream << strbuf.GetString();
-
-            hal_file_stream.close();
+            // the document is written while it is serialized instead of being assembled in memory first
+            char buffer[65536];
+            rapidjson::FileWriteStream os(pFile, buffer, sizeof(buffer));
+            JsonWriter writer(os);
+
+            writer.StartObject();
+            writer.Key("serialization_format_version");
+            writer.Int(SERIALIZATION_FORMAT_VERSION);
+            writer.Key("netlist");
+            serialize(nl, writer);
+            writer.EndObject();
+
+            os.Flush();
+            if (fclose(pFile) != 0)
+            {
+                log_error("netlist_persistent", "could not write file {}", hal_file.string());
+                return false;
+            }
 
             log_info("netlist_persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
 
@@ -1028,6 +1641,11 @@ namespace hal
 
         std::unique_ptr<Netlist> deserialize_from_file(const std::filesystem::path& hal_file, GateLibrary* gatelib)
         {
+            if (hal_file.extension() == ".halb")
+            {
+                return deserialize_from_binary_file(hal_file, gatelib);
+            }
+
             auto begin_time = std::chrono::high_resolution_clock::now();
 
             // event_controls::enable_all(false);
@@ -1040,6 +1658,24 @@ namespace hal
             }
 
             char buffer[65536];
+            bool requires_document = false;
+            {
+                rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
+                auto netlist = deserialize_stream(is, gatelib, requires_document);
+                if (!requires_document)
+                {
+                    fclose(pFile);
+                    if (netlist)
+                    {
+                        log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+                    }
+                    return netlist;
+                }
+            }
+
+            // the nodes of the file are not in the expected order, so the complete document has to be read
+            log_info("netlist_persistent", "'{}' cannot be read as a stream, reading it as a complete document instead", hal_file.string());
+            rewind(pFile);
             rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
             rapidjson::Document document;
             document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
@@ -1054,6 +1690,22 @@ namespace hal
 
             // event_controls::enable_all(false);
 
+            bool requires_document = false;
+            {
+                rapidjson::StringStream is(hal_string.c_str());
+                auto netlist = deserialize_stream(is, gatelib, requires_document);
+                if (!requires_document)
+                {
+                    if (netlist)
+                    {
+                        log_info("netlist_persistent", "deserialized '{}' in {:2.2f} seconds", "source string", DURATION(begin_time));
+                    }
+                    return netlist;
+                }
+            }
+
+            // the nodes of the string are not in the expected order, so the complete document has to be read
+            log_info("netlist_persistent", "source string cannot be read as a stream, reading it as a complete document instead");
             rapidjson::Document document;
             document.Parse<0, rapidjson::UTF8<> >(hal_string.c_str());
 
@@ -29,7 +29,7 @@ namespace hal
 
     const std::string ProjectManager::s_project_file = ".project.json";
 
-    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE)
+    ProjectManager::ProjectManager() : m_project_status(ProjectStatus::NONE), m_binary_netlist_format(false)
     {
         ;
     }
@@ -107,7 +107,7 @@ namespace hal
         }
         if (!success)
             return false;
-        m_netlist_file = m_proj_dir.get_default_filename(".hal");
+        m_netlist_file = m_proj_dir.get_default_filename(m_binary_netlist_format ? ".halb" : ".hal");
 
         std::filesystem::create_directory(m_proj_dir.get_filename("py"));
         std::filesystem::create_directory(m_proj_dir.get_filename(ProjectDirectory::s_shadow_dir));
@@ -145,10 +145,11 @@ namespace hal
         const GateLibrary* gl = m_netlist_save->get_gate_library();
         if (gl)
             m_gatelib_path = gl->get_path().string();
+        const std::string extension = m_binary_netlist_format ? ".halb" : ".hal";
         if (shadow)
-            m_netlist_file = m_proj_dir.get_shadow_filename(".hal");
+            m_netlist_file = m_proj_dir.get_shadow_filename(extension);
         else
-            m_netlist_file = m_proj_dir.get_default_filename(".hal");
+            m_netlist_file = m_proj_dir.get_default_filename(extension);
 
         if (!netlist_serializer::serialize_to_file(m_netlist_save, m_netlist_file))
             return false;
@@ -159,6 +160,16 @@ namespace hal
         return serialize_to_projectfile(shadow);
     }
 
+    void ProjectManager::set_binary_netlist_format(bool binary)
+    {
+        m_binary_netlist_format = binary;
+    }
+
+    bool ProjectManager::is_binary_netlist_format() const
+    {
+        return m_binary_netlist_format;
+    }
+
     std::string ProjectManager::get_netlist_filename() const
     {
         std::filesystem::path filename(m_proj_dir);
@@ -240,7 +251,8 @@ namespace hal
 
             if (doc.HasMember("netlist"))
             {
-                m_netlist_file = doc["netlist"].GetString();
+                m_netlist_file          = doc["netlist"].GetString();
+                m_binary_netlist_format = std::filesystem::path(m_netlist_file).extension() == ".halb";
                 std::filesystem::path netlistPath(m_proj_dir);
                 netlistPath.append(m_netlist_file);
                 m_netlist_load = netlist_factory::load_netlist(netlistPath,gatelibPath);
@@ -1405,6 +1405,7 @@ namespace hal
             py::arg("remove_unknown_variables") = false,
             R"(
             Computes the truth table outputs for a Boolean function that comprises <= 10 single-bit variables.
+            Functions that can be evaluated using two-valued logic are evaluated for 64 rows at once and may comprise up to 16 single-bit variables.
 
             **Warning:** The generation of the truth table is exponential in the number of parameters.
 
@@ -1433,6 +1434,7 @@ namespace hal
             py::arg("remove_unknown_variables") = false,
             R"(
             Prints the truth table for a Boolean function that comprises <= 10 single-bit variables.
+            Functions that can be evaluated using two-valued logic may comprise up to 16 single-bit variables.
 
             **Warning:** The generation of the truth table is exponential in the number of parameters.
 
@@ -1459,8 +1461,17 @@ namespace hal
             :type: int
         )");
 
-        py_boolean_function_node.def_readwrite("constant", &BooleanFunction::Node::constant, R"(
-            The (optional) constant value of the node.
+        py_boolean_function_node.def_property(
+            "constant",
+            &BooleanFunction::Node::constant,
+            [](BooleanFunction::Node& self, const std::vector<BooleanFunction::Value>& value) {
+                if (auto res = self.set_constant(value); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                }
+            },
+            R"(
+            The (optional) constant value of the node. Setting it only changes the value of a node of type 'Constant'.
 
             :type: list[hal_py.BooleanFunction.Value]
         )");
@@ -1471,8 +1482,17 @@ namespace hal
             :type: int
         )");
 
-        py_boolean_function_node.def_readwrite("variable", &BooleanFunction::Node::variable, R"(
-            The (optional) variable name of the node.
+        py_boolean_function_node.def_property(
+            "variable",
+            &BooleanFunction::Node::variable,
+            [](BooleanFunction::Node& self, const std::string& variable) {
+                if (auto res = self.set_variable(variable); res.is_error())
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                }
+            },
+            R"(
+            The (optional) variable name of the node. Setting it only changes the name of a node of type 'Variable'.
 
             :type: str
         )");
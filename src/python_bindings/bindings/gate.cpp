@@ -255,6 +255,29 @@ namespace hal
             :rtype: dict[str,hal_py.BooleanFunction]
         )");
 
+        py_gate.def(
+            "get_lut_truth_table",
+            [](const Gate& self) -> std::optional<u64> {
+                auto res = self.get_lut_truth_table();
+                if (res.is_ok())
+                {
+                    return res.get();
+                }
+                else
+                {
+                    log_error("python_context", "{}", res.get_error().get());
+                    return std::nullopt;
+                }
+            },
+            R"(
+            Get the truth table of a LUT gate with at most six input pins as configured by its INIT data.
+            Bit ``i`` of the truth table holds the output of the LUT for the input assignment ``i``, in which bit ``j`` corresponds to the ``j``-th input pin of the gate type.
+            The truth table is cached and shared among all gates of the same type with the same INIT value.
+
+            :returns: The truth table on success, ``None`` otherwise.
+            :rtype: int or None
+        )");
+
         py_gate.def("add_boolean_function", &Gate::add_boolean_function, py::arg("name"), py::arg("func"), R"(
             Add a Boolean function with the given name to the gate.
 
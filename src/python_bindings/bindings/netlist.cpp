@@ -498,6 +498,28 @@ namespace hal
             :param bool enable_checks: Set True to enable automatic checks, False otherwise.
         )");
 
+        py_netlist.def("begin_batch", &Netlist::begin_batch, R"(
+            Starts a batch of modifications during which automatic net checks are deferred.
+            Instead of reclassifying the input, output, and internal nets as well as the pins of all affected modules after every single modification, affected nets are collected and each of them is checked exactly once per module when the batch is committed using hal_py.Netlist.commit_batch.
+            Batches may be nested, the checks are only performed once the outermost batch is committed.
+
+            WARNING: until the batch is committed, module nets and pins do not reflect modifications made within the batch.
+        )");
+
+        py_netlist.def("commit_batch", &Netlist::commit_batch, R"(
+            Commits a batch of modifications started using hal_py.Netlist.begin_batch and performs all deferred net checks.
+
+            :returns: True on success, False otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist.def("is_batch_active", &Netlist::is_batch_active, R"(
+            Check whether a batch of modifications started using hal_py.Netlist.begin_batch has not yet been committed.
+
+            :returns: True if a batch is active, False otherwise.
+            :rtype: bool
+        )");
+
         py_netlist.def("get_unique_module_id", &Netlist::get_unique_module_id, R"(
             Get a spare module ID.
             The value of 0 is reserved and represents an invalid ID.
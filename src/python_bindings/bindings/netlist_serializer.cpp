@@ -10,6 +10,7 @@ namespace hal
 
         py_netlist_serializer.def("serialize_to_file", netlist_serializer::serialize_to_file, py::arg("netlist"), py::arg("hal_file"), R"(
             Serializes a netlist into a ``.hal`` file.
+            If the file has the extension ``.halb``, the netlist is serialized into the binary format instead.
         
             :param hal_py.Netlist netlist: The netlist to serialize.
             :param pathlib.Path hal_file: The path to the ``.hal`` file.
@@ -25,6 +26,7 @@ namespace hal
             R"(
                 Deserializes a netlist from a ``.hal`` file using the provided gate library.
                 If no gate library is provided, a gate library path must be specified within the ``.hal`` file.
+                If the file has the extension ``.halb``, the netlist is deserialized from the binary format instead.
             
                 :param pathlib.Path hal_file: The path to the ``.hal`` file.
                 :param hal_py.GateLibrary gate_lib: The gate library. Defaults to ``None``.
@@ -32,6 +34,31 @@ namespace hal
                 :rtype: hal_py.Netlist or None
             )");
 
+        py_netlist_serializer.def("serialize_to_binary_file", netlist_serializer::serialize_to_binary_file, py::arg("netlist"), py::arg("halb_file"), R"(
+            Serializes a netlist into a binary ``.halb`` file.
+            The binary format stores the same information as the ``.hal`` format in flat tables that refer to a shared string table.
+
+            :param hal_py.Netlist netlist: The netlist to serialize.
+            :param pathlib.Path halb_file: The path to the ``.halb`` file.
+            :returns: ``True`` on success, ``False`` otherwise.
+            :rtype: bool
+        )");
+
+        py_netlist_serializer.def(
+            "deserialize_from_binary_file",
+            [](const std::filesystem::path& halb_file, GateLibrary* gate_lib = nullptr) { return std::shared_ptr<Netlist>(netlist_serializer::deserialize_from_binary_file(halb_file, gate_lib)); },
+            py::arg("halb_file"),
+            py::arg("gate_lib") = nullptr,
+            R"(
+                Deserializes a netlist from a binary ``.halb`` file using the provided gate library.
+                If no gate library is provided, the gate library specified within the ``.halb`` file is used.
+
+                :param pathlib.Path halb_file: The path to the ``.halb`` file.
+                :param hal_py.GateLibrary gate_lib: The gate library. Defaults to ``None``.
+                :returns: The deserialized netlist on success, ``None`` otherwise.
+                :rtype: hal_py.Netlist or None
+            )");
+
         py_netlist_serializer.def(
             "deserialize_from_string",
             [](const std::string& hal_string, GateLibrary* gate_lib = nullptr) { return std::shared_ptr<Netlist>(netlist_serializer::deserialize_from_string(hal_string, gate_lib)); },
@@ -131,6 +131,20 @@ namespace hal
             :rtype: bool
         )");
 
+        py_project_manager.def("set_binary_netlist_format", &ProjectManager::set_binary_netlist_format, py::arg("binary"), R"(
+            Set whether the netlist is saved in the binary ``.halb`` format instead of the JSON ``.hal`` format by subsequent calls to ``serialize_project``.
+            Opening a project selects the format of its netlist file.
+
+            :param bool binary: Set to True to save the netlist in the binary format, False to save it in the JSON format.
+        )");
+
+        py_project_manager.def("is_binary_netlist_format", &ProjectManager::is_binary_netlist_format, R"(
+            Check whether the netlist is saved in the binary ``.halb`` format.
+
+            :returns: True if the netlist is saved in the binary format, False if it is saved in the JSON format.
+            :rtype: bool
+        )");
+
         py_project_manager.def("open_project", &ProjectManager::open_project, py::arg("path") = std::string(), R"(
             Open the project specified by the provided directory path.
 
@@ -0,0 +1,197 @@
+#include "hal_core/utilities/id_allocator.h"
+
+#include <algorithm>
+
+namespace hal
+{
+    bool IdAllocator::Bitmap::test(const u32 id) const
+    {
+        const u32 word = id >> 6;
+        if (word < m_words.size())
+        {
+            return (m_words[word] >> (id & 63)) & 1;
+        }
+        return m_overflow.find(id) != m_overflow.end();
+    }
+
+    void IdAllocator::Bitmap::set(const u32 id)
+    {
+        const u32 word = id >> 6;
+        if (word >= m_words.size())
+        {
+            // the bitmap may cover up to four times as many IDs as are currently tracked
+            if ((u64)word >= std::max<u64>(1024, ((u64)m_count + 1) / 16))
+            {
+                if (m_overflow.insert(id).second)
+                {
+                    m_count++;
+                }
+                return;
+            }
+            grow(word);
+        }
+
+        const u64 mask = u64(1) << (id & 63);
+        if ((m_words[word] & mask) == 0)
+        {
+            m_words[word] |= mask;
+            m_count++;
+            m_first_word = std::min(m_first_word, word);
+        }
+    }
+
+    void IdAllocator::Bitmap::reset(const u32 id)
+    {
+        const u32 word = id >> 6;
+        if (word >= m_words.size())
+        {
+            m_count -= m_overflow.erase(id);
+            return;
+        }
+
+        const u64 mask = u64(1) << (id & 63);
+        if ((m_words[word] & mask) != 0)
+        {
+            m_words[word] &= ~mask;
+            m_count--;
+        }
+    }
+
+    void IdAllocator::Bitmap::clear()
+    {
+        m_words.clear();
+        m_overflow.clear();
+        m_count      = 0;
+        m_first_word = 0;
+    }
+
+    bool IdAllocator::Bitmap::empty() const
+    {
+        return m_count == 0;
+    }
+
+    u32 IdAllocator::Bitmap::find_first_set() const
+    {
+        for (; m_first_word < m_words.size(); m_first_word++)
+        {
+            if (const u64 bits = m_words[m_first_word]; bits != 0)
+            {
+                return (m_first_word << 6) + __builtin_ctzll(bits);
+            }
+        }
+        return *m_overflow.begin();
+    }
+
+    u32 IdAllocator::Bitmap::find_first_unset(u32 id) const
+    {
+        for (u32 word = id >> 6; word < m_words.size(); word++)
+        {
+            // ignore the bits below the start ID in the first word
+            const u64 bits = ~m_words[word] & (~u64(0) << (id & 63));
+            if (bits != 0)
+            {
+                return (word << 6) + __builtin_ctzll(bits);
+            }
+            id = (word + 1) << 6;
+        }
+
+        for (auto it = m_overflow.lower_bound(id); it != m_overflow.end() && *it == id; it++)
+        {
+            id++;
+        }
+        return id;
+    }
+
+    std::set<u32> IdAllocator::Bitmap::to_set() const
+    {
+        std::set<u32> ids;
+        for (u32 word = 0; word < m_words.size(); word++)
+        {
+            for (u64 bits = m_words[word]; bits != 0; bits &= bits - 1)
+            {
+                ids.insert(ids.end(), (word << 6) + __builtin_ctzll(bits));
+            }
+        }
+        ids.insert(m_overflow.begin(), m_overflow.end());
+        return ids;
+    }
+
+    void IdAllocator::Bitmap::grow(const u32 word)
+    {
+        m_words.resize(std::max<u64>((u64)word + 1, (u64)m_words.size() * 2), 0);
+
+        // move all IDs that are now covered by the bitmap out of the overflow set
+        const u64 end = (u64)m_words.size() << 6;
+        auto it      = m_overflow.begin();
+        for (; it != m_overflow.end() && *it < end; it++)
+        {
+            m_words[*it >> 6] |= u64(1) << (*it & 63);
+        }
+        m_overflow.erase(m_overflow.begin(), it);
+    }
+
+    u32 IdAllocator::get_unique_id()
+    {
+        if (!m_free.empty())
+        {
+            return m_free.find_first_set();
+        }
+        m_next_id = m_used.find_first_unset(m_next_id);
+        return m_next_id;
+    }
+
+    bool IdAllocator::is_used(const u32 id) const
+    {
+        return m_used.test(id);
+    }
+
+    void IdAllocator::reserve(const u32 id)
+    {
+        m_free.reset(id);
+        m_used.set(id);
+    }
+
+    void IdAllocator::release(const u32 id)
+    {
+        m_free.set(id);
+        m_used.reset(id);
+    }
+
+    u32 IdAllocator::get_next_id() const
+    {
+        return m_next_id;
+    }
+
+    void IdAllocator::set_next_id(const u32 id)
+    {
+        m_next_id = id;
+    }
+
+    std::set<u32> IdAllocator::get_used_ids() const
+    {
+        return m_used.to_set();
+    }
+
+    void IdAllocator::set_used_ids(const std::set<u32>& ids)
+    {
+        m_used.clear();
+        for (const u32 id : ids)
+        {
+            m_used.set(id);
+        }
+    }
+
+    std::set<u32> IdAllocator::get_free_ids() const
+    {
+        return m_free.to_set();
+    }
+
+    void IdAllocator::set_free_ids(const std::set<u32>& ids)
+    {
+        m_free.clear();
+        for (const u32 id : ids)
+        {
+            m_free.set(id);
+        }
+    }
+}    // namespace hal
@@ -0,0 +1,68 @@
+#include "hal_core/utilities/memory_mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hal
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        unmap();
+    }
+
+    Result<std::monostate> MemoryMappedFile::map(const std::filesystem::path& file_path)
+    {
+        unmap();
+
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return ERR("could not map file '" + file_path.string() + "': unable to open file");
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return ERR("could not map file '" + file_path.string() + "': unable to determine file size");
+        }
+
+        // mapping an empty file fails, but its contents are known anyway
+        if (st.st_size == 0)
+        {
+            ::close(fd);
+            return OK({});
+        }
+
+        void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            return ERR("could not map file '" + file_path.string() + "': unable to map file into memory");
+        }
+
+        // the file is typically read front to back
+        madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+
+        m_data = static_cast<const char*>(mapped);
+        m_size = st.st_size;
+        return OK({});
+    }
+
+    void MemoryMappedFile::unmap()
+    {
+        if (m_data != nullptr)
+        {
+            munmap(const_cast<char*>(m_data), m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+
+    std::string_view MemoryMappedFile::get_data() const
+    {
+        return std::string_view(m_data, m_size);
+    }
+}    // namespace hal
@@ -1,10 +1,13 @@
 #include "netlist_test_utils.h"
 #include "gtest/gtest.h"
 #include "hal_core/netlist/boolean_function.h"
+#include "hal_core/netlist/boolean_function/compiled_boolean_function.h"
+#include "hal_core/netlist/boolean_function/expression_store.h"
 #include "hal_core/netlist/boolean_function/solver.h"
 #include "hal_core/netlist/boolean_function/types.h"
 
 #include <iostream>
+#include <numeric>
 #include <type_traits>
 #include <variant>
 
@@ -56,6 +59,42 @@ namespace hal {
         EXPECT_TRUE(a != _0);
     }
 
+    TEST(BooleanFunction, NodePayload) {
+        using Value = BooleanFunction::Value;
+
+        // variable names are resolved from the symbol table
+        const auto var = BooleanFunction::Node::Variable("a_rather_long_variable_name_beyond_sso", 1);
+        EXPECT_EQ(var.variable(), "a_rather_long_variable_name_beyond_sso");
+        EXPECT_EQ(var, BooleanFunction::Node::Variable("a_rather_long_variable_name_beyond_sso", 1));
+        EXPECT_NE(var, BooleanFunction::Node::Variable("a_rather_long_variable_name_beyond_sso", 2));
+        EXPECT_EQ(var.constant(), std::vector<Value>());
+        EXPECT_EQ(BooleanFunction::Node::Constant({Value::ONE}).variable(), "");
+
+        // packed and interned constants
+        const std::vector<Value> packed = {Value::ONE, Value::ZERO, Value::ONE, Value::ONE};
+        const std::vector<Value> undefined = {Value::ONE, Value::X, Value::Z, Value::ZERO};
+        const std::vector<Value> wide(100, Value::ONE);
+        for (const auto& value : {packed, undefined, wide})
+        {
+            const auto node = BooleanFunction::Node::Constant(value);
+            EXPECT_EQ(node.size, value.size());
+            EXPECT_EQ(node.constant(), value);
+            EXPECT_TRUE(node.has_constant_value(value));
+            EXPECT_EQ(node, BooleanFunction::Node::Constant(value));
+        }
+        EXPECT_EQ(BooleanFunction::Node::Constant(packed).get_constant_value_u64().get(), 0b1101);
+        EXPECT_TRUE(BooleanFunction::Node::Constant(packed).has_constant_value(0b1101));
+        EXPECT_TRUE(BooleanFunction::Node::Constant(undefined).get_constant_value_u64().is_error());
+        EXPECT_TRUE(BooleanFunction::Node::Constant(wide).get_constant_value_u64().is_error());
+        EXPECT_EQ(BooleanFunction::Node::Constant(undefined).to_string(), "0b0ZX1");
+
+        // the order of nodes does not depend on the order of interning
+        EXPECT_FALSE(BooleanFunction::Node::Variable("node_payload_b", 1) < BooleanFunction::Node::Variable("node_payload_a_", 1));
+        EXPECT_TRUE(BooleanFunction::Node::Variable("node_payload_a_", 1) < BooleanFunction::Node::Variable("node_payload_b", 1));
+        EXPECT_TRUE(BooleanFunction::Node::Constant({Value::ZERO, Value::ONE}) < BooleanFunction::Node::Constant({Value::ONE, Value::ZERO}));
+        EXPECT_TRUE(BooleanFunction::Node::Constant({Value::X, Value::ONE}) < BooleanFunction::Node::Constant({Value::ZERO, Value::ZERO}));
+    }
+
     TEST(BooleanFunction, ToString) {
         const auto a = BooleanFunction::Var("A"),
                    b = BooleanFunction::Var("B"),
@@ -142,7 +181,7 @@ namespace hal {
             EXPECT_EQ(expected, BooleanFunction::to_string(value, 10).get());
         }
 
-        const auto res_137 = BooleanFunction::to_string(BooleanFunction::Const(137, 16).get_top_level_node().constant, 10);
+        const auto res_137 = BooleanFunction::to_string(BooleanFunction::Const(137, 16).get_top_level_node().constant(), 10);
         ASSERT_TRUE(res_137.is_ok());
         EXPECT_EQ(res_137.get(), "137");
     }
@@ -1069,6 +1108,74 @@ namespace hal {
         const auto duration_in_seconds = std::chrono::duration<double>(std::chrono::system_clock::now() - start).count();
     }
 
+    TEST(BooleanFunction, NodeMemoryPerformance)
+    {
+        /// Mirrors the node layout prior to interning variable names and packing constants.
+        struct LegacyNode
+        {
+            u16 type;
+            u16 size;
+            std::vector<BooleanFunction::Value> constant;
+            u16 index;
+            std::string variable;
+        };
+
+        // per-gate functions of a flattened design with hierarchical net names
+        std::vector<BooleanFunction> functions;
+        for (u32 gate = 0; gate < 1000; gate++)
+        {
+            auto function = BooleanFunction::Const(gate & 1, 1);
+            for (u32 input = 0; input < 6; input++)
+            {
+                auto var = BooleanFunction::Var("top/core_" + std::to_string(gate % 7) + "/u_round/lut_" + std::to_string(gate) + "_I" + std::to_string(input));
+                function = (input % 2 == 0) ? (std::move(function) & std::move(var)) : (std::move(function) ^ std::move(var));
+            }
+            functions.push_back(std::move(function));
+        }
+
+        std::vector<BooleanFunction> clones;
+        for (const auto& function : functions)
+        {
+            clones.push_back(function.clone());
+        }
+
+        u64 num_nodes = 0, legacy_bytes = 0;
+        for (const auto& function : clones)
+        {
+            for (const auto& node : function.get_nodes())
+            {
+                num_nodes++;
+                legacy_bytes += sizeof(LegacyNode);
+                legacy_bytes += node.constant().size() * sizeof(BooleanFunction::Value);
+                legacy_bytes += (node.variable().size() > std::string().capacity()) ? node.variable().size() + 1 : 0;
+            }
+        }
+
+        EXPECT_EQ(clones, functions);
+        EXPECT_EQ(sizeof(BooleanFunction::Node), 16);
+        EXPECT_LT(num_nodes * sizeof(BooleanFunction::Node), legacy_bytes);
+    }
+
+    TEST(BooleanFunction, NodeSetters)
+    {
+        auto constant = BooleanFunction::Node::Constant({BooleanFunction::Value::ONE, BooleanFunction::Value::ZERO});
+        ASSERT_TRUE(constant.set_constant({BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE}).is_ok());
+        EXPECT_EQ(constant, BooleanFunction::Node::Constant({BooleanFunction::Value::ZERO, BooleanFunction::Value::ONE}));
+
+        // the bit-size of the node is left untouched
+        ASSERT_TRUE(constant.set_constant({BooleanFunction::Value::X}).is_ok());
+        EXPECT_EQ(constant.size, 2);
+        EXPECT_EQ(constant.constant(), std::vector<BooleanFunction::Value>({BooleanFunction::Value::X}));
+
+        auto variable = BooleanFunction::Node::Variable("A", 4);
+        ASSERT_TRUE(variable.set_variable("B").is_ok());
+        EXPECT_EQ(variable, BooleanFunction::Node::Variable("B", 4));
+
+        EXPECT_TRUE(variable.set_constant({BooleanFunction::Value::ONE}).is_error());
+        EXPECT_TRUE(constant.set_variable("A").is_error());
+        EXPECT_EQ(variable.variable(), "B");
+    }
+
     TEST(BooleanFunction, Substitution) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
@@ -1088,6 +1195,62 @@ namespace hal {
         EXPECT_EQ((a & b).substitute({{"A", c}, {"B", d}}).get(), c & d);
     }
 
+    TEST(BooleanFunction, ExpressionStore) {
+        const auto a = BooleanFunction::Var("A"),
+                   b = BooleanFunction::Var("B"),
+                   c = BooleanFunction::Var("C");
+
+        ExpressionStore store;
+        {
+            const auto e1 = store.get_expression((a & b) | (a & b)).get();
+            const auto e2 = store.get_expression(a & b).get();
+
+            // structurally equal sub-expressions are stored once
+            EXPECT_EQ(store.size(), 4);
+            EXPECT_EQ(e1.get_operands().at(0), e2);
+            EXPECT_EQ(e1.get_operands().at(1), e2);
+            EXPECT_EQ(e1.get_num_unique_nodes(), 4);
+            EXPECT_EQ(e1.get_expanded_length(), 7);
+            EXPECT_EQ(e1.get_variable_names(), std::set<std::string>({"A", "B"}));
+            EXPECT_EQ(e1.to_boolean_function().get(), (a & b) | (a & b));
+            EXPECT_EQ(store.get_expression(a & b).get(), e2);
+            EXPECT_NE(store.get_expression(b & a).get(), e2);
+
+            // substitution rewrites shared sub-expressions once and keeps unaffected ones
+            const auto e3 = store.substitute(e1, {{"B", store.get_expression(~c).get()}}).get();
+            EXPECT_EQ(e3.to_boolean_function().get(), (a & ~c) | (a & ~c));
+            EXPECT_EQ(store.substitute(e1, {{"C", e2}}).get(), e1);
+
+            // substitutions must match the bit-size of the replaced variable
+            EXPECT_TRUE(store.substitute(e1, {{"B", store.get_expression(BooleanFunction::Var("D", 2)).get()}}).is_error());
+            EXPECT_TRUE(store.substitute(e1, {{"B", store.get_expression(BooleanFunction::Const(1, 4)).get()}}).is_error());
+
+            EXPECT_TRUE(store.get_expression(BooleanFunction::Node::Operation(BooleanFunction::NodeType::And, 1), {e2}).is_error());
+            EXPECT_TRUE(store.get_expression(BooleanFunction()).is_error());
+            EXPECT_TRUE(SharedExpression().to_boolean_function().is_error());
+        }
+
+        // expressions are released once the last handle is gone
+        EXPECT_EQ(store.size(), 0);
+    }
+
+    TEST(BooleanFunction, ExpressionStorePerformance)
+    {
+        // every layer references the previous one twice, so the expanded function doubles in size with every layer
+        const u32 num_layers = 40;
+
+        ExpressionStore store;
+        auto layer = store.get_expression(BooleanFunction::Var("X0")).get();
+        for (u32 i = 1; i <= num_layers; i++)
+        {
+            const auto gate = store.get_expression(BooleanFunction::Var("P") ^ (BooleanFunction::Var("P") & BooleanFunction::Var("Y" + std::to_string(i)))).get();
+            layer           = store.substitute(gate, {{"P", layer}}).get();
+        }
+
+        EXPECT_EQ(layer.get_num_unique_nodes(), 1 + 3 * num_layers);
+        EXPECT_GT(layer.get_expanded_length(), u64(1) << num_layers);
+    }
+
     TEST(BooleanFunction, EvaluateSingleBit) {
         const auto a = BooleanFunction::Var("A"),
                    b = BooleanFunction::Var("B"),
@@ -1206,6 +1369,141 @@ namespace hal {
         }
     }
 
+    TEST(BooleanFunction, CompiledEvaluation) {
+        const auto a = BooleanFunction::Var("A", 4),
+                   b = BooleanFunction::Var("B", 4),
+                   c = BooleanFunction::Var("C"),
+                   i1 = BooleanFunction::Index(1, 4),
+                   i2 = BooleanFunction::Index(2, 4),
+                   i6 = BooleanFunction::Index(6, 6);
+
+        using Value = BooleanFunction::Value;
+
+        const std::vector<BooleanFunction> data = {
+            a & ~b,
+            (a | b) ^ BooleanFunction::Const(5, 4),
+            a + b,
+            a - b,
+            a * b,
+            BooleanFunction::Concat(BooleanFunction::Slice(a.clone(), i1.clone(), i2.clone(), 2).get(), b.clone(), 6).get(),
+            BooleanFunction::Zext(a.clone(), i6.clone(), 6).get(),
+            BooleanFunction::Sext(b.clone(), i6.clone(), 6).get(),
+            BooleanFunction::Eq(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ult(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ule(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Slt(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Sle(a.clone(), b.clone(), 1).get(),
+            BooleanFunction::Ite(c.clone(), a.clone(), b + a, 4).get(),
+        };
+
+        for (const auto& function : data) {
+            auto compiled_res = CompiledBooleanFunction::compile(function, {"A", "B", "C"});
+            ASSERT_TRUE(compiled_res.is_ok()) << function.to_string();
+            const auto compiled = compiled_res.get();
+            ASSERT_EQ(compiled.size(), function.size());
+
+            // variables that do not occur in the function are 1-bit inputs
+            const auto& sizes    = compiled.get_variable_sizes();
+            const u32 num_bits   = compiled.get_num_input_bits();
+            const u32 num_blocks = std::max(1u, (1u << num_bits) / 64);
+            ASSERT_EQ(std::accumulate(sizes.begin(), sizes.end(), 0u), num_bits);
+
+            // exhaustively compare against the symbolic evaluation, 64 assignments at a time
+            for (u32 block = 0; block < num_blocks; block++) {
+                std::vector<u64> inputs(num_bits, 0);
+                for (u32 lane = 0; lane < 64; lane++) {
+                    const u32 assignment = block * 64 + lane;
+                    for (u32 bit = 0; bit < num_bits; bit++) {
+                        inputs[bit] |= u64((assignment >> bit) & 1) << lane;
+                    }
+                }
+                const auto outputs = compiled.evaluate(inputs).get();
+
+                for (u32 lane = 0; lane < std::min(64u, 1u << num_bits); lane++) {
+                    const u32 assignment = block * 64 + lane;
+                    std::unordered_map<std::string, std::vector<Value>> input;
+                    for (u32 var = 0, bit = 0; var < sizes.size(); var++) {
+                        auto& values = input[compiled.get_variables().at(var)];
+                        for (u32 i = 0; i < sizes.at(var); i++, bit++) {
+                            values.push_back(static_cast<Value>((assignment >> bit) & 1));
+                        }
+                    }
+
+                    const auto expected = function.evaluate(input).get();
+                    for (u32 k = 0; k < outputs.size(); k++) {
+                        ASSERT_EQ(static_cast<Value>((outputs[k] >> lane) & 1), expected[k]) << function.to_string() << " for assignment " << assignment;
+                    }
+                }
+            }
+        }
+
+        // unsupported functions are rejected
+        EXPECT_TRUE(CompiledBooleanFunction::compile(a & BooleanFunction::Const({Value::X, Value::ONE, Value::ZERO, Value::Z})).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction::Shl(a.clone(), BooleanFunction::Index(1, 4), 4).get()).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(a & b, {"A"}).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(a & b, {"A", "B", "A"}).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(BooleanFunction()).is_error());
+
+        // shared expressions compile to the same program, but translate every shared sub-expression only once
+        ExpressionStore store;
+        for (const auto& function : data) {
+            const auto expression = store.get_expression(function).get();
+            const auto from_function = CompiledBooleanFunction::compile(function, {"A", "B", "C"}).get();
+            const auto from_expression_res = CompiledBooleanFunction::compile(expression, {"A", "B", "C"});
+            ASSERT_TRUE(from_expression_res.is_ok()) << function.to_string();
+            const auto from_expression = from_expression_res.get();
+            ASSERT_EQ(from_expression.get_variable_sizes(), from_function.get_variable_sizes());
+
+            std::vector<u64> inputs(from_function.get_num_input_bits());
+            for (u32 i = 0; i < inputs.size(); i++) {
+                inputs[i] = 0x9e3779b97f4a7c15 * (i + 1);
+            }
+            EXPECT_EQ(from_expression.evaluate(inputs).get(), from_function.evaluate(inputs).get()) << function.to_string();
+        }
+
+        const auto shared = store.get_expression((a & b) ^ (a & b)).get();
+        EXPECT_TRUE(CompiledBooleanFunction::compile(shared, {"A", "B"}).is_ok());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(shared, {"A"}).is_error());
+        EXPECT_TRUE(CompiledBooleanFunction::compile(SharedExpression()).is_error());
+    }
+
+    TEST(BooleanFunction, TruthTablePerformance)
+    {
+        // a 16-input cone of mixed XOR and AND-OR layers
+        std::vector<BooleanFunction> layer;
+        for (u32 i = 0; i < 16; i++)
+        {
+            layer.push_back(BooleanFunction::Var("I" + std::to_string(i)));
+        }
+        for (u32 level = 0; layer.size() > 1; level++)
+        {
+            std::vector<BooleanFunction> next;
+            for (u32 i = 0; i + 1 < layer.size(); i += 2)
+            {
+                next.push_back((level % 2 == 0) ? (layer[i] ^ layer[i + 1]) : ((layer[i] & layer[i + 1]) | ~layer[i]));
+            }
+            layer = std::move(next);
+        }
+        const BooleanFunction function = layer.front();
+
+        const auto res = function.compute_truth_table();
+
+        ASSERT_TRUE(res.is_ok());
+        ASSERT_EQ(res.get().size(), 1);
+        ASSERT_EQ(res.get().front().size(), 1 << 16);
+
+        // spot check some rows against the symbolic evaluation
+        for (u32 row : {0u, 1u, 0x1234u, 0xBEEFu, 0xFFFFu})
+        {
+            std::unordered_map<std::string, BooleanFunction::Value> input;
+            for (u32 i = 0; i < 16; i++)
+            {
+                input["I" + std::to_string(i)] = static_cast<BooleanFunction::Value>((row >> i) & 1);
+            }
+            EXPECT_EQ(res.get().front().at(row), function.evaluate(input).get());
+        }
+    }
+
     TEST(BooleanFunction, SimplificationVsTruthTable) {
         const auto  a = BooleanFunction::Var("A"),
                     b = BooleanFunction::Var("B"),
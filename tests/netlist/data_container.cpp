@@ -233,4 +233,86 @@ TEST_F(DataContainerTest, check_get_data)
 
     TEST_END
 }
+/**
+     * Testing that the data container behaves independently of the order of insertion and that data maps round trip.
+     *
+     * Functions: set_data, set_data_map, get_data_map, operator==
+     */
+TEST_F(DataContainerTest, check_entry_order)
+{
+    TEST_START
+    {
+        // Insert the same entries in different orders
+        TestDataContainer d_cont_0;
+        d_cont_0.set_data("category_1", "key_1", "data_type_1", "value_1", false);
+        d_cont_0.set_data("category_0", "key_0", "data_type_0", "value_0", false);
+        d_cont_0.set_data("category_0", "key_1", "data_type_0", "value_2", false);
+
+        TestDataContainer d_cont_1;
+        d_cont_1.set_data("category_0", "key_1", "data_type_0", "value_2", false);
+        d_cont_1.set_data("category_0", "key_0", "data_type_0", "value_0", false);
+        d_cont_1.set_data("category_1", "key_1", "data_type_1", "value_1", false);
+
+        EXPECT_TRUE(d_cont_0 == d_cont_1);
+        EXPECT_EQ(d_cont_0.get_data_map(), d_cont_1.get_data_map());
+
+        // Overwrite the data type and value of an existing entry
+        d_cont_1.set_data("category_0", "key_0", "data_type_2", "value_3", false);
+        EXPECT_TRUE(d_cont_0 != d_cont_1);
+        EXPECT_EQ(d_cont_1.get_data("category_0", "key_0"), std::make_tuple("data_type_2", "value_3"));
+        EXPECT_EQ(d_cont_1.get_data_map().size(), 3);
+
+        // Deleting and re-adding an entry restores equality
+        d_cont_1.delete_data("category_0", "key_0", false);
+        EXPECT_FALSE(d_cont_1.has_data("category_0", "key_0"));
+        d_cont_1.set_data("category_0", "key_0", "data_type_0", "value_0", false);
+        EXPECT_TRUE(d_cont_0 == d_cont_1);
+    }
+    {
+        // Round trip through the data map
+        TestDataContainer d_cont_0;
+        d_cont_0.set_data("generic", "INIT", "bit_vector", "8000", false);
+        d_cont_0.set_data("generic", "PIN_TYPE", "bit_vector", "01", false);
+        d_cont_0.set_data("attribute", "keep", "string", "", false);
+
+        TestDataContainer d_cont_1;
+        d_cont_1.set_data_map(d_cont_0.get_data_map());
+        EXPECT_TRUE(d_cont_0 == d_cont_1);
+        EXPECT_EQ(d_cont_1.get_data("attribute", "keep"), std::make_tuple("string", ""));
+        EXPECT_TRUE(d_cont_1.has_data("attribute", "keep"));
+
+        d_cont_1.set_data_map({});
+        EXPECT_TRUE(d_cont_1.get_data_map().empty());
+        EXPECT_FALSE(d_cont_1.has_data("generic", "INIT"));
+    }
+    {
+        // Lookups of categories and keys that have never been stored
+        TestDataContainer d_cont_0;
+        d_cont_0.set_data("category_0", "key_0", "data_type_0", "value_0", false);
+        EXPECT_FALSE(d_cont_0.has_data("unknown_category", "key_0"));
+        EXPECT_FALSE(d_cont_0.has_data("category_0", "unknown_key"));
+        EXPECT_EQ(d_cont_0.get_data("unknown_category", "unknown_key"), std::make_tuple("", ""));
+        EXPECT_TRUE(d_cont_0.delete_data("unknown_category", "key_0", false));
+        EXPECT_TRUE(d_cont_0.has_data("category_0", "key_0"));
+    }
+    {
+        // Copies keep their entries after the original has been destroyed, also when the shared table is emptied in between
+        TestDataContainer d_cont_1;
+        {
+            TestDataContainer d_cont_0;
+            d_cont_0.set_data("category_0", "key_0", "data_type_0", "value_0", false);
+            d_cont_1 = d_cont_0;
+        }
+        EXPECT_EQ(d_cont_1.get_data("category_0", "key_0"), std::make_tuple("data_type_0", "value_0"));
+
+        d_cont_1.delete_data("category_0", "key_0", false);
+        d_cont_1.set_data("category_1", "key_1", "data_type_1", "value_1", false);
+        TestDataContainer d_cont_2(d_cont_1);
+        d_cont_1.delete_data("category_1", "key_1", false);
+        EXPECT_EQ(d_cont_2.get_data("category_1", "key_1"), std::make_tuple("data_type_1", "value_1"));
+        EXPECT_FALSE(d_cont_2.has_data("category_0", "key_0"));
+    }
+
+    TEST_END
+}
 }
@@ -15,6 +15,7 @@
 #include <iomanip>
 #include <algorithm>
 #include <cassert>
+#include <thread>
 
 
 namespace hal
@@ -1231,6 +1232,145 @@ namespace hal
         TEST_END
     }
 
+    /**
+     * Testing the truth table of a lut Gate and the caching of lut functions.
+     *
+     * Functions: get_lut_truth_table, get_boolean_function
+     */
+    TEST_F(GateTest, check_lut_truth_table) {
+        TEST_START
+        {
+            // The truth table matches the Boolean function for every configuration
+            auto nl = test_utils::create_empty_netlist();
+            GateType* lut_type = nl->get_gate_library()->get_gate_type_by_name("LUT3");
+            Gate* lut_gate = nl->create_gate(lut_type, "lut");
+            const std::vector<std::string> input_pins = lut_type->get_input_pin_names();
+
+            for (int i = 0; i < 256; i++)
+            {
+                ASSERT_TRUE(lut_gate->set_init_data({i_to_hex_string(i)}).is_ok());
+
+                auto tt_res = lut_gate->get_lut_truth_table();
+                ASSERT_TRUE(tt_res.is_ok());
+                const u64 tt = tt_res.get();
+
+                const BooleanFunction bf = lut_gate->get_boolean_function("O");
+                for (u32 assignment = 0; assignment < 8; assignment++)
+                {
+                    std::unordered_map<std::string, BooleanFunction::Value> inputs;
+                    for (u32 j = 0; j < input_pins.size(); j++)
+                    {
+                        inputs[input_pins.at(j)] = ((assignment >> j) & 1) ? BooleanFunction::ONE : BooleanFunction::ZERO;
+                    }
+                    EXPECT_EQ(bf.evaluate(inputs).get(), ((tt >> assignment) & 1) ? BooleanFunction::ONE : BooleanFunction::ZERO);
+                }
+            }
+        }
+        {
+            // Gates of the same type and configuration share the function, changes of the INIT data are taken into account
+            auto nl = test_utils::create_empty_netlist();
+            GateType* lut_type = nl->get_gate_library()->get_gate_type_by_name("LUT4");
+            Gate* lut_a = nl->create_gate(lut_type, "lut_a");
+            Gate* lut_b = nl->create_gate(lut_type, "lut_b");
+
+            ASSERT_TRUE(lut_a->set_init_data({"8000"}).is_ok());
+            ASSERT_TRUE(lut_b->set_init_data({"8000"}).is_ok());
+            EXPECT_EQ(lut_a->get_lut_truth_table().get(), lut_b->get_lut_truth_table().get());
+            EXPECT_EQ(lut_a->get_boolean_function(), lut_b->get_boolean_function());
+            EXPECT_EQ(lut_a->get_boolean_function(), lut_a->get_boolean_function());
+
+            const BooleanFunction and_function = lut_a->get_boolean_function();
+            ASSERT_TRUE(lut_a->set_init_data({"FFFE"}).is_ok());
+            EXPECT_NE(lut_a->get_boolean_function(), and_function);
+            EXPECT_EQ(lut_a->get_lut_truth_table().get(), 0x7FFF);    // the INIT data of LUT4 is stored in ascending order
+            EXPECT_EQ(lut_b->get_boolean_function(), and_function);
+
+            const InitComponent* init_component = lut_type->get_component_as<InitComponent>([](const GateTypeComponent* component){ return component->get_type() == GateTypeComponent::ComponentType::init; });
+            ASSERT_NE(init_component, nullptr);
+            lut_a->delete_data(init_component->get_init_category(), init_component->get_init_identifiers().front());
+            EXPECT_EQ(lut_a->get_lut_truth_table().get(), 0);
+
+            nl->clear_caches();
+            EXPECT_EQ(lut_b->get_boolean_function(), and_function);
+            EXPECT_EQ(lut_b->get_lut_truth_table().get(), 0x0001);
+        }
+        // NEGATIVE
+        {
+            // The gate is not a lut or has an invalid configuration
+            NO_COUT_TEST_BLOCK;
+            auto nl = test_utils::create_empty_netlist();
+            Gate* gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("AND2"), "not_a_lut");
+            EXPECT_TRUE(gate->get_lut_truth_table().is_error());
+
+            GateType* lut_type = nl->get_gate_library()->get_gate_type_by_name("LUT3");
+            Gate* lut_gate = nl->create_gate(lut_type, "lut");
+            const InitComponent* init_component = lut_type->get_component_as<InitComponent>([](const GateTypeComponent* component){ return component->get_type() == GateTypeComponent::ComponentType::init; });
+            ASSERT_NE(init_component, nullptr);
+            lut_gate->set_data(init_component->get_init_category(), init_component->get_init_identifiers().front(), "bit_vector", "NOHx");
+            EXPECT_TRUE(lut_gate->get_lut_truth_table().is_error());
+            lut_gate->set_data(init_component->get_init_category(), init_component->get_init_identifiers().front(), "bit_vector", "11112222333344445");
+            EXPECT_TRUE(lut_gate->get_lut_truth_table().is_error());
+        }
+        TEST_END
+    }
+
+    /**
+     * Testing concurrent reads of the functions of lut Gates, which fill the shared lut function cache.
+     *
+     * Functions: get_lut_truth_table, get_boolean_function
+     */
+    TEST_F(GateTest, check_lut_function_concurrent_reads) {
+        TEST_START
+        {
+            auto nl = test_utils::create_empty_netlist();
+            GateType* lut_type = nl->get_gate_library()->get_gate_type_by_name("LUT4");
+            std::vector<Gate*> lut_gates;
+            std::vector<u64> expected_truth_tables;
+            std::vector<BooleanFunction> expected_functions;
+            for (int i = 0; i < 256; i++)
+            {
+                Gate* lut_gate = nl->create_gate(lut_type, "lut_" + std::to_string(i));
+                ASSERT_TRUE(lut_gate->set_init_data({i_to_hex_string(i % 64, 4)}).is_ok());
+                lut_gates.push_back(lut_gate);
+                expected_truth_tables.push_back(lut_gate->get_lut_truth_table().get());
+                expected_functions.push_back(lut_gate->get_boolean_function());
+            }
+
+            // drop the shared and the per-gate functions so that all threads derive them again at the same time
+            nl->clear_caches();
+            for (int i = 0; i < 256; i++)
+            {
+                ASSERT_TRUE(lut_gates.at(i)->set_init_data({i_to_hex_string(i % 64, 4)}).is_ok());
+            }
+
+            const u32 num_threads = 8;
+            std::vector<std::vector<u64>> truth_tables(num_threads);
+            std::vector<std::vector<BooleanFunction>> functions(num_threads);
+            std::vector<std::thread> threads;
+            for (u32 t = 0; t < num_threads; t++)
+            {
+                threads.emplace_back([&lut_gates, &truth_tables, &functions, t]() {
+                    for (const Gate* lut_gate : lut_gates)
+                    {
+                        truth_tables.at(t).push_back(lut_gate->get_lut_truth_table().get());
+                        functions.at(t).push_back(lut_gate->get_boolean_function());
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (u32 t = 0; t < num_threads; t++)
+            {
+                EXPECT_EQ(truth_tables.at(t), expected_truth_tables);
+                EXPECT_EQ(functions.at(t), expected_functions);
+            }
+        }
+        TEST_END
+    }
+
     /*************************************
      * Event System
      *************************************/
@@ -3,6 +3,8 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "netlist_test_utils.h"
+#include <chrono>
+#include <random>
 
 namespace hal {
 
@@ -20,6 +22,67 @@ namespace hal {
         virtual void TearDown() 
         {
         }
+
+        // builds a chain of nested modules that take an equal share of the gates, checks the membership of all gates, and deletes the modules again
+        void check_gate_membership(const u32 num_gates, const u32 num_modules)
+        {
+            std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+            GateType* buf               = nl->get_gate_library()->get_gate_type_by_name("BUF");
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<Gate*> gates;
+            gates.reserve(num_gates);
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                gates.push_back(nl->create_gate(buf, "gate_" + std::to_string(i)));
+            }
+            RecordProperty("create_gates_ms", std::to_string(milliseconds_since(start)));
+
+            start = std::chrono::steady_clock::now();
+            std::vector<Module*> modules;
+            const u32 gates_per_module = num_gates / num_modules;
+            Module* parent             = nl->get_top_module();
+            for (u32 i = 0; i < num_modules; i++)
+            {
+                std::vector<Gate*> module_gates(gates.begin() + i * gates_per_module, gates.begin() + (i + 1) * gates_per_module);
+                parent = nl->create_module("module_" + std::to_string(i), parent, module_gates);
+                ASSERT_NE(parent, nullptr);
+                modules.push_back(parent);
+            }
+            RecordProperty("build_hierarchy_ms", std::to_string(milliseconds_since(start)));
+
+            start          = std::chrono::steady_clock::now();
+            u32 mismatches = 0;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                Module* owner   = modules.at(i / gates_per_module);
+                Module* root    = modules.front();
+                Module* shallow = modules.at(num_modules / 2);
+                if (!owner->contains_gate(gates[i]) || !root->contains_gate(gates[i], true) || shallow->contains_gate(gates[i], true) != (i >= (num_modules / 2) * gates_per_module)
+                    || owner->get_gate_by_id(gates[i]->get_id()) != gates[i] || (owner != root && root->contains_gate(gates[i])))
+                {
+                    mismatches++;
+                }
+            }
+            RecordProperty("query_membership_ms", std::to_string(milliseconds_since(start)));
+            EXPECT_EQ(mismatches, 0);
+
+            // tear down from the outermost module so that gates move up one level at a time
+            start = std::chrono::steady_clock::now();
+            for (Module* m : modules)
+            {
+                EXPECT_TRUE(nl->delete_module(m));
+            }
+            RecordProperty("tear_down_ms", std::to_string(milliseconds_since(start)));
+
+            EXPECT_EQ(nl->get_top_module()->get_gates().size(), num_gates);
+            EXPECT_TRUE(nl->get_top_module()->contains_gate(gates.back()));
+        }
+
+        static i64 milliseconds_since(const std::chrono::steady_clock::time_point& start)
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        }
     };
 
     /**
@@ -388,6 +451,131 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Test the ancestry queries on a randomly built and modified module hierarchy against the parent modules.
+     *
+     * Functions: is_parent_module_of, is_submodule_of, contains_module, get_submodule_depth
+     */
+    TEST_F(ModuleTest, check_module_ancestry) {
+        TEST_START
+            {
+                std::unique_ptr<Netlist> netlist = test_utils::create_empty_netlist();
+                std::vector<Module*> modules = {netlist->get_top_module()};
+                std::mt19937 rng(42);
+
+                auto check_hierarchy = [&modules]() {
+                    for (Module* m : modules)
+                    {
+                        std::vector<Module*> parents = m->get_parent_modules();
+                        EXPECT_EQ(m->get_submodule_depth(), (int)parents.size());
+                        for (Module* other : modules)
+                        {
+                            bool expected = std::find(parents.begin(), parents.end(), other) != parents.end();
+                            EXPECT_EQ(other->is_parent_module_of(m, true), expected);
+                            EXPECT_EQ(other->contains_module(m, true), expected);
+                            EXPECT_EQ(m->is_submodule_of(other, true), expected);
+                            EXPECT_EQ(other->is_parent_module_of(m, false), m->get_parent_module() == other);
+                        }
+                    }
+                };
+
+                for (u32 i = 0; i < 60; i++)
+                {
+                    modules.push_back(netlist->create_module("module_" + std::to_string(i), modules.at(rng() % modules.size())));
+                }
+                check_hierarchy();
+
+                for (u32 i = 0; i < 30; i++)
+                {
+                    Module* m          = modules.at(1 + rng() % (modules.size() - 1));
+                    Module* new_parent = modules.at(rng() % modules.size());
+                    if (m != new_parent)
+                    {
+                        EXPECT_TRUE(m->set_parent_module(new_parent));
+                    }
+                }
+                check_hierarchy();
+
+                for (u32 i = 0; i < 10; i++)
+                {
+                    auto it = modules.begin() + 1 + rng() % (modules.size() - 1);
+                    netlist->delete_module(*it);
+                    modules.erase(it);
+                }
+                check_hierarchy();
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing gate membership queries within a deep module hierarchy and tearing the hierarchy down again.
+     *
+     * Functions: assign_gates, contains_gate, get_gate_by_id, delete_module
+     */
+    TEST_F(ModuleTest, check_gate_membership_hierarchy) {
+        TEST_START
+            check_gate_membership(10000, 100);
+        TEST_END
+    }
+
+    /**
+     * Benchmark building and tearing down a deep module hierarchy on a netlist with one million gates, run with --gtest_also_run_disabled_tests.
+     *
+     * Functions: assign_gates, contains_gate, get_gate_by_id, delete_module
+     */
+    TEST_F(ModuleTest, DISABLED_benchmark_gate_membership) {
+        TEST_START
+            check_gate_membership(1000000, 1000);
+        TEST_END
+    }
+
+    /**
+     * Testing that the lazy view on the gates of a module yields the same gates in the same order as get_gates.
+     *
+     * Functions: get_gates_view
+     */
+    TEST_F(ModuleTest, check_get_gates_view) {
+        TEST_START
+            {
+                std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+                std::mt19937 rng(3);
+
+                std::vector<Gate*> gates;
+                for (u32 i = 0; i < 100; i++)
+                {
+                    gates.push_back(nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "gate_" + std::to_string(i)));
+                }
+
+                // random hierarchy including empty modules
+                std::vector<Module*> modules = {nl->get_top_module()};
+                for (u32 i = 0; i < 20; i++)
+                {
+                    std::vector<Gate*> module_gates;
+                    for (u32 j = 0; j < rng() % 8; j++)
+                    {
+                        Gate* g = gates.at(rng() % gates.size());
+                        if (std::find(module_gates.begin(), module_gates.end(), g) == module_gates.end())
+                        {
+                            module_gates.push_back(g);
+                        }
+                    }
+                    modules.push_back(nl->create_module("module_" + std::to_string(i), modules.at(rng() % modules.size()), module_gates));
+                }
+
+                auto filter = [](Gate* g) { return g->get_id() % 3 != 0; };
+                for (Module* m : modules)
+                {
+                    EXPECT_EQ(m->get_gates_view().to_vector(), m->get_gates());
+                    EXPECT_EQ(m->get_gates_view(nullptr, true).to_vector(), m->get_gates(nullptr, true));
+                    EXPECT_EQ(m->get_gates_view(filter).to_vector(), m->get_gates(filter));
+                    EXPECT_EQ(m->get_gates_view(filter, true).to_vector(), m->get_gates(filter, true));
+                    EXPECT_EQ(m->get_gates_view(nullptr, true).empty(), m->get_gates(nullptr, true).empty());
+                }
+                EXPECT_EQ(nl->get_top_module()->get_gates_view(nullptr, true).to_vector().size(), gates.size());
+            }
+        TEST_END
+    }
+
     /**
      * Testing the contains_gate function
      *
@@ -830,6 +1018,115 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing that net checks deferred within a batch yield the same module nets and pins as immediate net checks.
+     *
+     * Functions: begin_batch, commit_batch, is_batch_active
+     */
+    TEST_F(ModuleTest, check_batch_net_checks) {
+        TEST_START
+            auto build = [](bool batched) {
+                std::unique_ptr<Netlist> nl = test_utils::create_empty_netlist();
+                std::mt19937 rng(7);
+
+                std::vector<Gate*> gates;
+                for (u32 i = 0; i < 200; i++)
+                {
+                    gates.push_back(nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("AND2"), "gate_" + std::to_string(i)));
+                }
+
+                if (batched)
+                {
+                    nl->begin_batch();
+                    EXPECT_TRUE(nl->is_batch_active());
+                }
+
+                for (u32 i = 0; i < 10; i++)
+                {
+                    test_utils::connect_global_in(nl.get(), gates.at(i), "I0", "in_" + std::to_string(i));
+                    test_utils::connect_global_in(nl.get(), gates.at(i), "I1", "in_" + std::to_string(i) + "_b");
+                }
+                for (u32 i = 10; i < gates.size(); i++)
+                {
+                    test_utils::connect(nl.get(), gates.at(rng() % i), "O", gates.at(i), "I0", "net_" + std::to_string(i) + "_0");
+                    test_utils::connect(nl.get(), gates.at(rng() % i), "O", gates.at(i), "I1", "net_" + std::to_string(i) + "_1");
+                }
+                for (u32 i = 190; i < gates.size(); i++)
+                {
+                    test_utils::connect_global_out(nl.get(), gates.at(i), "O", "out_" + std::to_string(i));
+                }
+
+                // nested hierarchy with gates moved across modules multiple times
+                std::vector<Module*> modules = {nl->get_top_module()};
+                for (u32 i = 0; i < 20; i++)
+                {
+                    std::vector<Gate*> module_gates;
+                    for (u32 j = 0; j < 10; j++)
+                    {
+                        Gate* g = gates.at(rng() % gates.size());
+                        if (std::find(module_gates.begin(), module_gates.end(), g) == module_gates.end())
+                        {
+                            module_gates.push_back(g);
+                        }
+                    }
+                    modules.push_back(nl->create_module("module_" + std::to_string(i), modules.at(rng() % modules.size()), module_gates));
+                }
+                modules.at(5)->set_parent_module(modules.at(3));
+                nl->delete_module(modules.at(7));
+                nl->delete_net(nl->get_nets([](const Net* n) { return n->get_name() == "net_100_0"; }).front());
+
+                if (batched)
+                {
+                    EXPECT_TRUE(nl->commit_batch());
+                    EXPECT_FALSE(nl->is_batch_active());
+                }
+
+                return nl;
+            };
+
+            auto names = [](const std::unordered_set<Net*>& nets) {
+                std::set<std::string> res;
+                for (const Net* n : nets)
+                {
+                    res.insert(n->get_name());
+                }
+                return res;
+            };
+
+            std::unique_ptr<Netlist> nl_immediate = build(false);
+            std::unique_ptr<Netlist> nl_batched   = build(true);
+
+            ASSERT_EQ(nl_immediate->get_modules().size(), nl_batched->get_modules().size());
+            for (Module* m_immediate : nl_immediate->get_modules())
+            {
+                Module* m_batched = nl_batched->get_module_by_id(m_immediate->get_id());
+                ASSERT_NE(m_batched, nullptr);
+                EXPECT_EQ(names(m_immediate->get_input_nets()), names(m_batched->get_input_nets()));
+                EXPECT_EQ(names(m_immediate->get_output_nets()), names(m_batched->get_output_nets()));
+                EXPECT_EQ(names(m_immediate->get_internal_nets()), names(m_batched->get_internal_nets()));
+
+                std::set<std::pair<std::string, PinDirection>> pins_immediate;
+                for (const ModulePin* pin : m_immediate->get_pins())
+                {
+                    pins_immediate.insert({pin->get_net()->get_name(), pin->get_direction()});
+                }
+                std::set<std::pair<std::string, PinDirection>> pins_batched;
+                for (const ModulePin* pin : m_batched->get_pins())
+                {
+                    pins_batched.insert({pin->get_net()->get_name(), pin->get_direction()});
+                }
+                EXPECT_EQ(pins_immediate, pins_batched);
+            }
+
+            {
+                // committing without an active batch fails
+                auto nl = test_utils::create_empty_netlist();
+                NO_COUT_TEST_BLOCK;
+                EXPECT_FALSE(nl->commit_batch());
+            }
+        TEST_END
+    }
+
     /**
      * Testing the usage of module pins
      *
@@ -2,9 +2,14 @@
 #include "hal_core/netlist/module.h"
 #include "hal_core/netlist/net.h"
 #include "hal_core/netlist/grouping.h"
+#include "hal_core/netlist/netlist_csr.h"
 #include "netlist_test_utils.h"
 #include "gate_library_test_utils.h"
 
+#include <chrono>
+#include <random>
+#include <thread>
+
 namespace hal {
     using test_utils::MIN_NETLIST_ID;
     using test_utils::MIN_MODULE_ID;
@@ -20,6 +25,34 @@ namespace hal {
 
         virtual void TearDown() {
         }
+
+        // creates a netlist in which every gate is driven by randomly chosen nets of the preceding gates, every 16th gate is a flip-flop
+        std::unique_ptr<Netlist> create_random_csr_netlist(const u32 num_gates) {
+            auto nl               = test_utils::create_empty_netlist();
+            const GateLibrary* gl = nl->get_gate_library();
+            GateType* and2        = gl->get_gate_type_by_name("AND2");
+            GateType* dff         = gl->get_gate_type_by_name("DFF");
+            std::mt19937 rng(1);
+
+            std::vector<Net*> nets;
+            for (u32 i = 0; i < num_gates; i++)
+            {
+                const bool sequential = (i % 16 == 0);
+                Gate* g               = nl->create_gate(sequential ? dff : and2, "gate_" + std::to_string(i));
+                if (!nets.empty())
+                {
+                    nets[rng() % nets.size()]->add_destination(g, sequential ? "D" : "I0");
+                    if (!sequential)
+                    {
+                        nets[nets.size() - 1 - rng() % std::min<size_t>(nets.size(), 64)]->add_destination(g, "I1");
+                    }
+                }
+                Net* n = nl->create_net("net_" + std::to_string(i));
+                n->add_source(g, sequential ? "Q" : "O");
+                nets.push_back(n);
+            }
+            return nl;
+        }
     };
 
     /**
@@ -1611,6 +1644,637 @@ namespace hal {
         TEST_END
     }
 
+    /**
+     * Testing the storage of gates, nets, and endpoints under random creation and deletion, including sparse IDs.
+     *
+     * Functions: create_gate, delete_gate, create_net, delete_net, get_gate_by_id, get_net_by_id, get_gates, get_nets, is_gate_in_netlist, is_net_in_netlist
+     */
+    TEST_F(NetlistTest, check_object_storage) {
+        TEST_START
+            {
+                auto nl = test_utils::create_empty_netlist();
+                GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+                std::mt19937 rng(1);
+
+                std::map<u32, Gate*> gates;
+                std::map<u32, Net*> nets;
+                std::vector<const void*> deleted;
+
+                auto random_id = [&rng]() -> u32 {
+                    // mostly dense IDs with a few sparse ones
+                    return (rng() % 8 == 0) ? 100000 + rng() % 4000000000u : 1 + rng() % 2000;
+                };
+
+                for (u32 round = 0; round < 4000; round++)
+                {
+                    const u32 op = rng() % 6;
+                    if (op == 0 || op == 1)
+                    {
+                        const u32 id = random_id();
+                        if (gates.find(id) == gates.end())
+                        {
+                            Gate* g = nl->create_gate(id, and2, "gate_" + std::to_string(id));
+                            ASSERT_NE(g, nullptr);
+                            gates[id] = g;
+                        }
+                    }
+                    else if (op == 2 || op == 3)
+                    {
+                        const u32 id = random_id();
+                        if (nets.find(id) == nets.end())
+                        {
+                            Net* n = nl->create_net(id, "net_" + std::to_string(id));
+                            ASSERT_NE(n, nullptr);
+                            nets[id] = n;
+
+                            // connect to a random source and destination
+                            if (!gates.empty())
+                            {
+                                Gate* src = std::next(gates.begin(), rng() % gates.size())->second;
+                                Gate* dst = std::next(gates.begin(), rng() % gates.size())->second;
+                                if (src->get_fan_out_net("O") == nullptr)
+                                {
+                                    EXPECT_NE(n->add_source(src, "O"), nullptr);
+                                }
+                                if (dst->get_fan_in_net("I0") == nullptr)
+                                {
+                                    EXPECT_NE(n->add_destination(dst, "I0"), nullptr);
+                                }
+                            }
+                        }
+                    }
+                    else if (op == 4 && !gates.empty())
+                    {
+                        auto it = std::next(gates.begin(), rng() % gates.size());
+                        deleted.push_back(it->second);
+                        EXPECT_TRUE(nl->delete_gate(it->second));
+                        gates.erase(it);
+                    }
+                    else if (op == 5 && !nets.empty())
+                    {
+                        auto it = std::next(nets.begin(), rng() % nets.size());
+                        deleted.push_back(it->second);
+                        EXPECT_TRUE(nl->delete_net(it->second));
+                        nets.erase(it);
+                    }
+                }
+
+                EXPECT_EQ(nl->get_gates().size(), gates.size());
+                EXPECT_EQ(nl->get_nets().size(), nets.size());
+                for (const auto& [id, g] : gates)
+                {
+                    EXPECT_EQ(nl->get_gate_by_id(id), g);
+                    EXPECT_TRUE(nl->is_gate_in_netlist(g));
+                    EXPECT_EQ(g->get_id(), id);
+                }
+                for (const auto& [id, n] : nets)
+                {
+                    EXPECT_EQ(nl->get_net_by_id(id), n);
+                    EXPECT_TRUE(nl->is_net_in_netlist(n));
+                    EXPECT_EQ(n->get_id(), id);
+                    for (Endpoint* ep : n->get_sources())
+                    {
+                        EXPECT_EQ(ep->get_net(), n);
+                        EXPECT_EQ(ep->get_gate()->get_fan_out_net(ep->get_pin()), n);
+                    }
+                    for (Endpoint* ep : n->get_destinations())
+                    {
+                        EXPECT_EQ(ep->get_net(), n);
+                        EXPECT_EQ(ep->get_gate()->get_fan_in_net(ep->get_pin()), n);
+                    }
+                }
+                for (Gate* g : nl->get_gates())
+                {
+                    EXPECT_EQ(gates.at(g->get_id()), g);
+                }
+                for (Net* n : nl->get_nets())
+                {
+                    EXPECT_EQ(nets.at(n->get_id()), n);
+                }
+
+                // pointers of deleted objects are not contained unless their memory has been reused
+                for (const void* ptr : deleted)
+                {
+                    const Gate* g = static_cast<const Gate*>(ptr);
+                    const Net* n  = static_cast<const Net*>(ptr);
+                    bool reused   = std::any_of(gates.begin(), gates.end(), [ptr](const auto& e) { return e.second == ptr; })
+                                  || std::any_of(nets.begin(), nets.end(), [ptr](const auto& e) { return e.second == ptr; });
+                    if (!reused)
+                    {
+                        EXPECT_FALSE(nl->is_gate_in_netlist(g));
+                        EXPECT_FALSE(nl->is_net_in_netlist(n));
+                    }
+                }
+                EXPECT_EQ(nl->get_gate_by_id(4000200001), nullptr);
+            }
+            {
+                // objects of other netlists are never contained
+                auto nl_0 = test_utils::create_example_netlist();
+                auto nl_1 = test_utils::create_example_netlist();
+                for (Gate* g : nl_1->get_gates())
+                {
+                    EXPECT_FALSE(nl_0->is_gate_in_netlist(g));
+                }
+                for (Net* n : nl_1->get_nets())
+                {
+                    EXPECT_FALSE(nl_0->is_net_in_netlist(n));
+                }
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the tracking of used and freed IDs against a reference model under random creation and deletion, including sparse IDs.
+     *
+     * Functions: get_unique_net_id, create_net, delete_net, get_used_net_ids, get_free_net_ids, set_used_net_ids, set_free_net_ids, get_next_net_id
+     */
+    TEST_F(NetlistTest, check_id_tracking) {
+        TEST_START
+            {
+                auto nl = test_utils::create_empty_netlist();
+                std::mt19937 rng(2);
+
+                // reference model of the previous implementation
+                u32 next_id = 1;
+                std::set<u32> used_ids;
+                std::set<u32> free_ids;
+                auto unique_id = [&]() -> u32 {
+                    if (!free_ids.empty())
+                    {
+                        return *free_ids.begin();
+                    }
+                    while (used_ids.find(next_id) != used_ids.end())
+                    {
+                        next_id++;
+                    }
+                    return next_id;
+                };
+
+                std::vector<Net*> nets;
+                for (u32 round = 0; round < 20000; round++)
+                {
+                    const u32 action = rng() % 8;
+                    if (action < 4 || nets.empty())
+                    {
+                        u32 id = unique_id();
+                        ASSERT_EQ(nl->get_unique_net_id(), id);
+                        if (action == 0)
+                        {
+                            // mostly dense IDs with a few sparse ones
+                            id = (rng() % 4 == 0) ? 100000 + rng() % 4000000000u : 1 + rng() % 6000;
+                        }
+                        Net* n = nl->create_net(id, "net_" + std::to_string(id));
+                        if (used_ids.find(id) != used_ids.end())
+                        {
+                            EXPECT_EQ(n, nullptr);
+                            continue;
+                        }
+                        ASSERT_NE(n, nullptr);
+                        free_ids.erase(id);
+                        used_ids.insert(id);
+                        nets.push_back(n);
+                    }
+                    else
+                    {
+                        const u32 index = rng() % nets.size();
+                        const u32 id    = nets[index]->get_id();
+                        ASSERT_TRUE(nl->delete_net(nets[index]));
+                        nets[index] = nets.back();
+                        nets.pop_back();
+                        free_ids.insert(id);
+                        used_ids.erase(id);
+                    }
+                }
+                EXPECT_EQ(nl->get_used_net_ids(), used_ids);
+                EXPECT_EQ(nl->get_free_net_ids(), free_ids);
+                EXPECT_EQ(nl->get_unique_net_id(), unique_id());
+                EXPECT_EQ(nl->get_next_net_id(), next_id);
+
+                // restoring the tracked IDs in another netlist yields the same unique IDs
+                auto other_nl = test_utils::create_empty_netlist();
+                other_nl->set_next_net_id(nl->get_next_net_id());
+                other_nl->set_used_net_ids(nl->get_used_net_ids());
+                other_nl->set_free_net_ids(nl->get_free_net_ids());
+                EXPECT_EQ(other_nl->get_used_net_ids(), used_ids);
+                EXPECT_EQ(other_nl->get_free_net_ids(), free_ids);
+                EXPECT_EQ(other_nl->get_unique_net_id(), unique_id());
+            }
+            {
+                // create and delete one million nets
+                auto nl    = test_utils::create_empty_netlist();
+                auto begin = std::chrono::steady_clock::now();
+                std::vector<Net*> nets;
+                nets.reserve(1000000);
+                for (u32 i = 0; i < 1000000; i++)
+                {
+                    nets.push_back(nl->create_net(nl->get_unique_net_id(), "net"));
+                }
+                for (Net* n : nets)
+                {
+                    nl->delete_net(n);
+                }
+                for (u32 i = 0; i < 1000000; i++)
+                {
+                    nl->create_net(nl->get_unique_net_id(), "net");
+                }
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+                std::cout << "created, deleted, and recreated 1000000 nets in " << duration << "ms" << std::endl;
+                EXPECT_EQ(nl->get_free_net_ids().size(), 0);
+                EXPECT_EQ(nl->get_used_net_ids().size(), 1000000);
+                EXPECT_EQ(nl->get_unique_net_id(), 1000001);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that copying a netlist preserves all objects including the order of endpoints, gates within modules, and module nets.
+     *
+     * Functions: copy
+     */
+    TEST_F(NetlistTest, check_copy) {
+        TEST_START
+            {
+                auto nl        = test_utils::create_empty_netlist();
+                GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+                GateType* dff  = nl->get_gate_library()->get_gate_type_by_name("DFF");
+                std::mt19937 rng(3);
+
+                std::vector<Gate*> gates;
+                std::vector<Net*> nets;
+                for (u32 i = 0; i < 2000; i++)
+                {
+                    const bool is_ff = (i % 8 == 0);
+                    Gate* g          = nl->create_gate(is_ff ? dff : and2, "gate_" + std::to_string(i));
+                    if (!nets.empty())
+                    {
+                        nets[rng() % nets.size()]->add_destination(g, is_ff ? "D" : "I0");
+                        if (!is_ff)
+                        {
+                            nets[rng() % nets.size()]->add_destination(g, "I1");
+                        }
+                    }
+                    Net* n = nl->create_net("net_" + std::to_string(i));
+                    n->add_source(g, is_ff ? "Q" : "O");
+                    if (i % 16 == 0)
+                    {
+                        g->set_data("generic", "INIT", "bit_vector", std::to_string(i));
+                        n->set_data("attribute", "keep", "string", "true");
+                    }
+                    if (i % 32 == 1)
+                    {
+                        g->add_boolean_function("O", BooleanFunction::from_string("I0 | I1").get());
+                    }
+                    gates.push_back(g);
+                    nets.push_back(n);
+                }
+                nl->mark_global_input_net(nl->create_net("in"));
+                nl->get_net_by_id(nl->get_unique_net_id() - 1)->add_destination(gates[5], "I1");
+                nl->mark_global_output_net(nets.back());
+
+                // free some IDs
+                nl->delete_gate(gates[17]);
+                nl->delete_net(nets[23]);
+                gates.erase(gates.begin() + 17);
+
+                // module hierarchy with shuffled gates
+                std::shuffle(gates.begin(), gates.end(), rng);
+                Module* mod_0 = nl->create_module("mod_0", nl->get_top_module(), std::vector<Gate*>(gates.begin(), gates.begin() + 600));
+                Module* mod_1 = nl->create_module("mod_1", mod_0, std::vector<Gate*>(gates.begin() + 600, gates.begin() + 900));
+                Module* mod_2 = nl->create_module("mod_2", nl->get_top_module(), std::vector<Gate*>(gates.begin() + 900, gates.begin() + 1000));
+                mod_1->set_data("attribute", "name", "string", "sub");
+                Grouping* grouping = nl->create_grouping("grouping");
+                grouping->assign_module(mod_2);
+                grouping->assign_gate(gates[1500]);
+                grouping->assign_net(nets[42]);
+
+                auto res = nl->copy();
+                ASSERT_TRUE(res.is_ok());
+                std::unique_ptr<Netlist> c_nl = res.get();
+                EXPECT_TRUE(*c_nl == *nl);
+
+                auto endpoint_ids = [](const std::vector<Endpoint*>& endpoints) {
+                    std::vector<std::pair<u32, std::string>> ids;
+                    for (const Endpoint* ep : endpoints)
+                    {
+                        ids.push_back({ep->get_gate()->get_id(), ep->get_pin()->get_name()});
+                    }
+                    return ids;
+                };
+                auto net_ids = [](const auto& nets) {
+                    std::set<u32> ids;
+                    for (const Net* n : nets)
+                    {
+                        ids.insert(n->get_id());
+                    }
+                    return ids;
+                };
+
+                for (const Net* n : nl->get_nets())
+                {
+                    const Net* c_n = c_nl->get_net_by_id(n->get_id());
+                    ASSERT_NE(c_n, nullptr);
+                    EXPECT_NE(c_n, n);
+                    EXPECT_EQ(endpoint_ids(c_n->get_sources()), endpoint_ids(n->get_sources()));
+                    EXPECT_EQ(endpoint_ids(c_n->get_destinations()), endpoint_ids(n->get_destinations()));
+                    EXPECT_EQ(c_n->get_data_map(), n->get_data_map());
+                }
+                for (const Gate* g : nl->get_gates())
+                {
+                    const Gate* c_g = c_nl->get_gate_by_id(g->get_id());
+                    ASSERT_NE(c_g, nullptr);
+                    EXPECT_EQ(endpoint_ids(c_g->get_fan_in_endpoints()), endpoint_ids(g->get_fan_in_endpoints()));
+                    EXPECT_EQ(endpoint_ids(c_g->get_fan_out_endpoints()), endpoint_ids(g->get_fan_out_endpoints()));
+                    EXPECT_EQ(c_g->get_boolean_functions(true), g->get_boolean_functions(true));
+                    EXPECT_EQ(c_g->get_module()->get_id(), g->get_module()->get_id());
+                    for (const Endpoint* ep : c_g->get_fan_in_endpoints())
+                    {
+                        EXPECT_TRUE(c_nl->is_net_in_netlist(ep->get_net()));
+                        EXPECT_EQ(ep->get_gate(), c_g);
+                    }
+                }
+                for (const Module* m : nl->get_modules())
+                {
+                    const Module* c_m = c_nl->get_module_by_id(m->get_id());
+                    ASSERT_NE(c_m, nullptr);
+                    std::vector<u32> gate_ids, c_gate_ids;
+                    for (const Gate* g : m->get_gates())
+                    {
+                        gate_ids.push_back(g->get_id());
+                    }
+                    for (const Gate* g : c_m->get_gates())
+                    {
+                        c_gate_ids.push_back(g->get_id());
+                    }
+                    EXPECT_EQ(c_gate_ids, gate_ids);
+                    EXPECT_EQ(net_ids(c_m->get_nets()), net_ids(m->get_nets()));
+                    EXPECT_EQ(net_ids(c_m->get_input_nets()), net_ids(m->get_input_nets()));
+                    EXPECT_EQ(net_ids(c_m->get_output_nets()), net_ids(m->get_output_nets()));
+                    EXPECT_EQ(net_ids(c_m->get_internal_nets()), net_ids(m->get_internal_nets()));
+                    EXPECT_EQ(c_m->get_pins().size(), m->get_pins().size());
+                }
+                EXPECT_EQ(c_nl->get_free_gate_ids(), nl->get_free_gate_ids());
+                EXPECT_EQ(c_nl->get_free_net_ids(), nl->get_free_net_ids());
+                EXPECT_EQ(c_nl->get_unique_gate_id(), nl->get_unique_gate_id());
+                EXPECT_EQ(c_nl->get_grouping_by_id(grouping->get_id())->get_gate_ids(), grouping->get_gate_ids());
+
+                // the copy is independent of the original
+                ASSERT_TRUE(c_nl->delete_gate(c_nl->get_gate_by_id(gates[0]->get_id())));
+                EXPECT_FALSE(*c_nl == *nl);
+                EXPECT_NE(nl->get_gate_by_id(gates[0]->get_id()), nullptr);
+            }
+            {
+                // copy a netlist with 100000 gates
+                auto nl        = test_utils::create_empty_netlist();
+                GateType* and2 = nl->get_gate_library()->get_gate_type_by_name("AND2");
+                std::mt19937 rng(4);
+                std::vector<Net*> nets;
+                for (u32 i = 0; i < 100000; i++)
+                {
+                    Gate* g = nl->create_gate(and2, "gate");
+                    if (!nets.empty())
+                    {
+                        nets[rng() % nets.size()]->add_destination(g, "I0");
+                        nets[rng() % nets.size()]->add_destination(g, "I1");
+                    }
+                    nets.push_back(nl->create_net("net"));
+                    nets.back()->add_source(g, "O");
+                }
+
+                auto begin    = std::chrono::steady_clock::now();
+                auto res      = nl->copy();
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+                std::cout << "copied netlist with 100000 gates in " << duration << "ms" << std::endl;
+                ASSERT_TRUE(res.is_ok());
+                EXPECT_TRUE(*res.get() == *nl);
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing that the lazy views yield the same elements as the accessors returning vectors.
+     *
+     * Functions: get_gates_view, get_nets_view, Gate::get_fan_in_nets_view, Gate::get_fan_out_nets_view, Gate::get_fan_in_endpoints_view, Gate::get_fan_out_endpoints_view,
+     * Gate::get_predecessors_view, Gate::get_successors_view, Net::get_sources_view, Net::get_destinations_view
+     */
+    TEST_F(NetlistTest, check_views) {
+        TEST_START
+            {
+                auto nl = test_utils::create_example_netlist();
+
+                auto gate_filter = [](const Gate* g) { return g->get_id() % 2 == 0; };
+                auto net_filter  = [](const Net* n) { return n->get_id() % 2 == 1; };
+                EXPECT_EQ(nl->get_gates_view().to_vector(), nl->get_gates());
+                EXPECT_EQ(nl->get_gates_view(gate_filter).to_vector(), nl->get_gates(gate_filter));
+                EXPECT_EQ(nl->get_gates_view(gate_filter).size(), nl->get_gates(gate_filter).size());
+                EXPECT_EQ(nl->get_nets_view().to_vector(), nl->get_nets());
+                EXPECT_EQ(nl->get_nets_view(net_filter).to_vector(), nl->get_nets(net_filter));
+                EXPECT_TRUE(nl->get_gates_view([](const Gate*) { return false; }).empty());
+
+                auto ep_filter  = [](Endpoint* ep) { return ep->get_pin()->get_name() != "I0"; };
+                auto pin_filter = [](const GatePin* pin, Endpoint* ep) { return pin->get_name() != "I1" && ep->get_gate()->get_id() != 3; };
+                for (Gate* g : nl->get_gates())
+                {
+                    EXPECT_EQ(g->get_fan_in_nets_view().to_vector(), g->get_fan_in_nets());
+                    EXPECT_EQ(g->get_fan_out_nets_view().to_vector(), g->get_fan_out_nets());
+                    EXPECT_EQ(g->get_fan_in_nets_view(net_filter).to_vector(), g->get_fan_in_nets(net_filter));
+                    EXPECT_EQ(g->get_fan_in_endpoints_view(ep_filter).to_vector(), g->get_fan_in_endpoints(ep_filter));
+                    EXPECT_EQ(g->get_fan_out_endpoints_view(ep_filter).to_vector(), g->get_fan_out_endpoints(ep_filter));
+                    EXPECT_EQ(g->get_predecessors_view().to_vector(), g->get_predecessors());
+                    EXPECT_EQ(g->get_successors_view().to_vector(), g->get_successors());
+                    EXPECT_EQ(g->get_predecessors_view(pin_filter).to_vector(), g->get_predecessors(pin_filter));
+                    EXPECT_EQ(g->get_successors_view(pin_filter).to_vector(), g->get_successors(pin_filter));
+                }
+                for (Net* n : nl->get_nets())
+                {
+                    EXPECT_EQ(n->get_sources_view().to_vector(), n->get_sources());
+                    EXPECT_EQ(n->get_destinations_view().to_vector(), n->get_destinations());
+                    EXPECT_EQ(n->get_destinations_view(ep_filter).to_vector(), n->get_destinations(ep_filter));
+                    EXPECT_EQ(n->get_destinations_view(ep_filter).size(), n->get_num_of_destinations(ep_filter));
+                }
+            }
+        TEST_END
+    }
+
+    /**
+     * Testing the connectivity snapshot in compressed sparse row format and its invalidation.
+     *
+     * Functions: get_csr, clear_caches
+     */
+    TEST_F(NetlistTest, check_csr) {
+        TEST_START
+            // the snapshot matches the netlist
+            auto check_csr = [](const Netlist* netlist) {
+                const auto csr = netlist->get_csr();
+                ASSERT_EQ(csr->get_num_gates(), netlist->get_gates().size());
+                ASSERT_EQ(csr->get_num_nets(), netlist->get_nets().size());
+                for (u32 i = 0; i < csr->get_num_gates(); i++)
+                {
+                    Gate* g = csr->get_gate(i);
+                    EXPECT_EQ(g, netlist->get_gates().at(i));
+                    EXPECT_EQ(csr->get_gate_index(g), i);
+                    EXPECT_EQ(csr->is_sequential(i), g->get_type()->has_property(GateTypeProperty::sequential));
+                    EXPECT_EQ(csr->is_combinational(i), g->get_type()->has_property(GateTypeProperty::combinational));
+
+                    std::vector<Net*> fan_in_nets;
+                    for (const auto& c : csr->get_fan_in_nets(i))
+                    {
+                        fan_in_nets.push_back(csr->get_net(c.net));
+                    }
+                    EXPECT_EQ(fan_in_nets, g->get_fan_in_nets());
+
+                    std::vector<Net*> fan_out_nets;
+                    for (const auto& c : csr->get_fan_out_nets(i))
+                    {
+                        fan_out_nets.push_back(csr->get_net(c.net));
+                    }
+                    EXPECT_EQ(fan_out_nets, g->get_fan_out_nets());
+
+                    std::vector<std::tuple<Gate*, Net*, PinType>> successors;
+                    for (const auto& e : csr->get_successors(i))
+                    {
+                        successors.push_back({csr->get_gate(e.gate), csr->get_net(e.net), e.pin_type});
+                    }
+                    std::vector<std::tuple<Gate*, Net*, PinType>> expected_successors;
+                    for (const Endpoint* ep : g->get_successors())
+                    {
+                        expected_successors.push_back({ep->get_gate(), ep->get_net(), ep->get_pin()->get_type()});
+                    }
+                    EXPECT_EQ(successors, expected_successors);
+
+                    std::vector<std::tuple<Gate*, Net*, PinType>> predecessors;
+                    for (const auto& e : csr->get_predecessors(i))
+                    {
+                        predecessors.push_back({csr->get_gate(e.gate), csr->get_net(e.net), e.pin_type});
+                    }
+                    std::vector<std::tuple<Gate*, Net*, PinType>> expected_predecessors;
+                    for (const Endpoint* ep : g->get_predecessors())
+                    {
+                        expected_predecessors.push_back({ep->get_gate(), ep->get_net(), ep->get_pin()->get_type()});
+                    }
+                    EXPECT_EQ(predecessors, expected_predecessors);
+                }
+                for (u32 i = 0; i < csr->get_num_nets(); i++)
+                {
+                    Net* n = csr->get_net(i);
+                    EXPECT_EQ(csr->get_net_index(n), i);
+
+                    std::vector<std::pair<Gate*, PinType>> sources;
+                    for (const auto& c : csr->get_sources(i))
+                    {
+                        sources.push_back({csr->get_gate(c.gate), c.pin_type});
+                    }
+                    std::vector<std::pair<Gate*, PinType>> expected_sources;
+                    for (const Endpoint* ep : n->get_sources())
+                    {
+                        expected_sources.push_back({ep->get_gate(), ep->get_pin()->get_type()});
+                    }
+                    std::sort(sources.begin(), sources.end());
+                    std::sort(expected_sources.begin(), expected_sources.end());
+                    EXPECT_EQ(sources, expected_sources);
+
+                    std::vector<std::pair<Gate*, PinType>> destinations;
+                    for (const auto& c : csr->get_destinations(i))
+                    {
+                        destinations.push_back({csr->get_gate(c.gate), c.pin_type});
+                    }
+                    std::vector<std::pair<Gate*, PinType>> expected_destinations;
+                    for (const Endpoint* ep : n->get_destinations())
+                    {
+                        expected_destinations.push_back({ep->get_gate(), ep->get_pin()->get_type()});
+                    }
+                    std::sort(destinations.begin(), destinations.end());
+                    std::sort(expected_destinations.begin(), expected_destinations.end());
+                    EXPECT_EQ(destinations, expected_destinations);
+                }
+            };
+
+            {
+                auto nl = test_utils::create_example_netlist();
+                check_csr(nl.get());
+
+                // the snapshot is cached until the connectivity changes
+                const auto csr = nl->get_csr();
+                EXPECT_EQ(nl->get_csr(), csr);
+                nl->get_top_module()->set_name("renamed");
+                nl->create_module("module", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID + 0)});
+                EXPECT_EQ(nl->get_csr(), csr);
+                nl->clear_caches();
+                EXPECT_NE(nl->get_csr(), csr);
+
+                Gate* gate = nl->get_gate_by_id(MIN_GATE_ID + 3);
+                const auto before_removal = nl->get_csr();
+                Net* net                  = gate->get_fan_out_nets().front();
+                ASSERT_TRUE(net->remove_source(gate, gate->get_fan_out_endpoints().front()->get_pin()));
+                EXPECT_NE(nl->get_csr(), before_removal);
+                check_csr(nl.get());
+
+                // previous snapshots remain valid, but gates and nets that are not part of a snapshot are rejected
+                const u32 index = before_removal->get_gate_index(gate);
+                ASSERT_NE(index, NetlistCSR::invalid_index);
+                EXPECT_FALSE(before_removal->get_successors(index).empty());
+                EXPECT_TRUE(nl->get_csr()->get_successors(nl->get_csr()->get_gate_index(gate)).empty());
+
+                ASSERT_TRUE(nl->delete_gate(gate));
+                EXPECT_EQ(nl->get_csr()->get_gate_index(gate), NetlistCSR::invalid_index);
+                Gate* new_gate = nl->create_gate(nl->get_gate_library()->get_gate_type_by_name("BUF"), "new_gate");
+                Net* new_net   = nl->create_net(4000000000u, "sparse_net");
+                ASSERT_NE(new_net, nullptr);
+                ASSERT_TRUE(new_net->add_source(new_gate, "O"));
+                check_csr(nl.get());
+                EXPECT_EQ(nl->get_csr()->get_net_index(new_net), nl->get_nets().size() - 1);
+                EXPECT_EQ(nl->get_csr()->get_gate_index(nullptr), NetlistCSR::invalid_index);
+
+                auto other_nl = test_utils::create_example_netlist();
+                EXPECT_EQ(nl->get_csr()->get_gate_index(other_nl->get_gate_by_id(MIN_GATE_ID + 0)), NetlistCSR::invalid_index);
+            }
+            {
+                // the snapshot of a randomly connected netlist with sequential and combinational gates
+                auto nl = create_random_csr_netlist(2000);
+                check_csr(nl.get());
+            }
+            {
+                // concurrent readers share a single snapshot
+                auto nl = create_random_csr_netlist(2000);
+                const u32 num_threads = 8;
+                std::vector<std::shared_ptr<const NetlistCSR>> snapshots(num_threads);
+                std::vector<std::thread> threads;
+                for (u32 t = 0; t < num_threads; t++)
+                {
+                    threads.emplace_back([&nl, &snapshots, t]() { snapshots.at(t) = nl->get_csr(); });
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                ASSERT_NE(snapshots.front(), nullptr);
+                for (const auto& snapshot : snapshots)
+                {
+                    EXPECT_EQ(snapshot, snapshots.front());
+                }
+                EXPECT_EQ(nl->get_csr(), snapshots.front());
+            }
+        TEST_END
+    }
+
+    /**
+     * Benchmark for building the connectivity snapshot of a large netlist, run with --gtest_also_run_disabled_tests.
+     *
+     * Functions: get_csr
+     */
+    TEST_F(NetlistTest, DISABLED_benchmark_csr) {
+        TEST_START
+            const u32 num_gates = 1000000;
+            auto nl             = create_random_csr_netlist(num_gates);
+
+            const auto begin_time = std::chrono::steady_clock::now();
+            const auto csr        = nl->get_csr();
+            const auto duration   = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_time).count();
+            EXPECT_EQ(csr->get_num_gates(), num_gates);
+            EXPECT_EQ(csr->get_num_nets(), num_gates);
+            RecordProperty("build_ms", std::to_string(duration));
+        TEST_END
+    }
+
     /*************************************
      * Event System
      *************************************/
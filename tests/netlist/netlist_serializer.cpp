@@ -8,10 +8,14 @@
 #include "hal_core/netlist/netlist.h"
 #include "hal_core/netlist/netlist_factory.h"
 #include "hal_core/plugin_system/plugin_manager.h"
+#include "hal_core/utilities/utils.h"
 #include "gate_library_test_utils.h"
 #include "netlist_test_utils.h"
 
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 
 namespace hal {
     using test_utils::MIN_GATE_ID;
@@ -275,4 +279,310 @@ namespace hal {
              }
          TEST_END
      }
+
+     /**
+      * Testing the deserialization of a file whose nodes are not in the order written by the serializer.
+      *
+      * Functions: serialize_to_file, deserialize_from_file, deserialize_from_string
+      */
+     TEST_F(NetlistSerializerTest, check_deserialize_reordered_nodes) {
+         TEST_START
+             auto nl = create_example_serializer_netlist();
+             std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+             ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+             std::ifstream in_file(test_hal_file_path.string());
+             std::string content((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+             in_file.close();
+
+             // move the format version behind the netlist node
+             const std::string version_key = "\"serialization_format_version\"";
+             std::size_t version_begin     = content.find(version_key);
+             std::size_t version_end       = content.find(',', version_begin);
+             ASSERT_NE(version_begin, std::string::npos);
+             ASSERT_NE(version_end, std::string::npos);
+             std::string version_member = content.substr(version_begin, version_end - version_begin);
+             content.erase(version_begin, version_end + 1 - version_begin);
+             content.insert(content.rfind('}'), "," + version_member);
+
+             std::unique_ptr<Netlist> des_nl = netlist_serializer::deserialize_from_string(content);
+             ASSERT_NE(des_nl, nullptr);
+             EXPECT_TRUE(*nl == *des_nl);
+
+             std::ofstream out_file(test_hal_file_path.string());
+             out_file << content;
+             out_file.close();
+             des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+             ASSERT_NE(des_nl, nullptr);
+             EXPECT_TRUE(*nl == *des_nl);
+         TEST_END
+     }
+
+     /**
+      * Testing that the streaming serializer writes exactly the same file as the document-based serializer it replaced.
+      * The golden file has been written by the document-based serializer, with the path of the gate library replaced by a placeholder.
+      *
+      * Functions: serialize_to_file
+      */
+     TEST_F(NetlistSerializerTest, check_serialize_to_file_golden) {
+         TEST_START
+             // every gate has at most one custom function, since the functions are written in the order of an unordered map
+             auto nl = std::make_unique<Netlist>(m_gl);
+             nl->set_id(7);
+             nl->set_input_filename("golden_input_filename");
+             nl->set_device_name("golden_device_name");
+             nl->set_design_name("golden_design_name");
+             nl->get_top_module()->set_type("top_mod_type");
+
+             Gate* gnd_gate = nl->create_gate(1, m_gl->get_gate_type_by_name("GND"), "gnd_gate");
+             Gate* vcc_gate = nl->create_gate(2, m_gl->get_gate_type_by_name("VCC"), "vcc_gate");
+             Gate* and_gate = nl->create_gate(3, m_gl->get_gate_type_by_name("AND2"), "and_gate", 12, 4);
+             Gate* buf_gate = nl->create_gate(4, m_gl->get_gate_type_by_name("BUF"), "buf_gate");
+             Gate* inv_gate = nl->create_gate(5, m_gl->get_gate_type_by_name("INV"), "inv_gate", 0, 31);
+             Gate* xor_gate = nl->create_gate(6, m_gl->get_gate_type_by_name("XOR2"), "xor_gate");
+             gnd_gate->mark_gnd_gate();
+             vcc_gate->mark_vcc_gate();
+
+             Net* in_net = nl->create_net(10, "in_net");
+             in_net->add_destination(buf_gate, "I");
+             in_net->add_destination(xor_gate, "I0");
+             in_net->mark_global_input_net();
+
+             Net* gnd_net = nl->create_net(11, "gnd_net");
+             gnd_net->add_source(gnd_gate, "O");
+             gnd_net->add_destination(xor_gate, "I1");
+
+             Net* vcc_net = nl->create_net(12, "vcc_net");
+             vcc_net->add_source(vcc_gate, "O");
+             vcc_net->add_destination(and_gate, "I1");
+
+             Net* buf_net = nl->create_net(13, "buf_net");
+             buf_net->add_source(buf_gate, "O");
+             buf_net->add_destination(and_gate, "I0");
+
+             Net* and_net = nl->create_net(14, "and_net");
+             and_net->add_source(and_gate, "O");
+             and_net->add_destination(inv_gate, "I");
+
+             Net* out_net = nl->create_net(15, "out_net");
+             out_net->add_source(inv_gate, "O");
+             out_net->mark_global_output_net();
+
+             Net* xor_net = nl->create_net(16, "xor_net");
+             xor_net->add_source(xor_gate, "O");
+             xor_net->mark_global_output_net();
+
+             Module* mod_0 = nl->create_module(2, "mod_0", nl->get_top_module(), {buf_gate, and_gate});
+             mod_0->set_type("mod_type_0");
+             Module* mod_1 = nl->create_module(3, "mod_1", mod_0, {inv_gate});
+             mod_1->set_type("mod_type_1");
+
+             ModulePin* pin_in  = mod_0->get_pin_by_net(in_net);
+             ModulePin* pin_vcc = mod_0->get_pin_by_net(vcc_net);
+             ASSERT_NE(pin_in, nullptr);
+             ASSERT_NE(pin_vcc, nullptr);
+             ASSERT_TRUE(mod_0->set_pin_name(pin_in, "mod_0_in"));
+             ASSERT_TRUE(mod_0->set_pin_name(pin_vcc, "mod_0_vcc"));
+             ASSERT_TRUE(mod_0->create_pin_group("mod_0_inputs", {pin_in, pin_vcc}, PinDirection::input, PinType::none, false, 3).is_ok());
+
+             and_gate->set_data("category_0", "key_0", "string", "value with \"quotes\"");
+             and_gate->set_data("category_0", "key_1", "int", "42");
+             and_gate->add_boolean_function("O_custom", BooleanFunction::from_string("I0 & !I1").get());
+             inv_gate->add_boolean_function("O_custom", BooleanFunction::from_string("!I").get());
+             in_net->set_data("category_1", "key_2", "string", "net_value");
+             mod_1->set_data("category_2", "key_3", "string", "module_value");
+
+             std::filesystem::path test_hal_file_path = test_utils::create_sandbox_path("test_hal_file.hal");
+             ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_hal_file_path));
+
+             std::ifstream in_file(test_hal_file_path.string());
+             std::string content((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+             in_file.close();
+
+             std::ifstream golden_file(utils::get_base_directory().string() + "/bin/test-files/netlist/serializer_golden.hal");
+             ASSERT_TRUE(golden_file.is_open());
+             std::string golden((std::istreambuf_iterator<char>(golden_file)), std::istreambuf_iterator<char>());
+             golden_file.close();
+
+             const std::string placeholder = "GATE_LIBRARY_PATH";
+             std::size_t placeholder_pos   = golden.find(placeholder);
+             ASSERT_NE(placeholder_pos, std::string::npos);
+             golden.replace(placeholder_pos, placeholder.size(), m_gl->get_path().string());
+
+             EXPECT_EQ(content, golden);
+         TEST_END
+     }
+
+     /**
+      * Testing the serialization and a followed deserialization of the example netlist using the binary format.
+      *
+      * Functions: serialize_to_binary_file, deserialize_from_binary_file
+      */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize) {
+         TEST_START
+             {
+                 // Serialize and deserialize the example netlist and compare the result with the original netlist
+                 auto nl = create_example_serializer_netlist();
+                 nl->get_gate_by_id(5)->set_location({3, 7});
+                 nl->get_module_by_id(2)->get_pin_groups().front()->set_ordered(true);
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_binary_file(nl.get(), test_halb_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_binary_file(test_halb_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+                 EXPECT_EQ(des_nl->get_id(), 123);
+                 EXPECT_EQ(des_nl->get_gate_by_id(5)->get_location_x(), 3);
+                 EXPECT_EQ(des_nl->get_gate_by_id(5)->get_location_y(), 7);
+                 EXPECT_EQ(des_nl->get_gate_by_id(1)->get_boolean_functions(true), nl->get_gate_by_id(1)->get_boolean_functions(true));
+                 EXPECT_TRUE(des_nl->get_module_by_id(2)->get_pin_groups().front()->is_ordered());
+             }
+             {
+                 // The file extension selects the binary format
+                 auto nl = create_example_serializer_netlist();
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), test_halb_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_binary_file(test_halb_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+
+                 des_nl = netlist_factory::load_netlist(test_halb_file_path, test_utils::create_sandbox_path("testing_gate_library.hgl"));
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+             {
+                 // Serialize and deserialize an empty netlist and compare the result with the original netlist
+                 auto nl = std::make_unique<Netlist>(m_gl);
+
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_binary_file(nl.get(), test_halb_file_path));
+                 auto des_nl = netlist_serializer::deserialize_from_binary_file(test_halb_file_path);
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+             }
+         TEST_END
+     }
+
+     /**
+      * Testing the deserialization of invalid binary files.
+      *
+      * Functions: serialize_to_binary_file, deserialize_from_binary_file
+      */
+     TEST_F(NetlistSerializerTest, check_binary_serialize_and_deserialize_negative) {
+         TEST_START
+             {
+                 // Serialize a netlist which is a nullptr
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 EXPECT_FALSE(netlist_serializer::serialize_to_binary_file(nullptr, test_halb_file_path));
+             }
+             {
+                 // Deserialize a netlist from a non existing path
+                 NO_COUT_TEST_BLOCK;
+                 EXPECT_EQ(netlist_serializer::deserialize_from_binary_file(std::filesystem::path("/using/this/file/is/let.halb")), nullptr);
+             }
+             {
+                 // Deserialize a file that is not a binary netlist
+                 NO_COUT_TEST_BLOCK;
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 std::ofstream myfile(test_halb_file_path.string());
+                 myfile << "I h4ve no binary f0rmat!!!";
+                 myfile.close();
+                 EXPECT_EQ(netlist_serializer::deserialize_from_binary_file(test_halb_file_path), nullptr);
+             }
+             {
+                 // Deserialize truncated files
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_binary_file(nl.get(), test_halb_file_path));
+                 const auto file_size = std::filesystem::file_size(test_halb_file_path);
+                 for (auto size : {file_size - 1, file_size / 2, (decltype(file_size))12})
+                 {
+                     std::filesystem::resize_file(test_halb_file_path, size);
+                     EXPECT_EQ(netlist_serializer::deserialize_from_binary_file(test_halb_file_path), nullptr);
+                 }
+             }
+             {
+                 // Deserialize a file whose last module runs into the string table
+                 NO_COUT_TEST_BLOCK;
+                 auto nl = create_example_serializer_netlist();
+                 std::filesystem::path test_halb_file_path = test_utils::create_sandbox_path("test_hal_file.halb");
+                 ASSERT_TRUE(netlist_serializer::serialize_to_binary_file(nl.get(), test_halb_file_path));
+
+                 std::ifstream in_file(test_halb_file_path.string(), std::ios::binary);
+                 std::string data((std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>());
+                 in_file.close();
+
+                 // drop the last byte of the body and move the string table offset in the header accordingly
+                 u64 string_table_offset = 0;
+                 for (u32 i = 0; i < 8; i++)
+                 {
+                     string_table_offset |= (u64)(u8)data.at(12 + i) << (8 * i);
+                 }
+                 data.erase(string_table_offset - 1, 1);
+                 string_table_offset--;
+                 for (u32 i = 0; i < 8; i++)
+                 {
+                     data.at(12 + i) = (char)(string_table_offset >> (8 * i));
+                 }
+
+                 std::ofstream out_file(test_halb_file_path.string(), std::ios::binary | std::ios::trunc);
+                 out_file << data;
+                 out_file.close();
+                 EXPECT_EQ(netlist_serializer::deserialize_from_binary_file(test_halb_file_path), nullptr);
+             }
+         TEST_END
+     }
+
+     /**
+      * Benchmark comparing the JSON and the binary format when saving and loading a larger netlist, run with --gtest_also_run_disabled_tests.
+      *
+      * Functions: serialize_to_file, deserialize_from_file, serialize_to_binary_file, deserialize_from_binary_file
+      */
+     TEST_F(NetlistSerializerTest, DISABLED_benchmark_binary_serialization) {
+         TEST_START
+             const u32 num_gates = 100000;
+
+             auto nl = std::make_unique<Netlist>(m_gl);
+             GateType* and_type = m_gl->get_gate_type_by_name("AND2");
+             Module* sub_module = nl->create_module("sub_module", nl->get_top_module());
+             Net* prev_net      = nl->create_net("in");
+             prev_net->mark_global_input_net();
+             std::vector<Gate*> sub_module_gates;
+             for (u32 i = 0; i < num_gates; i++)
+             {
+                 Gate* gate = nl->create_gate(and_type, "and_" + std::to_string(i));
+                 prev_net->add_destination(gate, "I0");
+                 prev_net->add_destination(gate, "I1");
+                 prev_net = nl->create_net("net_" + std::to_string(i));
+                 prev_net->add_source(gate, "O");
+                 if (i < num_gates / 2)
+                 {
+                     sub_module_gates.push_back(gate);
+                 }
+             }
+             prev_net->mark_global_output_net();
+             sub_module->assign_gates(sub_module_gates);
+
+             for (const std::string format : {"hal", "halb"})
+             {
+                 std::filesystem::path file_path = test_utils::create_sandbox_path("benchmark." + format);
+
+                 auto begin_time = std::chrono::steady_clock::now();
+                 ASSERT_TRUE(netlist_serializer::serialize_to_file(nl.get(), file_path));
+                 const auto save_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_time).count();
+
+                 begin_time         = std::chrono::steady_clock::now();
+                 auto des_nl        = netlist_serializer::deserialize_from_file(file_path);
+                 const auto load_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin_time).count();
+
+                 ASSERT_NE(des_nl, nullptr);
+                 EXPECT_TRUE(*nl == *des_nl);
+                 RecordProperty(format + "_bytes", std::to_string(std::filesystem::file_size(file_path)));
+                 RecordProperty(format + "_save_ms", std::to_string(save_ms));
+                 RecordProperty(format + "_load_ms", std::to_string(load_ms));
+             }
+         TEST_END
+     }
 }    //namespace hal